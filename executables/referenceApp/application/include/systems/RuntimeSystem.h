@@ -16,8 +16,15 @@ class RuntimeSystem
 , private ::async::IRunnable
 {
 public:
+#ifdef PLATFORM_SUPPORT_RUNNABLE_STATISTICS
+    explicit RuntimeSystem(
+        ::async::ContextType context,
+        ::async::AsyncBinding::RuntimeMonitorType& runtimeMonitor,
+        ::async::AsyncBinding::RunnableRuntimeMonitorType& runnableRuntimeMonitor);
+#else
     explicit RuntimeSystem(
         ::async::ContextType context, ::async::AsyncBinding::RuntimeMonitorType& runtimeMonitor);
+#endif
     RuntimeSystem(RuntimeSystem const&)            = delete;
     RuntimeSystem& operator=(RuntimeSystem const&) = delete;
 
@@ -4,6 +4,7 @@
 
 #include <async/Async.h>
 #include <bsp/eeprom/IEepromDriver.h>
+#include <bsp/flash/IFlashDriver.h>
 #include <console/AsyncCommandWrapper.h>
 #include <lifecycle/AsyncLifecycleComponent.h>
 #include <storage/EepStorage.h>
@@ -13,6 +14,8 @@
 #include <storage/StorageJob.h>
 #include <storage/StorageTester.h>
 
+#include <etl/span.h>
+
 namespace systems
 {
 
@@ -37,11 +40,13 @@ static constexpr ::storage::MappingConfig MAPPING_CONFIG[] = {
         2,
         EEP_STORAGE_ID
     },
+#ifdef PLATFORM_SUPPORT_FLASH
     {
         0xb02,
         0,
         FEE_STORAGE_ID
     },
+#endif
 };
 
 static constexpr ::storage::EepBlockConfig EEP_BLOCK_CONFIG[] = {
@@ -61,6 +66,14 @@ static constexpr ::storage::EepBlockConfig EEP_BLOCK_CONFIG[] = {
         false
     },
 };
+
+#ifdef PLATFORM_SUPPORT_FLASH
+static constexpr ::storage::FeeBlockConfig FEE_BLOCK_CONFIG[] = {
+    {
+        8     /* size in bytes (uint16_t) */
+    },
+};
+#endif
 // END config
 // clang-format on
 
@@ -70,7 +83,15 @@ public:
     explicit StorageSystem(
         ::async::ContextType driverContext,
         ::async::ContextType userContext,
-        ::eeprom::IEepromDriver& eepDriver);
+        ::eeprom::IEepromDriver& eepDriver
+#ifdef PLATFORM_SUPPORT_FLASH
+        ,
+        ::flash::IFlashDriver& flashDriver,
+        ::etl::span<uint8_t const> feeMemory,
+        uint32_t feeFlashAddress,
+        uint32_t feeSectorSize
+#endif
+    );
     StorageSystem(StorageSystem const&)            = delete;
     StorageSystem& operator=(StorageSystem const&) = delete;
 
@@ -87,20 +108,30 @@ private:
     static constexpr size_t EEP_CONFIG_SIZE
         = sizeof(EEP_BLOCK_CONFIG) / sizeof(::storage::EepBlockConfig);
 
-    static constexpr size_t MAX_DATA_SIZE = 8; // largest size defined in EEP_BLOCK_CONFIG
+    // largest size defined in EEP_BLOCK_CONFIG and FEE_BLOCK_CONFIG
+    static constexpr size_t MAX_DATA_SIZE = 8;
 
     ::storage::declare::EepStorage<EEP_CONFIG_SIZE, MAX_DATA_SIZE> _eepStorage;
-    ::storage::FeeStorage _feeStorage;
-
     ::storage::QueuingStorage _eepQueuingStorage;
+
+#ifdef PLATFORM_SUPPORT_FLASH
+    static constexpr size_t FEE_CONFIG_SIZE
+        = sizeof(FEE_BLOCK_CONFIG) / sizeof(::storage::FeeBlockConfig);
+
+    ::storage::declare::FeeStorage<FEE_CONFIG_SIZE, MAX_DATA_SIZE> _feeStorage;
     ::storage::QueuingStorage _feeQueuingStorage;
 
+    static constexpr size_t NUM_STORAGES = 2;
+#else
+    static constexpr size_t NUM_STORAGES = 1;
+#endif
+
     static constexpr size_t MAPPING_CONFIG_SIZE
         = sizeof(MAPPING_CONFIG) / sizeof(::storage::MappingConfig);
 
     ::storage::declare::MappingStorage<
         MAPPING_CONFIG_SIZE,
-        2 /* number of delegate storages */,
+        NUM_STORAGES /* number of delegate storages */,
         2 /* max simultaneous jobs */>
         _mappingStorage;
 
@@ -6,6 +6,7 @@
 #include <async/IRunnable.h>
 #include <console/AsyncCommandWrapper.h>
 #include <lifecycle/AsyncLifecycleComponent.h>
+#include <lifecycle/LifecycleManager.h>
 #include <lifecycle/console/LifecycleControlCommand.h>
 
 namespace systems
@@ -17,7 +18,7 @@ class SysAdminSystem
 {
 public:
     explicit SysAdminSystem(
-        ::async::ContextType context, ::lifecycle::ILifecycleManager& lifecycleManager);
+        ::async::ContextType context, ::lifecycle::LifecycleManager& lifecycleManager);
     SysAdminSystem(SysAdminSystem const&)            = delete;
     SysAdminSystem& operator=(SysAdminSystem const&) = delete;
 
@@ -15,6 +15,14 @@
 #include <uds/jobs/ReadIdentifierFromMemory.h>
 #include <uds/jobs/WriteIdentifierToMemory.h>
 #include <uds/services/communicationcontrol/CommunicationControl.h>
+#ifdef PLATFORM_SUPPORT_FLASH
+#include <bsp/flash/IFlashDriver.h>
+#include <transport/TransportConfiguration.h>
+#include <uds/services/download/FlashDownload.h>
+#include <uds/services/download/RequestDownload.h>
+#include <uds/services/download/RequestTransferExit.h>
+#include <uds/services/download/TransferData.h>
+#endif
 #include <uds/services/readdata/ReadDataByIdentifier.h>
 #include <uds/services/routinecontrol/RequestRoutineResults.h>
 #include <uds/services/routinecontrol/RoutineControl.h>
@@ -46,7 +54,15 @@ public:
         lifecycle::LifecycleManager& lManager,
         transport::ITransportSystem& transportSystem,
         ::async::ContextType context,
-        uint16_t udsAddress);
+        uint16_t udsAddress
+#ifdef PLATFORM_SUPPORT_FLASH
+        ,
+        ::flash::IFlashDriver& flashDriver,
+        ::async::ContextType flashContext,
+        uint32_t downloadMemoryStart,
+        uint32_t downloadMemorySize
+#endif
+    );
 
     void init() override;
     void run() override;
@@ -65,6 +81,12 @@ public:
     ReadDataByIdentifier& getReadDataByIdentifier();
 
 private:
+#ifdef PLATFORM_SUPPORT_FLASH
+    // TransferData requests use the whole diagnostic payload
+    static uint16_t const DOWNLOAD_BLOCK_SIZE
+        = transport::TransportConfiguration::DIAG_PAYLOAD_SIZE - 2U;
+#endif
+
     void addDiagJobs();
     void removeDiagJobs();
     void shutdownComplete(transport::AbstractTransportLayer&);
@@ -94,6 +116,12 @@ private:
     ReadIdentifierPot _read22Cf02;
     WriteIdentifierToMemory _write2eCf03;
     TesterPresent _testerPresent;
+#ifdef PLATFORM_SUPPORT_FLASH
+    declare::FlashDownload<DOWNLOAD_BLOCK_SIZE> _flashDownload;
+    RequestDownload _requestDownload;
+    TransferData _transferData;
+    RequestTransferExit _requestTransferExit;
+#endif
 
     ::async::ContextType _context;
     ::async::TimeoutType _timeout;
@@ -96,23 +96,38 @@ using bsp::Uart;
 using ::util::logger::LIFECYCLE;
 using ::util::logger::Logger;
 
-using AsyncAdapter        = ::async::AsyncBinding::AdapterType;
-using AsyncRuntimeMonitor = ::async::AsyncBinding::RuntimeMonitorType;
-using AsyncContextHook    = ::async::AsyncBinding::ContextHookType;
+using AsyncAdapter                = ::async::AsyncBinding::AdapterType;
+using AsyncRuntimeMonitor         = ::async::AsyncBinding::RuntimeMonitorType;
+using AsyncContextHook            = ::async::AsyncBinding::ContextHookType;
+#ifdef PLATFORM_SUPPORT_RUNNABLE_STATISTICS
+using AsyncRunnableRuntimeMonitor = ::async::AsyncBinding::RunnableRuntimeMonitorType;
+using AsyncRunnableHook           = ::async::AsyncBinding::RunnableHookType;
+#endif
 
 constexpr size_t MaxNumComponents         = 16;
 constexpr size_t MaxNumLevels             = 9;
 constexpr size_t MaxNumComponentsPerLevel = MaxNumComponents;
 
+#ifdef PLATFORM_SUPPORT_FLASH
+// the last sectors of the flash memory hold the flash EEPROM emulation, the rest takes downloads
+constexpr uint32_t FeeSectorSize   = ::flash::FlashDriver::SECTOR_SIZE;
+constexpr uint32_t FeeFlashSize    = 4U * FeeSectorSize;
+constexpr uint32_t FeeFlashAddress = ::flash::FlashDriver::FLASH_SIZE - FeeFlashSize;
+#endif
+
 using LifecycleManager = ::lifecycle::declare::
     LifecycleManager<MaxNumComponents, MaxNumLevels, MaxNumComponentsPerLevel>;
 
 char const* const isrGroupNames[ISR_GROUP_COUNT] = {"test"};
 
 AsyncRuntimeMonitor runtimeMonitor{
-    AsyncContextHook::InstanceType::GetNameType::create<&AsyncAdapter::getTaskName>(),
+    AsyncRuntimeMonitor::GetNameType::create<&AsyncAdapter::getTaskName>(),
     isrGroupNames};
 
+#ifdef PLATFORM_SUPPORT_RUNNABLE_STATISTICS
+AsyncRunnableRuntimeMonitor runnableRuntimeMonitor;
+#endif
+
 LifecycleManager lifecycleManager{
     TASK_SYSADMIN,
     ::lifecycle::LifecycleManager::GetTimestampType::create<&getSystemTimeUs32Bit>()};
@@ -238,8 +253,15 @@ void startApp()
     /* runlevel 1 */
     ::platform::platformLifecycleAdd(lifecycleManager, 1U);
 
+#ifdef PLATFORM_SUPPORT_RUNNABLE_STATISTICS
+    lifecycleManager.addComponent(
+        "runtime",
+        runtimeSystem.create(TASK_BACKGROUND, runtimeMonitor, runnableRuntimeMonitor),
+        1U);
+#else
     lifecycleManager.addComponent(
         "runtime", runtimeSystem.create(TASK_BACKGROUND, runtimeMonitor), 1U);
+#endif
     lifecycleManager.addComponent("safety", safetySystem.create(TASK_SAFETY, lifecycleManager), 1U);
 
     /* runlevel 2 */
@@ -265,10 +287,22 @@ void startApp()
 #endif
 
 #ifdef PLATFORM_SUPPORT_STORAGE
+    // clang-format off
     lifecycleManager.addComponent(
         "storage",
-        storageSystem.create(TASK_BSP, TASK_DEMO, ::platform::getStaticBsp().getEepromDriver()),
+        storageSystem.create(
+            TASK_BSP,
+            TASK_DEMO,
+            ::platform::getStaticBsp().getEepromDriver()
+#ifdef PLATFORM_SUPPORT_FLASH
+            , ::platform::getStaticBsp().getFlashDriver()
+            , ::platform::getStaticBsp().getFlashMemory().last(FeeFlashSize)
+            , FeeFlashAddress
+            , FeeSectorSize
+#endif
+        ),
         5U);
+    // clang-format on
 #endif
 
     /* runlevel 6 */
@@ -288,8 +322,23 @@ void startApp()
 
     /* runlevel 7 */
 #if defined(PLATFORM_SUPPORT_TRANSPORT) && defined(PLATFORM_SUPPORT_UDS)
+    // clang-format off
     lifecycleManager.addComponent(
-        "uds", udsSystem.create(lifecycleManager, *transportSystem, TASK_UDS, LOGICAL_ADDRESS), 7U);
+        "uds",
+        udsSystem.create(
+            lifecycleManager,
+            *transportSystem,
+            TASK_UDS,
+            LOGICAL_ADDRESS
+#ifdef PLATFORM_SUPPORT_FLASH
+            , ::platform::getStaticBsp().getFlashDriver()
+            , TASK_BSP
+            , 0U
+            , FeeFlashAddress
+#endif
+        ),
+        7U);
+    // clang-format on
 #endif
 
     /* runlevel 8 */
@@ -350,6 +399,12 @@ BackgroundTask backgroundTask{"background"};
 using SafetyTask = AsyncAdapter::TaskStack<TASK_SAFETY>;
 SafetyTask safetyTask{"safety", safetyStack};
 
+#ifdef PLATFORM_SUPPORT_RUNNABLE_STATISTICS
+AsyncContextHook::InstanceType runtimeContextHook{runtimeMonitor, runnableRuntimeMonitor};
+AsyncContextHook contextHook{runtimeContextHook};
+AsyncRunnableHook runnableHook{runnableRuntimeMonitor};
+#else
 AsyncContextHook contextHook{runtimeMonitor};
+#endif
 
 } // namespace app
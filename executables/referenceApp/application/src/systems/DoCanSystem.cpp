@@ -24,6 +24,8 @@ uint8_t const ALLOCATE_RETRY_COUNT    = 15U;
 uint8_t const FLOW_CONTROL_WAIT_COUNT = 15U;
 uint16_t const MIN_SEPARATION_TIME    = 200U;
 uint8_t const BLOCK_SIZE              = 15U;
+// consecutive frames written to the CAN transceiver at once, fits the CanFlex2Transceiver queue
+uint8_t const MAX_SEND_FRAME_COUNT    = 3U;
 
 uint32_t systemUs() { return getSystemTimeUs32Bit(); }
 
@@ -78,7 +80,8 @@ void DoCanSystem::initLayer()
             ::etl::ref(transceiver),
             ::etl::ref(_classicAddressingFilter),
             ::etl::ref(_classicAddressingFilter),
-            ::etl::ref(_addressing));
+            ::etl::ref(_addressing),
+            MAX_SEND_FRAME_COUNT);
 
     _transportLayers.emplace_back(
         ::busid::CAN_0,
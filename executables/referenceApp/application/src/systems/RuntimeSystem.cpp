@@ -10,6 +10,20 @@ constexpr uint32_t SYSTEM_CYCLE_TIME = 1000;
 namespace systems
 {
 
+#ifdef PLATFORM_SUPPORT_RUNNABLE_STATISTICS
+RuntimeSystem::RuntimeSystem(
+    ::async::ContextType const context,
+    ::async::AsyncBinding::RuntimeMonitorType& runtimeMonitor,
+    ::async::AsyncBinding::RunnableRuntimeMonitorType& runnableRuntimeMonitor)
+: _context(context)
+, _timeout()
+, _statisticsCommand(runtimeMonitor, runnableRuntimeMonitor)
+, _asyncCommandWrapperForStatisticsCommand(_statisticsCommand, context)
+{
+    setTransitionContext(context);
+    (void)runnableRuntimeMonitor.registerRunnable(*this, "runtime");
+}
+#else
 RuntimeSystem::RuntimeSystem(
     ::async::ContextType const context, ::async::AsyncBinding::RuntimeMonitorType& runtimeMonitor)
 : _context(context)
@@ -19,6 +33,7 @@ RuntimeSystem::RuntimeSystem(
 {
     setTransitionContext(context);
 }
+#endif
 
 void RuntimeSystem::init()
 {
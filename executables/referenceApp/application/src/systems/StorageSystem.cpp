@@ -9,20 +9,40 @@ namespace systems
 StorageSystem::StorageSystem(
     ::async::ContextType const driverContext,
     ::async::ContextType const userContext,
-    ::eeprom::IEepromDriver& eepDriver)
+    ::eeprom::IEepromDriver& eepDriver
+#ifdef PLATFORM_SUPPORT_FLASH
+    ,
+    ::flash::IFlashDriver& flashDriver,
+    ::etl::span<uint8_t const> const feeMemory,
+    uint32_t const feeFlashAddress,
+    uint32_t const feeSectorSize
+#endif
+    )
 : _eepDriver(eepDriver)
 , _eepStorage(EEP_BLOCK_CONFIG, _eepDriver)
-, _feeStorage()
 , _eepQueuingStorage(_eepStorage, driverContext)
+#ifdef PLATFORM_SUPPORT_FLASH
+, _feeStorage(
+      FEE_BLOCK_CONFIG, flashDriver, feeMemory, feeFlashAddress, feeSectorSize, driverContext)
 , _feeQueuingStorage(_feeStorage, driverContext)
 , _mappingStorage(MAPPING_CONFIG, driverContext, _eepQueuingStorage, _feeQueuingStorage)
+#else
+, _mappingStorage(MAPPING_CONFIG, driverContext, _eepQueuingStorage)
+#endif
 , _storageTester(_mappingStorage, driverContext)
 , _asyncStorageTester(_storageTester, userContext)
 {
     setTransitionContext(driverContext);
 }
 
-void StorageSystem::init() { transitionDone(); }
+void StorageSystem::init()
+{
+#ifdef PLATFORM_SUPPORT_FLASH
+    // rebuild the index of the flash EEPROM emulation, its jobs fail if this isn't possible
+    (void)_feeStorage.init();
+#endif
+    transitionDone();
+}
 
 void StorageSystem::run() { transitionDone(); }
 
@@ -11,7 +11,7 @@ namespace systems
 {
 
 SysAdminSystem::SysAdminSystem(
-    ::async::ContextType const context, ::lifecycle::ILifecycleManager& lifecycleManager)
+    ::async::ContextType const context, ::lifecycle::LifecycleManager& lifecycleManager)
 : _context(context)
 , _timeout()
 , _lifecycleControlCommand(lifecycleManager)
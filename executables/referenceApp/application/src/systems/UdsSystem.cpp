@@ -20,7 +20,15 @@ UdsSystem::UdsSystem(
     lifecycle::LifecycleManager& lManager,
     transport::ITransportSystem& transportSystem,
     ::async::ContextType context,
-    uint16_t udsAddress)
+    uint16_t udsAddress
+#ifdef PLATFORM_SUPPORT_FLASH
+    ,
+    ::flash::IFlashDriver& flashDriver,
+    ::async::ContextType flashContext,
+    uint32_t downloadMemoryStart,
+    uint32_t downloadMemorySize
+#endif
+    )
 : AsyncLifecycleComponent()
 , ::etl::singleton_base<UdsSystem>(*this)
 , _udsLifecycleConnector(lManager)
@@ -50,6 +58,12 @@ UdsSystem::UdsSystem(
 , _read22Cf02()
 , _write2eCf03(0xCF03, storedData2eCf03)
 , _testerPresent()
+#ifdef PLATFORM_SUPPORT_FLASH
+, _flashDownload(flashDriver, context, flashContext, downloadMemoryStart, downloadMemorySize)
+, _requestDownload(_flashDownload)
+, _transferData(_flashDownload)
+, _requestTransferExit(_flashDownload)
+#endif
 , _context(context)
 , _timeout()
 {
@@ -121,6 +135,14 @@ void UdsSystem::addDiagJobs()
     (void)_jobRoot.addAbstractDiagJob(_stopRoutine);
     (void)_jobRoot.addAbstractDiagJob(_requestRoutineResults);
 
+#ifdef PLATFORM_SUPPORT_FLASH
+    // 34, 36, 37 - Download
+    (void)_jobRoot.addAbstractDiagJob(_requestDownload);
+    (void)_jobRoot.addAbstractDiagJob(_transferData);
+    (void)_jobRoot.addAbstractDiagJob(_requestTransferExit);
+    _diagnosticSessionControl.addDiagSessionListener(_flashDownload);
+#endif
+
     // Services
     (void)_jobRoot.addAbstractDiagJob(_testerPresent);
     (void)_jobRoot.addAbstractDiagJob(_diagnosticSessionControl);
@@ -144,6 +166,15 @@ void UdsSystem::removeDiagJobs()
     _jobRoot.removeAbstractDiagJob(_stopRoutine);
     _jobRoot.removeAbstractDiagJob(_requestRoutineResults);
 
+#ifdef PLATFORM_SUPPORT_FLASH
+    // 34, 36, 37 - Download
+    _jobRoot.removeAbstractDiagJob(_requestDownload);
+    _jobRoot.removeAbstractDiagJob(_transferData);
+    _jobRoot.removeAbstractDiagJob(_requestTransferExit);
+    _diagnosticSessionControl.removeDiagSessionListener(_flashDownload);
+    _flashDownload.abort();
+#endif
+
     // Services
     _jobRoot.removeAbstractDiagJob(_testerPresent);
     _jobRoot.removeAbstractDiagJob(_diagnosticSessionControl);
@@ -4,6 +4,15 @@
 
 #include <async/Config.h>
 #include <async/StaticContextHook.h>
+#ifdef PLATFORM_SUPPORT_RUNNABLE_STATISTICS
+#include <async/StaticRunnableHook.h>
+#endif
+#ifdef PLATFORM_SUPPORT_RUNTIME_HISTOGRAM
+#include <runtime/HistogramRuntimeStatistics.h>
+#endif
+#ifdef PLATFORM_SUPPORT_RUNNABLE_STATISTICS
+#include <runtime/RunnableRuntimeMonitor.h>
+#endif
 #include <runtime/RuntimeMonitor.h>
 #include <runtime/RuntimeStatistics.h>
 
@@ -13,27 +22,97 @@
 #include <async/FreeRtosAdapter.h>
 #elif defined(SUPPORT_THREADX)
 #include <async/ThreadXAdapter.h>
+#elif defined(SUPPORT_PTHREAD)
+#include <async/PthreadAdapter.h>
 #endif
 
 namespace async
 {
+/**
+ * Forwards the context switches to the runtime monitor of the tasks and to the runnable runtime
+ * monitor, so that the latter doesn't account the time a runnable is switched out.
+ */
+template<class RuntimeMonitor, class RunnableRuntimeMonitor>
+class RuntimeContextHook
+{
+public:
+    RuntimeContextHook(
+        RuntimeMonitor& runtimeMonitor, RunnableRuntimeMonitor& runnableRuntimeMonitor)
+    : _runtimeMonitor(runtimeMonitor), _runnableRuntimeMonitor(runnableRuntimeMonitor)
+    {}
+
+    void enterTask(size_t const taskIdx)
+    {
+        _runtimeMonitor.enterTask(taskIdx);
+        _runnableRuntimeMonitor.enterTask(taskIdx);
+    }
+
+    void leaveTask(size_t const taskIdx)
+    {
+        _runnableRuntimeMonitor.leaveTask(taskIdx);
+        _runtimeMonitor.leaveTask(taskIdx);
+    }
+
+    void enterIsrGroup(size_t const isrGroupIdx)
+    {
+        _runtimeMonitor.enterIsrGroup(isrGroupIdx);
+        _runnableRuntimeMonitor.enterIsrGroup(isrGroupIdx);
+    }
+
+    void leaveIsrGroup(size_t const isrGroupIdx)
+    {
+        _runnableRuntimeMonitor.leaveIsrGroup(isrGroupIdx);
+        _runtimeMonitor.leaveIsrGroup(isrGroupIdx);
+    }
+
+private:
+    RuntimeMonitor& _runtimeMonitor;
+    RunnableRuntimeMonitor& _runnableRuntimeMonitor;
+};
+
 struct AsyncBinding : public Config
 {
     static size_t const WAIT_EVENTS_TICK_COUNT = 100U;
 
+#ifdef PLATFORM_SUPPORT_RUNNABLE_STATISTICS
+    static size_t const RUNNABLE_STATISTICS_COUNT = 32U;
+
+    // the runnable hook must be declared before the adapter type is instantiated, without it the
+    // task contexts use NoRunnableHook
+    using RunnableRuntimeMonitorType
+        = ::runtime::declare::RunnableRuntimeMonitor<RUNNABLE_STATISTICS_COUNT, TASK_COUNT + 1U>;
+    using RunnableHookType = StaticRunnableHook<RunnableRuntimeMonitorType>;
+#endif
+
 #if defined(SUPPORT_FREERTOS)
     using AdapterType = FreeRtosAdapter<AsyncBinding>;
 #elif defined(SUPPORT_THREADX)
     using AdapterType = ThreadXAdapter<AsyncBinding>;
+#elif defined(SUPPORT_PTHREAD)
+    using AdapterType = PthreadAdapter<AsyncBinding>;
+#endif
+
+#ifdef PLATFORM_SUPPORT_RUNTIME_HISTOGRAM
+    // a histogram costs about 1 KB per task and ISR group, so it is enabled per platform
+    using ContextStatisticsType = ::runtime::HistogramRuntimeStatistics<>;
+#else
+    using ContextStatisticsType = ::runtime::RuntimeStatistics;
 #endif
 
     using RuntimeMonitorType = ::runtime::declare::RuntimeMonitor<
-        ::runtime::RuntimeStatistics,
+        ContextStatisticsType,
         ::runtime::RuntimeStatistics,
         AdapterType::OS_TASK_COUNT,
         ISR_GROUP_COUNT>;
 
+#ifdef PLATFORM_SUPPORT_RUNNABLE_STATISTICS
+    // accounting runnables costs a lock and a lookup per runnable and context switch, so it is
+    // enabled per platform
+    using ContextHookType
+        = StaticContextHook<RuntimeContextHook<RuntimeMonitorType, RunnableRuntimeMonitorType>>;
+#else
     using ContextHookType = StaticContextHook<RuntimeMonitorType>;
+#endif
 };
 
 using AsyncBindingType = AsyncBinding;
@@ -6,6 +6,7 @@
 
 namespace can
 {
+class CANLatencyHistogram;
 class ICanTransceiver;
 
 /**
@@ -22,5 +23,11 @@ public:
      * there is no transceiver for the provided \p busId.
      */
     virtual ICanTransceiver* getCanTransceiver(uint8_t busId) = 0;
+
+    /**
+     * Returns a pointer to the ::can::CANLatencyHistogram recording the receive latency of the
+     * transceiver for a given \p busId or nullptr if the latency is not recorded.
+     */
+    virtual CANLatencyHistogram* getLatencyHistogram(uint8_t busId) = 0;
 };
 } // namespace can
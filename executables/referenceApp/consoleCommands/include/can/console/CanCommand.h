@@ -19,7 +19,8 @@ protected:
     enum Commands
     {
         CMD_INFO,
-        CMD_SEND
+        CMD_SEND,
+        CMD_LATENCY
     };
 
     DECLARE_COMMAND_GROUP_GET_INFO
@@ -27,6 +28,8 @@ protected:
 
 private:
     void send(::util::command::CommandContext& context, ::util::format::SharedStringWriter& writer);
+    void
+    latency(::util::command::CommandContext& context, ::util::format::SharedStringWriter& writer);
 
     ::can::ICanSystem& _canSystem;
     CANFrame _canFrame;
@@ -3,10 +3,11 @@
 #pragma once
 
 #include <util/command/GroupCommand.h>
+#include <util/format/SharedStringWriter.h>
 
 namespace lifecycle
 {
-class ILifecycleManager;
+class LifecycleManager;
 }
 
 namespace lifecycle
@@ -15,14 +16,16 @@ namespace lifecycle
 class LifecycleControlCommand : public ::util::command::GroupCommand
 {
 public:
-    LifecycleControlCommand(ILifecycleManager& lifecycleManager);
+    LifecycleControlCommand(LifecycleManager& lifecycleManager);
 
 protected:
     DECLARE_COMMAND_GROUP_GET_INFO
     void executeCommand(::util::command::CommandContext& context, uint8_t idx) override;
 
 private:
-    ILifecycleManager& _lifecycleManager;
+    void printCriticalPath(::util::format::SharedStringWriter& writer);
+
+    LifecycleManager& _lifecycleManager;
 };
 
 } // namespace lifecycle
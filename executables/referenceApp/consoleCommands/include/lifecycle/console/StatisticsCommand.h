@@ -4,6 +4,10 @@
 
 #include <async/AsyncBinding.h>
 #include <etl/optional.h>
+#ifdef PLATFORM_SUPPORT_RUNNABLE_STATISTICS
+#include <runtime/RunnableStatistics.h>
+#endif
+#include <runtime/RuntimeStatistics.h>
 #include <runtime/StatisticsContainer.h>
 #include <util/command/GroupCommand.h>
 
@@ -12,7 +16,13 @@ namespace lifecycle
 class StatisticsCommand : public ::util::command::GroupCommand
 {
 public:
-    StatisticsCommand(::async::AsyncBinding::RuntimeMonitorType& runtimeMonitor);
+#ifdef PLATFORM_SUPPORT_RUNNABLE_STATISTICS
+    StatisticsCommand(
+        ::async::AsyncBinding::RuntimeMonitorType& runtimeMonitor,
+        ::async::AsyncBinding::RunnableRuntimeMonitorType& runnableRuntimeMonitor);
+#else
+    explicit StatisticsCommand(::async::AsyncBinding::RuntimeMonitorType& runtimeMonitor);
+#endif
 
     void setTicksPerUs(uint32_t ticksPerUs);
     void cyclic_1000ms();
@@ -22,19 +32,37 @@ protected:
     void executeCommand(::util::command::CommandContext& context, uint8_t idx) override;
 
 private:
+    using ContextStatistics = ::async::AsyncBinding::RuntimeMonitorType::ContextStatisticsType;
+
     using TaskStatistics = ::runtime::declare::StatisticsContainer<
-        ::runtime::RuntimeStatistics,
+        ContextStatistics,
         ::async::AsyncBindingType::AdapterType::OS_TASK_COUNT>;
 
     using IsrGroupStatistics
-        = ::runtime::declare::StatisticsContainer<::runtime::RuntimeStatistics, ISR_GROUP_COUNT>;
+        = ::runtime::declare::StatisticsContainer<ContextStatistics, ISR_GROUP_COUNT>;
+
+#ifdef PLATFORM_SUPPORT_RUNNABLE_STATISTICS
+    using RunnableStatistics = ::runtime::declare::StatisticsContainer<
+        ::runtime::RunnableStatistics,
+        ::async::AsyncBinding::RUNNABLE_STATISTICS_COUNT>;
+#endif
 
     ::async::AsyncBinding::RuntimeMonitorType& _runtimeMonitor;
+#ifdef PLATFORM_SUPPORT_RUNNABLE_STATISTICS
+    ::async::AsyncBinding::RunnableRuntimeMonitorType& _runnableRuntimeMonitor;
+#endif
 
     TaskStatistics _taskStatistics;
     IsrGroupStatistics _isrGroupStatistics;
+#ifdef PLATFORM_SUPPORT_RUNNABLE_STATISTICS
+    RunnableStatistics _runnableStatistics;
+#endif
+    ::runtime::RuntimeStatistics _loggerLockStatistics;
 
     ::etl::optional<uint32_t> _ticksPerUs;
+#ifdef PLATFORM_SUPPORT_RUNNABLE_STATISTICS
+    uint32_t _untrackedRunnableRunCount;
+#endif
     uint32_t _totalRuntime;
 };
 
@@ -5,6 +5,7 @@
 #include "busid/BusId.h"
 
 #include <can/transceiver/AbstractCANTransceiver.h>
+#include <can/transceiver/CANLatencyHistogram.h>
 
 using namespace ::util::command;
 using namespace ::util::format;
@@ -20,6 +21,8 @@ DEFINE_COMMAND_GROUP_GET_INFO_BEGIN(CanCommand, "can", "Can system.")
     COMMAND_GROUP_COMMAND(CMD_INFO, "info", "print bus info")
     COMMAND_GROUP_COMMAND(CMD_SEND, "send", "send frame: id data[8]\n"
     "\t[send 0x123 1 2 3 4 5 6 7 8] sends to CAN_0 Frame(CanId = 0x123)\n")
+    COMMAND_GROUP_COMMAND(CMD_LATENCY, "latency", "print receive latency histogram: [reset]\n"
+    "\t[latency reset] prints and clears the histogram of CAN_0\n")
 
 DEFINE_COMMAND_GROUP_GET_INFO_END
 
@@ -57,6 +60,45 @@ void CanCommand::send(
     }
 }
 
+void CanCommand::latency(
+    ::util::command::CommandContext& context, ::util::format::SharedStringWriter& writer)
+{
+    bool const reset
+        = context.hasToken() && context.scanEnumToken<bool>().check("reset", true).getValue();
+    if (!context.checkEol())
+    {
+        return;
+    }
+
+    ::can::CANLatencyHistogram* const histogram = _canSystem.getLatencyHistogram(::busid::CAN_0);
+    if (histogram == nullptr)
+    {
+        writer.printf("no latency recorded for CanBus %u\n", ::busid::CAN_0);
+        return;
+    }
+    writer.printf(
+        "CanBus %u: %u frames, min %u us, max %u us\n",
+        ::busid::CAN_0,
+        histogram->getCount(),
+        histogram->getMin(),
+        histogram->getMax());
+    for (size_t bucket = 0U; bucket < ::can::CANLatencyHistogram::BUCKET_COUNT; ++bucket)
+    {
+        uint32_t const count = histogram->getBucketCount(bucket);
+        if (count > 0U)
+        {
+            writer.printf(
+                "  >= %7u us: %u\n",
+                ::can::CANLatencyHistogram::getBucketLowerBound(bucket),
+                count);
+        }
+    }
+    if (reset)
+    {
+        histogram->reset();
+    }
+}
+
 void CanCommand::executeCommand(::util::command::CommandContext& context, uint8_t idx)
 {
     ::util::format::SharedStringWriter writer(context);
@@ -75,6 +117,12 @@ void CanCommand::executeCommand(::util::command::CommandContext& context, uint8_
         }
         break;
 
+        case CMD_LATENCY:
+        {
+            latency(context, writer);
+        }
+        break;
+
         default: break;
     }
 }
@@ -3,7 +3,7 @@
 #include "lifecycle/console/LifecycleControlCommand.h"
 
 #include <async/Async.h>
-#include <lifecycle/ILifecycleManager.h>
+#include <lifecycle/LifecycleManager.h>
 
 #include <etl/error_handler.h>
 
@@ -14,6 +14,7 @@ enum Id
     ID_REBOOT,
     ID_POWEROFF,
     GO_TO_LEVEL,
+    ID_PATH,
     ID_UDEF,
     ID_PABT,
     ID_DABT,
@@ -28,13 +29,14 @@ DEFINE_COMMAND_GROUP_GET_INFO_BEGIN(LifecycleControlCommand, "lc", "lifecycle co
 COMMAND_GROUP_COMMAND(ID_REBOOT, "reboot", "reboot the system")
 COMMAND_GROUP_COMMAND(ID_POWEROFF, "poweroff", "poweroff the system")
 COMMAND_GROUP_COMMAND(GO_TO_LEVEL, "level", "switch to level")
+COMMAND_GROUP_COMMAND(ID_PATH, "path", "print the critical path of the last startup")
 COMMAND_GROUP_COMMAND(ID_UDEF, "udef", "forces an undefined instruction exception")
 COMMAND_GROUP_COMMAND(ID_PABT, "pabt", "forces a prefetch abort exception")
 COMMAND_GROUP_COMMAND(ID_DABT, "dabt", "forces a data abort exception")
 COMMAND_GROUP_COMMAND(ID_ASSERT, "assert", "forces an assert")
 DEFINE_COMMAND_GROUP_GET_INFO_END
 
-LifecycleControlCommand::LifecycleControlCommand(ILifecycleManager& lifecycleManager)
+LifecycleControlCommand::LifecycleControlCommand(LifecycleManager& lifecycleManager)
 : _lifecycleManager(lifecycleManager)
 {}
 
@@ -66,6 +68,12 @@ void LifecycleControlCommand::executeCommand(::util::command::CommandContext& co
             }
             break;
         }
+        case ID_PATH:
+        {
+            ::util::format::SharedStringWriter writer(context);
+            printCriticalPath(writer);
+            break;
+        }
         case ID_UDEF:
         {
             break;
@@ -90,4 +98,29 @@ void LifecycleControlCommand::executeCommand(::util::command::CommandContext& co
     }
 }
 
+void LifecycleControlCommand::printCriticalPath(::util::format::SharedStringWriter& writer)
+{
+    ::etl::array<uint8_t, LifecycleManager::MAX_DEPENDENCY_COMPONENT_COUNT> path{};
+    size_t const count = _lifecycleManager.getCriticalPath(path);
+    if (count == 0U)
+    {
+        writer.printf("no startup recorded\n");
+        return;
+    }
+    writer.printf("   ready us    init us     run us  component\n");
+    for (size_t idx = 0U; idx < count; ++idx)
+    {
+        LifecycleManager::ComponentInfo const& componentInfo
+            = _lifecycleManager.getComponentInfo(static_cast<size_t>(path[idx]));
+        writer.printf(
+            "%10u %10u %10u  %s\n",
+            componentInfo._readyTime,
+            componentInfo._transitionTimes[static_cast<uint8_t>(
+                ILifecycleComponent::Transition::Type::INIT)],
+            componentInfo._transitionTimes[static_cast<uint8_t>(
+                ILifecycleComponent::Transition::Type::RUN)],
+            componentInfo._name);
+    }
+}
+
 } // namespace lifecycle
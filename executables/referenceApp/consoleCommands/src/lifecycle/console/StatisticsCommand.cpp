@@ -3,6 +3,10 @@
 #include "lifecycle/console/StatisticsCommand.h"
 
 #include <async/Async.h>
+#include <logger/MeasuredLock.h>
+#ifdef PLATFORM_SUPPORT_RUNTIME_HISTOGRAM
+#include <runtime/HistogramRuntimeStatistics.h>
+#endif
 #include <runtime/StatisticsWriter.h>
 #include <util/format/SharedStringWriter.h>
 
@@ -19,11 +23,36 @@ void format(
     statisticsWriter.writeRuntime("max ", 6U, statistics.getMaxRuntime());
 }
 
+#ifdef PLATFORM_SUPPORT_RUNTIME_HISTOGRAM
+void formatWithPercentiles(
+    ::runtime::StatisticsWriter& statisticsWriter,
+    ::runtime::HistogramRuntimeStatistics<> const& statistics)
+{
+    format(statisticsWriter, statistics);
+    statisticsWriter.writePercentileRuntimes(6U, statistics);
+}
+#endif
+
+#ifdef PLATFORM_SUPPORT_RUNNABLE_STATISTICS
+void formatRunnable(
+    ::runtime::StatisticsWriter& statisticsWriter, ::runtime::RunnableStatistics const& statistics)
+{
+    statisticsWriter.writeRuntimePercentage("%", statistics.getTotalRuntime());
+    statisticsWriter.writeRuntimeMS("total ", 9U, statistics.getTotalRuntime());
+    statisticsWriter.writeNumber("runs ", 6U, statistics.getTotalRunCount());
+    statisticsWriter.writeRuntime("avg ", 6U, statistics.getAverageRuntime());
+    statisticsWriter.writeRuntime("max ", 6U, statistics.getMaxRuntime());
+    statisticsWriter.writeRuntime("avg delay ", 6U, statistics.getAverageDelay());
+    statisticsWriter.writeRuntime("max delay ", 6U, statistics.getMaxDelay());
+}
+#endif
+
 template<typename T, typename I>
 void printCpu(
     ::util::command::CommandContext& context,
     T const& taskStatistics,
     I const& isrGroupStatistics,
+    ::runtime::RuntimeStatistics const& loggerLockStatistics,
     ::etl::optional<uint32_t> const& ticksPerUs,
     uint32_t const totalRuntime)
 {
@@ -39,16 +68,36 @@ void printCpu(
 
     using FormatStatisticsType
         = ::runtime::StatisticsWriter::FormatStatistics<::runtime::RuntimeStatistics>::Type;
+    using FormatContextStatisticsType = ::runtime::StatisticsWriter::FormatStatistics<
+        ::async::AsyncBinding::ContextStatisticsType>::Type;
 
     FormatStatisticsType formatStatistics = FormatStatisticsType::create<&format>();
+#ifdef PLATFORM_SUPPORT_RUNTIME_HISTOGRAM
+    FormatContextStatisticsType formatContextStatistics
+        = FormatContextStatisticsType::create<&formatWithPercentiles>();
+#else
+    FormatContextStatisticsType formatContextStatistics
+        = FormatContextStatisticsType::create<&format>();
+#endif
 
     statisticsWriter.formatStatisticsGroup(
-        formatStatistics, "task", 15U, taskStatistics.getIterator());
+        formatContextStatistics, "task", 15U, taskStatistics.getIterator());
 
     statisticsWriter.writeEol();
 
     statisticsWriter.formatStatisticsGroup(
-        formatStatistics, "isr group", 15U, isrGroupStatistics.getIterator());
+        formatContextStatistics, "isr group", 15U, isrGroupStatistics.getIterator());
+
+    statisticsWriter.writeEol();
+
+    ::runtime::RuntimeStatistics const header;
+    statisticsWriter.setMode(::runtime::StatisticsWriter::Mode::Type::HEADER);
+    statisticsWriter.formatStatisticsLine(formatStatistics, "lock", 15U, "", header);
+    statisticsWriter.setMode(::runtime::StatisticsWriter::Mode::Type::LINE);
+    statisticsWriter.formatStatisticsLine(formatStatistics, "lock", 15U, "", header);
+    statisticsWriter.setMode(::runtime::StatisticsWriter::Mode::Type::VALUE);
+    statisticsWriter.formatStatisticsLine(
+        formatStatistics, "lock", 15U, "logger", loggerLockStatistics);
 
     statisticsWriter.writeEol();
 
@@ -57,6 +106,40 @@ void printCpu(
     statisticsWriter.writeRuntime("", 8U, totalRuntime);
 }
 
+#ifdef PLATFORM_SUPPORT_RUNNABLE_STATISTICS
+template<typename R>
+void printRunnables(
+    ::util::command::CommandContext& context,
+    R const& runnableStatistics,
+    uint32_t const untrackedRunCount,
+    ::etl::optional<uint32_t> const& ticksPerUs,
+    uint32_t const totalRuntime)
+{
+    ::util::format::SharedStringWriter writer(context);
+
+    if (!ticksPerUs.has_value())
+    {
+        writer.printf("cannot print runnable statistics, ticksPerUs is unknown\n");
+        return;
+    }
+
+    ::runtime::StatisticsWriter statisticsWriter(writer, totalRuntime, *ticksPerUs);
+
+    using FormatRunnableStatisticsType
+        = ::runtime::StatisticsWriter::FormatStatistics<::runtime::RunnableStatistics>::Type;
+
+    statisticsWriter.formatStatisticsGroup(
+        FormatRunnableStatisticsType::create<&formatRunnable>(),
+        "runnable",
+        19U,
+        runnableStatistics.getIterator());
+
+    statisticsWriter.writeEol();
+
+    writer.printf("untracked runs: %d\n", untrackedRunCount);
+}
+#endif
+
 void printStack(
     ::util::command::CommandContext& context,
     ::async::AsyncBinding::RuntimeMonitorType& /* runtimeMonitor */)
@@ -79,6 +162,7 @@ enum Id
 {
     ID_CPU,
     ID_STACK,
+    ID_RUNNABLES,
     ID_ALL
 };
 
@@ -89,16 +173,36 @@ namespace lifecycle
 DEFINE_COMMAND_GROUP_GET_INFO_BEGIN(StatisticsCommand, "stats", "lifecycle statistics command")
 COMMAND_GROUP_COMMAND(ID_CPU, "cpu", "prints CPU statistics")
 COMMAND_GROUP_COMMAND(ID_STACK, "stack", "prints stack statistics")
+#ifdef PLATFORM_SUPPORT_RUNNABLE_STATISTICS
+COMMAND_GROUP_COMMAND(ID_RUNNABLES, "runnables", "prints runnable statistics")
+#endif
 COMMAND_GROUP_COMMAND(ID_ALL, "all", "prints all statistics")
 DEFINE_COMMAND_GROUP_GET_INFO_END
 
+#ifdef PLATFORM_SUPPORT_RUNNABLE_STATISTICS
+StatisticsCommand::StatisticsCommand(
+    ::async::AsyncBinding::RuntimeMonitorType& runtimeMonitor,
+    ::async::AsyncBinding::RunnableRuntimeMonitorType& runnableRuntimeMonitor)
+: _runtimeMonitor(runtimeMonitor)
+, _runnableRuntimeMonitor(runnableRuntimeMonitor)
+, _taskStatistics()
+, _isrGroupStatistics()
+, _runnableStatistics()
+, _loggerLockStatistics()
+, _ticksPerUs()
+, _untrackedRunnableRunCount(0)
+, _totalRuntime(0)
+{}
+#else
 StatisticsCommand::StatisticsCommand(::async::AsyncBinding::RuntimeMonitorType& runtimeMonitor)
 : _runtimeMonitor(runtimeMonitor)
 , _taskStatistics()
 , _isrGroupStatistics()
+, _loggerLockStatistics()
 , _ticksPerUs()
 , _totalRuntime(0)
 {}
+#endif
 
 void StatisticsCommand::setTicksPerUs(uint32_t const ticksPerUs) { _ticksPerUs = ticksPerUs; }
 
@@ -107,6 +211,13 @@ void StatisticsCommand::cyclic_1000ms()
     ::async::Lock const lock;
     _taskStatistics.copyFrom(_runtimeMonitor.getTaskStatistics());
     _isrGroupStatistics.copyFrom(_runtimeMonitor.getIsrGroupStatistics());
+    _loggerLockStatistics = ::logger::LockStatistics::getStatistics();
+    ::logger::LockStatistics::reset();
+#ifdef PLATFORM_SUPPORT_RUNNABLE_STATISTICS
+    _runnableStatistics.copyFrom(_runnableRuntimeMonitor.getStatistics());
+    _untrackedRunnableRunCount = _runnableRuntimeMonitor.getUntrackedRunCount();
+    _runnableRuntimeMonitor.reset();
+#endif
     _totalRuntime = _runtimeMonitor.reset();
 }
 
@@ -116,7 +227,13 @@ void StatisticsCommand::executeCommand(::util::command::CommandContext& context,
     {
         case ID_CPU:
         {
-            printCpu(context, _taskStatistics, _isrGroupStatistics, _ticksPerUs, _totalRuntime);
+            printCpu(
+                context,
+                _taskStatistics,
+                _isrGroupStatistics,
+                _loggerLockStatistics,
+                _ticksPerUs,
+                _totalRuntime);
             break;
         }
         case ID_STACK:
@@ -124,10 +241,36 @@ void StatisticsCommand::executeCommand(::util::command::CommandContext& context,
             printStack(context, _runtimeMonitor);
             break;
         }
+#ifdef PLATFORM_SUPPORT_RUNNABLE_STATISTICS
+        case ID_RUNNABLES:
+        {
+            printRunnables(
+                context,
+                _runnableStatistics,
+                _untrackedRunnableRunCount,
+                _ticksPerUs,
+                _totalRuntime);
+            break;
+        }
+#endif
         case ID_ALL:
         {
-            printCpu(context, _taskStatistics, _isrGroupStatistics, _ticksPerUs, _totalRuntime);
+            printCpu(
+                context,
+                _taskStatistics,
+                _isrGroupStatistics,
+                _loggerLockStatistics,
+                _ticksPerUs,
+                _totalRuntime);
             printStack(context, _runtimeMonitor);
+#ifdef PLATFORM_SUPPORT_RUNNABLE_STATISTICS
+            printRunnables(
+                context,
+                _runnableStatistics,
+                _untrackedRunnableRunCount,
+                _ticksPerUs,
+                _totalRuntime);
+#endif
             break;
         }
         default:
@@ -25,9 +25,18 @@ set(PLATFORM_SUPPORT_ETHERNET
 set(PLATFORM_SUPPORT_STORAGE
     ON
     CACHE BOOL "Turn persistent storage on or off" FORCE)
+set(PLATFORM_SUPPORT_FLASH
+    ON
+    CACHE BOOL "Turn flash download via UDS on or off" FORCE)
 set(PLATFORM_SUPPORT_TRANSPORT
     ON
     CACHE BOOL "Turn TRANSPORT support on or off" FORCE)
 set(PLATFORM_SUPPORT_UDS
     ON
     CACHE BOOL "Turn UDS support on or off" FORCE)
+set(PLATFORM_SUPPORT_RUNTIME_HISTOGRAM
+    ON
+    CACHE BOOL "Turn runtime histograms of tasks and ISR groups on or off" FORCE)
+set(PLATFORM_SUPPORT_RUNNABLE_STATISTICS
+    ON
+    CACHE BOOL "Turn runtime statistics of runnables on or off" FORCE)
@@ -0,0 +1,5 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#define FLASH_FILEPATH "/tmp/openbsw_posix_flash.bin"
@@ -3,7 +3,9 @@
 #pragma once
 
 #include "bsp/eeprom/IEepromDriver.h"
+#include "bsp/flash/IFlashDriver.h"
 #include "eeprom/EepromDriver.h"
+#include "flash/FlashDriver.h"
 
 class StaticBsp
 {
@@ -14,6 +16,11 @@ public:
 
     eeprom::IEepromDriver& getEepromDriver() { return _eepromDriver; }
 
+    flash::IFlashDriver& getFlashDriver() { return _flashDriver; }
+
+    ::etl::span<uint8_t const> getFlashMemory() const { return _flashDriver.getMemory(); }
+
 private:
     ::eeprom::EepromDriver _eepromDriver;
+    ::flash::FlashDriver _flashDriver;
 };
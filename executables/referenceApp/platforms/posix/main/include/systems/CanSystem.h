@@ -21,6 +21,7 @@ public:
     CanSystem& operator=(CanSystem const&) = delete;
 
     ::can::ICanTransceiver* getCanTransceiver(uint8_t busId) override;
+    ::can::CANLatencyHistogram* getLatencyHistogram(uint8_t busId) override;
 
     void init() final;
     void run() final;
@@ -34,6 +35,7 @@ private:
     ::async::ContextType _context;
 
     ::can::SocketCanTransceiver _canTransceiver;
+    ::can::CANLatencyHistogram _latencyHistogram;
 };
 
 } // namespace systems
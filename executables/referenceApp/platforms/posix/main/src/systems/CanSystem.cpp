@@ -16,9 +16,10 @@ namespace
 } // namespace
 
 CanSystem::CanSystem(::async::ContextType context)
-: _timeout(), _context(context), _canTransceiver(canConfig)
+: _timeout(), _context(context), _canTransceiver(canConfig), _latencyHistogram()
 {
     setTransitionContext(context);
+    _canTransceiver.setLatencyHistogram(_latencyHistogram);
 }
 
 void CanSystem::init() { transitionDone(); }
@@ -49,6 +50,15 @@ void CanSystem::shutdown()
     return nullptr;
 }
 
+::can::CANLatencyHistogram* CanSystem::getLatencyHistogram(uint8_t busId)
+{
+    if (busId == ::busid::CAN_0)
+    {
+        return &_latencyHistogram;
+    }
+    return nullptr;
+}
+
 void CanSystem::execute() { _canTransceiver.run(MAX_SENT_PER_RUN, MAX_RECEIVED_PER_RUN); }
 
 } // namespace systems
@@ -4,8 +4,6 @@
 
 #include "ethConfig.h"
 
-#include <poll.h>
-
 namespace systems
 {
 
@@ -35,21 +33,23 @@ void TapEthernetSystem::shutdown()
 {
     _driver.stop();
     _rxTimeout.cancel();
+    auto const& statistics = _driver.getStatistics();
+    ::util::logger::Logger::info(
+        ::util::logger::ETHERNET,
+        "TapEthernetDriver stopped (rx: %u, rx pool exhausted: %u, rx queue full: %u, tx: %u, tx "
+        "errors: %u)",
+        statistics.rxFrames,
+        statistics.rxPoolExhausted,
+        statistics.rxQueueFull,
+        statistics.txFrames,
+        statistics.txErrors);
     transitionDone();
 }
 
 void TapEthernetSystem::execute()
 {
-    pollfd pollFds[1];
-    pollFds[0].fd     = _driver.getTapInterfaceFd();
-    pollFds[0].events = POLLIN;
-    while (poll(pollFds, 1, 0) > 0)
-    {
-        if ((pollFds[0].revents & POLLIN) != 0)
-        {
-            _driver.readFrame();
-        }
-    }
+    // read as many frames as fit into the queue, further frames are read on the next execution
+    (void)_driver.readFrames(_driver._queue.capacity());
 }
 
 bool TapEthernetSystem::getLinkStatus(size_t const /*port*/) { return true; }
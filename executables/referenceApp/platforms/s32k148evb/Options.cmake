@@ -24,6 +24,15 @@ set(PLATFORM_SUPPORT_MPU
 set(PLATFORM_SUPPORT_STORAGE
     ON
     CACHE BOOL "Turn persistent storage on or off" FORCE)
+set(PLATFORM_SUPPORT_FLASH
+    OFF
+    CACHE BOOL "Turn flash download via UDS on or off" FORCE)
 set(PLATFORM_SUPPORT_ROM_CHECK
     OFF
     CACHE BOOL "Turn ON ROM check support" FORCE)
+set(PLATFORM_SUPPORT_RUNTIME_HISTOGRAM
+    OFF
+    CACHE BOOL "Turn runtime histograms of tasks and ISR groups on or off" FORCE)
+set(PLATFORM_SUPPORT_RUNNABLE_STATISTICS
+    OFF
+    CACHE BOOL "Turn runtime statistics of runnables on or off" FORCE)
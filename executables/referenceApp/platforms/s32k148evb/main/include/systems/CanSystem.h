@@ -89,6 +89,15 @@ public:
      */
     ::can::ICanTransceiver* getCanTransceiver(uint8_t busId) override;
 
+    /**
+     * Checks if the given busId is equal to CAN_0. If it is returns a pointer to the histogram
+     * of the receive latency of CanFlex2Transceiver else nullptr.
+     *
+     * \param busId BusId.
+     * \return A non-const pointer to the CANLatencyHistogram object.
+     */
+    ::can::CANLatencyHistogram* getLatencyHistogram(uint8_t busId) override;
+
     /**
      * Executes the CanRxRunnable in the given context.
      */
@@ -129,6 +138,7 @@ public:
 private:
     ::async::ContextType _context;
     bios::CanFlex2Transceiver _transceiver0;
+    ::can::CANLatencyHistogram _latencyHistogram0;
     CanRxRunnable _canRxRunnable;
 };
 
@@ -25,8 +25,11 @@ namespace systems
       Can0Config,
       staticBsp.getCanPhy(),
       staticBsp.getPowerStateController())
+, _latencyHistogram0()
 , _canRxRunnable(*this)
-{}
+{
+    _transceiver0.setLatencyHistogram(_latencyHistogram0);
+}
 
 void CanSystem::init() { transitionDone(); }
 
@@ -59,6 +62,15 @@ void CanSystem::shutdown()
     return nullptr;
 }
 
+::can::CANLatencyHistogram* CanSystem::getLatencyHistogram(uint8_t busId)
+{
+    if (busId == ::busid::CAN_0)
+    {
+        return &_latencyHistogram0;
+    }
+    return nullptr;
+}
+
 void CanSystem::dispatchRxTask() { ::async::execute(_context, _canRxRunnable); }
 
 CanSystem::CanRxRunnable::CanRxRunnable(CanSystem& parent) : _parent(parent), _enabled(false) {}
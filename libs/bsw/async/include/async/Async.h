@@ -16,6 +16,16 @@ namespace async
  */
 void execute(ContextType context, RunnableType& runnable);
 
+/**
+ * Execute the given runnable immediately in a runnable lane of the context, non-blocking call.
+ * Runnables of higher lanes are executed first, a lane beyond the lanes of the context selects
+ * its last lane.
+ * \param context Context of execution
+ * \param runnable Runnable to execute
+ * \param lane Lane of the runnable
+ */
+void execute(ContextType context, RunnableType& runnable, size_t lane);
+
 /**
  * Execute runnable after specified delay, non-blocking call
  * \param context Context of execution
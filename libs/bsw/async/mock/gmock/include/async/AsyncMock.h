@@ -19,6 +19,7 @@ public:
     AsyncMock() : ::etl::singleton_base<AsyncMock>(*this) {}
 
     MOCK_METHOD(void, execute, (ContextType contextType, RunnableType& runnableType));
+    MOCK_METHOD(void, execute, (ContextType contextType, RunnableType& runnableType, size_t lane));
     MOCK_METHOD(
         void,
         schedule,
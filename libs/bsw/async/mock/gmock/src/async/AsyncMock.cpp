@@ -11,6 +11,11 @@ void execute(ContextType const context, RunnableType& runnable)
     ::etl::singleton_base<AsyncMock>::instance().execute(context, runnable);
 }
 
+void execute(ContextType const context, RunnableType& runnable, size_t const lane)
+{
+    ::etl::singleton_base<AsyncMock>::instance().execute(context, runnable, lane);
+}
+
 void schedule(
     ContextType const context,
     RunnableType& runnable,
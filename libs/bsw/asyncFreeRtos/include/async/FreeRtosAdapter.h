@@ -72,9 +72,14 @@ public:
     static ContextType const TASK_IDLE  = 0U;
     static ContextType const TASK_TIMER = static_cast<ContextType>(TASK_COUNT);
 
+    static size_t const RUNNABLE_LANE_COUNT = internal::TaskRunnableLaneCount<Binding>::value;
+
     using AdapterType = FreeRtosAdapter<Binding>;
 
-    using TaskContextType  = TaskContext<AdapterType>;
+    using TimerType        = typename internal::TaskTimer<Binding>::Type;
+    using RunnableHookType = typename internal::TaskRunnableHook<Binding>::Type;
+    using WakeupHookType   = typename internal::TaskWakeupHook<Binding>::Type;
+    using TaskContextType  = TaskContext<AdapterType, TimerType>;
     using TaskFunctionType = typename TaskContextType::TaskFunctionType;
 
     using TaskConfigsType = internal::TaskConfigHolder<OS_TASK_COUNT>;
@@ -156,6 +161,24 @@ public:
      */
     static void execute(ContextType context, RunnableType& runnable);
 
+    /**
+     * Executes a specified runnable within a given context in one of its runnable lanes.
+     *
+     * \param context The task context.
+     * \param runnable The runnable to execute.
+     * \param lane The lane of the runnable, runnables of higher lanes are executed first.
+     */
+    static void execute(ContextType context, RunnableType& runnable, size_t lane);
+
+    /**
+     * Sets the time budget of a runnable lane of a given context.
+     *
+     * \param context The task context.
+     * \param lane The lane to set the budget for.
+     * \param budgetUs The time in microseconds after which the context yields, 0 for no budget.
+     */
+    static void setRunnableLaneBudget(ContextType context, size_t lane, uint32_t budgetUs);
+
     /**
      * Schedules a runnable to execute after a delay.
      *
@@ -195,6 +218,15 @@ public:
      */
     static void cancel(TimeoutType& timeout);
 
+    /**
+     * Wakes up a context to process its due timeouts, e.g. as the wakeup function of a
+     * HighResolutionWakeup. From an interrupt it has to be called between enterIsr() and
+     * leaveIsr().
+     *
+     * \param context The task context.
+     */
+    static void wakeup(ContextType context);
+
     /// Notifies the system of an interrupt entry.
     static void enterIsr();
 
@@ -378,6 +410,20 @@ inline void FreeRtosAdapter<Binding>::execute(ContextType const context, Runnabl
     _taskContexts[static_cast<size_t>(context)].execute(runnable);
 }
 
+template<class Binding>
+inline void FreeRtosAdapter<Binding>::execute(
+    ContextType const context, RunnableType& runnable, size_t const lane)
+{
+    _taskContexts[static_cast<size_t>(context)].execute(runnable, lane);
+}
+
+template<class Binding>
+inline void FreeRtosAdapter<Binding>::setRunnableLaneBudget(
+    ContextType const context, size_t const lane, uint32_t const budgetUs)
+{
+    _taskContexts[static_cast<size_t>(context)].setRunnableLaneBudget(lane, budgetUs);
+}
+
 template<class Binding>
 inline void FreeRtosAdapter<Binding>::schedule(
     ContextType const context,
@@ -412,6 +458,12 @@ inline void FreeRtosAdapter<Binding>::cancel(TimeoutType& timeout)
     }
 }
 
+template<class Binding>
+inline void FreeRtosAdapter<Binding>::wakeup(ContextType const context)
+{
+    _taskContexts[static_cast<size_t>(context)].wakeup();
+}
+
 template<class Binding>
 inline BaseType_t* FreeRtosAdapter<Binding>::getHigherPriorityTaskWoken()
 {
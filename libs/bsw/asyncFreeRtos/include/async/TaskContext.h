@@ -8,11 +8,14 @@
 #include "async/EventDispatcher.h"
 #include "async/EventPolicy.h"
 #include "async/RunnableExecutor.h"
+#include "async/RunnableHook.h"
 #include "async/Types.h"
+#include "async/WakeupHook.h"
 
 #include <bsp/timer/SystemTimer.h>
 #include <etl/delegate.h>
 #include <etl/span.h>
+#include <etl/type_traits.h>
 #include <timer/Timer.h>
 
 #include <FreeRTOS.h>
@@ -20,6 +23,78 @@
 
 namespace async
 {
+namespace internal
+{
+/**
+ * Selects the timer engine of a TaskContext. The binding may provide a TimerType, e.g.
+ * ::timer::TimerWheel<LockType> for contexts with many timeouts, ::timer::Timer is used
+ * otherwise.
+ */
+template<class Binding, class = void>
+struct TaskTimer
+{
+    using Type = ::timer::Timer<LockType>;
+};
+
+template<class Binding>
+struct TaskTimer<Binding, ::etl::void_t<typename Binding::TimerType>>
+{
+    using Type = typename Binding::TimerType;
+};
+
+/**
+ * Selects the runnable hook of a TaskContext. The binding may provide a RunnableHookType, e.g.
+ * StaticRunnableHook<::runtime::RunnableRuntimeMonitor<>> to account the execution time of each
+ * runnable, NoRunnableHook is used otherwise. The binding has to declare the RunnableHookType
+ * before it instantiates its adapter.
+ */
+template<class Binding, class = void>
+struct TaskRunnableHook
+{
+    using Type = NoRunnableHook;
+};
+
+template<class Binding>
+struct TaskRunnableHook<Binding, ::etl::void_t<typename Binding::RunnableHookType>>
+{
+    using Type = typename Binding::RunnableHookType;
+};
+
+/**
+ * Selects the wakeup hook of a TaskContext. The binding may provide a WakeupHookType, e.g.
+ * StaticWakeupHook<declare::HighResolutionWakeup<...>> to wake up the contexts at the exact time
+ * of their timeouts, NoWakeupHook is used otherwise and timeouts are rounded up to RTOS ticks.
+ */
+template<class Binding, class = void>
+struct TaskWakeupHook
+{
+    using Type = NoWakeupHook;
+};
+
+template<class Binding>
+struct TaskWakeupHook<Binding, ::etl::void_t<typename Binding::WakeupHookType>>
+{
+    using Type = typename Binding::WakeupHookType;
+};
+
+/**
+ * Selects the number of runnable lanes of a TaskContext. The binding may provide a
+ * RUNNABLE_LANE_COUNT to execute urgent runnables ahead of the others, a single lane is used
+ * otherwise.
+ */
+template<class Binding, class = void>
+struct TaskRunnableLaneCount
+{
+    static size_t const value = 1U;
+};
+
+template<class Binding>
+struct TaskRunnableLaneCount<Binding, ::etl::void_t<decltype(Binding::RUNNABLE_LANE_COUNT)>>
+{
+    static size_t const value = Binding::RUNNABLE_LANE_COUNT;
+};
+} // namespace internal
+
 /**
  * Provides an interface between application-specific Tasks and Timers
  * and the FreeRTOS framework, managing FreeRTOS* task and timer callbacks.
@@ -29,12 +104,13 @@ namespace async
  * for task creation, scheduling and processing callbacks.
  *
  * \tparam Binding The specific binding type associated with the TaskContext.
+ * \tparam Timer The timer engine holding the timeouts of this context.
  */
-template<class Binding>
+template<class Binding, class Timer = typename internal::TaskTimer<Binding>::Type>
 class TaskContext : public EventDispatcher<2U, LockType>
 {
 public:
-    using TaskFunctionType = ::etl::delegate<void(TaskContext<Binding>&)>;
+    using TaskFunctionType = ::etl::delegate<void(TaskContext<Binding, Timer>&)>;
     using StackType        = ::etl::span<StackType_t>;
 
     TaskContext();
@@ -79,8 +155,16 @@ public:
     /**
      * Executes asynchronously the specified runnable within this task context.
      * \param runnable The runnable to execute.
+     * \param lane The lane of the runnable, runnables of higher lanes are executed first.
      */
-    void execute(RunnableType& runnable);
+    void execute(RunnableType& runnable, size_t lane = 0U);
+
+    /**
+     * Sets the time budget of a runnable lane, see RunnableExecutor.
+     * \param lane The lane to set the budget for.
+     * \param budgetUs The time in microseconds after which the context yields, 0 for no budget.
+     */
+    void setRunnableLaneBudget(size_t lane, uint32_t budgetUs);
 
     /**
      * Schedules a runnable to execute after a delay.
@@ -107,6 +191,12 @@ public:
      */
     void cancel(TimeoutType& timeout);
 
+    /**
+     * Sets the timer event of this context, which makes it process its due timeouts. Called by
+     * the wakeup hook when the next timeout of this context is due.
+     */
+    void wakeup();
+
     /// Calls the task's assigned function.
     void callTaskFunction();
 
@@ -130,21 +220,23 @@ public:
      * Default function to be executed by a task within this context.
      * \param taskContext The context in which the task executes.
      */
-    static void defaultTaskFunction(TaskContext<Binding>& taskContext);
+    static void defaultTaskFunction(TaskContext<Binding, Timer>& taskContext);
 
     /**
      * Default function to be executed by the idle task.
      * \param taskContext The context in which the task executes.
      */
-    static void defaultIdleFunction(TaskContext<Binding>& taskContext);
+    static void defaultIdleFunction(TaskContext<Binding, Timer>& taskContext);
 
 private:
-    friend class EventPolicy<TaskContext<Binding>, 0U>;
-    friend class EventPolicy<TaskContext<Binding>, 1U>;
+    friend class EventPolicy<TaskContext<Binding, Timer>, 0U>;
+    friend class EventPolicy<TaskContext<Binding, Timer>, 1U>;
 
-    using ExecuteEventPolicyType = EventPolicy<TaskContext<Binding>, 0U>;
-    using TimerEventPolicyType   = EventPolicy<TaskContext<Binding>, 1U>;
-    using TimerType              = ::timer::Timer<LockType>;
+    using ExecuteEventPolicyType = EventPolicy<TaskContext<Binding, Timer>, 0U>;
+    using TimerEventPolicyType   = EventPolicy<TaskContext<Binding, Timer>, 1U>;
+    using TimerType              = Timer;
+    using RunnableHookType       = typename internal::TaskRunnableHook<Binding>::Type;
+    using WakeupHookType         = typename internal::TaskWakeupHook<Binding>::Type;
 
     static EventMaskType const STOP_EVENT_MASK = static_cast<EventMaskType>(
         static_cast<EventMaskType>(1U) << static_cast<EventMaskType>(EVENT_COUNT));
@@ -158,7 +250,13 @@ private:
 
     static void staticTaskFunction(void* param);
 
-    RunnableExecutor<RunnableType, ExecuteEventPolicyType, LockType> _runnableExecutor;
+    RunnableExecutor<
+        RunnableType,
+        ExecuteEventPolicyType,
+        LockType,
+        RunnableHookType,
+        internal::TaskRunnableLaneCount<Binding>::value>
+        _runnableExecutor;
     TimerType _timer;
     TimerEventPolicyType _timerEventPolicy;
     TaskFunctionType _taskFunction;
@@ -170,8 +268,8 @@ private:
 /**
  * Inline implementations.
  */
-template<class Binding>
-inline TaskContext<Binding>::TaskContext()
+template<class Binding, class Timer>
+inline TaskContext<Binding, Timer>::TaskContext()
 : _runnableExecutor(*this)
 , _timerEventPolicy(*this)
 , _taskFunction()
@@ -184,8 +282,8 @@ inline TaskContext<Binding>::TaskContext()
     _runnableExecutor.init();
 }
 
-template<class Binding>
-void TaskContext<Binding>::initTask(
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::initTask(
     ContextType const context, char const* const name, TaskFunctionType const taskFunction)
 {
     _context      = context;
@@ -195,14 +293,14 @@ void TaskContext<Binding>::initTask(
                         : TaskFunctionType::template create<&TaskContext::defaultIdleFunction>();
 }
 
-template<class Binding>
-void TaskContext<Binding>::initTaskHandle(TaskHandle_t const taskHandle)
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::initTaskHandle(TaskHandle_t const taskHandle)
 {
     _taskHandle = taskHandle;
 }
 
-template<class Binding>
-void TaskContext<Binding>::createTask(
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::createTask(
     ContextType const context,
     StaticTask_t& task,
     char const* const name,
@@ -225,32 +323,39 @@ void TaskContext<Binding>::createTask(
         &task);
 }
 
-template<class Binding>
-inline char const* TaskContext<Binding>::getName() const
+template<class Binding, class Timer>
+inline char const* TaskContext<Binding, Timer>::getName() const
 {
     return _name;
 }
 
-template<class Binding>
-inline TaskHandle_t TaskContext<Binding>::getTaskHandle() const
+template<class Binding, class Timer>
+inline TaskHandle_t TaskContext<Binding, Timer>::getTaskHandle() const
 {
     return _taskHandle;
 }
 
-template<class Binding>
-inline uint32_t TaskContext<Binding>::getUnusedStackSize() const
+template<class Binding, class Timer>
+inline uint32_t TaskContext<Binding, Timer>::getUnusedStackSize() const
 {
     return getUnusedStackSize(_taskHandle);
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::execute(RunnableType& runnable)
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::execute(RunnableType& runnable, size_t const lane)
 {
-    _runnableExecutor.enqueue(runnable);
+    _runnableExecutor.enqueue(runnable, lane);
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::schedule(
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::setRunnableLaneBudget(
+    size_t const lane, uint32_t const budgetUs)
+{
+    _runnableExecutor.setLaneBudget(lane, budgetUs);
+}
+
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::schedule(
     RunnableType& runnable, TimeoutType& timeout, uint32_t const delay, TimeUnitType const unit)
 {
     if (!_timer.isActive(timeout))
@@ -264,8 +369,8 @@ inline void TaskContext<Binding>::schedule(
     }
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::scheduleAtFixedRate(
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::scheduleAtFixedRate(
     RunnableType& runnable, TimeoutType& timeout, uint32_t const period, TimeUnitType const unit)
 {
     if (!_timer.isActive(timeout))
@@ -279,14 +384,20 @@ inline void TaskContext<Binding>::scheduleAtFixedRate(
     }
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::cancel(TimeoutType& timeout)
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::cancel(TimeoutType& timeout)
 {
     _timer.cancel(timeout);
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::setEvents(EventMaskType const eventMask)
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::wakeup()
+{
+    _timerEventPolicy.setEvent();
+}
+
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::setEvents(EventMaskType const eventMask)
 {
     BaseType_t* const higherPriorityTaskHasWoken = Binding::getHigherPriorityTaskWoken();
     if (higherPriorityTaskHasWoken != nullptr)
@@ -299,16 +410,23 @@ inline void TaskContext<Binding>::setEvents(EventMaskType const eventMask)
     }
 }
 
-template<class Binding>
-inline EventMaskType TaskContext<Binding>::waitEvents()
+template<class Binding, class Timer>
+inline EventMaskType TaskContext<Binding, Timer>::waitEvents()
 {
     EventMaskType eventMask = 0U;
     uint32_t ticks          = Binding::WAIT_EVENTS_TICK_COUNT;
     uint32_t nextDelta;
-    bool const hasDelta = _timer.getNextDelta(getSystemTimeUs32Bit(), nextDelta);
+    uint32_t const nowUs = getSystemTimeUs32Bit();
+    bool const hasDelta  = _timer.getNextDelta(nowUs, nextDelta);
     if (hasDelta)
     {
         ticks = static_cast<uint32_t>((nextDelta + (Config::TICK_IN_US - 1U)) / Config::TICK_IN_US);
+        // the wakeup hook may set the timer event before the tick rounded up to is reached
+        WakeupHookType::setWakeup(_context, nowUs + nextDelta);
+    }
+    else
+    {
+        WakeupHookType::clearWakeup(_context);
     }
     if (xTaskNotifyWait(0U, WAIT_EVENT_MASK, &eventMask, ticks) != 0)
     {
@@ -324,22 +442,22 @@ inline EventMaskType TaskContext<Binding>::waitEvents()
     }
 }
 
-template<class Binding>
-inline EventMaskType TaskContext<Binding>::peekEvents()
+template<class Binding, class Timer>
+inline EventMaskType TaskContext<Binding, Timer>::peekEvents()
 {
     EventMaskType eventMask = 0U;
     (void)xTaskNotifyWait(0U, WAIT_EVENT_MASK, &eventMask, 0U);
     return eventMask;
 }
 
-template<class Binding>
-void TaskContext<Binding>::callTaskFunction()
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::callTaskFunction()
 {
     _taskFunction(*this);
 }
 
-template<class Binding>
-void TaskContext<Binding>::dispatch()
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::dispatch()
 {
     EventMaskType eventMask = 0U;
     while ((eventMask & STOP_EVENT_MASK) == 0U)
@@ -349,14 +467,14 @@ void TaskContext<Binding>::dispatch()
     }
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::stopDispatch()
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::stopDispatch()
 {
     setEvents(STOP_EVENT_MASK);
 }
 
-template<class Binding>
-void TaskContext<Binding>::dispatchWhileWork()
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::dispatchWhileWork()
 {
     while (true)
     {
@@ -373,33 +491,33 @@ void TaskContext<Binding>::dispatchWhileWork()
     }
 }
 
-template<class Binding>
-uint32_t TaskContext<Binding>::getUnusedStackSize(TaskHandle_t const taskHandle)
+template<class Binding, class Timer>
+uint32_t TaskContext<Binding, Timer>::getUnusedStackSize(TaskHandle_t const taskHandle)
 {
     return static_cast<uint32_t>(uxTaskGetStackHighWaterMark(taskHandle))
            * static_cast<uint32_t>(sizeof(StackType_t));
 }
 
-template<class Binding>
-void TaskContext<Binding>::defaultTaskFunction(TaskContext<Binding>& taskContext)
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::defaultTaskFunction(TaskContext<Binding, Timer>& taskContext)
 {
     taskContext.dispatch();
 }
 
-template<class Binding>
-void TaskContext<Binding>::defaultIdleFunction(TaskContext<Binding>& taskContext)
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::defaultIdleFunction(TaskContext<Binding, Timer>& taskContext)
 {
     taskContext.dispatchWhileWork();
 }
 
-template<class Binding>
-void TaskContext<Binding>::handleTimeout()
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::handleTimeout()
 {
     while (_timer.processNextTimeout(getSystemTimeUs32Bit())) {}
 }
 
-template<class Binding>
-void TaskContext<Binding>::staticTaskFunction(void* const param)
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::staticTaskFunction(void* const param)
 {
     TaskContext& taskContext = *reinterpret_cast<TaskContext*>(param);
     taskContext.callTaskFunction();
@@ -11,6 +11,11 @@ void execute(ContextType const context, RunnableType& runnable)
     AdapterType::execute(context, runnable);
 }
 
+void execute(ContextType const context, RunnableType& runnable, size_t const lane)
+{
+    AdapterType::execute(context, runnable, lane);
+}
+
 void schedule(
     ContextType const context,
     RunnableType& runnable,
@@ -2,12 +2,16 @@
 
 #include "async/TaskContext.h"
 
+#include "async/HighResolutionWakeup.h"
 #include "async/RunnableMock.h"
+#include "async/StaticWakeupHook.h"
 #include "async/TimeoutMock.h"
 
+#include <bsp/timer/OneShotTimerMock.h>
 #include <bsp/timer/SystemTimerMock.h>
 #include <etl/singleton_base.h>
 #include <os/FreeRtosMock.h>
+#include <timer/TimerWheel.h>
 
 namespace
 {
@@ -18,6 +22,8 @@ ACTION_P(StopDispatch, cut) { cut->stopDispatch(); }
 
 ACTION_P(CopyArgPointee2, pointer) { *arg2 = *pointer; }
 
+ACTION_P(SaveArgAddress, pointer) { *pointer = &arg0; }
+
 class TestBindingMock : public ::etl::singleton_base<TestBindingMock>
 {
 public:
@@ -36,6 +42,41 @@ public:
     MOCK_METHOD(void, taskFunction, (TaskContext<TestBindingMock> & taskContext));
 };
 
+class WakeupHookMock : public ::etl::singleton_base<WakeupHookMock>
+{
+public:
+    WakeupHookMock() : ::etl::singleton_base<WakeupHookMock>(*this) {}
+
+    static void setWakeup(ContextType const context, uint32_t const timeUs)
+    {
+        instance().setWakeupFunc(context, timeUs);
+    }
+
+    static void clearWakeup(ContextType const context) { instance().clearWakeupFunc(context); }
+
+    MOCK_METHOD(void, setWakeupFunc, (ContextType context, uint32_t timeUs));
+    MOCK_METHOD(void, clearWakeupFunc, (ContextType context));
+};
+
+struct TestWakeupBinding : public TestBindingMock
+{
+    using WakeupHookType = WakeupHookMock;
+};
+
+struct TestWakeupLock
+{
+    TestWakeupLock() {}
+
+    ~TestWakeupLock() {}
+};
+
+using TestHighResolutionWakeupType = declare::HighResolutionWakeup<2U, TestWakeupLock>;
+
+struct TestHighResolutionWakeupBinding : public TestBindingMock
+{
+    using WakeupHookType = StaticWakeupHook<TestHighResolutionWakeupType>;
+};
+
 class TaskContextTest : public Test
 {
 public:
@@ -305,6 +346,195 @@ TEST_F(TaskContextTest, testSchedule)
     }
 }
 
+/**
+ * \refs: SMD_asyncFreeRtos_TaskContextAsyncApi
+ * \desc: To test task schedule functionality with a timer wheel as timer engine
+ */
+TEST_F(TaskContextTest, testScheduleWithTimerWheel)
+{
+    using TaskContextType = TaskContext<TestBindingMock, ::timer::TimerWheel<LockType, 10U>>;
+    TaskContextType cut;
+    TaskFunction_t* osTaskFunction = 0L;
+    EXPECT_CALL(
+        _freeRtosMock, xTaskCreateStatic(NotNull(), _name, 100, NotNull(), 12U, _stack, &_task))
+        .WillOnce(DoAll(SaveArg<0>(&osTaskFunction), Return(&_taskHandle)));
+    cut.createTask(1U, _task, _name, 12U, _stack, TaskContextType::TaskFunctionType());
+
+    uint32_t now = 100000U;
+    EXPECT_CALL(_systemTimerMock, getSystemTimeUs32Bit()).WillRepeatedly(ReturnPointee(&now));
+
+    // Schedule timer. Expect task notify
+    uint32_t eventMask = 0U;
+    EXPECT_CALL(_bindingMock, getHigherPriorityTaskWokenFunc())
+        .WillOnce(Return(static_cast<BaseType_t*>(0L)));
+    EXPECT_CALL(_freeRtosMock, xTaskNotify(&_taskHandle, _, eSetBits))
+        .WillOnce(SaveArg<1>(&eventMask));
+    cut.schedule(_runnableMock1, _timeout1, 20U, TimeUnit::MILLISECONDS);
+    Mock::VerifyAndClearExpectations(&_freeRtosMock);
+
+    // Schedule and cancel second timer (to elapse later). No task notify expected
+    cut.schedule(_runnableMock2, _timeout2, 5U, TimeUnit::SECONDS);
+    cut.cancel(_timeout2);
+
+    Sequence seq;
+    EXPECT_CALL(_freeRtosMock, xTaskNotifyWait(0U, 7U, NotNull(), 200U))
+        .InSequence(seq)
+        .WillOnce(DoAll(SetArgPointee<2>(eventMask), Return(true)));
+    // the timer expires after the exact delay
+    EXPECT_CALL(_freeRtosMock, xTaskNotifyWait(0U, 7U, NotNull(), 200U))
+        .InSequence(seq)
+        .WillOnce(DoAll(Assign(&now, 120000U), SetArgPointee<2>(0U), Return(false)));
+    EXPECT_CALL(_runnableMock1, execute()).InSequence(seq);
+    EXPECT_CALL(
+        _freeRtosMock, xTaskNotifyWait(0U, 7U, NotNull(), TestBindingMock::WAIT_EVENTS_TICK_COUNT))
+        .InSequence(seq)
+        .WillOnce(DoAll(SetArgPointee<2>(0U), StopDispatch(&cut), Return(false)));
+    // trigger shutdown on next iteration
+    EXPECT_CALL(_bindingMock, getHigherPriorityTaskWokenFunc())
+        .WillOnce(Return(static_cast<BaseType_t*>(0L)));
+    EXPECT_CALL(_freeRtosMock, xTaskNotify(&_taskHandle, _, eSetBits))
+        .InSequence(seq)
+        .WillOnce(SaveArg<1>(&eventMask));
+    EXPECT_CALL(
+        _freeRtosMock, xTaskNotifyWait(0U, 7U, NotNull(), TestBindingMock::WAIT_EVENTS_TICK_COUNT))
+        .InSequence(seq)
+        .WillOnce(DoAll(CopyArgPointee2(&eventMask), Return(true)));
+    osTaskFunction(&cut);
+}
+
+/**
+ * \refs: SMD_asyncFreeRtos_TaskContextAsyncApi
+ * \desc: To test that a wakeup hook wakes up the task at the exact time of its next timeout
+ */
+TEST_F(TaskContextTest, testScheduleWithWakeupHook)
+{
+    using TaskContextType = TaskContext<TestWakeupBinding>;
+    StrictMock<WakeupHookMock> wakeupHookMock;
+    TaskContextType cut;
+    TaskFunction_t* osTaskFunction = 0L;
+    EXPECT_CALL(
+        _freeRtosMock, xTaskCreateStatic(NotNull(), _name, 100, NotNull(), 12U, _stack, &_task))
+        .WillOnce(DoAll(SaveArg<0>(&osTaskFunction), Return(&_taskHandle)));
+    cut.createTask(1U, _task, _name, 12U, _stack, TaskContextType::TaskFunctionType());
+
+    uint32_t now = 100000U;
+    EXPECT_CALL(_systemTimerMock, getSystemTimeUs32Bit()).WillRepeatedly(ReturnPointee(&now));
+
+    // Schedule a timer with sub-tick resolution
+    uint32_t eventMask = 0U;
+    EXPECT_CALL(_bindingMock, getHigherPriorityTaskWokenFunc())
+        .WillRepeatedly(Return(static_cast<BaseType_t*>(0L)));
+    EXPECT_CALL(_freeRtosMock, xTaskNotify(&_taskHandle, _, eSetBits))
+        .WillOnce(SaveArg<1>(&eventMask));
+    cut.schedule(_runnableMock1, _timeout1, 250U, TimeUnit::MICROSECONDS);
+    Mock::VerifyAndClearExpectations(&_freeRtosMock);
+
+    Sequence seq;
+    // the hook is asked to wake up the task after exactly 250us, the tick wait is rounded up
+    EXPECT_CALL(wakeupHookMock, setWakeupFunc(1U, 100250U)).InSequence(seq);
+    EXPECT_CALL(_freeRtosMock, xTaskNotifyWait(0U, 7U, NotNull(), 3U))
+        .InSequence(seq)
+        .WillOnce(DoAll(SetArgPointee<2>(eventMask), Return(true)));
+    EXPECT_CALL(wakeupHookMock, setWakeupFunc(1U, 100250U)).InSequence(seq);
+    // the hook wakes up the task with the timer event before the tick
+    EXPECT_CALL(_freeRtosMock, xTaskNotifyWait(0U, 7U, NotNull(), 3U))
+        .InSequence(seq)
+        .WillOnce(DoAll(
+            Assign(&now, 100250U),
+            InvokeWithoutArgs([&cut]() { cut.wakeup(); }),
+            CopyArgPointee2(&eventMask),
+            Return(true)));
+    EXPECT_CALL(_freeRtosMock, xTaskNotify(&_taskHandle, _, eSetBits))
+        .InSequence(seq)
+        .WillOnce(SaveArg<1>(&eventMask));
+    EXPECT_CALL(_runnableMock1, execute()).InSequence(seq);
+    // without timeout the wakeup is withdrawn
+    EXPECT_CALL(wakeupHookMock, clearWakeupFunc(1U)).InSequence(seq);
+    EXPECT_CALL(
+        _freeRtosMock, xTaskNotifyWait(0U, 7U, NotNull(), TestBindingMock::WAIT_EVENTS_TICK_COUNT))
+        .InSequence(seq)
+        .WillOnce(DoAll(SetArgPointee<2>(0U), StopDispatch(&cut), Return(false)));
+    EXPECT_CALL(_freeRtosMock, xTaskNotify(&_taskHandle, _, eSetBits))
+        .InSequence(seq)
+        .WillOnce(SaveArg<1>(&eventMask));
+    EXPECT_CALL(wakeupHookMock, clearWakeupFunc(1U)).InSequence(seq);
+    EXPECT_CALL(
+        _freeRtosMock, xTaskNotifyWait(0U, 7U, NotNull(), TestBindingMock::WAIT_EVENTS_TICK_COUNT))
+        .InSequence(seq)
+        .WillOnce(DoAll(CopyArgPointee2(&eventMask), Return(true)));
+    osTaskFunction(&cut);
+}
+
+/**
+ * \refs: SMD_asyncFreeRtos_TaskContextAsyncApi
+ * \desc: To test that a timeout shorter than a tick is executed on expiry of the one-shot timer of
+ * a HighResolutionWakeup, i.e. before the tick the task waits for
+ */
+TEST_F(TaskContextTest, testSubTickTimeoutFiresBeforeNextTick)
+{
+    using TaskContextType = TaskContext<TestHighResolutionWakeupBinding>;
+    TaskContextType cut;
+    auto const wakeupContext = [&cut](ContextType const) { cut.wakeup(); };
+    StrictMock<::bsp::OneShotTimerMock> oneShotTimerMock;
+    ::bsp::IOneShotTimerListener* timerListener = nullptr;
+    EXPECT_CALL(oneShotTimerMock, setListener(_)).WillOnce(SaveArgAddress(&timerListener));
+    TestHighResolutionWakeupType wakeup(
+        oneShotTimerMock, TestHighResolutionWakeupType::WakeupFunctionType(wakeupContext));
+    StaticWakeupHook<TestHighResolutionWakeupType> wakeupHook(wakeup);
+    ASSERT_EQ(&wakeup, timerListener);
+
+    TaskFunction_t* osTaskFunction = 0L;
+    EXPECT_CALL(
+        _freeRtosMock, xTaskCreateStatic(NotNull(), _name, 100, NotNull(), 12U, _stack, &_task))
+        .WillOnce(DoAll(SaveArg<0>(&osTaskFunction), Return(&_taskHandle)));
+    cut.createTask(1U, _task, _name, 12U, _stack, TaskContextType::TaskFunctionType());
+
+    uint32_t now = 100000U;
+    EXPECT_CALL(_systemTimerMock, getSystemTimeUs32Bit()).WillRepeatedly(ReturnPointee(&now));
+
+    // Schedule a timer that expires 30us before the next tick at 100100us
+    uint32_t eventMask = 0U;
+    EXPECT_CALL(_bindingMock, getHigherPriorityTaskWokenFunc())
+        .WillRepeatedly(Return(static_cast<BaseType_t*>(0L)));
+    EXPECT_CALL(_freeRtosMock, xTaskNotify(&_taskHandle, _, eSetBits))
+        .WillOnce(SaveArg<1>(&eventMask));
+    cut.schedule(_runnableMock1, _timeout1, 30U, TimeUnit::MICROSECONDS);
+    Mock::VerifyAndClearExpectations(&_freeRtosMock);
+
+    Sequence seq;
+    // the one-shot timer is programmed with the time of the timeout, the tick wait is rounded up
+    EXPECT_CALL(oneShotTimerMock, start(100030U)).InSequence(seq);
+    EXPECT_CALL(_freeRtosMock, xTaskNotifyWait(0U, 7U, NotNull(), 1U))
+        .InSequence(seq)
+        .WillOnce(DoAll(SetArgPointee<2>(eventMask), Return(true)));
+    // the timer expires while the task waits for the tick and sets the timer event
+    EXPECT_CALL(_freeRtosMock, xTaskNotifyWait(0U, 7U, NotNull(), 1U))
+        .InSequence(seq)
+        .WillOnce(DoAll(
+            Assign(&now, 100030U),
+            InvokeWithoutArgs([timerListener]() { timerListener->expired(); }),
+            CopyArgPointee2(&eventMask),
+            Return(true)));
+    EXPECT_CALL(_freeRtosMock, xTaskNotify(&_taskHandle, _, eSetBits))
+        .InSequence(seq)
+        .WillOnce(SaveArg<1>(&eventMask));
+    EXPECT_CALL(_runnableMock1, execute())
+        .InSequence(seq)
+        .WillOnce(InvokeWithoutArgs([&now]() { EXPECT_LT(now, 100100U); }));
+    EXPECT_CALL(
+        _freeRtosMock, xTaskNotifyWait(0U, 7U, NotNull(), TestBindingMock::WAIT_EVENTS_TICK_COUNT))
+        .InSequence(seq)
+        .WillOnce(DoAll(SetArgPointee<2>(0U), StopDispatch(&cut), Return(false)));
+    EXPECT_CALL(_freeRtosMock, xTaskNotify(&_taskHandle, _, eSetBits))
+        .InSequence(seq)
+        .WillOnce(SaveArg<1>(&eventMask));
+    EXPECT_CALL(
+        _freeRtosMock, xTaskNotifyWait(0U, 7U, NotNull(), TestBindingMock::WAIT_EVENTS_TICK_COUNT))
+        .InSequence(seq)
+        .WillOnce(DoAll(CopyArgPointee2(&eventMask), Return(true)));
+    osTaskFunction(&cut);
+}
+
 /**
  * \refs: SMD_asyncFreeRtos_TaskContextAsyncApi
  * \desc: To test task schedule at fixedrate functionality
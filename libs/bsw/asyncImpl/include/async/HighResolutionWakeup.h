@@ -0,0 +1,179 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup async
+ */
+#pragma once
+
+#include "async/Types.h"
+
+#include <bsp/timer/IOneShotTimer.h>
+#include <bsp/timer/SystemTimer.h>
+#include <etl/array.h>
+#include <etl/delegate.h>
+#include <etl/span.h>
+
+namespace async
+{
+/**
+ * Wakes up task contexts at the exact time of their next timeout instead of at the next RTOS
+ * tick. All contexts share a single one-shot timer that is programmed with the earliest
+ * requested wakeup. On expiry the wakeup function is called for each context whose wakeup is
+ * due, it is expected to set the timer event of the context.
+ *
+ * The task contexts call setWakeup() through a StaticWakeupHook before they wait. A context that
+ * is woken up by another event keeps its wakeup, which then only causes a spurious timer event.
+ *
+ * \tparam Lock The lock protecting the wakeup times against the contexts and the timer.
+ */
+template<class Lock>
+class HighResolutionWakeup : public ::bsp::IOneShotTimerListener
+{
+public:
+    using WakeupFunctionType = ::etl::delegate<void(ContextType)>;
+
+    /**
+     * \param wakeupTimes Storage of the wakeup time of each context, at most 32 contexts.
+     * \param timer The one-shot timer shared by all contexts.
+     * \param wakeup The function that sets the timer event of a context.
+     */
+    HighResolutionWakeup(
+        ::etl::span<uint32_t> wakeupTimes,
+        ::bsp::IOneShotTimer& timer,
+        WakeupFunctionType wakeup);
+
+    /**
+     * Requests a wakeup of a context.
+     * \param context The context to wake up.
+     * \param timeUs The absolute time in the time base of getSystemTimeUs32Bit().
+     */
+    void setWakeup(ContextType context, uint32_t timeUs);
+
+    /// Withdraws the wakeup requested for a context.
+    void clearWakeup(ContextType context);
+
+    /// Calls the wakeup function for all due contexts and programs the next wakeup.
+    void expired() override;
+
+private:
+    static bool isBefore(uint32_t timeUs, uint32_t otherTimeUs);
+
+    ::etl::span<uint32_t> _wakeupTimes;
+    ::bsp::IOneShotTimer& _timer;
+    WakeupFunctionType _wakeup;
+    uint32_t _pendingMask;
+    uint32_t _programmedTime;
+    bool _isProgrammed;
+};
+
+namespace declare
+{
+/**
+ * HighResolutionWakeup with storage for ContextCount contexts.
+ */
+template<size_t ContextCount, class Lock>
+class HighResolutionWakeup : public ::async::HighResolutionWakeup<Lock>
+{
+    static_assert(ContextCount <= 32U, "wakeups are tracked in a 32 bit mask");
+
+public:
+    using WakeupFunctionType = typename ::async::HighResolutionWakeup<Lock>::WakeupFunctionType;
+
+    HighResolutionWakeup(::bsp::IOneShotTimer& timer, WakeupFunctionType const wakeup)
+    : ::async::HighResolutionWakeup<Lock>(_wakeupTimes, timer, wakeup), _wakeupTimes()
+    {}
+
+private:
+    ::etl::array<uint32_t, ContextCount> _wakeupTimes;
+};
+
+} // namespace declare
+
+/**
+ * Inline implementation.
+ */
+template<class Lock>
+HighResolutionWakeup<Lock>::HighResolutionWakeup(
+    ::etl::span<uint32_t> const wakeupTimes,
+    ::bsp::IOneShotTimer& timer,
+    WakeupFunctionType const wakeup)
+: _wakeupTimes(wakeupTimes)
+, _timer(timer)
+, _wakeup(wakeup)
+, _pendingMask(0U)
+, _programmedTime(0U)
+, _isProgrammed(false)
+{
+    _timer.setListener(*this);
+}
+
+template<class Lock>
+void HighResolutionWakeup<Lock>::setWakeup(ContextType const context, uint32_t const timeUs)
+{
+    Lock const lock;
+    size_t const idx  = static_cast<size_t>(context);
+    _wakeupTimes[idx] = timeUs;
+    _pendingMask |= (1U << idx);
+    // a later wakeup than the programmed one is programmed when the timer expires
+    if ((!_isProgrammed) || isBefore(timeUs, _programmedTime))
+    {
+        _programmedTime = timeUs;
+        _isProgrammed   = true;
+        _timer.start(timeUs);
+    }
+}
+
+template<class Lock>
+void HighResolutionWakeup<Lock>::clearWakeup(ContextType const context)
+{
+    Lock const lock;
+    _pendingMask &= ~(1U << static_cast<size_t>(context));
+}
+
+template<class Lock>
+void HighResolutionWakeup<Lock>::expired()
+{
+    uint32_t dueMask = 0U;
+    {
+        Lock const lock;
+        uint32_t const nowUs = getSystemTimeUs32Bit();
+        _isProgrammed        = false;
+        for (size_t idx = 0U; idx < _wakeupTimes.size(); ++idx)
+        {
+            uint32_t const mask = 1U << idx;
+            if ((_pendingMask & mask) == 0U)
+            {
+                continue;
+            }
+            if (!isBefore(nowUs, _wakeupTimes[idx]))
+            {
+                dueMask |= mask;
+            }
+            else if ((!_isProgrammed) || isBefore(_wakeupTimes[idx], _programmedTime))
+            {
+                _programmedTime = _wakeupTimes[idx];
+                _isProgrammed   = true;
+            }
+        }
+        _pendingMask &= ~dueMask;
+        if (_isProgrammed)
+        {
+            _timer.start(_programmedTime);
+        }
+    }
+    for (size_t idx = 0U; dueMask != 0U; ++idx, dueMask >>= 1U)
+    {
+        if ((dueMask & 1U) != 0U)
+        {
+            _wakeup(static_cast<ContextType>(idx));
+        }
+    }
+}
+
+template<class Lock>
+inline bool HighResolutionWakeup<Lock>::isBefore(uint32_t const timeUs, uint32_t const otherTimeUs)
+{
+    return static_cast<int32_t>(timeUs - otherTimeUs) < 0;
+}
+
+} // namespace async
@@ -6,6 +6,10 @@
 #pragma once
 
 #include "async/Queue.h"
+#include "async/RunnableHook.h"
+
+#include <bsp/timer/SystemTimer.h>
+#include <etl/array.h>
 
 #include <platform/config.h>
 
@@ -15,14 +19,37 @@ namespace async
  * A template class that enables the enqueuing and execution of Runnables. It leverages an
  * EventPolicy, making it suitable for event-driven applications.
  *
+ * Runnables are held in LaneCount intrusive queues, the lanes. A runnable is placed in a lane
+ * when it is enqueued, lanes with a higher index are executed first. Runnables of the same lane
+ * are executed in the order they were enqueued. After each runnable the lanes are checked
+ * again, so a runnable of a higher lane waits at most for the runnable currently executed.
+ *
+ * Each lane can be given a time budget. Once the runnables of a lane have been executed for
+ * longer than the budget within one call of the event handler, the executor sets its event again
+ * and returns, so that the other events of the context are handled before the remaining
+ * runnables are executed.
+ *
  * \tparam Runnable Type of functions, that will be executed.
  * \tparam EventPolicy EventPolicy is derived from EventDispatcher. Method enqueue will set Event,
  * specified in EventPolicy.
+ * \tparam Lock Lock protecting the queue.
+ * \tparam Hook Static hook that is notified when a runnable is enqueued and around its execution,
+ * e.g. to account the execution time per runnable. The default NoRunnableHook adds no overhead.
+ * \tparam LaneCount Number of lanes. The default single lane executes all runnables in order.
  */
-template<typename Runnable, typename EventPolicy, typename Lock>
+template<
+    typename Runnable,
+    typename EventPolicy,
+    typename Lock,
+    typename Hook    = NoRunnableHook,
+    size_t LaneCount = 1U>
 class RunnableExecutor
 {
+    static_assert(LaneCount > 0U, "at least one lane is required");
+
 public:
+    static size_t const LANE_COUNT = LaneCount;
+
     explicit RunnableExecutor(typename EventPolicy::EventDispatcherType& eventDispatcher);
 
     void init();
@@ -33,71 +60,121 @@ public:
      * handleEvents is called on the EventDispatcher, all Runnables in the queue are executed
      * sequentially, and the queue is emptied.
      * \param runnable Runnable to be executed
+     * \param lane Lane of the runnable, a lane beyond the last one selects the last lane. A
+     * runnable that is already enqueued keeps its lane.
+     */
+    void enqueue(Runnable& runnable, size_t lane = 0U);
+
+    /**
+     * Sets the time budget of a lane.
+     * \param lane Lane to set the budget for, a lane beyond the last one selects the last lane
+     * \param budgetUs Time in microseconds after which the executor yields, 0 for no budget
      */
-    void enqueue(Runnable& runnable);
+    void setLaneBudget(size_t lane, uint32_t budgetUs);
 
 private:
     void handleEvent();
 
-    Queue<Runnable> _queue;
+    Runnable* dequeue(size_t& lane);
+
+    ::etl::array<Queue<Runnable>, LaneCount> _queues;
+    ::etl::array<uint32_t, LaneCount> _budgetsUs;
     EventPolicy _eventPolicy;
 };
 
 /**
  * Inline implementations.
  */
-template<typename Runnable, typename EventPolicy, typename Lock>
-RunnableExecutor<Runnable, EventPolicy, Lock>::RunnableExecutor(
+template<typename Runnable, typename EventPolicy, typename Lock, typename Hook, size_t LaneCount>
+RunnableExecutor<Runnable, EventPolicy, Lock, Hook, LaneCount>::RunnableExecutor(
     typename EventPolicy::EventDispatcherType& eventDispatcher)
-: _queue(), _eventPolicy(eventDispatcher)
+: _queues(), _budgetsUs(), _eventPolicy(eventDispatcher)
 {}
 
-template<typename Runnable, typename EventPolicy, typename Lock>
-void RunnableExecutor<Runnable, EventPolicy, Lock>::init()
+template<typename Runnable, typename EventPolicy, typename Lock, typename Hook, size_t LaneCount>
+void RunnableExecutor<Runnable, EventPolicy, Lock, Hook, LaneCount>::init()
 {
     _eventPolicy.setEventHandler(
         EventPolicy::HandlerFunctionType::
             template create<RunnableExecutor, &RunnableExecutor::handleEvent>(*this));
 }
 
-template<typename Runnable, typename EventPolicy, typename Lock>
-void RunnableExecutor<Runnable, EventPolicy, Lock>::shutdown()
+template<typename Runnable, typename EventPolicy, typename Lock, typename Hook, size_t LaneCount>
+void RunnableExecutor<Runnable, EventPolicy, Lock, Hook, LaneCount>::shutdown()
 {
     _eventPolicy.removeEventHandler();
 }
 
-template<typename Runnable, typename EventPolicy, typename Lock>
-inline void RunnableExecutor<Runnable, EventPolicy, Lock>::enqueue(Runnable& runnable)
+template<typename Runnable, typename EventPolicy, typename Lock, typename Hook, size_t LaneCount>
+inline void RunnableExecutor<Runnable, EventPolicy, Lock, Hook, LaneCount>::enqueue(
+    Runnable& runnable, size_t const lane)
 {
     {
         ESR_UNUSED const Lock lock;
         if (!runnable.isEnqueued())
         {
-            _queue.enqueue(runnable);
+            Hook::enqueueRunnable(runnable);
+            _queues[(lane < LaneCount) ? lane : (LaneCount - 1U)].enqueue(runnable);
         }
     }
     _eventPolicy.setEvent();
 }
 
-template<typename Runnable, typename EventPolicy, typename Lock>
-void RunnableExecutor<Runnable, EventPolicy, Lock>::handleEvent()
+template<typename Runnable, typename EventPolicy, typename Lock, typename Hook, size_t LaneCount>
+inline void RunnableExecutor<Runnable, EventPolicy, Lock, Hook, LaneCount>::setLaneBudget(
+    size_t const lane, uint32_t const budgetUs)
+{
+    _budgetsUs[(lane < LaneCount) ? lane : (LaneCount - 1U)] = budgetUs;
+}
+
+template<typename Runnable, typename EventPolicy, typename Lock, typename Hook, size_t LaneCount>
+void RunnableExecutor<Runnable, EventPolicy, Lock, Hook, LaneCount>::handleEvent()
 {
+    ::etl::array<uint32_t, LaneCount> usedUs{};
     while (true)
     {
         Runnable* runnable;
+        size_t lane = 0U;
         {
             ESR_UNUSED const Lock lock;
-            runnable = _queue.dequeue();
+            runnable = dequeue(lane);
         }
-        if (runnable != nullptr)
+        if (runnable == nullptr)
         {
-            runnable->execute();
+            break;
         }
-        else
+        uint32_t const budgetUs = _budgetsUs[lane];
+        uint32_t const startUs  = (budgetUs != 0U) ? getSystemTimeUs32Bit() : 0U;
+        Hook::enterRunnable(*runnable);
+        runnable->execute();
+        Hook::leaveRunnable(*runnable);
+        if (budgetUs != 0U)
         {
-            break;
+            usedUs[lane] += getSystemTimeUs32Bit() - startUs;
+            if (usedUs[lane] >= budgetUs)
+            {
+                // yield to the other events of the context, the remaining runnables follow
+                _eventPolicy.setEvent();
+                break;
+            }
+        }
+    }
+}
+
+template<typename Runnable, typename EventPolicy, typename Lock, typename Hook, size_t LaneCount>
+inline Runnable*
+RunnableExecutor<Runnable, EventPolicy, Lock, Hook, LaneCount>::dequeue(size_t& lane)
+{
+    for (lane = LaneCount; lane > 0U;)
+    {
+        --lane;
+        Runnable* const runnable = _queues[lane].dequeue();
+        if (runnable != nullptr)
+        {
+            return runnable;
         }
     }
+    return nullptr;
 }
 
 } // namespace async
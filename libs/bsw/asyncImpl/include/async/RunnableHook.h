@@ -0,0 +1,30 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup async
+ */
+#pragma once
+
+namespace async
+{
+/**
+ * Runnable hook that doesn't record anything. It is the default hook of RunnableExecutor, all
+ * functions are empty so that calling them compiles to nothing.
+ *
+ * A hook that records the execution of runnables provides the same static functions:
+ * - enqueueRunnable() is called when a runnable is placed in the queue of an executor.
+ * - enterRunnable() and leaveRunnable() are called right before and after a runnable is executed.
+ */
+struct NoRunnableHook
+{
+    template<typename Runnable>
+    static void enqueueRunnable(Runnable const&) {}
+
+    template<typename Runnable>
+    static void enterRunnable(Runnable const&) {}
+
+    template<typename Runnable>
+    static void leaveRunnable(Runnable const&) {}
+};
+
+} // namespace async
@@ -0,0 +1,62 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup async
+ */
+#pragma once
+
+#include <etl/singleton_base.h>
+
+namespace async
+{
+/**
+ * Runnable hook that forwards the static hook functions to the single instance of T, e.g. a
+ * ::runtime::RunnableRuntimeMonitor. It can be provided as RunnableHookType by an async binding.
+ *
+ * \tparam T The underlying type with enqueueRunnable(), enterRunnable() and leaveRunnable().
+ */
+template<class T>
+class StaticRunnableHook : public ::etl::singleton_base<T>
+{
+public:
+    using InstanceType = T;
+
+    explicit StaticRunnableHook(T& instance);
+
+    template<typename Runnable>
+    static void enqueueRunnable(Runnable const& runnable);
+    template<typename Runnable>
+    static void enterRunnable(Runnable const& runnable);
+    template<typename Runnable>
+    static void leaveRunnable(Runnable const& runnable);
+};
+
+/**
+ * Inline implementation.
+ */
+template<class T>
+StaticRunnableHook<T>::StaticRunnableHook(T& instance) : ::etl::singleton_base<T>(instance)
+{}
+
+template<class T>
+template<typename Runnable>
+inline void StaticRunnableHook<T>::enqueueRunnable(Runnable const& runnable)
+{
+    ::etl::singleton_base<T>::instance().enqueueRunnable(runnable);
+}
+
+template<class T>
+template<typename Runnable>
+inline void StaticRunnableHook<T>::enterRunnable(Runnable const& runnable)
+{
+    ::etl::singleton_base<T>::instance().enterRunnable(runnable);
+}
+
+template<class T>
+template<typename Runnable>
+inline void StaticRunnableHook<T>::leaveRunnable(Runnable const& runnable)
+{
+    ::etl::singleton_base<T>::instance().leaveRunnable(runnable);
+}
+
+} // namespace async
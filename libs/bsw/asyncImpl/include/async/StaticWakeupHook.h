@@ -0,0 +1,51 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup async
+ */
+#pragma once
+
+#include "async/Types.h"
+
+#include <etl/singleton_base.h>
+
+namespace async
+{
+/**
+ * Wakeup hook that forwards the static hook functions to the single instance of T, e.g. a
+ * HighResolutionWakeup. It can be provided as WakeupHookType by an async binding.
+ *
+ * \tparam T The underlying type with setWakeup() and clearWakeup().
+ */
+template<class T>
+class StaticWakeupHook : public ::etl::singleton_base<T>
+{
+public:
+    using InstanceType = T;
+
+    explicit StaticWakeupHook(T& instance);
+
+    static void setWakeup(ContextType context, uint32_t timeUs);
+    static void clearWakeup(ContextType context);
+};
+
+/**
+ * Inline implementation.
+ */
+template<class T>
+StaticWakeupHook<T>::StaticWakeupHook(T& instance) : ::etl::singleton_base<T>(instance)
+{}
+
+template<class T>
+inline void StaticWakeupHook<T>::setWakeup(ContextType const context, uint32_t const timeUs)
+{
+    ::etl::singleton_base<T>::instance().setWakeup(context, timeUs);
+}
+
+template<class T>
+inline void StaticWakeupHook<T>::clearWakeup(ContextType const context)
+{
+    ::etl::singleton_base<T>::instance().clearWakeup(context);
+}
+
+} // namespace async
@@ -0,0 +1,28 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup async
+ */
+#pragma once
+
+#include "async/Types.h"
+
+namespace async
+{
+/**
+ * Wakeup hook that doesn't request any wakeups. It is the default wakeup hook of the task
+ * contexts, which then wake up for timeouts with the granularity of the RTOS tick.
+ *
+ * A hook that provides high resolution wakeups provides the same static functions:
+ * - setWakeup() is called by a context before it waits, with the absolute time in microseconds
+ *   of its next timeout. The hook sets the timer event of the context at this time.
+ * - clearWakeup() is called by a context that has no timeout to wait for.
+ */
+struct NoWakeupHook
+{
+    static void setWakeup(ContextType, uint32_t) {}
+
+    static void clearWakeup(ContextType) {}
+};
+
+} // namespace async
@@ -0,0 +1,165 @@
+// Copyright 2025 Accenture.
+
+#include "async/HighResolutionWakeup.h"
+
+#include "async/StaticWakeupHook.h"
+
+#include <bsp/timer/OneShotTimerMock.h>
+#include <bsp/timer/SystemTimerMock.h>
+#include <etl/memory.h>
+
+#include <gmock/gmock.h>
+
+namespace
+{
+using namespace ::async;
+using namespace ::testing;
+
+struct TestLock
+{
+    TestLock() {}
+
+    ~TestLock() {}
+};
+
+ACTION_P(SaveArgAddress, pointer) { *pointer = &arg0; }
+
+using CutType = ::async::declare::HighResolutionWakeup<4U, TestLock>;
+
+class HighResolutionWakeupTest : public Test
+{
+public:
+    HighResolutionWakeupTest()
+    {
+        EXPECT_CALL(_timerMock, setListener(_)).WillOnce(SaveArgAddress(&_listener));
+        _cut.create(
+            _timerMock,
+            CutType::WakeupFunctionType::
+                create<HighResolutionWakeupTest, &HighResolutionWakeupTest::wakeup>(*this));
+        Mock::VerifyAndClearExpectations(&_timerMock);
+        EXPECT_CALL(_systemTimerMock, getSystemTimeUs32Bit()).WillRepeatedly(ReturnPointee(&_now));
+    }
+
+    MOCK_METHOD(void, wakeup, (ContextType context));
+
+protected:
+    StrictMock<::bsp::OneShotTimerMock> _timerMock;
+    StrictMock<SystemTimerMock> _systemTimerMock;
+    ::bsp::IOneShotTimerListener* _listener = nullptr;
+    ::etl::typed_storage<CutType> _cut;
+    uint32_t _now = 1000U;
+};
+
+TEST_F(HighResolutionWakeupTest, testConstructorSetsListener)
+{
+    EXPECT_EQ(&*_cut, _listener);
+}
+
+TEST_F(HighResolutionWakeupTest, testTimerIsProgrammedWithEarliestWakeup)
+{
+    EXPECT_CALL(_timerMock, start(1500U));
+    _cut->setWakeup(1U, 1500U);
+    // a later wakeup doesn't change the programmed time
+    _cut->setWakeup(2U, 1600U);
+    Mock::VerifyAndClearExpectations(&_timerMock);
+    // an earlier one does
+    EXPECT_CALL(_timerMock, start(1100U));
+    _cut->setWakeup(3U, 1100U);
+}
+
+TEST_F(HighResolutionWakeupTest, testExpiredWakesDueContextsAndProgramsNextWakeup)
+{
+    EXPECT_CALL(_timerMock, start(_)).Times(AnyNumber());
+    _cut->setWakeup(0U, 1100U);
+    _cut->setWakeup(1U, 1200U);
+    _cut->setWakeup(2U, 1100U);
+    _cut->setWakeup(3U, 1300U);
+    Mock::VerifyAndClearExpectations(&_timerMock);
+
+    _now = 1100U;
+    EXPECT_CALL(_timerMock, start(1200U));
+    EXPECT_CALL(*this, wakeup(0U));
+    EXPECT_CALL(*this, wakeup(2U));
+    _listener->expired();
+    Mock::VerifyAndClearExpectations(this);
+    Mock::VerifyAndClearExpectations(&_timerMock);
+
+    // a late expiry wakes all overdue contexts
+    _now = 1400U;
+    EXPECT_CALL(*this, wakeup(1U));
+    EXPECT_CALL(*this, wakeup(3U));
+    _listener->expired();
+    Mock::VerifyAndClearExpectations(this);
+
+    // the wakeups are consumed
+    _listener->expired();
+}
+
+TEST_F(HighResolutionWakeupTest, testSpuriousExpiryReprogramsPendingWakeup)
+{
+    EXPECT_CALL(_timerMock, start(1200U)).Times(2);
+    _cut->setWakeup(1U, 1200U);
+    _now = 1190U;
+    _listener->expired();
+}
+
+TEST_F(HighResolutionWakeupTest, testClearedWakeupIsNotSignalled)
+{
+    EXPECT_CALL(_timerMock, start(1100U));
+    _cut->setWakeup(1U, 1100U);
+    _cut->clearWakeup(1U);
+    _now = 1100U;
+    _listener->expired();
+}
+
+TEST_F(HighResolutionWakeupTest, testMovedWakeupIsProgrammedOnExpiry)
+{
+    EXPECT_CALL(_timerMock, start(1100U));
+    _cut->setWakeup(1U, 1100U);
+    // a context woken up by another event waits for a later timeout
+    _cut->setWakeup(1U, 1500U);
+    Mock::VerifyAndClearExpectations(&_timerMock);
+
+    _now = 1100U;
+    EXPECT_CALL(_timerMock, start(1500U));
+    _listener->expired();
+    Mock::VerifyAndClearExpectations(&_timerMock);
+
+    _now = 1500U;
+    EXPECT_CALL(*this, wakeup(1U));
+    _listener->expired();
+}
+
+TEST_F(HighResolutionWakeupTest, testWakeupTimesWrapAround)
+{
+    _now = 0xFFFFFF00U;
+    EXPECT_CALL(_timerMock, start(0x00000100U));
+    _cut->setWakeup(1U, 0x00000100U);
+    Mock::VerifyAndClearExpectations(&_timerMock);
+    // before the wrap around
+    EXPECT_CALL(_timerMock, start(0xFFFFFFF0U));
+    _cut->setWakeup(2U, 0xFFFFFFF0U);
+    Mock::VerifyAndClearExpectations(&_timerMock);
+
+    _now = 0xFFFFFFF0U;
+    EXPECT_CALL(*this, wakeup(2U));
+    EXPECT_CALL(_timerMock, start(0x00000100U));
+    _listener->expired();
+    Mock::VerifyAndClearExpectations(this);
+
+    _now = 0x00000100U;
+    EXPECT_CALL(*this, wakeup(1U));
+    _listener->expired();
+}
+
+TEST_F(HighResolutionWakeupTest, testStaticWakeupHookForwardsToInstance)
+{
+    StaticWakeupHook<CutType> const hook(*_cut);
+    EXPECT_CALL(_timerMock, start(1100U));
+    StaticWakeupHook<CutType>::setWakeup(1U, 1100U);
+    StaticWakeupHook<CutType>::clearWakeup(1U);
+    _now = 1100U;
+    _listener->expired();
+}
+
+} // namespace
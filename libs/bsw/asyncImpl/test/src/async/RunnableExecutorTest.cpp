@@ -6,6 +6,7 @@
 #include "async/QueueNode.h"
 #include "async/RunnableMock.h"
 
+#include <bsp/timer/SystemTimerMock.h>
 #include <etl/delegate.h>
 
 #include <gmock/gmock.h>
@@ -37,6 +38,27 @@ struct TestLock
     ~TestLock() {}
 };
 
+class RunnableHookMock
+{
+public:
+    MOCK_METHOD(void, enqueueRunnable, (IRunnable const& runnable));
+    MOCK_METHOD(void, enterRunnable, (IRunnable const& runnable));
+    MOCK_METHOD(void, leaveRunnable, (IRunnable const& runnable));
+};
+
+struct TestHook
+{
+    static void enqueueRunnable(IRunnable const& runnable) { _mock->enqueueRunnable(runnable); }
+
+    static void enterRunnable(IRunnable const& runnable) { _mock->enterRunnable(runnable); }
+
+    static void leaveRunnable(IRunnable const& runnable) { _mock->leaveRunnable(runnable); }
+
+    static RunnableHookMock* _mock;
+};
+
+RunnableHookMock* TestHook::_mock = nullptr;
+
 TEST_F(RunnableExecutorTest, testAll)
 {
     RunnableExecutor<IRunnable, EventPolicy<RunnableExecutorTest, 2>, TestLock> cut(*this);
@@ -88,4 +110,144 @@ TEST_F(RunnableExecutorTest, testAll)
     }
 }
 
+TEST_F(RunnableExecutorTest, testHook)
+{
+    StrictMock<RunnableHookMock> hookMock;
+    TestHook::_mock = &hookMock;
+    RunnableExecutor<IRunnable, EventPolicy<RunnableExecutorTest, 2>, TestLock, TestHook> cut(
+        *this);
+    HandlerFunctionType eventHandler;
+    EXPECT_CALL(*this, setEventHandler(2U, _)).WillOnce(SaveArg<1>(&eventHandler));
+    cut.init();
+    {
+        // expect hook to be notified only if the runnable is placed in the queue
+        EXPECT_CALL(*this, setEvents(1U << 2U)).Times(3);
+        EXPECT_CALL(hookMock, enqueueRunnable(Ref(_runnableMock1)));
+        EXPECT_CALL(hookMock, enqueueRunnable(Ref(_runnableMock2)));
+        cut.enqueue(_runnableMock1);
+        cut.enqueue(_runnableMock2);
+        cut.enqueue(_runnableMock1);
+        Mock::VerifyAndClearExpectations(this);
+        Mock::VerifyAndClearExpectations(&hookMock);
+    }
+    {
+        // expect hook to be notified around the execution of each runnable
+        Sequence seq;
+        EXPECT_CALL(hookMock, enterRunnable(Ref(_runnableMock1))).InSequence(seq);
+        EXPECT_CALL(_runnableMock1, execute()).InSequence(seq);
+        EXPECT_CALL(hookMock, leaveRunnable(Ref(_runnableMock1))).InSequence(seq);
+        EXPECT_CALL(hookMock, enterRunnable(Ref(_runnableMock2))).InSequence(seq);
+        EXPECT_CALL(_runnableMock2, execute()).InSequence(seq);
+        EXPECT_CALL(hookMock, leaveRunnable(Ref(_runnableMock2))).InSequence(seq);
+        eventHandler();
+        Mock::VerifyAndClearExpectations(&hookMock);
+    }
+    TestHook::_mock = nullptr;
+}
+
+TEST_F(RunnableExecutorTest, testLanes)
+{
+    RunnableExecutor<IRunnable, EventPolicy<RunnableExecutorTest, 2>, TestLock, NoRunnableHook, 3U>
+        cut(*this);
+    HandlerFunctionType eventHandler;
+    EXPECT_CALL(*this, setEventHandler(2U, _)).WillOnce(SaveArg<1>(&eventHandler));
+    cut.init();
+    StrictMock<RunnableMock> runnableMock4;
+    EXPECT_CALL(*this, setEvents(1U << 2U)).Times(AnyNumber());
+    {
+        // expect higher lanes to be executed first and each lane in order, a lane beyond the
+        // last one selects the last lane
+        cut.enqueue(_runnableMock1);
+        cut.enqueue(_runnableMock2, 1U);
+        cut.enqueue(_runnableMock3);
+        cut.enqueue(runnableMock4, 5U);
+        Sequence seq;
+        EXPECT_CALL(runnableMock4, execute()).InSequence(seq);
+        EXPECT_CALL(_runnableMock2, execute()).InSequence(seq);
+        EXPECT_CALL(_runnableMock1, execute()).InSequence(seq);
+        EXPECT_CALL(_runnableMock3, execute()).InSequence(seq);
+        eventHandler();
+        Mock::VerifyAndClearExpectations(&_runnableMock1);
+    }
+    {
+        // expect a runnable of a higher lane that is enqueued while executing to be executed next,
+        // and an enqueued runnable to keep its lane
+        cut.enqueue(_runnableMock1);
+        cut.enqueue(_runnableMock2);
+        cut.enqueue(_runnableMock2, 2U);
+        Sequence seq;
+        EXPECT_CALL(_runnableMock1, execute())
+            .InSequence(seq)
+            .WillOnce(Invoke([&cut, this]() { cut.enqueue(_runnableMock3, 2U); }));
+        EXPECT_CALL(_runnableMock3, execute()).InSequence(seq);
+        EXPECT_CALL(_runnableMock2, execute()).InSequence(seq);
+        eventHandler();
+    }
+}
+
+TEST_F(RunnableExecutorTest, testLaneBudget)
+{
+    StrictMock<SystemTimerMock> systemTimerMock;
+    uint32_t now = 1000U;
+    EXPECT_CALL(systemTimerMock, getSystemTimeUs32Bit()).WillRepeatedly(ReturnPointee(&now));
+    RunnableExecutor<IRunnable, EventPolicy<RunnableExecutorTest, 2>, TestLock, NoRunnableHook, 2U>
+        cut(*this);
+    HandlerFunctionType eventHandler;
+    EXPECT_CALL(*this, setEventHandler(2U, _)).WillOnce(SaveArg<1>(&eventHandler));
+    cut.init();
+    cut.setLaneBudget(0U, 100U);
+    EXPECT_CALL(*this, setEvents(1U << 2U)).Times(3);
+    cut.enqueue(_runnableMock1);
+    cut.enqueue(_runnableMock2);
+    cut.enqueue(_runnableMock3);
+    Mock::VerifyAndClearExpectations(this);
+    {
+        // expect the executor to yield with its event set once the budget of the lane is used up
+        Sequence seq;
+        EXPECT_CALL(_runnableMock1, execute()).InSequence(seq).WillOnce(Assign(&now, 1060U));
+        EXPECT_CALL(_runnableMock2, execute()).InSequence(seq).WillOnce(Assign(&now, 1120U));
+        EXPECT_CALL(*this, setEvents(1U << 2U)).InSequence(seq);
+        eventHandler();
+        Mock::VerifyAndClearExpectations(this);
+        Mock::VerifyAndClearExpectations(&_runnableMock3);
+    }
+    {
+        // expect the budget to be renewed with the next event, lanes without budget don't yield
+        EXPECT_CALL(*this, setEvents(1U << 2U)).Times(2);
+        cut.enqueue(_runnableMock1, 1U);
+        cut.enqueue(_runnableMock2, 1U);
+        Sequence seq;
+        EXPECT_CALL(_runnableMock1, execute()).InSequence(seq).WillOnce(Assign(&now, 1500U));
+        EXPECT_CALL(_runnableMock2, execute()).InSequence(seq).WillOnce(Assign(&now, 2000U));
+        EXPECT_CALL(_runnableMock3, execute()).InSequence(seq).WillOnce(Assign(&now, 2050U));
+        eventHandler();
+    }
+}
+
+TEST_F(RunnableExecutorTest, testLaneBudgetBeyondLastLane)
+{
+    StrictMock<SystemTimerMock> systemTimerMock;
+    uint32_t now = 1000U;
+    EXPECT_CALL(systemTimerMock, getSystemTimeUs32Bit()).WillRepeatedly(ReturnPointee(&now));
+    RunnableExecutor<IRunnable, EventPolicy<RunnableExecutorTest, 2>, TestLock, NoRunnableHook, 2U>
+        cut(*this);
+    HandlerFunctionType eventHandler;
+    EXPECT_CALL(*this, setEventHandler(2U, _)).WillOnce(SaveArg<1>(&eventHandler));
+    cut.init();
+    // expect the budget of a lane beyond the last one to be set for the last lane
+    cut.setLaneBudget(5U, 100U);
+    EXPECT_CALL(*this, setEvents(1U << 2U)).Times(2);
+    cut.enqueue(_runnableMock1, 1U);
+    cut.enqueue(_runnableMock2, 1U);
+    Mock::VerifyAndClearExpectations(this);
+    Sequence seq;
+    EXPECT_CALL(_runnableMock1, execute()).InSequence(seq).WillOnce(Assign(&now, 1100U));
+    EXPECT_CALL(*this, setEvents(1U << 2U)).InSequence(seq);
+    eventHandler();
+    Mock::VerifyAndClearExpectations(this);
+    Mock::VerifyAndClearExpectations(&_runnableMock2);
+    EXPECT_CALL(_runnableMock2, execute());
+    eventHandler();
+}
+
 } // namespace
@@ -0,0 +1,215 @@
+// Copyright 2025 Accenture.
+
+#include <async/TaskContext.h>
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace
+{
+using namespace ::async;
+
+struct BenchmarkBinding
+{};
+
+using TaskContextType = TaskContext<BenchmarkBinding>;
+
+size_t const JOB_COUNT    = 1000U;
+uint32_t const JOB_ROUNDS = 2000U;
+
+/**
+ * Signals the benchmark thread once all contexts have finished their jobs.
+ */
+class Completion
+{
+public:
+    void reset(uint32_t const count) { _pending.store(count); }
+
+    void done()
+    {
+        if (_pending.fetch_sub(1U) == 1U)
+        {
+            internal::futexWake(_pending, 1);
+        }
+    }
+
+    void wait()
+    {
+        uint32_t pending = _pending.load();
+        while (pending != 0U)
+        {
+            (void)internal::futexWait(_pending, pending, nullptr);
+            pending = _pending.load();
+        }
+    }
+
+private:
+    ::std::atomic<uint32_t> _pending{0U};
+};
+
+/**
+ * A CPU-bound job like a cyclic runnable of the reference application. It executes itself again
+ * in its context until JOB_COUNT jobs are done, so other runnables of the context can interleave.
+ */
+class JobRunnable : public RunnableType
+{
+public:
+    JobRunnable(TaskContextType& context, Completion& completion)
+    : _context(context), _completion(completion)
+    {}
+
+    void start()
+    {
+        _remaining = JOB_COUNT;
+        _context.execute(*this);
+    }
+
+    void execute() override
+    {
+        for (uint32_t i = 0U; i < JOB_ROUNDS; ++i)
+        {
+            _value = (_value * 1103515245U) + 12345U;
+        }
+        benchmark::DoNotOptimize(_value);
+        --_remaining;
+        if (_remaining > 0U)
+        {
+            _context.execute(*this);
+        }
+        else
+        {
+            _completion.done();
+        }
+    }
+
+private:
+    TaskContextType& _context;
+    Completion& _completion;
+    size_t _remaining = 0U;
+    uint32_t _value   = 1U;
+};
+
+/**
+ * Executes runnables of two contexts alternately, each one executing the other's.
+ */
+class PingPongRunnable : public RunnableType
+{
+public:
+    PingPongRunnable(TaskContextType& context, Completion& completion)
+    : _context(context), _completion(completion)
+    {}
+
+    void start(size_t const count, PingPongRunnable& peer)
+    {
+        _peer      = &peer;
+        peer._peer = this;
+        _remaining = count;
+        _context.execute(*this);
+    }
+
+    void execute() override
+    {
+        if (_remaining == 0U)
+        {
+            _completion.done();
+        }
+        else
+        {
+            --_remaining;
+            _peer->_remaining = _remaining;
+            _peer->_context.execute(*_peer);
+        }
+    }
+
+private:
+    TaskContextType& _context;
+    Completion& _completion;
+    PingPongRunnable* _peer = nullptr;
+    size_t _remaining       = 0U;
+};
+
+std::vector<std::unique_ptr<TaskContextType>> startContexts(size_t const count)
+{
+    cpu_set_t allowed;
+    (void)sched_getaffinity(0, sizeof(allowed), &allowed);
+    size_t const cpuCount = static_cast<size_t>(CPU_COUNT(&allowed));
+    std::vector<std::unique_ptr<TaskContextType>> contexts;
+    for (size_t i = 0U; i < count; ++i)
+    {
+        contexts.emplace_back(new TaskContextType());
+        // one context per CPU as long as there are enough of them
+        uint32_t const cpuMask = (count <= cpuCount) ? (1U << i) : 0U;
+        contexts[i]->initTask(
+            static_cast<ContextType>(i),
+            "bench",
+            0U,
+            TaskConfig{cpuMask, 0U},
+            TaskContextType::TaskFunctionType());
+        (void)contexts[i]->startThread();
+    }
+    return contexts;
+}
+
+void stopContexts(std::vector<std::unique_ptr<TaskContextType>>& contexts)
+{
+    for (auto& context : contexts)
+    {
+        context->stopDispatch();
+        context->joinThread();
+    }
+}
+} // namespace
+
+/**
+ * Runs JOB_COUNT jobs in each of state.range(0) contexts. With the contexts running in parallel
+ * threads, the jobs per second scale with the number of CPUs.
+ */
+void BM_contexts_parallel_jobs(benchmark::State& state)
+{
+    size_t const contextCount = static_cast<size_t>(state.range(0));
+    auto contexts             = startContexts(contextCount);
+    Completion completion;
+    std::vector<JobRunnable> jobs;
+    for (auto& context : contexts)
+    {
+        jobs.emplace_back(*context, completion);
+    }
+    while (state.KeepRunning())
+    {
+        completion.reset(static_cast<uint32_t>(contextCount));
+        for (JobRunnable& job : jobs)
+        {
+            job.start();
+        }
+        completion.wait();
+    }
+    state.SetItemsProcessed(
+        static_cast<int64_t>(state.iterations() * contextCount * JOB_COUNT));
+    stopContexts(contexts);
+}
+
+/**
+ * Measures the latency of executing a runnable in another context, the peer thread sleeping on
+ * its futex in between.
+ */
+void BM_contexts_ping_pong(benchmark::State& state)
+{
+    size_t const roundTrips = 1000U;
+    auto contexts           = startContexts(2U);
+    Completion completion;
+    PingPongRunnable ping(*contexts[0], completion);
+    PingPongRunnable pong(*contexts[1], completion);
+    while (state.KeepRunning())
+    {
+        completion.reset(1U);
+        ping.start(2U * roundTrips, pong);
+        completion.wait();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * 2U * roundTrips));
+    stopContexts(contexts);
+}
+
+BENCHMARK(BM_contexts_parallel_jobs)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+BENCHMARK(BM_contexts_ping_pong)->UseRealTime();
@@ -0,0 +1,112 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup async
+ */
+#pragma once
+
+#include "async/Futex.h"
+
+namespace async
+{
+namespace internal
+{
+/**
+ * Recursive lock shared by all threads of the process. It takes the role that suspending all
+ * interrupts has on a single core: Lock, ModifiableLock and the posix implementation of
+ * suspendResumeAllInterrupts all enter this section, so code protected by either of them is
+ * mutually exclusive across all contexts.
+ *
+ * Entering a free section costs a single compare-and-swap, threads that find it taken sleep on
+ * a futex until it is left.
+ */
+class CriticalSection
+{
+public:
+    static void enter();
+    static void leave();
+
+    /// \return true if the calling thread is within the section
+    static bool isEntered();
+
+private:
+    enum : uint32_t
+    {
+        FREE      = 0U,
+        TAKEN     = 1U,
+        CONTENDED = 2U
+    };
+
+    // static data of a header only class
+    template<class T = void>
+    struct State
+    {
+        static ::std::atomic<uint32_t> _word;
+        static ::std::atomic<uintptr_t> _owner;
+        static uint32_t _depth;
+    };
+
+    static uintptr_t getThreadId();
+};
+
+/**
+ * Inline implementations.
+ */
+template<class T>
+::std::atomic<uint32_t> CriticalSection::State<T>::_word{FREE};
+template<class T>
+::std::atomic<uintptr_t> CriticalSection::State<T>::_owner{0U};
+template<class T>
+uint32_t CriticalSection::State<T>::_depth = 0U;
+
+inline uintptr_t CriticalSection::getThreadId()
+{
+    static thread_local char const marker = 0;
+    return reinterpret_cast<uintptr_t>(&marker);
+}
+
+inline void CriticalSection::enter()
+{
+    uintptr_t const threadId = getThreadId();
+    if (State<>::_owner.load(::std::memory_order_relaxed) == threadId)
+    {
+        ++State<>::_depth;
+        return;
+    }
+    uint32_t word = FREE;
+    if (!State<>::_word.compare_exchange_strong(word, TAKEN, ::std::memory_order_acquire))
+    {
+        if (word != CONTENDED)
+        {
+            word = State<>::_word.exchange(CONTENDED, ::std::memory_order_acquire);
+        }
+        while (word != FREE)
+        {
+            (void)futexWait(State<>::_word, CONTENDED, nullptr);
+            word = State<>::_word.exchange(CONTENDED, ::std::memory_order_acquire);
+        }
+    }
+    State<>::_owner.store(threadId, ::std::memory_order_relaxed);
+    State<>::_depth = 1U;
+}
+
+inline void CriticalSection::leave()
+{
+    --State<>::_depth;
+    if (State<>::_depth == 0U)
+    {
+        State<>::_owner.store(0U, ::std::memory_order_relaxed);
+        if (State<>::_word.exchange(FREE, ::std::memory_order_release) == CONTENDED)
+        {
+            futexWake(State<>::_word, 1);
+        }
+    }
+}
+
+inline bool CriticalSection::isEntered()
+{
+    return State<>::_owner.load(::std::memory_order_relaxed) == getThreadId();
+}
+
+} // namespace internal
+} // namespace async
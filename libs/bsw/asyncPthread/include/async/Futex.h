@@ -0,0 +1,80 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup async
+ */
+#pragma once
+
+#include <platform/estdint.h>
+
+#include <atomic>
+#include <cerrno>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace async
+{
+namespace internal
+{
+static_assert(
+    sizeof(::std::atomic<uint32_t>) == sizeof(uint32_t), "futex word must be a plain 32 bit word");
+
+/**
+ * Blocks the calling thread as long as word holds the expected value.
+ *
+ * \param word The futex word.
+ * \param expected The value of word for which the thread sleeps.
+ * \param deadline Absolute CLOCK_MONOTONIC time to wake up at, nullptr to wait without timeout.
+ * \return false if the deadline has passed, true if the thread was woken up or word didn't hold
+ *         the expected value
+ */
+inline bool
+futexWait(::std::atomic<uint32_t>& word, uint32_t const expected, timespec const* const deadline)
+{
+    long const result = syscall(
+        SYS_futex,
+        reinterpret_cast<uint32_t*>(&word),
+        FUTEX_WAIT_BITSET | FUTEX_PRIVATE_FLAG,
+        expected,
+        deadline,
+        nullptr,
+        FUTEX_BITSET_MATCH_ANY);
+    return (result == 0) || (errno != ETIMEDOUT);
+}
+
+/**
+ * Wakes up to count threads waiting on word.
+ */
+inline void futexWake(::std::atomic<uint32_t>& word, int const count)
+{
+    (void)syscall(
+        SYS_futex,
+        reinterpret_cast<uint32_t*>(&word),
+        FUTEX_WAKE | FUTEX_PRIVATE_FLAG,
+        count,
+        nullptr,
+        nullptr,
+        0);
+}
+
+/**
+ * \return the CLOCK_MONOTONIC time delayUs microseconds from now
+ */
+inline timespec getDeadline(uint32_t const delayUs)
+{
+    timespec deadline;
+    (void)clock_gettime(CLOCK_MONOTONIC, &deadline);
+    deadline.tv_sec += static_cast<time_t>(delayUs / 1000000U);
+    deadline.tv_nsec += static_cast<long>((delayUs % 1000000U) * 1000U);
+    if (deadline.tv_nsec >= 1000000000L)
+    {
+        deadline.tv_nsec -= 1000000000L;
+        ++deadline.tv_sec;
+    }
+    return deadline;
+}
+
+} // namespace internal
+} // namespace async
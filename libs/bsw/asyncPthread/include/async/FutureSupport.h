@@ -0,0 +1,61 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup async
+ */
+#pragma once
+
+#include <async/Types.h>
+#include <util/concurrent/IFutureSupport.h>
+
+#include <atomic>
+
+namespace async
+{
+/**
+ * This class implements wait and notify
+ * functions to synchronize between threads.
+ *
+ */
+class FutureSupport : public ::os::IFutureSupport
+{
+public:
+    /**
+     * Class constructor.
+     *
+     * \param context execution context.
+     */
+    explicit FutureSupport(ContextType context);
+
+    /**
+     * Wait function sets the thread into "waiting" state.
+     */
+    void wait() override;
+
+    /**
+     * Notify function wakes from "waiting" state.
+     */
+    void notify() override;
+
+    /**
+     * The function causes assertion if context assigned
+     * to this instance is not equal to actual context of
+     * the thread where functions of current instance are executed.
+     */
+    void assertTaskContext() override;
+
+    /**
+     * The function checks if the context assigned to this instance
+     * corresponds to actual context of the thread
+     * where functions of current instance are executed.
+     *
+     * \return true if contexts match.
+     */
+    bool verifyTaskContext() override;
+
+private:
+    ContextType _context;
+    ::std::atomic<uint32_t> _notified;
+};
+
+} // namespace async
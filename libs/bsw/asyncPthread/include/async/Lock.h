@@ -0,0 +1,36 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup async
+ */
+#pragma once
+
+#include "async/CriticalSection.h"
+
+namespace async
+{
+/**
+ * A synchronization mechanism that blocks threads from accessing a resource.
+ *
+ * The Lock class ensures mutual exclusion, allowing only one thread to access a
+ * protected resource or function at a time. When a thread acquires the lock,
+ * any other thread attempting to acquire it is blocked until the lock is released.
+ * The lock is automatically released in the destructor (RAII idiom).
+ *
+ * All locks share one recursive internal::CriticalSection, so locks can be nested.
+ */
+class Lock
+{
+public:
+    Lock();
+    ~Lock();
+};
+
+/**
+ * Inline implementations.
+ */
+inline Lock::Lock() { internal::CriticalSection::enter(); }
+
+inline Lock::~Lock() { internal::CriticalSection::leave(); }
+
+} // namespace async
@@ -0,0 +1,336 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup async
+ */
+#pragma once
+
+#include "async/TaskContext.h"
+#include "async/TaskInitializer.h"
+
+#include <etl/array.h>
+#include <etl/delegate.h>
+
+namespace async
+{
+/**
+ * Adapter class running each context of the application's binding in its own POSIX thread.
+ *
+ * Unlike the simulator ports of FreeRTOS and ThreadX, where only one task runs at a time, the
+ * contexts run in parallel on all CPUs of the host. Each thread can be pinned to a set of CPUs
+ * and given a SCHED_FIFO priority with its TaskConfig. The idle context runs in the thread that
+ * calls run(). The timer context has no thread, as every context waits for its own timeouts.
+ *
+ * As there is no scheduler to report task switches, the context hook of the binding isn't
+ * called. The runnable hook accounts the execution time of runnables as on the other adapters.
+ *
+ * \tparam Binding The binding type specifying application-specific configurations.
+ */
+template<class Binding>
+class PthreadAdapter
+{
+public:
+    static size_t const TASK_COUNT      = Binding::TASK_COUNT;
+    static size_t const OS_TASK_COUNT   = TASK_COUNT + 1U;
+    static ContextType const TASK_IDLE  = 0U;
+    static ContextType const TASK_TIMER = static_cast<ContextType>(TASK_COUNT);
+
+    static size_t const RUNNABLE_LANE_COUNT = internal::TaskRunnableLaneCount<Binding>::value;
+
+    using AdapterType = PthreadAdapter<Binding>;
+
+    using TimerType        = typename internal::TaskTimer<Binding>::Type;
+    using RunnableHookType = typename internal::TaskRunnableHook<Binding>::Type;
+    using TaskContextType  = TaskContext<AdapterType, TimerType>;
+    using TaskFunctionType = typename TaskContextType::TaskFunctionType;
+    using TaskConfigType   = TaskConfig;
+
+    using StartAppFunctionType = ::etl::delegate<void()>;
+
+    template<size_t StackSize>
+    using Stack           = internal::Stack<StackSize>;
+    using TaskInitializer = internal::TaskInitializer<AdapterType>;
+
+    template<size_t StackSize = 0U>
+    using IdleTask = internal::IdleTask<AdapterType, StackSize>;
+    template<size_t StackSize = 0U>
+    using TimerTask = internal::TimerTask<AdapterType, StackSize>;
+    template<ContextType Context, size_t StackSize = 0U>
+    using Task = internal::Task<AdapterType, Context, StackSize>;
+    template<ContextType Context>
+    using TaskStack = internal::Task<AdapterType, Context>;
+
+    /// Struct representing the stack usage for a specific task.
+    struct StackUsage
+    {
+        StackUsage();
+
+        uint32_t _stackSize;
+        uint32_t _usedSize;
+    };
+
+    static char const* getTaskName(size_t taskIdx);
+
+    static TaskConfigType const* getTaskConfig(size_t taskIdx);
+
+    static ContextType getCurrentTaskContext();
+
+    /**
+     * Runs the adapter. All tasks are initialized and their threads are started, then the
+     * application defined startApp function and the task function of the idle task are called
+     * in the calling thread. Returns after stop() has been called and all threads have ended.
+     *
+     * \param startApp The function to start the application.
+     */
+    static void run(StartAppFunctionType startApp);
+
+    /// Stops the dispatching of all contexts, which makes run() return.
+    static void stop();
+
+    /**
+     * Retrieves the stack size of a specified task. The used size of the stacks isn't measured.
+     *
+     * \param taskIdx The index of the task.
+     * \param stackUsage A reference to the StackUsage struct to populate.
+     * \return True if stack usage information is successfully retrieved.
+     */
+    static bool getStackUsage(size_t taskIdx, StackUsage& stackUsage);
+
+    /**
+     * Executes a specified runnable within a given context.
+     *
+     * \param context The task context.
+     * \param runnable The runnable to execute.
+     */
+    static void execute(ContextType context, RunnableType& runnable);
+
+    /**
+     * Executes a specified runnable within a given context in one of its runnable lanes.
+     *
+     * \param context The task context.
+     * \param runnable The runnable to execute.
+     * \param lane The lane of the runnable, runnables of higher lanes are executed first.
+     */
+    static void execute(ContextType context, RunnableType& runnable, size_t lane);
+
+    /**
+     * Sets the time budget of a runnable lane of a given context.
+     *
+     * \param context The task context.
+     * \param lane The lane to set the budget for.
+     * \param budgetUs The time in microseconds after which the context yields, 0 for no budget.
+     */
+    static void setRunnableLaneBudget(ContextType context, size_t lane, uint32_t budgetUs);
+
+    /**
+     * Schedules a runnable to execute after a delay.
+     *
+     * \param context The task context.
+     * \param runnable The runnable to schedule.
+     * \param timeout The timeout associated with the runnable.
+     * \param delay The delay before execution.
+     * \param unit The time unit for the delay.
+     */
+    static void schedule(
+        ContextType context,
+        RunnableType& runnable,
+        TimeoutType& timeout,
+        uint32_t delay,
+        TimeUnitType unit);
+
+    /**
+     * Schedules a runnable to execute at a fixed rate.
+     *
+     * \param context The task context.
+     * \param runnable The runnable to schedule.
+     * \param timeout The timeout associated with the runnable.
+     * \param delay The delay before the first execution.
+     * \param unit The time unit for the delay.
+     */
+    static void scheduleAtFixedRate(
+        ContextType context,
+        RunnableType& runnable,
+        TimeoutType& timeout,
+        uint32_t delay,
+        TimeUnitType unit);
+
+    /**
+     * Cancels a scheduled runnable.
+     *
+     * \param timeout The timeout associated with the runnable to cancel.
+     */
+    static void cancel(TimeoutType& timeout);
+
+private:
+    friend struct internal::TaskInitializer<AdapterType>;
+
+    static void initTask(TaskInitializer& initializer);
+
+    static ::etl::array<TaskContextType, TASK_COUNT> _taskContexts;
+    static char const* _timerTaskName;
+    static size_t _timerTaskStackSize;
+    static TaskConfigType _timerTaskConfig;
+};
+
+/**
+ * Inline implementations.
+ */
+template<class Binding>
+::etl::array<typename PthreadAdapter<Binding>::TaskContextType, PthreadAdapter<Binding>::TASK_COUNT>
+    PthreadAdapter<Binding>::_taskContexts;
+template<class Binding>
+char const* PthreadAdapter<Binding>::_timerTaskName = nullptr;
+template<class Binding>
+size_t PthreadAdapter<Binding>::_timerTaskStackSize = 0U;
+template<class Binding>
+TaskConfig PthreadAdapter<Binding>::_timerTaskConfig;
+
+template<class Binding>
+inline char const* PthreadAdapter<Binding>::getTaskName(size_t const taskIdx)
+{
+    return (taskIdx < _taskContexts.size()) ? _taskContexts[taskIdx].getName() : _timerTaskName;
+}
+
+template<class Binding>
+inline typename PthreadAdapter<Binding>::TaskConfigType const*
+PthreadAdapter<Binding>::getTaskConfig(size_t const taskIdx)
+{
+    return (taskIdx < _taskContexts.size()) ? &_taskContexts[taskIdx].getConfig()
+                                            : &_timerTaskConfig;
+}
+
+template<class Binding>
+inline ContextType PthreadAdapter<Binding>::getCurrentTaskContext()
+{
+    return TaskContextType::getCurrentContext();
+}
+
+template<class Binding>
+void PthreadAdapter<Binding>::initTask(TaskInitializer& initializer)
+{
+    ContextType const context = initializer._context;
+    if (context == TASK_TIMER)
+    {
+        _timerTaskName      = initializer._name;
+        _timerTaskStackSize = initializer._stackSize;
+        _timerTaskConfig    = initializer._config;
+    }
+    else
+    {
+        _taskContexts[static_cast<size_t>(context)].initTask(
+            context,
+            initializer._name,
+            initializer._stackSize,
+            initializer._config,
+            initializer._taskFunction);
+    }
+}
+
+template<class Binding>
+void PthreadAdapter<Binding>::run(StartAppFunctionType const startApp)
+{
+    TaskInitializer::run();
+    for (size_t idx = 1U; idx < _taskContexts.size(); ++idx)
+    {
+        if (_taskContexts[idx].isInitialized())
+        {
+            (void)_taskContexts[idx].startThread();
+        }
+    }
+    TaskContextType& idleContext = _taskContexts[TASK_IDLE];
+    if (!idleContext.isInitialized())
+    {
+        idleContext.initTask(TASK_IDLE, "idle", 0U, TaskConfigType(), TaskFunctionType());
+    }
+    idleContext.enterThread();
+    startApp();
+    idleContext.callTaskFunction();
+    for (size_t idx = 1U; idx < _taskContexts.size(); ++idx)
+    {
+        _taskContexts[idx].joinThread();
+    }
+    internal::currentContext() = CONTEXT_INVALID;
+}
+
+template<class Binding>
+void PthreadAdapter<Binding>::stop()
+{
+    for (TaskContextType& taskContext : _taskContexts)
+    {
+        taskContext.stopDispatch();
+    }
+}
+
+template<class Binding>
+bool PthreadAdapter<Binding>::getStackUsage(size_t const taskIdx, StackUsage& stackUsage)
+{
+    if (taskIdx < OS_TASK_COUNT)
+    {
+        size_t const stackSize = (taskIdx < _taskContexts.size())
+                                     ? _taskContexts[taskIdx].getStackSize()
+                                     : _timerTaskStackSize;
+        stackUsage._stackSize  = static_cast<uint32_t>(stackSize);
+        stackUsage._usedSize   = 0U;
+    }
+    return false;
+}
+
+template<class Binding>
+inline void PthreadAdapter<Binding>::execute(ContextType const context, RunnableType& runnable)
+{
+    _taskContexts[static_cast<size_t>(context)].execute(runnable);
+}
+
+template<class Binding>
+inline void PthreadAdapter<Binding>::execute(
+    ContextType const context, RunnableType& runnable, size_t const lane)
+{
+    _taskContexts[static_cast<size_t>(context)].execute(runnable, lane);
+}
+
+template<class Binding>
+inline void PthreadAdapter<Binding>::setRunnableLaneBudget(
+    ContextType const context, size_t const lane, uint32_t const budgetUs)
+{
+    _taskContexts[static_cast<size_t>(context)].setRunnableLaneBudget(lane, budgetUs);
+}
+
+template<class Binding>
+inline void PthreadAdapter<Binding>::schedule(
+    ContextType const context,
+    RunnableType& runnable,
+    TimeoutType& timeout,
+    uint32_t const delay,
+    TimeUnitType const unit)
+{
+    _taskContexts[static_cast<size_t>(context)].schedule(runnable, timeout, delay, unit);
+}
+
+template<class Binding>
+inline void PthreadAdapter<Binding>::scheduleAtFixedRate(
+    ContextType const context,
+    RunnableType& runnable,
+    TimeoutType& timeout,
+    uint32_t const delay,
+    TimeUnitType const unit)
+{
+    _taskContexts[static_cast<size_t>(context)].scheduleAtFixedRate(runnable, timeout, delay, unit);
+}
+
+template<class Binding>
+inline void PthreadAdapter<Binding>::cancel(TimeoutType& timeout)
+{
+    LockType const lock;
+    ContextType const context = timeout._context;
+    if (context != CONTEXT_INVALID)
+    {
+        timeout._context = CONTEXT_INVALID;
+        _taskContexts[static_cast<size_t>(context)].cancel(timeout);
+    }
+}
+
+template<class Binding>
+PthreadAdapter<Binding>::StackUsage::StackUsage() : _stackSize(0U), _usedSize(0U)
+{}
+
+} // namespace async
@@ -0,0 +1,27 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup async
+ */
+#pragma once
+
+#include "async/Config.h"
+
+/**
+ * Minimum stack size of a thread in bytes. The stack sizes given to the tasks are sized for the
+ * targets, the C library of the host needs considerably more.
+ */
+#ifndef ASYNC_CONFIG_MIN_STACK_SIZE
+#define ASYNC_CONFIG_MIN_STACK_SIZE (64U * 1024U)
+#endif
+
+namespace async
+{
+struct Config
+{
+    static size_t const TASK_COUNT     = static_cast<size_t>(ASYNC_CONFIG_TASK_COUNT);
+    static size_t const TICK_IN_US     = static_cast<size_t>(ASYNC_CONFIG_TICK_IN_US);
+    static size_t const MIN_STACK_SIZE = static_cast<size_t>(ASYNC_CONFIG_MIN_STACK_SIZE);
+};
+
+} // namespace async
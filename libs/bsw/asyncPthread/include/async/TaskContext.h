@@ -0,0 +1,547 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup async
+ */
+#pragma once
+
+#include "async/EventDispatcher.h"
+#include "async/EventPolicy.h"
+#include "async/Futex.h"
+#include "async/PthreadConfig.h"
+#include "async/RunnableExecutor.h"
+#include "async/RunnableHook.h"
+#include "async/Types.h"
+
+#include <bsp/timer/SystemTimer.h>
+#include <etl/delegate.h>
+#include <etl/type_traits.h>
+#include <timer/Timer.h>
+
+#include <cstdio>
+#include <limits.h>
+#include <pthread.h>
+#include <sched.h>
+
+namespace async
+{
+namespace internal
+{
+/**
+ * Selects the timer engine of a TaskContext. The binding may provide a TimerType, e.g.
+ * ::timer::TimerWheel<LockType> for contexts with many timeouts, ::timer::Timer is used
+ * otherwise.
+ */
+template<class Binding, class = void>
+struct TaskTimer
+{
+    using Type = ::timer::Timer<LockType>;
+};
+
+template<class Binding>
+struct TaskTimer<Binding, ::etl::void_t<typename Binding::TimerType>>
+{
+    using Type = typename Binding::TimerType;
+};
+
+/**
+ * Selects the runnable hook of a TaskContext. The binding may provide a RunnableHookType, e.g.
+ * StaticRunnableHook<::runtime::RunnableRuntimeMonitor<>> to account the execution time of each
+ * runnable, NoRunnableHook is used otherwise. The binding has to declare the RunnableHookType
+ * before it instantiates its adapter.
+ */
+template<class Binding, class = void>
+struct TaskRunnableHook
+{
+    using Type = NoRunnableHook;
+};
+
+template<class Binding>
+struct TaskRunnableHook<Binding, ::etl::void_t<typename Binding::RunnableHookType>>
+{
+    using Type = typename Binding::RunnableHookType;
+};
+
+/// \return the context of the calling thread, CONTEXT_INVALID outside of the task threads
+inline ContextType& currentContext()
+{
+    static thread_local ContextType context = CONTEXT_INVALID;
+    return context;
+}
+
+/**
+ * Selects the number of runnable lanes of a TaskContext. The binding may provide a
+ * RUNNABLE_LANE_COUNT to execute urgent runnables ahead of the others, a single lane is used
+ * otherwise.
+ */
+template<class Binding, class = void>
+struct TaskRunnableLaneCount
+{
+    static size_t const value = 1U;
+};
+
+template<class Binding>
+struct TaskRunnableLaneCount<Binding, ::etl::void_t<decltype(Binding::RUNNABLE_LANE_COUNT)>>
+{
+    static size_t const value = Binding::RUNNABLE_LANE_COUNT;
+};
+} // namespace internal
+
+/**
+ * Scheduling configuration of the thread of a task.
+ */
+struct TaskConfig
+{
+    /// CPUs the thread may run on, bit n standing for CPU n. 0 doesn't restrict the CPUs.
+    uint32_t cpuMask;
+    /// SCHED_FIFO priority (1..99) of the thread, 0 keeps the default policy SCHED_OTHER.
+    uint8_t priority;
+};
+
+/**
+ * Runs the runnables and timeouts of a context in a dedicated POSIX thread.
+ *
+ * Events are bits of an atomic futex word: setEvents() sets the bits and wakes the thread only
+ * if it announced to sleep, waitEvents() sleeps on the word until an event is set or the next
+ * timeout of the context is due. Timeouts are waited for with an absolute CLOCK_MONOTONIC
+ * deadline, so neither a tick nor a timer thread is needed.
+ *
+ * \tparam Binding The specific binding type associated with the TaskContext.
+ * \tparam Timer The timer engine holding the timeouts of this context.
+ */
+template<class Binding, class Timer = typename internal::TaskTimer<Binding>::Type>
+class TaskContext : public EventDispatcher<2U, LockType>
+{
+public:
+    using TaskFunctionType = ::etl::delegate<void(TaskContext<Binding, Timer>&)>;
+
+    TaskContext();
+
+    /**
+     * Initializes the task of this context.
+     * \param context The context associated with this task.
+     * \param name The name of this task.
+     * \param stackSize The requested stack size, raised to Config::MIN_STACK_SIZE.
+     * \param config The scheduling configuration of the thread.
+     * \param taskFunction The function to execute in this task, an invalid function dispatches.
+     */
+    void initTask(
+        ContextType context,
+        char const* name,
+        size_t stackSize,
+        TaskConfig const& config,
+        TaskFunctionType taskFunction);
+
+    bool isInitialized() const;
+
+    /**
+     * Creates the thread executing the task function.
+     * \return true if the thread has been created
+     */
+    bool startThread();
+
+    /// Waits for the task function of a started thread to return.
+    void joinThread();
+
+    /**
+     * Makes the calling thread the thread of this context, e.g. to execute the task function in
+     * the main thread.
+     */
+    void enterThread();
+
+    char const* getName() const;
+
+    size_t getStackSize() const;
+
+    TaskConfig const& getConfig() const;
+
+    /**
+     * Executes asynchronously the specified runnable within this task context.
+     * \param runnable The runnable to execute.
+     * \param lane The lane of the runnable, runnables of higher lanes are executed first.
+     */
+    void execute(RunnableType& runnable, size_t lane = 0U);
+
+    /**
+     * Sets the time budget of a runnable lane, see RunnableExecutor.
+     * \param lane The lane to set the budget for.
+     * \param budgetUs The time in microseconds after which the context yields, 0 for no budget.
+     */
+    void setRunnableLaneBudget(size_t lane, uint32_t budgetUs);
+
+    /**
+     * Schedules a runnable to execute after a delay.
+     * \param runnable The runnable to schedule.
+     * \param timeout The timeout associated with the runnable.
+     * \param delay The delay before execution.
+     * \param unit The time unit for the delay.
+     */
+    void schedule(RunnableType& runnable, TimeoutType& timeout, uint32_t delay, TimeUnitType unit);
+
+    /**
+     * Schedules a runnable to execute at a fixed rate.
+     * \param runnable The runnable to schedule.
+     * \param timeout The timeout associated with the runnable.
+     * \param period The period between executions.
+     * \param unit The time unit for the period.
+     */
+    void scheduleAtFixedRate(
+        RunnableType& runnable, TimeoutType& timeout, uint32_t period, TimeUnitType unit);
+
+    /**
+     * Cancels a scheduled runnable.
+     * \param timeout The timeout associated with the runnable to cancel.
+     */
+    void cancel(TimeoutType& timeout);
+
+    /// Calls the task's assigned function.
+    void callTaskFunction();
+
+    /// Dispatches events until stopDispatch() is called.
+    void dispatch();
+
+    /// Stops event dispatching.
+    void stopDispatch();
+
+    /// Dispatches events while runnable is executing.
+    void dispatchWhileWork();
+
+    /// \return the context of the calling thread, CONTEXT_INVALID outside of the task threads
+    static ContextType getCurrentContext();
+
+    /**
+     * Default function to be executed by a task within this context.
+     * \param taskContext The context in which the task executes.
+     */
+    static void defaultTaskFunction(TaskContext<Binding, Timer>& taskContext);
+
+private:
+    friend class EventPolicy<TaskContext<Binding, Timer>, 0U>;
+    friend class EventPolicy<TaskContext<Binding, Timer>, 1U>;
+
+    using ExecuteEventPolicyType = EventPolicy<TaskContext<Binding, Timer>, 0U>;
+    using TimerEventPolicyType   = EventPolicy<TaskContext<Binding, Timer>, 1U>;
+    using TimerType              = Timer;
+    using RunnableHookType       = typename internal::TaskRunnableHook<Binding>::Type;
+
+    static EventMaskType const STOP_EVENT_MASK = static_cast<EventMaskType>(
+        static_cast<EventMaskType>(1U) << static_cast<EventMaskType>(EVENT_COUNT));
+    // set in the futex word while the thread sleeps or is about to sleep on it
+    static EventMaskType const WAITING_FLAG = 0x80000000U;
+
+    void setEvents(EventMaskType eventMask);
+    EventMaskType waitEvents();
+    EventMaskType peekEvents();
+
+    void handleTimeout();
+    void initThread() const;
+
+    static void* staticTaskFunction(void* param);
+
+    RunnableExecutor<
+        RunnableType,
+        ExecuteEventPolicyType,
+        LockType,
+        RunnableHookType,
+        internal::TaskRunnableLaneCount<Binding>::value>
+        _runnableExecutor;
+    TimerType _timer;
+    TimerEventPolicyType _timerEventPolicy;
+    TaskFunctionType _taskFunction;
+    ::std::atomic<uint32_t> _events;
+    pthread_t _thread;
+    char const* _name;
+    size_t _stackSize;
+    TaskConfig _config;
+    ContextType _context;
+    bool _isStarted;
+};
+
+/**
+ * Inline implementations.
+ */
+template<class Binding, class Timer>
+inline TaskContext<Binding, Timer>::TaskContext()
+: _runnableExecutor(*this)
+, _timerEventPolicy(*this)
+, _taskFunction()
+, _events(0U)
+, _thread()
+, _name(nullptr)
+, _stackSize(0U)
+, _config()
+, _context(CONTEXT_INVALID)
+, _isStarted(false)
+{
+    _timerEventPolicy.setEventHandler(
+        HandlerFunctionType::create<TaskContext, &TaskContext::handleTimeout>(*this));
+    _runnableExecutor.init();
+}
+
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::initTask(
+    ContextType const context,
+    char const* const name,
+    size_t const stackSize,
+    TaskConfig const& config,
+    TaskFunctionType const taskFunction)
+{
+    size_t const minStackSize = (Config::MIN_STACK_SIZE > static_cast<size_t>(PTHREAD_STACK_MIN))
+                                    ? Config::MIN_STACK_SIZE
+                                    : static_cast<size_t>(PTHREAD_STACK_MIN);
+    _context      = context;
+    _name         = name;
+    _stackSize    = (stackSize > minStackSize) ? stackSize : minStackSize;
+    _config       = config;
+    _taskFunction = taskFunction.is_valid()
+                        ? taskFunction
+                        : TaskFunctionType::template create<&TaskContext::defaultTaskFunction>();
+}
+
+template<class Binding, class Timer>
+inline bool TaskContext<Binding, Timer>::isInitialized() const
+{
+    return _context != CONTEXT_INVALID;
+}
+
+template<class Binding, class Timer>
+bool TaskContext<Binding, Timer>::startThread()
+{
+    // a stop request of a previous run must not end the new one
+    (void)_events.fetch_and(~STOP_EVENT_MASK, ::std::memory_order_relaxed);
+    pthread_attr_t attr;
+    (void)pthread_attr_init(&attr);
+    (void)pthread_attr_setstacksize(&attr, _stackSize);
+    _isStarted = (pthread_create(&_thread, &attr, &staticTaskFunction, this) == 0);
+    (void)pthread_attr_destroy(&attr);
+    return _isStarted;
+}
+
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::joinThread()
+{
+    if (_isStarted)
+    {
+        (void)pthread_join(_thread, nullptr);
+        _isStarted = false;
+    }
+}
+
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::enterThread()
+{
+    (void)_events.fetch_and(~STOP_EVENT_MASK, ::std::memory_order_relaxed);
+    initThread();
+}
+
+template<class Binding, class Timer>
+inline char const* TaskContext<Binding, Timer>::getName() const
+{
+    return _name;
+}
+
+template<class Binding, class Timer>
+inline size_t TaskContext<Binding, Timer>::getStackSize() const
+{
+    return _stackSize;
+}
+
+template<class Binding, class Timer>
+inline TaskConfig const& TaskContext<Binding, Timer>::getConfig() const
+{
+    return _config;
+}
+
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::execute(RunnableType& runnable, size_t const lane)
+{
+    _runnableExecutor.enqueue(runnable, lane);
+}
+
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::setRunnableLaneBudget(
+    size_t const lane, uint32_t const budgetUs)
+{
+    _runnableExecutor.setLaneBudget(lane, budgetUs);
+}
+
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::schedule(
+    RunnableType& runnable, TimeoutType& timeout, uint32_t const delay, TimeUnitType const unit)
+{
+    // other threads may schedule the same timeout concurrently
+    LockType const lock;
+    if (!_timer.isActive(timeout))
+    {
+        timeout._runnable = &runnable;
+        timeout._context  = _context;
+        if (_timer.set(timeout, delay * static_cast<uint32_t>(unit), getSystemTimeUs32Bit()))
+        {
+            _timerEventPolicy.setEvent();
+        }
+    }
+}
+
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::scheduleAtFixedRate(
+    RunnableType& runnable, TimeoutType& timeout, uint32_t const period, TimeUnitType const unit)
+{
+    LockType const lock;
+    if (!_timer.isActive(timeout))
+    {
+        timeout._runnable = &runnable;
+        timeout._context  = _context;
+        if (_timer.setCyclic(timeout, period * static_cast<uint32_t>(unit), getSystemTimeUs32Bit()))
+        {
+            _timerEventPolicy.setEvent();
+        }
+    }
+}
+
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::cancel(TimeoutType& timeout)
+{
+    _timer.cancel(timeout);
+}
+
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::setEvents(EventMaskType const eventMask)
+{
+    if ((_events.fetch_or(eventMask, ::std::memory_order_release) & WAITING_FLAG) != 0U)
+    {
+        internal::futexWake(_events, 1);
+    }
+}
+
+template<class Binding, class Timer>
+EventMaskType TaskContext<Binding, Timer>::waitEvents()
+{
+    uint32_t nextDelta;
+    bool const hasDelta = _timer.getNextDelta(getSystemTimeUs32Bit(), nextDelta);
+    timespec deadline{};
+    if (hasDelta)
+    {
+        deadline = internal::getDeadline(nextDelta);
+    }
+    while (true)
+    {
+        EventMaskType const eventMask = peekEvents();
+        if (eventMask != 0U)
+        {
+            return eventMask;
+        }
+        uint32_t expected = 0U;
+        if (_events.compare_exchange_strong(expected, WAITING_FLAG, ::std::memory_order_acquire)
+            && (!internal::futexWait(_events, WAITING_FLAG, hasDelta ? &deadline : nullptr)))
+        {
+            return peekEvents() | TimerEventPolicyType::EVENT_MASK;
+        }
+    }
+}
+
+template<class Binding, class Timer>
+inline EventMaskType TaskContext<Binding, Timer>::peekEvents()
+{
+    return _events.exchange(0U, ::std::memory_order_acquire) & ~WAITING_FLAG;
+}
+
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::callTaskFunction()
+{
+    _taskFunction(*this);
+}
+
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::dispatch()
+{
+    EventMaskType eventMask = 0U;
+    while ((eventMask & STOP_EVENT_MASK) == 0U)
+    {
+        eventMask = waitEvents();
+        handleEvents(eventMask);
+    }
+}
+
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::stopDispatch()
+{
+    setEvents(STOP_EVENT_MASK);
+}
+
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::dispatchWhileWork()
+{
+    while (true)
+    {
+        handleTimeout();
+        EventMaskType const eventMask = peekEvents();
+        if (eventMask != 0U)
+        {
+            handleEvents(eventMask);
+        }
+        else
+        {
+            break;
+        }
+    }
+}
+
+template<class Binding, class Timer>
+inline ContextType TaskContext<Binding, Timer>::getCurrentContext()
+{
+    return internal::currentContext();
+}
+
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::defaultTaskFunction(TaskContext<Binding, Timer>& taskContext)
+{
+    taskContext.dispatch();
+}
+
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::handleTimeout()
+{
+    while (_timer.processNextTimeout(getSystemTimeUs32Bit())) {}
+}
+
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::initThread() const
+{
+    internal::currentContext() = _context;
+    bool success = true;
+    if (_config.cpuMask != 0U)
+    {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        for (size_t cpu = 0U; cpu < 32U; ++cpu)
+        {
+            if ((_config.cpuMask & (1U << cpu)) != 0U)
+            {
+                CPU_SET(cpu, &cpuSet);
+            }
+        }
+        success = (pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) == 0);
+    }
+    if (_config.priority != 0U)
+    {
+        sched_param param{};
+        param.sched_priority = static_cast<int>(_config.priority);
+        success = (pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) == 0) && success;
+    }
+    if (!success)
+    {
+        // SCHED_FIFO needs CAP_SYS_NICE or an RLIMIT_RTPRIO, the task runs unconfigured then
+        printf("Failed to configure thread of task %s\r\n", _name);
+    }
+}
+
+template<class Binding, class Timer>
+void* TaskContext<Binding, Timer>::staticTaskFunction(void* const param)
+{
+    TaskContext& taskContext = *reinterpret_cast<TaskContext*>(param);
+    taskContext.initThread();
+    taskContext.callTaskFunction();
+    return nullptr;
+}
+
+} // namespace async
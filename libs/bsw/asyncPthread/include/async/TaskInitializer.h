@@ -0,0 +1,298 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "async/StaticRunnable.h"
+#include "async/Types.h"
+
+#include <etl/array.h>
+
+namespace async
+{
+namespace internal
+{
+/**
+ * Stack memory of a task. The threads allocate their own stacks, the type is kept to declare
+ * tasks with external stacks the same way on all platforms.
+ */
+template<size_t StackSize>
+using Stack = ::etl::array<uint8_t, StackSize>;
+
+/**
+ * The TaskInitializer struct centralizes the initialization of tasks within the application.
+ *
+ * Each task object holds an initializer, which registers the task with the adapter when the
+ * adapter is run.
+ *
+ * \tparam Adapter The adapter type used to provide specific task configuration types and functions.
+ */
+template<typename Adapter>
+struct TaskInitializer : public StaticRunnable<TaskInitializer<Adapter>>
+{
+    using AdapterType      = Adapter;
+    using TaskConfigType   = typename AdapterType::TaskConfigType;
+    using TaskFunctionType = typename AdapterType::TaskFunctionType;
+
+    /**
+     * \param context The execution context of the task.
+     * \param name The name of the task.
+     * \param stackSize The requested stack size of the task.
+     * \param taskFunction The function that the task will execute.
+     * \param config Configuration settings for the task.
+     */
+    TaskInitializer(
+        ContextType context,
+        char const* name,
+        size_t stackSize,
+        TaskFunctionType taskFunction,
+        TaskConfigType const& config);
+
+    /// Executes task object initialization.
+    void execute();
+
+    /// The function assigned for the task's execution.
+    TaskFunctionType _taskFunction;
+
+    /// The name of the task.
+    char const* _name;
+
+    /// The requested stack size of the task.
+    size_t _stackSize;
+
+    /// The context in which the task will execute.
+    ContextType _context;
+
+    /// The configuration settings for the task.
+    TaskConfigType _config;
+};
+
+/**
+ * Primary template class that serves as a container for task-related objects and
+ * configuration.
+ *
+ * \tparam Adapter The adapter type that supplies specific task configuration types and functions.
+ * \tparam Context The context in which the task operates.
+ * \tparam StackSize The size of the stack requested for the task.
+ */
+template<class Adapter, ContextType Context, size_t StackSize = 0U>
+class TaskImpl
+{
+public:
+    using TaskConfigType   = typename Adapter::TaskConfigType;
+    using TaskFunctionType = typename Adapter::TaskFunctionType;
+
+    TaskImpl(char const* name, TaskFunctionType taskFunction, TaskConfigType const& taskConfig);
+
+protected:
+    ~TaskImpl() = default;
+
+private:
+    TaskInitializer<Adapter> _initializer;
+};
+
+template<class Adapter, ContextType Context>
+class TaskImpl<Adapter, Context, 0U>
+{
+public:
+    using TaskConfigType   = typename Adapter::TaskConfigType;
+    using TaskFunctionType = typename Adapter::TaskFunctionType;
+
+    template<typename T>
+    TaskImpl(
+        char const* name,
+        T& stack,
+        TaskFunctionType taskFunction,
+        TaskConfigType const& taskConfig);
+
+protected:
+    ~TaskImpl() = default;
+
+private:
+    TaskInitializer<Adapter> _initializer;
+};
+
+template<class Adapter, size_t StackSize = 0U>
+struct IdleTask : public TaskImpl<Adapter, Adapter::TASK_IDLE, StackSize>
+{
+    using TaskFunctionType = typename Adapter::TaskFunctionType;
+    using TaskConfigType   = typename Adapter::TaskConfigType;
+
+    IdleTask(char const* name, TaskConfigType const& taskConfig = TaskConfigType());
+
+    IdleTask(
+        char const* name,
+        TaskFunctionType taskFunction,
+        TaskConfigType const& taskConfig = TaskConfigType());
+};
+
+template<class Adapter>
+struct IdleTask<Adapter, 0U> : public TaskImpl<Adapter, Adapter::TASK_IDLE>
+{
+    using TaskFunctionType = typename Adapter::TaskFunctionType;
+    using TaskConfigType   = typename Adapter::TaskConfigType;
+
+    template<typename T>
+    IdleTask(char const* name, T& stack, TaskConfigType const& taskConfig = TaskConfigType());
+
+    template<typename T>
+    IdleTask(
+        char const* name,
+        T& stack,
+        TaskFunctionType taskFunction,
+        TaskConfigType const& taskConfig = TaskConfigType());
+};
+
+template<class Adapter, size_t StackSize = 0U>
+struct TimerTask : public TaskImpl<Adapter, Adapter::TASK_TIMER, StackSize>
+{
+    using TaskConfigType = typename Adapter::TaskConfigType;
+
+    explicit TimerTask(char const* name, TaskConfigType const& taskConfig = TaskConfigType());
+};
+
+template<class Adapter>
+struct TimerTask<Adapter, 0U> : public TaskImpl<Adapter, Adapter::TASK_TIMER>
+{
+    using TaskConfigType = typename Adapter::TaskConfigType;
+
+    template<typename T>
+    TimerTask(char const* name, T& stack, TaskConfigType const& taskConfig = TaskConfigType());
+};
+
+template<class Adapter, ContextType Context, size_t StackSize = 0U>
+struct Task : public TaskImpl<Adapter, Context, StackSize>
+{
+    using TaskFunctionType = typename Adapter::TaskFunctionType;
+    using TaskConfigType   = typename Adapter::TaskConfigType;
+
+    explicit Task(char const* name, TaskConfigType const& taskConfig = TaskConfigType());
+
+    Task(
+        char const* name,
+        TaskFunctionType taskFunction,
+        TaskConfigType const& taskConfig = TaskConfigType());
+};
+
+template<class Adapter, ContextType Context>
+struct Task<Adapter, Context, 0U> : public TaskImpl<Adapter, Context>
+{
+    using TaskFunctionType = typename Adapter::TaskFunctionType;
+    using TaskConfigType   = typename Adapter::TaskConfigType;
+
+    template<typename T>
+    explicit Task(char const* name, T& stack, TaskConfigType const& taskConfig = TaskConfigType());
+
+    template<typename T>
+    Task(
+        char const* name,
+        T& stack,
+        TaskFunctionType taskFunction,
+        TaskConfigType const& taskConfig = TaskConfigType());
+};
+
+template<class Adapter>
+TaskInitializer<Adapter>::TaskInitializer(
+    ContextType const context,
+    char const* const name,
+    size_t const stackSize,
+    TaskFunctionType const taskFunction,
+    TaskConfigType const& config)
+: _taskFunction(taskFunction)
+, _name(name)
+, _stackSize(stackSize)
+, _context(context)
+, _config(config)
+{}
+
+template<class Adapter>
+void TaskInitializer<Adapter>::execute()
+{
+    Adapter::initTask(*this);
+}
+
+template<class Adapter, ContextType Context, size_t StackSize>
+TaskImpl<Adapter, Context, StackSize>::TaskImpl(
+    char const* const name, TaskFunctionType const taskFunction, TaskConfigType const& taskConfig)
+: _initializer(Context, name, StackSize, taskFunction, taskConfig)
+{}
+
+template<class Adapter, ContextType Context>
+template<typename T>
+TaskImpl<Adapter, Context, 0U>::TaskImpl(
+    char const* const name,
+    T& stack,
+    TaskFunctionType const taskFunction,
+    TaskConfigType const& taskConfig)
+: _initializer(Context, name, sizeof(stack), taskFunction, taskConfig)
+{}
+
+template<class Adapter, size_t StackSize>
+IdleTask<Adapter, StackSize>::IdleTask(char const* const name, TaskConfigType const& taskConfig)
+: TaskImpl<Adapter, Adapter::TASK_IDLE, StackSize>(name, TaskFunctionType(), taskConfig)
+{}
+
+template<class Adapter, size_t StackSize>
+IdleTask<Adapter, StackSize>::IdleTask(
+    char const* const name, TaskFunctionType const taskFunction, TaskConfigType const& taskConfig)
+: TaskImpl<Adapter, Adapter::TASK_IDLE, StackSize>(name, taskFunction, taskConfig)
+{}
+
+template<class Adapter>
+template<typename T>
+IdleTask<Adapter, 0U>::IdleTask(char const* const name, T& stack, TaskConfigType const& taskConfig)
+: TaskImpl<Adapter, Adapter::TASK_IDLE>(name, stack, TaskFunctionType(), taskConfig)
+{}
+
+template<class Adapter>
+template<typename T>
+IdleTask<Adapter, 0U>::IdleTask(
+    char const* const name,
+    T& stack,
+    TaskFunctionType const taskFunction,
+    TaskConfigType const& taskConfig)
+: TaskImpl<Adapter, Adapter::TASK_IDLE>(name, stack, taskFunction, taskConfig)
+{}
+
+template<class Adapter, size_t StackSize>
+TimerTask<Adapter, StackSize>::TimerTask(char const* const name, TaskConfigType const& taskConfig)
+: TaskImpl<Adapter, Adapter::TASK_TIMER, StackSize>(
+    name, typename Adapter::TaskFunctionType(), taskConfig)
+{}
+
+template<class Adapter>
+template<typename T>
+TimerTask<Adapter, 0U>::TimerTask(
+    char const* const name, T& stack, TaskConfigType const& taskConfig)
+: TaskImpl<Adapter, Adapter::TASK_TIMER>(
+    name, stack, typename Adapter::TaskFunctionType(), taskConfig)
+{}
+
+template<class Adapter, ContextType Context, size_t StackSize>
+Task<Adapter, Context, StackSize>::Task(char const* const name, TaskConfigType const& taskConfig)
+: TaskImpl<Adapter, Context, StackSize>(name, TaskFunctionType(), taskConfig)
+{}
+
+template<class Adapter, ContextType Context, size_t StackSize>
+Task<Adapter, Context, StackSize>::Task(
+    char const* const name, TaskFunctionType const taskFunction, TaskConfigType const& taskConfig)
+: TaskImpl<Adapter, Context, StackSize>(name, taskFunction, taskConfig)
+{}
+
+template<class Adapter, ContextType Context>
+template<typename T>
+Task<Adapter, Context, 0U>::Task(char const* const name, T& stack, TaskConfigType const& taskConfig)
+: TaskImpl<Adapter, Context>(name, stack, typename Adapter::TaskFunctionType(), taskConfig)
+{}
+
+template<class Adapter, ContextType Context>
+template<typename T>
+Task<Adapter, Context, 0U>::Task(
+    char const* const name,
+    T& stack,
+    TaskFunctionType const taskFunction,
+    TaskConfigType const& taskConfig)
+: TaskImpl<Adapter, Context>(name, stack, taskFunction, taskConfig)
+{}
+
+} // namespace internal
+} // namespace async
@@ -0,0 +1,39 @@
+// Copyright 2025 Accenture.
+
+#include "async/FutureSupport.h"
+
+#include "async/Futex.h"
+
+#include <async/AsyncBinding.h>
+
+#include <etl/error_handler.h>
+
+namespace async
+{
+FutureSupport::FutureSupport(ContextType const context) : _context(context), _notified(0U) {}
+
+void FutureSupport::wait()
+{
+    while (_notified.exchange(0U, ::std::memory_order_acquire) == 0U)
+    {
+        (void)internal::futexWait(_notified, 0U, nullptr);
+    }
+}
+
+void FutureSupport::notify()
+{
+    _notified.store(1U, ::std::memory_order_release);
+    internal::futexWake(_notified, 1);
+}
+
+void FutureSupport::assertTaskContext()
+{
+    ETL_ASSERT(verifyTaskContext(), ETL_ERROR_GENERIC("task context not verified"));
+}
+
+bool FutureSupport::verifyTaskContext()
+{
+    return _context == AsyncBinding::AdapterType::getCurrentTaskContext();
+}
+
+} // namespace async
@@ -0,0 +1,16 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "async/PthreadAdapter.h"
+
+namespace async
+{
+struct AsyncBinding : public Config
+{
+    using AdapterType = PthreadAdapter<AsyncBinding>;
+};
+
+using AsyncBindingType = AsyncBinding;
+
+} // namespace async
@@ -0,0 +1,7 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#define ASYNC_CONFIG_TASK_COUNT     (3)
+#define ASYNC_CONFIG_TICK_IN_US     (1000)
+#define ASYNC_CONFIG_MIN_STACK_SIZE (32U * 1024U)
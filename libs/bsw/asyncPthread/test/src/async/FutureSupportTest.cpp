@@ -0,0 +1,58 @@
+// Copyright 2025 Accenture.
+
+#include "async/FutureSupport.h"
+
+#include <async/AsyncBinding.h>
+
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+using namespace ::async;
+using namespace ::testing;
+
+TEST(FutureSupportTest, testVerifyTaskContext)
+{
+    ::async::FutureSupport cut(1U);
+    // the test thread isn't a task thread
+    EXPECT_FALSE(cut.verifyTaskContext());
+    EXPECT_THROW({ cut.assertTaskContext(); }, ::etl::exception);
+
+    ::async::internal::currentContext() = 1U;
+    EXPECT_TRUE(cut.verifyTaskContext());
+    cut.assertTaskContext();
+    ::async::internal::currentContext() = CONTEXT_INVALID;
+}
+
+TEST(FutureSupportTest, testWaitReturnsAfterNotifyFromOtherThread)
+{
+    ::async::FutureSupport cut(1U);
+    std::atomic<bool> isNotified{false};
+    std::thread thread(
+        [&cut, &isNotified]()
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            isNotified = true;
+            cut.notify();
+        });
+    cut.wait();
+    EXPECT_TRUE(isNotified);
+    thread.join();
+}
+
+TEST(FutureSupportTest, testNotifyBeforeWaitIsNotLost)
+{
+    ::async::FutureSupport cut(1U);
+    cut.notify();
+    cut.wait();
+    // a second notification is needed for the next wait
+    std::thread thread([&cut]() { cut.notify(); });
+    cut.wait();
+    thread.join();
+}
+
+} // namespace
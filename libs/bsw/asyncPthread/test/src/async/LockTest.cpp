@@ -0,0 +1,99 @@
+// Copyright 2025 Accenture.
+
+#include "async/Lock.h"
+
+#include "async/ModifiableLock.h"
+
+#include <gmock/gmock.h>
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::async;
+using namespace ::testing;
+using ::async::internal::CriticalSection;
+
+TEST(LockTest, testLocksAndUnlocks)
+{
+    EXPECT_FALSE(CriticalSection::isEntered());
+    {
+        Lock const cut;
+        EXPECT_TRUE(CriticalSection::isEntered());
+    }
+    EXPECT_FALSE(CriticalSection::isEntered());
+}
+
+TEST(LockTest, testLocksCanBeNested)
+{
+    {
+        Lock const outer;
+        {
+            Lock const inner;
+            EXPECT_TRUE(CriticalSection::isEntered());
+        }
+        EXPECT_TRUE(CriticalSection::isEntered());
+    }
+    EXPECT_FALSE(CriticalSection::isEntered());
+}
+
+TEST(LockTest, testOtherThreadIsNotWithinTheLock)
+{
+    Lock const cut;
+    bool isEntered = true;
+    std::thread thread([&isEntered]() { isEntered = CriticalSection::isEntered(); });
+    thread.join();
+    EXPECT_FALSE(isEntered);
+}
+
+TEST(LockTest, testLocksAreMutuallyExclusiveAcrossThreads)
+{
+    size_t const threadCount = 4U;
+    size_t const loopCount   = 100000U;
+    // not atomic on purpose, only the lock protects it
+    size_t counter           = 0U;
+    std::vector<std::thread> threads;
+    for (size_t i = 0U; i < threadCount; ++i)
+    {
+        threads.emplace_back(
+            [&counter]()
+            {
+                for (size_t j = 0U; j < loopCount; ++j)
+                {
+                    Lock const lock;
+                    size_t const value = counter;
+                    counter            = value + 1U;
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(threadCount * loopCount, counter);
+}
+
+TEST(LockTest, testModifiableLockUnlocksAndLocks)
+{
+    {
+        ModifiableLock cut;
+        EXPECT_TRUE(CriticalSection::isEntered());
+        cut.unlock();
+        EXPECT_FALSE(CriticalSection::isEntered());
+        cut.unlock();
+        EXPECT_FALSE(CriticalSection::isEntered());
+        cut.lock();
+        EXPECT_TRUE(CriticalSection::isEntered());
+        cut.lock();
+        EXPECT_TRUE(CriticalSection::isEntered());
+    }
+    EXPECT_FALSE(CriticalSection::isEntered());
+    {
+        ModifiableLock cut;
+        cut.unlock();
+    }
+    EXPECT_FALSE(CriticalSection::isEntered());
+}
+
+} // namespace
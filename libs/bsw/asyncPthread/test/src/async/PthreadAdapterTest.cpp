@@ -0,0 +1,131 @@
+// Copyright 2025 Accenture.
+
+#include "async/PthreadAdapter.h"
+
+#include "async/Async.h"
+#include "async/AsyncBinding.h"
+
+#include <gmock/gmock.h>
+
+#include <thread>
+
+namespace
+{
+using namespace ::async;
+using namespace ::testing;
+
+using CutType = AsyncBinding::AdapterType;
+
+/**
+ * Passes itself on from context to context and stops the adapter in the last one.
+ */
+class ChainRunnable : public RunnableType
+{
+public:
+    ChainRunnable(ContextType const context, ChainRunnable* const next)
+    : _next(next), _context(context), _executedContext(CONTEXT_INVALID)
+    {}
+
+    void start() { ::async::execute(_context, *this); }
+
+    void execute() override
+    {
+        _executedContext = CutType::getCurrentTaskContext();
+        _thread          = std::this_thread::get_id();
+        if (_next != nullptr)
+        {
+            _next->start();
+        }
+        else
+        {
+            CutType::stop();
+        }
+    }
+
+    ChainRunnable* _next;
+    ContextType _context;
+    ContextType _executedContext;
+    std::thread::id _thread;
+};
+
+class PthreadAdapterTest : public Test
+{
+public:
+    PthreadAdapterTest() : _idle(0U, nullptr), _second(2U, &_idle), _first(1U, &_second) {}
+
+    void startApp()
+    {
+        _startAppContext = CutType::getCurrentTaskContext();
+        _first.start();
+    }
+
+    void scheduleApp() { ::async::schedule(2U, _second, _timeout, 5U, TimeUnit::MILLISECONDS); }
+
+protected:
+    ChainRunnable _idle;
+    ChainRunnable _second;
+    ChainRunnable _first;
+    CutType::Stack<16U * 1024U> _stack;
+    TimeoutType _timeout;
+    ContextType _startAppContext = CONTEXT_INVALID;
+};
+
+TEST_F(PthreadAdapterTest, testRunExecutesContextsInOwnThreadsUntilStopped)
+{
+    CutType::IdleTask<> idleTask("idle", _stack);
+    CutType::Task<1U, 64U * 1024U> task1("task1");
+    CutType::Task<2U> task2("task2", _stack, CutType::TaskConfigType{0U, 0U});
+    CutType::TimerTask<> timerTask("timer", _stack);
+
+    CutType::run(CutType::StartAppFunctionType::
+                     create<PthreadAdapterTest, &PthreadAdapterTest::startApp>(*this));
+
+    EXPECT_EQ(0U, _startAppContext);
+    EXPECT_EQ(1U, _first._executedContext);
+    EXPECT_EQ(2U, _second._executedContext);
+    EXPECT_EQ(0U, _idle._executedContext);
+    EXPECT_NE(_first._thread, _second._thread);
+    EXPECT_NE(std::this_thread::get_id(), _first._thread);
+    EXPECT_NE(std::this_thread::get_id(), _second._thread);
+    EXPECT_EQ(std::this_thread::get_id(), _idle._thread);
+    EXPECT_EQ(CONTEXT_INVALID, CutType::getCurrentTaskContext());
+
+    EXPECT_STREQ("idle", CutType::getTaskName(0U));
+    EXPECT_STREQ("task1", CutType::getTaskName(1U));
+    EXPECT_STREQ("task2", CutType::getTaskName(2U));
+    EXPECT_STREQ("timer", CutType::getTaskName(3U));
+
+    CutType::StackUsage stackUsage;
+    EXPECT_FALSE(CutType::getStackUsage(1U, stackUsage));
+    EXPECT_EQ(64U * 1024U, stackUsage._stackSize);
+    EXPECT_EQ(0U, stackUsage._usedSize);
+    EXPECT_FALSE(CutType::getStackUsage(2U, stackUsage));
+    EXPECT_EQ(32U * 1024U, stackUsage._stackSize);
+}
+
+TEST_F(PthreadAdapterTest, testRunCanBeRepeated)
+{
+    for (size_t i = 0U; i < 2U; ++i)
+    {
+        CutType::Task<1U> task1("task1", _stack);
+        CutType::Task<2U> task2("task2", _stack);
+        _first._executedContext = CONTEXT_INVALID;
+        _idle._executedContext  = CONTEXT_INVALID;
+        CutType::run(CutType::StartAppFunctionType::
+                         create<PthreadAdapterTest, &PthreadAdapterTest::startApp>(*this));
+        EXPECT_EQ(1U, _first._executedContext);
+        EXPECT_EQ(0U, _idle._executedContext);
+    }
+}
+
+TEST_F(PthreadAdapterTest, testScheduleExecutesInTargetContext)
+{
+    CutType::Task<1U> task1("task1", _stack);
+    CutType::Task<2U> task2("task2", _stack);
+    CutType::run(CutType::StartAppFunctionType::
+                     create<PthreadAdapterTest, &PthreadAdapterTest::scheduleApp>(*this));
+    EXPECT_EQ(2U, _second._executedContext);
+    EXPECT_EQ(0U, _idle._executedContext);
+}
+
+} // namespace
@@ -0,0 +1,254 @@
+// Copyright 2025 Accenture.
+
+#include "async/TaskContext.h"
+
+#include <gmock/gmock.h>
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::async;
+using namespace ::testing;
+using namespace ::std::chrono;
+
+struct TestBinding
+{};
+
+struct LaneBinding
+{
+    static size_t const RUNNABLE_LANE_COUNT = 2U;
+};
+
+using TaskContextType = TaskContext<TestBinding>;
+
+ContextType const CONTEXT = 2U;
+
+/**
+ * Records the context, CPU and time of each execution.
+ */
+class RecordingRunnable : public RunnableType
+{
+public:
+    void execute() override
+    {
+        std::lock_guard<std::mutex> const lock(_mutex);
+        _contexts.push_back(TaskContextType::getCurrentContext());
+        _threads.push_back(std::this_thread::get_id());
+        _cpus.push_back(sched_getcpu());
+        _times.push_back(steady_clock::now());
+        _condition.notify_all();
+    }
+
+    bool waitForRuns(size_t const count)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        return _condition.wait_for(
+            lock, seconds(5), [this, count]() { return _contexts.size() >= count; });
+    }
+
+    size_t getRunCount()
+    {
+        std::lock_guard<std::mutex> const lock(_mutex);
+        return _contexts.size();
+    }
+
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    std::vector<ContextType> _contexts;
+    std::vector<std::thread::id> _threads;
+    std::vector<int> _cpus;
+    std::vector<steady_clock::time_point> _times;
+};
+
+/**
+ * Keeps the context busy for a while.
+ */
+class BusyRunnable : public RunnableType
+{
+public:
+    void execute() override
+    {
+        auto const end = steady_clock::now() + microseconds(100);
+        while (steady_clock::now() < end) {}
+    }
+};
+
+class TaskContextTest : public Test
+{
+public:
+    TaskContextTest()
+    {
+        _cut.initTask(CONTEXT, "test", 0U, TaskConfig(), TaskContextType::TaskFunctionType());
+    }
+
+    ~TaskContextTest() override
+    {
+        _cut.stopDispatch();
+        _cut.joinThread();
+    }
+
+protected:
+    TaskContextType _cut;
+    RecordingRunnable _runnable;
+    TimeoutType _timeout1;
+    TimeoutType _timeout2;
+};
+
+TEST_F(TaskContextTest, testInitTask)
+{
+    EXPECT_TRUE(_cut.isInitialized());
+    EXPECT_STREQ("test", _cut.getName());
+    // raised to the minimum of the configuration
+    EXPECT_EQ(32U * 1024U, _cut.getStackSize());
+
+    TaskContextType bigStack;
+    EXPECT_FALSE(bigStack.isInitialized());
+    bigStack.initTask(
+        1U, "big", 1024U * 1024U, TaskConfig{3U, 5U}, TaskContextType::TaskFunctionType());
+    EXPECT_EQ(1024U * 1024U, bigStack.getStackSize());
+    EXPECT_EQ(3U, bigStack.getConfig().cpuMask);
+    EXPECT_EQ(5U, bigStack.getConfig().priority);
+}
+
+TEST_F(TaskContextTest, testExecutesRunnableInOwnThread)
+{
+    ASSERT_TRUE(_cut.startThread());
+    _cut.execute(_runnable);
+    ASSERT_TRUE(_runnable.waitForRuns(1U));
+    EXPECT_EQ(CONTEXT, _runnable._contexts[0]);
+    EXPECT_NE(std::this_thread::get_id(), _runnable._threads[0]);
+    EXPECT_EQ(CONTEXT_INVALID, TaskContextType::getCurrentContext());
+}
+
+TEST_F(TaskContextTest, testExecutesRunnableEnqueuedBeforeStart)
+{
+    _cut.execute(_runnable);
+    ASSERT_TRUE(_cut.startThread());
+    ASSERT_TRUE(_runnable.waitForRuns(1U));
+    EXPECT_EQ(CONTEXT, _runnable._contexts[0]);
+}
+
+TEST_F(TaskContextTest, testDispatchWhileWorkExecutesInCallingThread)
+{
+    _cut.execute(_runnable);
+    _cut.dispatchWhileWork();
+    ASSERT_EQ(1U, _runnable.getRunCount());
+    EXPECT_EQ(std::this_thread::get_id(), _runnable._threads[0]);
+}
+
+TEST_F(TaskContextTest, testScheduleExecutesAfterDelay)
+{
+    ASSERT_TRUE(_cut.startThread());
+    auto const start = steady_clock::now();
+    _cut.schedule(_runnable, _timeout1, 20U, TimeUnit::MILLISECONDS);
+    ASSERT_TRUE(_runnable.waitForRuns(1U));
+    EXPECT_GE(_runnable._times[0] - start, milliseconds(20));
+    EXPECT_EQ(CONTEXT, _runnable._contexts[0]);
+}
+
+TEST_F(TaskContextTest, testEarlierTimeoutWakesSleepingThread)
+{
+    ASSERT_TRUE(_cut.startThread());
+    RecordingRunnable late;
+    _cut.schedule(late, _timeout1, 100U, TimeUnit::SECONDS);
+    // let the thread fall asleep until the late timeout
+    std::this_thread::sleep_for(milliseconds(10));
+    auto const start = steady_clock::now();
+    _cut.schedule(_runnable, _timeout2, 5U, TimeUnit::MILLISECONDS);
+    ASSERT_TRUE(_runnable.waitForRuns(1U));
+    EXPECT_LT(_runnable._times[0] - start, seconds(1));
+    EXPECT_EQ(0U, late.getRunCount());
+    _cut.cancel(_timeout1);
+}
+
+TEST_F(TaskContextTest, testScheduleAtFixedRateExecutesUntilCancelled)
+{
+    ASSERT_TRUE(_cut.startThread());
+    _cut.scheduleAtFixedRate(_runnable, _timeout1, 2U, TimeUnit::MILLISECONDS);
+    ASSERT_TRUE(_runnable.waitForRuns(3U));
+    _cut.cancel(_timeout1);
+    // an execution may have been in progress while cancelling
+    std::this_thread::sleep_for(milliseconds(5));
+    size_t const runCount = _runnable.getRunCount();
+    std::this_thread::sleep_for(milliseconds(20));
+    EXPECT_EQ(runCount, _runnable.getRunCount());
+}
+
+TEST_F(TaskContextTest, testThreadCanBeRestartedAfterStop)
+{
+    ASSERT_TRUE(_cut.startThread());
+    _cut.stopDispatch();
+    _cut.joinThread();
+    ASSERT_TRUE(_cut.startThread());
+    _cut.execute(_runnable);
+    ASSERT_TRUE(_runnable.waitForRuns(1U));
+}
+
+TEST_F(TaskContextTest, testThreadIsPinnedToConfiguredCpu)
+{
+    cpu_set_t allowed;
+    ASSERT_EQ(0, sched_getaffinity(0, sizeof(allowed), &allowed));
+    int cpu = 0;
+    while ((cpu < 32) && !CPU_ISSET(cpu, &allowed))
+    {
+        ++cpu;
+    }
+    ASSERT_LT(cpu, 32);
+    TaskContextType pinned;
+    pinned.initTask(
+        1U,
+        "pinned",
+        0U,
+        TaskConfig{1U << static_cast<uint32_t>(cpu), 0U},
+        TaskContextType::TaskFunctionType());
+    ASSERT_TRUE(pinned.startThread());
+    pinned.execute(_runnable);
+    bool const hasRun = _runnable.waitForRuns(1U);
+    pinned.stopDispatch();
+    pinned.joinThread();
+    ASSERT_TRUE(hasRun);
+    EXPECT_EQ(cpu, _runnable._cpus[0]);
+}
+
+TEST_F(TaskContextTest, testUrgentLaneBypassesQueuedLoad)
+{
+    TaskContext<LaneBinding> lanes;
+    lanes.initTask(1U, "lanes", 0U, TaskConfig(), TaskContext<LaneBinding>::TaskFunctionType());
+    ASSERT_TRUE(lanes.startThread());
+    ::std::array<BusyRunnable, 100U> load;
+    RecordingRunnable drained;
+    steady_clock::duration delays[2];
+    // measure the queueing delay behind 10ms of load in the same lane, then in a higher lane
+    for (size_t lane = 0U; lane < 2U; ++lane)
+    {
+        for (BusyRunnable& runnable : load)
+        {
+            lanes.execute(runnable);
+        }
+        lanes.execute(drained);
+        std::this_thread::sleep_for(milliseconds(1));
+        auto const start = steady_clock::now();
+        lanes.execute(_runnable, lane);
+        ASSERT_TRUE(_runnable.waitForRuns(lane + 1U));
+        delays[lane] = _runnable._times[lane] - start;
+        ASSERT_TRUE(drained.waitForRuns(lane + 1U));
+    }
+    lanes.stopDispatch();
+    lanes.joinThread();
+    (void)printf(
+        "queueing delay behind load: same lane %dus, higher lane %dus\n",
+        static_cast<int>(duration_cast<microseconds>(delays[0]).count()),
+        static_cast<int>(duration_cast<microseconds>(delays[1]).count()));
+    EXPECT_GT(_runnable._times[0], drained._times[0]);
+    EXPECT_LT(_runnable._times[1], drained._times[1]);
+    EXPECT_LT(delays[1], delays[0]);
+}
+
+} // namespace
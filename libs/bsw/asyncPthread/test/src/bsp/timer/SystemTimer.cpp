@@ -0,0 +1,15 @@
+// Copyright 2025 Accenture.
+
+#include <bsp/timer/SystemTimer.h>
+
+#include <ctime>
+
+// the contexts wait for CLOCK_MONOTONIC deadlines, so the tests need the real time
+uint32_t getSystemTimeUs32Bit(void)
+{
+    timespec now;
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    uint64_t const seconds      = static_cast<uint64_t>(now.tv_sec);
+    uint64_t const microseconds = static_cast<uint64_t>(now.tv_nsec) / 1000U;
+    return static_cast<uint32_t>((seconds * 1000000U) + microseconds);
+}
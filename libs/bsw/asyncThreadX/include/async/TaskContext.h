@@ -9,22 +9,97 @@
 #include "async/EventDispatcher.h"
 #include "async/EventPolicy.h"
 #include "async/RunnableExecutor.h"
+#include "async/RunnableHook.h"
 #include "async/Types.h"
+#include "async/WakeupHook.h"
 #include "tx_api.h"
 
 #include <bsp/timer/SystemTimer.h>
 #include <etl/delegate.h>
 #include <etl/error_handler.h>
 #include <etl/span.h>
+#include <etl/type_traits.h>
 #include <timer/Timer.h>
 
 namespace async
 {
+namespace internal
+{
+/**
+ * Selects the timer engine of a TaskContext. The binding may provide a TimerType, e.g.
+ * ::timer::TimerWheel<LockType> for contexts with many timeouts, ::timer::Timer is used
+ * otherwise.
+ */
+template<class Binding, class = void>
+struct TaskTimer
+{
+    using Type = ::timer::Timer<LockType>;
+};
+
+template<class Binding>
+struct TaskTimer<Binding, ::etl::void_t<typename Binding::TimerType>>
+{
+    using Type = typename Binding::TimerType;
+};
+
+/**
+ * Selects the runnable hook of a TaskContext. The binding may provide a RunnableHookType, e.g.
+ * StaticRunnableHook<::runtime::RunnableRuntimeMonitor<>> to account the execution time of each
+ * runnable, NoRunnableHook is used otherwise. The binding has to declare the RunnableHookType
+ * before it instantiates its adapter.
+ */
+template<class Binding, class = void>
+struct TaskRunnableHook
+{
+    using Type = NoRunnableHook;
+};
+
+template<class Binding>
+struct TaskRunnableHook<Binding, ::etl::void_t<typename Binding::RunnableHookType>>
+{
+    using Type = typename Binding::RunnableHookType;
+};
+
+/**
+ * Selects the wakeup hook of a TaskContext. The binding may provide a WakeupHookType, e.g.
+ * StaticWakeupHook<declare::HighResolutionWakeup<...>> to wake up the contexts at the exact time
+ * of their timeouts, NoWakeupHook is used otherwise and timeouts are rounded up to RTOS ticks.
+ */
+template<class Binding, class = void>
+struct TaskWakeupHook
+{
+    using Type = NoWakeupHook;
+};
+
 template<class Binding>
+struct TaskWakeupHook<Binding, ::etl::void_t<typename Binding::WakeupHookType>>
+{
+    using Type = typename Binding::WakeupHookType;
+};
+
+/**
+ * Selects the number of runnable lanes of a TaskContext. The binding may provide a
+ * RUNNABLE_LANE_COUNT to execute urgent runnables ahead of the others, a single lane is used
+ * otherwise.
+ */
+template<class Binding, class = void>
+struct TaskRunnableLaneCount
+{
+    static size_t const value = 1U;
+};
+
+template<class Binding>
+struct TaskRunnableLaneCount<Binding, ::etl::void_t<decltype(Binding::RUNNABLE_LANE_COUNT)>>
+{
+    static size_t const value = Binding::RUNNABLE_LANE_COUNT;
+};
+} // namespace internal
+
+template<class Binding, class Timer = typename internal::TaskTimer<Binding>::Type>
 class TaskContext : public EventDispatcher<2U, LockType>
 {
 public:
-    using TaskFunctionType       = ::etl::delegate<void(TaskContext<Binding>&)>;
+    using TaskFunctionType       = ::etl::delegate<void(TaskContext<Binding, Timer>&)>;
     using StaticTaskFunctionType = void (*)(ULONG);
     using StackType              = ::etl::span<ULONG>;
 
@@ -48,26 +123,35 @@ public:
 
     TX_THREAD& getTaskHandle() const;
 
-    void execute(RunnableType& runnable);
+    void execute(RunnableType& runnable, size_t lane = 0U);
+    void setRunnableLaneBudget(size_t lane, uint32_t budgetUs);
     void schedule(RunnableType& runnable, TimeoutType& timeout, uint32_t delay, TimeUnitType unit);
     void scheduleAtFixedRate(
         RunnableType& runnable, TimeoutType& timeout, uint32_t period, TimeUnitType unit);
     void cancel(TimeoutType& timeout);
 
+    /**
+     * Sets the timer event of this context, which makes it process its due timeouts. Called by
+     * the wakeup hook when the next timeout of this context is due.
+     */
+    void wakeup();
+
     void callTaskFunction();
     void dispatch();
     void stopDispatch();
     void dispatchWhileWork();
 
-    static void defaultTaskFunction(TaskContext<Binding>& taskContext);
+    static void defaultTaskFunction(TaskContext<Binding, Timer>& taskContext);
 
 private:
-    friend class EventPolicy<TaskContext<Binding>, 0U>;
-    friend class EventPolicy<TaskContext<Binding>, 1U>;
+    friend class EventPolicy<TaskContext<Binding, Timer>, 0U>;
+    friend class EventPolicy<TaskContext<Binding, Timer>, 1U>;
 
-    using ExecuteEventPolicyType = EventPolicy<TaskContext<Binding>, 0U>;
-    using TimerEventPolicyType   = EventPolicy<TaskContext<Binding>, 1U>;
-    using TimerType              = ::timer::Timer<LockType>;
+    using ExecuteEventPolicyType = EventPolicy<TaskContext<Binding, Timer>, 0U>;
+    using TimerEventPolicyType   = EventPolicy<TaskContext<Binding, Timer>, 1U>;
+    using TimerType              = Timer;
+    using RunnableHookType       = typename internal::TaskRunnableHook<Binding>::Type;
+    using WakeupHookType         = typename internal::TaskWakeupHook<Binding>::Type;
 
     static EventMaskType const STOP_EVENT_MASK = static_cast<EventMaskType>(
         static_cast<EventMaskType>(1U) << static_cast<EventMaskType>(EVENT_COUNT));
@@ -79,7 +163,13 @@ private:
 
     void handleTimeout();
 
-    RunnableExecutor<RunnableType, ExecuteEventPolicyType, LockType> _runnableExecutor;
+    RunnableExecutor<
+        RunnableType,
+        ExecuteEventPolicyType,
+        LockType,
+        RunnableHookType,
+        internal::TaskRunnableLaneCount<Binding>::value>
+        _runnableExecutor;
     TimerType _timer;
     TimerEventPolicyType _timerEventPolicy;
     TaskFunctionType _taskFunction;
@@ -92,8 +182,8 @@ private:
 /**
  * Inline implementations.
  */
-template<class Binding>
-inline TaskContext<Binding>::TaskContext()
+template<class Binding, class Timer>
+inline TaskContext<Binding, Timer>::TaskContext()
 : _runnableExecutor(*this)
 , _timer()
 , _timerEventPolicy(*this)
@@ -107,8 +197,8 @@ inline TaskContext<Binding>::TaskContext()
     _runnableExecutor.init();
 }
 
-template<class Binding>
-void TaskContext<Binding>::initTask(
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::initTask(
     ContextType const context, char const* const name, TX_THREAD& taskHandle)
 {
     _context    = context;
@@ -116,8 +206,8 @@ void TaskContext<Binding>::initTask(
     _taskHandle = &taskHandle;
 }
 
-template<class Binding>
-void TaskContext<Binding>::createTask(
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::createTask(
     ContextType const context,
     TX_THREAD& task,
     char const* const name,
@@ -155,8 +245,8 @@ void TaskContext<Binding>::createTask(
     _taskHandle = &task;
 }
 
-template<class Binding>
-void TaskContext<Binding>::startTask()
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::startTask()
 {
     if (_taskHandle != nullptr)
     {
@@ -164,8 +254,8 @@ void TaskContext<Binding>::startTask()
     }
 }
 
-template<class Binding>
-inline char const* TaskContext<Binding>::getName() const
+template<class Binding, class Timer>
+inline char const* TaskContext<Binding, Timer>::getName() const
 {
     if (_name != nullptr)
     {
@@ -177,20 +267,27 @@ inline char const* TaskContext<Binding>::getName() const
     }
 }
 
-template<class Binding>
-inline TX_THREAD& TaskContext<Binding>::getTaskHandle() const
+template<class Binding, class Timer>
+inline TX_THREAD& TaskContext<Binding, Timer>::getTaskHandle() const
 {
     return *_taskHandle;
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::execute(RunnableType& runnable)
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::execute(RunnableType& runnable, size_t const lane)
 {
-    _runnableExecutor.enqueue(runnable);
+    _runnableExecutor.enqueue(runnable, lane);
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::schedule(
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::setRunnableLaneBudget(
+    size_t const lane, uint32_t const budgetUs)
+{
+    _runnableExecutor.setLaneBudget(lane, budgetUs);
+}
+
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::schedule(
     RunnableType& runnable, TimeoutType& timeout, uint32_t const delay, TimeUnitType const unit)
 {
     if (!_timer.isActive(timeout))
@@ -204,8 +301,8 @@ inline void TaskContext<Binding>::schedule(
     }
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::scheduleAtFixedRate(
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::scheduleAtFixedRate(
     RunnableType& runnable, TimeoutType& timeout, uint32_t const period, TimeUnitType const unit)
 {
     if (!_timer.isActive(timeout))
@@ -220,14 +317,20 @@ inline void TaskContext<Binding>::scheduleAtFixedRate(
     }
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::cancel(TimeoutType& timeout)
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::cancel(TimeoutType& timeout)
 {
     _timer.cancel(timeout);
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::setEvents(EventMaskType const eventMask)
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::wakeup()
+{
+    _timerEventPolicy.setEvent();
+}
+
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::setEvents(EventMaskType const eventMask)
 {
     tx_event_flags_set(
         &_eventObject,
@@ -236,16 +339,23 @@ inline void TaskContext<Binding>::setEvents(EventMaskType const eventMask)
     );
 }
 
-template<class Binding>
-inline EventMaskType TaskContext<Binding>::waitEvents()
+template<class Binding, class Timer>
+inline EventMaskType TaskContext<Binding, Timer>::waitEvents()
 {
     EventMaskType eventMask = 0U;
     uint32_t ticks          = Binding::WAIT_EVENTS_TICK_COUNT;
     uint32_t nextDelta;
-    bool const hasDelta = _timer.getNextDelta(getSystemTimeUs32Bit(), nextDelta);
+    uint32_t const nowUs = getSystemTimeUs32Bit();
+    bool const hasDelta  = _timer.getNextDelta(nowUs, nextDelta);
     if (hasDelta)
     {
         ticks = static_cast<uint32_t>((nextDelta + (Config::TICK_IN_US - 1U)) / Config::TICK_IN_US);
+        // the wakeup hook may set the timer event before the tick rounded up to is reached
+        WakeupHookType::setWakeup(_context, nowUs + nextDelta);
+    }
+    else
+    {
+        WakeupHookType::clearWakeup(_context);
     }
     auto const result = tx_event_flags_get(
         &_eventObject,
@@ -268,14 +378,14 @@ inline EventMaskType TaskContext<Binding>::waitEvents()
     }
 }
 
-template<class Binding>
-void TaskContext<Binding>::callTaskFunction()
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::callTaskFunction()
 {
     _taskFunction(*this);
 }
 
-template<class Binding>
-void TaskContext<Binding>::dispatch()
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::dispatch()
 {
     EventMaskType eventMask = 0U;
     while ((eventMask & STOP_EVENT_MASK) == 0U)
@@ -285,21 +395,21 @@ void TaskContext<Binding>::dispatch()
     }
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::stopDispatch()
+template<class Binding, class Timer>
+inline void TaskContext<Binding, Timer>::stopDispatch()
 {
     _runnableExecutor.shutdown();
     setEvents(STOP_EVENT_MASK);
 }
 
-template<class Binding>
-void TaskContext<Binding>::defaultTaskFunction(TaskContext<Binding>& taskContext)
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::defaultTaskFunction(TaskContext<Binding, Timer>& taskContext)
 {
     taskContext.dispatch();
 }
 
-template<class Binding>
-void TaskContext<Binding>::handleTimeout()
+template<class Binding, class Timer>
+void TaskContext<Binding, Timer>::handleTimeout()
 {
     while (_timer.processNextTimeout(getSystemTimeUs32Bit())) {}
 }
@@ -78,9 +78,14 @@ public:
     static ContextType const TASK_IDLE        = 0U;
     static ContextType const TASK_TIMER       = static_cast<ContextType>(TASK_COUNT);
 
+    static size_t const RUNNABLE_LANE_COUNT = internal::TaskRunnableLaneCount<Binding>::value;
+
     using AdapterType = ThreadXAdapter<Binding>;
 
-    using TaskContextType        = TaskContext<AdapterType>;
+    using TimerType              = typename internal::TaskTimer<Binding>::Type;
+    using RunnableHookType       = typename internal::TaskRunnableHook<Binding>::Type;
+    using WakeupHookType         = typename internal::TaskWakeupHook<Binding>::Type;
+    using TaskContextType        = TaskContext<AdapterType, TimerType>;
     using TaskFunctionType       = typename TaskContextType::TaskFunctionType;
     using StaticTaskFunctionType = typename TaskContextType::StaticTaskFunctionType;
 
@@ -125,6 +130,8 @@ public:
     static void callIdleTaskFunction();
 
     static void execute(ContextType context, RunnableType& runnable);
+    static void execute(ContextType context, RunnableType& runnable, size_t lane);
+    static void setRunnableLaneBudget(ContextType context, size_t lane, uint32_t budgetUs);
 
     static void schedule(
         ContextType context,
@@ -142,6 +149,14 @@ public:
 
     static void cancel(TimeoutType& timeout);
 
+    /**
+     * Wakes up a context to process its due timeouts, e.g. as the wakeup function of a
+     * HighResolutionWakeup. It may be called from an interrupt.
+     *
+     * \param context The task context.
+     */
+    static void wakeup(ContextType context);
+
     static void callInitFromThreadXKernel();
 
 private:
@@ -296,6 +311,20 @@ inline void ThreadXAdapter<Binding>::execute(ContextType const context, Runnable
     _taskContexts[static_cast<size_t>(context)].execute(runnable);
 }
 
+template<class Binding>
+inline void ThreadXAdapter<Binding>::execute(
+    ContextType const context, RunnableType& runnable, size_t const lane)
+{
+    _taskContexts[static_cast<size_t>(context)].execute(runnable, lane);
+}
+
+template<class Binding>
+inline void ThreadXAdapter<Binding>::setRunnableLaneBudget(
+    ContextType const context, size_t const lane, uint32_t const budgetUs)
+{
+    _taskContexts[static_cast<size_t>(context)].setRunnableLaneBudget(lane, budgetUs);
+}
+
 template<class Binding>
 inline void ThreadXAdapter<Binding>::schedule(
     ContextType const context,
@@ -330,6 +359,12 @@ inline void ThreadXAdapter<Binding>::cancel(TimeoutType& timeout)
     }
 }
 
+template<class Binding>
+inline void ThreadXAdapter<Binding>::wakeup(ContextType const context)
+{
+    _taskContexts[static_cast<size_t>(context)].wakeup();
+}
+
 template<class Binding>
 void ThreadXAdapter<Binding>::staticTaskFunction(ULONG param)
 {
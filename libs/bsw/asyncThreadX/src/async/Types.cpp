@@ -13,7 +13,10 @@ void TimeoutType::expired()
     RunnableType* const runnable = _runnable;
     if (runnable != nullptr)
     {
+        using RunnableHookType = AsyncBindingType::AdapterType::RunnableHookType;
+        RunnableHookType::enterRunnable(*runnable);
         runnable->execute();
+        RunnableHookType::leaveRunnable(*runnable);
     }
 }
 
@@ -0,0 +1,54 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <platform/estdint.h>
+
+namespace bsp
+{
+/**
+ * Listener of an IOneShotTimer.
+ */
+class IOneShotTimerListener
+{
+public:
+    /**
+     * Called once when the programmed expiry time has been reached. Depending on the
+     * implementation this is called from an interrupt or from a thread of the timer.
+     */
+    virtual void expired() = 0;
+
+protected:
+    IOneShotTimerListener& operator=(IOneShotTimerListener const&) = default;
+};
+
+/**
+ * IOneShotTimer formulates the generic interface of a single hardware compare channel that
+ * fires once at an absolute time with microsecond resolution. The time base is the one of
+ * getSystemTimeUs32Bit().
+ */
+class IOneShotTimer
+{
+public:
+    /**
+     * Sets the listener to call on expiry. Must be called before the timer is started.
+     */
+    virtual void setListener(IOneShotTimerListener& listener) = 0;
+
+    /**
+     * Programs the timer to expire at timeUs, replacing a previously programmed expiry. A time
+     * that has already passed expires as soon as possible.
+     * \param timeUs    absolute expiry time in the time base of getSystemTimeUs32Bit()
+     */
+    virtual void start(uint32_t timeUs) = 0;
+
+    /**
+     * Cancels a programmed expiry.
+     */
+    virtual void stop() = 0;
+
+protected:
+    IOneShotTimer& operator=(IOneShotTimer const&) = default;
+};
+
+} // namespace bsp
@@ -0,0 +1,19 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "bsp/timer/IOneShotTimer.h"
+
+#include <gmock/gmock.h>
+
+namespace bsp
+{
+class OneShotTimerMock : public IOneShotTimer
+{
+public:
+    MOCK_METHOD(void, setListener, (IOneShotTimerListener&), (override));
+    MOCK_METHOD(void, start, (uint32_t), (override));
+    MOCK_METHOD(void, stop, (), (override));
+};
+
+} // namespace bsp
@@ -0,0 +1,156 @@
+// Copyright 2024 Accenture.
+
+#include <benchmark/benchmark.h>
+#include <can/SocketCanTransceiver.h>
+#include <can/canframes/CANFrame.h>
+#include <can/filter/IntervalFilter.h>
+#include <can/framemgmt/ICANFrameListener.h>
+#include <can/gateway/CanGateway.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+/**
+ * Throughput and latency benchmarks of the CAN gateway between virtual CAN interfaces on posix.
+ *
+ * Frames are sent on vcan0, routed by the gateway to vcan1 or to vcan1 and vcan2, and received
+ * there by a second socket each. The latency is measured from writing a frame on vcan0 until it
+ * is received on the destination interface, including all system calls in between.
+ *
+ * The benchmarks need three virtual CAN interfaces:
+ *
+ *   for i in 0 1 2; do
+ *       sudo ip link add dev vcan$i type vcan
+ *       sudo ip link set up vcan$i
+ *   done
+ */
+
+namespace
+{
+int const FRAMES_PER_ITERATION = 16;
+
+using Gateway = ::can::CanGateway<3U, 1U, 64U * ::can::CanGatewayFrame::MAX_ELEMENT_SIZE>;
+
+uint64_t now()
+{
+    return static_cast<uint64_t>(::std::chrono::duration_cast<::std::chrono::nanoseconds>(
+                                     ::std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+}
+
+/**
+ * Receives the routed frames, each carrying its send time as payload.
+ */
+class LatencyListener : public ::can::ICANFrameListener
+{
+public:
+    LatencyListener() : _filter(0U, 0x7FFU), _receivedCount(0U), _totalNs(0U), _maxNs(0U) {}
+
+    void frameReceived(::can::CANFrame const& canFrame) override
+    {
+        uint64_t sent = 0U;
+        (void)::std::memcpy(&sent, canFrame.getPayload(), sizeof(sent));
+        uint64_t const latency = now() - sent;
+        ++_receivedCount;
+        _totalNs += latency;
+        _maxNs = ::std::max(_maxNs, latency);
+    }
+
+    ::can::IFilter& getFilter() override { return _filter; }
+
+    ::can::IntervalFilter _filter;
+    uint32_t _receivedCount;
+    uint64_t _totalNs;
+    uint64_t _maxNs;
+};
+
+/**
+ * Routes bursts of state.range(0) frames from vcan0 to destinationCount interfaces.
+ */
+void runGateway(benchmark::State& state, size_t const destinationCount)
+{
+    static ::can::SocketCanTransceiver::DeviceConfig const CONFIGS[]
+        = {{"vcan0", 0U, true}, {"vcan1", 1U, true}, {"vcan2", 2U, true}};
+    ::can::CanGatewayRoute const routes[]
+        = {{0U, 0x100U, 0x1FFU, static_cast<uint8_t>(((1U << destinationCount) - 1U) << 1U)}};
+    ::can::CanGatewayRoutingTable const routingTable(routes);
+    Gateway gateway(routingTable);
+
+    ::can::SocketCanTransceiver sender(CONFIGS[0]);
+    ::can::SocketCanTransceiver gatewayTransceiver0(CONFIGS[0]);
+    ::can::SocketCanTransceiver gatewayTransceiver1(CONFIGS[1]);
+    ::can::SocketCanTransceiver gatewayTransceiver2(CONFIGS[2]);
+    ::can::SocketCanTransceiver receiver1(CONFIGS[1]);
+    ::can::SocketCanTransceiver receiver2(CONFIGS[2]);
+    ::can::SocketCanTransceiver* const transceivers[] = {
+        &sender,
+        &gatewayTransceiver0,
+        &gatewayTransceiver1,
+        &gatewayTransceiver2,
+        &receiver1,
+        &receiver2};
+    LatencyListener listener1;
+    LatencyListener listener2;
+    gatewayTransceiver0.addCANFrameListener(gateway.getIngress(0U));
+    receiver1.addCANFrameListener(listener1);
+    receiver2.addCANFrameListener(listener2);
+    for (auto* const transceiver : transceivers)
+    {
+        (void)transceiver->init();
+        (void)transceiver->open();
+    }
+
+    int const framesPerRun = static_cast<int>(state.range(0));
+    ::can::CANFrame frame(0x123U);
+    frame.setPayloadLength(8U);
+    while (state.KeepRunning())
+    {
+        for (int i = 0; i < FRAMES_PER_ITERATION; i += framesPerRun)
+        {
+            for (int j = 0; j < framesPerRun; ++j)
+            {
+                uint64_t const sent = now();
+                (void)::std::memcpy(frame.getPayload(), &sent, sizeof(sent));
+                (void)sender.write(frame);
+            }
+            sender.run(framesPerRun, 0);
+            gatewayTransceiver0.run(0, framesPerRun);
+            (void)gateway.getEgress(1U).drain(gatewayTransceiver1, framesPerRun);
+            (void)gateway.getEgress(2U).drain(gatewayTransceiver2, framesPerRun);
+            gatewayTransceiver1.run(framesPerRun, 0);
+            gatewayTransceiver2.run(framesPerRun, 0);
+            receiver1.run(0, framesPerRun);
+            receiver2.run(0, framesPerRun);
+        }
+    }
+
+    uint32_t const receivedCount = listener1._receivedCount + listener2._receivedCount;
+    state.counters["forwarded"]  = gateway.getRouteStatistics(0U).forwarded;
+    state.counters["dropped"]    = gateway.getRouteStatistics(0U).dropped;
+    state.counters["received"]   = receivedCount;
+    state.counters["latency_avg_us"]
+        = (receivedCount > 0U)
+              ? (static_cast<double>(listener1._totalNs + listener2._totalNs) / receivedCount)
+                    / 1000.0
+              : 0.0;
+    state.counters["latency_max_us"]
+        = static_cast<double>(::std::max(listener1._maxNs, listener2._maxNs)) / 1000.0;
+    state.SetItemsProcessed(static_cast<int64_t>(receivedCount));
+
+    for (auto* const transceiver : transceivers)
+    {
+        (void)transceiver->close();
+    }
+    receiver2.removeCANFrameListener(listener2);
+    receiver1.removeCANFrameListener(listener1);
+    gatewayTransceiver0.removeCANFrameListener(gateway.getIngress(0U));
+}
+} // namespace
+
+void BM_gateway_one_destination(benchmark::State& state) { runGateway(state, 1U); }
+
+void BM_gateway_two_destinations(benchmark::State& state) { runGateway(state, 2U); }
+
+BENCHMARK(BM_gateway_one_destination)->RangeMultiplier(2)->Range(1, 16);
+BENCHMARK(BM_gateway_two_destinations)->RangeMultiplier(2)->Range(1, 16);
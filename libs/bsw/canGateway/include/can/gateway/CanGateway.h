@@ -0,0 +1,140 @@
+// Copyright 2024 Accenture.
+
+/**
+ * Contains CanGateway.
+ * \file CanGateway.h
+ * \ingroup gateway
+ */
+#pragma once
+
+#include "can/gateway/CanGatewayEgress.h"
+#include "can/gateway/CanGatewayFrame.h"
+#include "can/gateway/CanGatewayIngress.h"
+#include "can/gateway/CanGatewayRoutingTable.h"
+
+#include <io/JoinReader.h>
+#include <io/MemoryQueue.h>
+
+#include <etl/array.h>
+#include <etl/error_handler.h>
+#include <etl/vector.h>
+
+namespace can
+{
+/**
+ * CAN gateway between BUS_COUNT buses with statically allocated queues.
+ *
+ * There is one MemoryQueue for each pair of source and destination bus, so that each queue has a
+ * single producer (the CanGatewayIngress of the source bus) and a single consumer (the
+ * CanGatewayEgress of the destination bus). The egress of a bus reads the queues from all source
+ * buses through a JoinReader, which serves them round robin.
+ *
+ * The ingress of each bus has to be registered as listener at the transceiver of the bus, and the
+ * egress of each bus has to be drained cyclically, e.g. in the context running the transceiver.
+ *
+ * [TPARAMS_BEGIN]
+ * \tparam BUS_COUNT      Number of buses, at most CanGatewayRoutingTable::MAX_BUS_COUNT.
+ * \tparam ROUTE_COUNT    Maximum number of routes of the routing table.
+ * \tparam QUEUE_CAPACITY Size of each queue in bytes.
+ * [TPARAMS_END]
+ */
+template<size_t BUS_COUNT, size_t ROUTE_COUNT, size_t QUEUE_CAPACITY>
+class CanGateway
+{
+    static_assert(
+        (BUS_COUNT > 0U) && (BUS_COUNT <= CanGatewayRoutingTable::MAX_BUS_COUNT),
+        "invalid bus count");
+
+public:
+    using QueueType = ::io::MemoryQueue<QUEUE_CAPACITY, CanGatewayFrame::MAX_ELEMENT_SIZE>;
+
+    /**
+     * \param routingTable routes, must outlive the gateway
+     *
+     * \assert routingTable.getRouteCount() <= ROUTE_COUNT
+     */
+    explicit CanGateway(CanGatewayRoutingTable const& routingTable);
+
+    CanGateway(CanGateway const&)            = delete;
+    CanGateway& operator=(CanGateway const&) = delete;
+
+    /**
+     * \return the listener to register at the transceiver of bus
+     */
+    CanGatewayIngress& getIngress(uint8_t const bus) { return _ingresses[bus]; }
+
+    /**
+     * \return the egress to drain into the transceiver of bus
+     */
+    CanGatewayEgress& getEgress(uint8_t const bus) { return _egresses[bus]; }
+
+    /**
+     * \return the reader joining the queues to bus, its stats count the frames by source bus
+     */
+    ::io::JoinReader<BUS_COUNT> const& getJoinReader(uint8_t const bus) const
+    {
+        return _joinReaders[bus];
+    }
+
+    /**
+     * \return the statistics of the route with index routeIndex
+     */
+    CanGatewayRouteStatistics const& getRouteStatistics(size_t const routeIndex) const
+    {
+        return _statistics[routeIndex];
+    }
+
+private:
+    static constexpr size_t QUEUE_COUNT = BUS_COUNT * BUS_COUNT;
+
+    ::etl::array<QueueType, QUEUE_COUNT> _queues;
+    ::etl::vector<::io::MemoryQueueWriter<QueueType>, QUEUE_COUNT> _writers;
+    ::etl::vector<::io::MemoryQueueReader<QueueType>, QUEUE_COUNT> _readers;
+    /// writers by source bus and destination bus
+    ::etl::array<::etl::array<::io::IWriter*, BUS_COUNT>, BUS_COUNT> _destinations;
+    /// readers by destination bus and source bus
+    ::etl::array<::etl::array<::io::IReader*, BUS_COUNT>, BUS_COUNT> _sources;
+    ::etl::vector<::io::JoinReader<BUS_COUNT>, BUS_COUNT> _joinReaders;
+    ::etl::array<CanGatewayRouteStatistics, ROUTE_COUNT> _statistics;
+    ::etl::vector<CanGatewayIngress, BUS_COUNT> _ingresses;
+    ::etl::vector<CanGatewayEgress, BUS_COUNT> _egresses;
+};
+
+template<size_t BUS_COUNT, size_t ROUTE_COUNT, size_t QUEUE_CAPACITY>
+CanGateway<BUS_COUNT, ROUTE_COUNT, QUEUE_CAPACITY>::CanGateway(
+    CanGatewayRoutingTable const& routingTable)
+: _queues()
+, _writers()
+, _readers()
+, _destinations()
+, _sources()
+, _joinReaders()
+, _statistics()
+, _ingresses()
+, _egresses()
+{
+    ETL_ASSERT(
+        routingTable.getRouteCount() <= ROUTE_COUNT,
+        ETL_ERROR_GENERIC("not too many routes must be given"));
+    for (size_t source = 0U; source < BUS_COUNT; ++source)
+    {
+        for (size_t destination = 0U; destination < BUS_COUNT; ++destination)
+        {
+            QueueType& queue                   = _queues[(source * BUS_COUNT) + destination];
+            _destinations[source][destination] = &_writers.emplace_back(queue);
+            _sources[destination][source]      = &_readers.emplace_back(queue);
+        }
+    }
+    for (size_t bus = 0U; bus < BUS_COUNT; ++bus)
+    {
+        _egresses.emplace_back(_joinReaders.emplace_back(::etl::span<::io::IReader*, BUS_COUNT>(
+            _sources[bus].data(), BUS_COUNT)));
+        _ingresses.emplace_back(
+            static_cast<uint8_t>(bus),
+            routingTable,
+            ::etl::span<::io::IWriter* const>(_destinations[bus].data(), BUS_COUNT),
+            ::etl::span<CanGatewayRouteStatistics>(_statistics.data(), _statistics.size()));
+    }
+}
+
+} // namespace can
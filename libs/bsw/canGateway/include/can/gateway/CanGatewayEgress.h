@@ -0,0 +1,59 @@
+// Copyright 2024 Accenture.
+
+/**
+ * Contains CanGatewayEgress.
+ * \file CanGatewayEgress.h
+ * \ingroup gateway
+ */
+#pragma once
+
+#include <can/transceiver/ICanTransceiver.h>
+#include <io/IReader.h>
+
+namespace can
+{
+/**
+ * Transmit side of the CAN gateway for one destination bus.
+ *
+ * The egress reads the frames queued by the ingresses, e.g. through an ::io::JoinReader over the
+ * queues from all source buses, and writes them to the transceiver of its bus. It is the single
+ * consumer of its queues and is meant to be drained from the context that also runs the
+ * transceiver.
+ */
+class CanGatewayEgress
+{
+public:
+    /**
+     * \param reader reader of the queues to this bus, must outlive the egress
+     */
+    explicit CanGatewayEgress(::io::IReader& reader);
+
+    CanGatewayEgress(CanGatewayEgress const&)            = delete;
+    CanGatewayEgress& operator=(CanGatewayEgress const&) = delete;
+
+    /**
+     * Takes up to maxFrameCount queued frames and writes them to transceiver. If the transmit
+     * queue of the transceiver is full, the frame stays queued and draining stops until the next
+     * call. Frames the transceiver rejects for other reasons are counted as failed and dropped.
+     *
+     * \return number of frames written successfully
+     */
+    size_t drain(ICanTransceiver& transceiver, size_t maxFrameCount);
+
+    /**
+     * \return number of frames written to the transceiver
+     */
+    uint32_t getSentCount() const { return _sentCount; }
+
+    /**
+     * \return number of frames dropped because the transceiver rejected them
+     */
+    uint32_t getFailedCount() const { return _failedCount; }
+
+private:
+    ::io::IReader& _reader;
+    uint32_t _sentCount;
+    uint32_t _failedCount;
+};
+
+} // namespace can
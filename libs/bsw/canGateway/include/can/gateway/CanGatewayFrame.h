@@ -0,0 +1,50 @@
+// Copyright 2024 Accenture.
+
+/**
+ * Contains CanGatewayFrame.
+ * \file CanGatewayFrame.h
+ * \ingroup gateway
+ */
+#pragma once
+
+#include <can/canframes/CANFrame.h>
+#include <etl/span.h>
+
+namespace can
+{
+/**
+ * Layout of a CANFrame in a gateway queue.
+ *
+ * Each queue element holds the identifier and the timestamp of the frame followed by its payload,
+ * so the payload length is given by the element size. Both words are stored in host byte order,
+ * the queues never leave the ECU.
+ */
+struct CanGatewayFrame
+{
+    /// Size of the identifier and timestamp in front of the payload.
+    static constexpr size_t HEADER_SIZE      = 2U * sizeof(uint32_t);
+    /// Size of the largest element, to be used as maximum element size of a gateway queue.
+    static constexpr size_t MAX_ELEMENT_SIZE = HEADER_SIZE + CANFrame::MAX_FRAME_LENGTH;
+
+    /**
+     * \return size of the element holding frame
+     */
+    static size_t getElementSize(CANFrame const& frame)
+    {
+        return HEADER_SIZE + static_cast<size_t>(frame.getPayloadLength());
+    }
+
+    /**
+     * Writes frame with identifier id into element.
+     * \pre element.size() == getElementSize(frame)
+     */
+    static void encode(CANFrame const& frame, uint32_t id, ::etl::span<uint8_t> element);
+
+    /**
+     * Reads element into frame.
+     * \return false if element is no valid element, frame is unchanged then
+     */
+    static bool decode(::etl::span<uint8_t const> element, CANFrame& frame);
+};
+
+} // namespace can
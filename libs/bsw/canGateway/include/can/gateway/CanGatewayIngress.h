@@ -0,0 +1,75 @@
+// Copyright 2024 Accenture.
+
+/**
+ * Contains CanGatewayIngress.
+ * \file CanGatewayIngress.h
+ * \ingroup gateway
+ */
+#pragma once
+
+#include "can/gateway/CanGatewayRoutingTable.h"
+
+#include <can/filter/IntervalFilter.h>
+#include <can/framemgmt/ICANFrameListener.h>
+#include <io/IWriter.h>
+
+#include <etl/span.h>
+
+namespace can
+{
+/**
+ * Receive side of the CAN gateway for one source bus.
+ *
+ * The ingress is registered as ICANFrameListener at the transceiver of its source bus. It looks
+ * up the route of each received frame and writes the frame directly into the queue of each
+ * destination bus of the route, without any intermediate buffer. If a frame goes to several
+ * destinations, it is encoded once and the encoded element is copied into the other queues, like
+ * ::io::SplitWriter does.
+ *
+ * The filter of the ingress covers the range from the smallest to the largest identifier of the
+ * routes of its bus, the exact routes are checked in frameReceived().
+ *
+ * The ingress is the single producer of its destination queues, so each source bus needs its own
+ * queue per destination. ::io::JoinReader can be used to merge the queues of a destination bus.
+ */
+class CanGatewayIngress : public ICANFrameListener
+{
+public:
+    /**
+     * \param sourceBus     index of the bus this ingress receives from
+     * \param routingTable  routes, must outlive the ingress
+     * \param destinations  writer of the queue to destination bus n at index n, nullptr for a
+     *                      bus without queue, must outlive the ingress
+     * \param statistics    statistics of the routes by route index, must outlive the ingress
+     *
+     * \assert each destination bus of the routes of sourceBus has a writer
+     * \assert statistics.size() >= routingTable.getRouteCount()
+     */
+    CanGatewayIngress(
+        uint8_t sourceBus,
+        CanGatewayRoutingTable const& routingTable,
+        ::etl::span<::io::IWriter* const> destinations,
+        ::etl::span<CanGatewayRouteStatistics> statistics);
+
+    /**
+     * Forwards canFrame according to its route.
+     */
+    void frameReceived(CANFrame const& canFrame) override;
+
+    IFilter& getFilter() override { return _filter; }
+
+    /**
+     * \return number of frames that passed the filter but have no route
+     */
+    uint32_t getUnroutedCount() const { return _unroutedCount; }
+
+private:
+    CanGatewayRoutingTable const& _routingTable;
+    ::etl::span<::io::IWriter* const> _destinations;
+    ::etl::span<CanGatewayRouteStatistics> _statistics;
+    IntervalFilter _filter;
+    uint32_t _unroutedCount;
+    uint8_t _sourceBus;
+};
+
+} // namespace can
@@ -0,0 +1,52 @@
+// Copyright 2024 Accenture.
+
+/**
+ * Contains CanGatewayRoute and CanGatewayRouteStatistics.
+ * \file CanGatewayRoute.h
+ * \ingroup gateway
+ */
+#pragma once
+
+#include <can/canframes/CanId.h>
+#include <platform/estdint.h>
+
+namespace can
+{
+/**
+ * A route of the CAN gateway: all frames received on the source bus with an identifier in
+ * [firstId, lastId] are forwarded to each bus set in the destination mask.
+ *
+ * The identifiers are given as CanId values, i.e. extended identifiers carry
+ * CanId::EXTENDED_QUALIFIER_BIT. If remappedFirstId is set, the identifiers are shifted so that
+ * firstId is forwarded as remappedFirstId, firstId + 1 as remappedFirstId + 1 and so on.
+ */
+struct CanGatewayRoute
+{
+    /// Value of remappedFirstId for routes forwarding the frames with unchanged identifiers.
+    static constexpr uint32_t NO_REMAP = CanId::INVALID_ID;
+
+    /// Index of the bus the frames are received on.
+    uint8_t sourceBus;
+    /// First identifier of the route.
+    uint32_t firstId;
+    /// Last identifier of the route.
+    uint32_t lastId;
+    /// Bit n is set if the frames are forwarded to the bus with index n.
+    uint8_t destinationMask;
+    /// Identifier firstId is forwarded as, or NO_REMAP.
+    uint32_t remappedFirstId = NO_REMAP;
+};
+
+/**
+ * Counters of a single CanGatewayRoute. They are updated in the receive context of the source bus
+ * only, so they can be read from other contexts without locking but may be slightly outdated.
+ */
+struct CanGatewayRouteStatistics
+{
+    /// Number of frames put into a destination queue, counted once per destination.
+    uint32_t forwarded = 0U;
+    /// Number of frames lost because a destination queue was full, counted once per destination.
+    uint32_t dropped   = 0U;
+};
+
+} // namespace can
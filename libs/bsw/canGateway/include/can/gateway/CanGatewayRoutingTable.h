@@ -0,0 +1,80 @@
+// Copyright 2024 Accenture.
+
+/**
+ * Contains CanGatewayRoutingTable.
+ * \file CanGatewayRoutingTable.h
+ * \ingroup gateway
+ */
+#pragma once
+
+#include "can/gateway/CanGatewayRoute.h"
+
+#include <etl/array.h>
+#include <etl/span.h>
+
+namespace can
+{
+/**
+ * Compiled lookup structure over a constant array of CanGatewayRoutes.
+ *
+ * The routes must be sorted by source bus and first identifier, and the identifier ranges of the
+ * routes of a source bus must not overlap. The constructor checks this and records where the
+ * routes of each source bus start, so that findRoute() only has to do a binary search within the
+ * routes of one bus. Nothing is copied, the routes are referenced for the lifetime of the table.
+ */
+class CanGatewayRoutingTable
+{
+public:
+    /// Maximum number of buses, limited by the width of CanGatewayRoute::destinationMask.
+    static constexpr size_t MAX_BUS_COUNT = 8U;
+    /// Value returned by findRoute() for frames without route.
+    static constexpr size_t NO_ROUTE      = 0xFFFFFFFFU;
+
+    /**
+     * Compiles the routing table.
+     * \param routes sorted routes, must outlive the table
+     *
+     * \assert routes are sorted by sourceBus and firstId
+     * \assert routes of the same source bus don't overlap
+     * \assert sourceBus < MAX_BUS_COUNT and firstId <= lastId for each route
+     */
+    explicit CanGatewayRoutingTable(::etl::span<CanGatewayRoute const> routes);
+
+    CanGatewayRoutingTable(CanGatewayRoutingTable const&)            = delete;
+    CanGatewayRoutingTable& operator=(CanGatewayRoutingTable const&) = delete;
+
+    /**
+     * \return index of the route of a frame with identifier id received on sourceBus, NO_ROUTE
+     *         if there is none
+     */
+    size_t findRoute(uint8_t sourceBus, uint32_t id) const;
+
+    /**
+     * \return the routes of the given source bus
+     */
+    ::etl::span<CanGatewayRoute const> getRoutes(uint8_t sourceBus) const;
+
+    /**
+     * \return the route with index idx
+     */
+    CanGatewayRoute const& getRoute(size_t const idx) const { return _routes[idx]; }
+
+    /**
+     * \return index of the first route of the given source bus
+     */
+    size_t getFirstRouteIndex(uint8_t const sourceBus) const
+    {
+        return _busOffsets[static_cast<size_t>(sourceBus)];
+    }
+
+    /**
+     * \return number of routes
+     */
+    size_t getRouteCount() const { return _routes.size(); }
+
+private:
+    ::etl::span<CanGatewayRoute const> _routes;
+    ::etl::array<size_t, MAX_BUS_COUNT + 1U> _busOffsets;
+};
+
+} // namespace can
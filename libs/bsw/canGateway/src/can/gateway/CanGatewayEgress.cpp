@@ -0,0 +1,50 @@
+// Copyright 2024 Accenture.
+
+#include "can/gateway/CanGatewayEgress.h"
+
+#include "can/gateway/CanGatewayFrame.h"
+
+namespace can
+{
+CanGatewayEgress::CanGatewayEgress(::io::IReader& reader)
+: _reader(reader), _sentCount(0U), _failedCount(0U)
+{}
+
+size_t CanGatewayEgress::drain(ICanTransceiver& transceiver, size_t const maxFrameCount)
+{
+    size_t count = 0U;
+    CANFrame frame;
+    for (size_t idx = 0U; idx < maxFrameCount; ++idx)
+    {
+        ::etl::span<uint8_t const> const element = _reader.peek();
+        if (element.size() == 0U)
+        {
+            break;
+        }
+        if (!CanGatewayFrame::decode(element, frame))
+        {
+            ++_failedCount;
+            _reader.release();
+            continue;
+        }
+        ICanTransceiver::ErrorCode const result = transceiver.write(frame);
+        if (result == ICanTransceiver::ErrorCode::CAN_ERR_TX_HW_QUEUE_FULL)
+        {
+            // keep the frame for the next call
+            break;
+        }
+        _reader.release();
+        if (result == ICanTransceiver::ErrorCode::CAN_ERR_OK)
+        {
+            ++_sentCount;
+            ++count;
+        }
+        else
+        {
+            ++_failedCount;
+        }
+    }
+    return count;
+}
+
+} // namespace can
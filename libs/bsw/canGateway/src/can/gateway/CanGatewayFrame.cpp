@@ -0,0 +1,41 @@
+// Copyright 2024 Accenture.
+
+#include "can/gateway/CanGatewayFrame.h"
+
+#include <cstring>
+
+namespace can
+{
+constexpr size_t CanGatewayFrame::HEADER_SIZE;
+constexpr size_t CanGatewayFrame::MAX_ELEMENT_SIZE;
+
+void CanGatewayFrame::encode(
+    CANFrame const& frame, uint32_t const id, ::etl::span<uint8_t> const element)
+{
+    uint32_t const timestamp = frame.timestamp();
+    (void)::std::memcpy(element.data(), &id, sizeof(id));
+    (void)::std::memcpy(element.data() + sizeof(id), &timestamp, sizeof(timestamp));
+    (void)::std::memcpy(
+        element.data() + HEADER_SIZE,
+        frame.getPayload(),
+        static_cast<size_t>(frame.getPayloadLength()));
+}
+
+bool CanGatewayFrame::decode(::etl::span<uint8_t const> const element, CANFrame& frame)
+{
+    if ((element.size() < HEADER_SIZE) || (element.size() > MAX_ELEMENT_SIZE))
+    {
+        return false;
+    }
+    uint32_t id        = 0U;
+    uint32_t timestamp = 0U;
+    (void)::std::memcpy(&id, element.data(), sizeof(id));
+    (void)::std::memcpy(&timestamp, element.data() + sizeof(id), sizeof(timestamp));
+    frame.setId(id);
+    frame.setTimestamp(timestamp);
+    frame.setPayload(
+        element.data() + HEADER_SIZE, static_cast<uint8_t>(element.size() - HEADER_SIZE));
+    return true;
+}
+
+} // namespace can
@@ -0,0 +1,92 @@
+// Copyright 2024 Accenture.
+
+#include "can/gateway/CanGatewayIngress.h"
+
+#include "can/gateway/CanGatewayFrame.h"
+
+#include <etl/error_handler.h>
+#include <etl/memory.h>
+
+namespace can
+{
+CanGatewayIngress::CanGatewayIngress(
+    uint8_t const sourceBus,
+    CanGatewayRoutingTable const& routingTable,
+    ::etl::span<::io::IWriter* const> const destinations,
+    ::etl::span<CanGatewayRouteStatistics> const statistics)
+: ICANFrameListener()
+, _routingTable(routingTable)
+, _destinations(destinations)
+, _statistics(statistics)
+, _filter()
+, _unroutedCount(0U)
+, _sourceBus(sourceBus)
+{
+    ETL_ASSERT(
+        _statistics.size() >= _routingTable.getRouteCount(),
+        ETL_ERROR_GENERIC("statistics must be given for all routes"));
+    for (CanGatewayRoute const& route : _routingTable.getRoutes(_sourceBus))
+    {
+        for (size_t bus = 0U; bus < CanGatewayRoutingTable::MAX_BUS_COUNT; ++bus)
+        {
+            ETL_ASSERT(
+                ((route.destinationMask & (1U << bus)) == 0U)
+                    || ((bus < _destinations.size()) && (_destinations[bus] != nullptr)),
+                ETL_ERROR_GENERIC("destination buses must have a writer"));
+        }
+        _filter.add(route.firstId, route.lastId);
+    }
+}
+
+void CanGatewayIngress::frameReceived(CANFrame const& canFrame)
+{
+    uint32_t const id        = canFrame.getId();
+    size_t const routeIndex  = _routingTable.findRoute(_sourceBus, id);
+    if (routeIndex == CanGatewayRoutingTable::NO_ROUTE)
+    {
+        ++_unroutedCount;
+        return;
+    }
+    CanGatewayRoute const& route          = _routingTable.getRoute(routeIndex);
+    CanGatewayRouteStatistics& statistics = _statistics[routeIndex];
+    uint32_t const forwardedId            = (route.remappedFirstId == CanGatewayRoute::NO_REMAP)
+                                                ? id
+                                                : (route.remappedFirstId + (id - route.firstId));
+    size_t const size                     = CanGatewayFrame::getElementSize(canFrame);
+
+    // encode into the first destination with free space, then copy from there
+    ::io::IWriter* encoded = nullptr;
+    ::etl::span<uint8_t> element;
+    for (size_t bus = 0U; bus < _destinations.size(); ++bus)
+    {
+        if ((route.destinationMask & (1U << bus)) == 0U)
+        {
+            continue;
+        }
+        ::io::IWriter& writer           = *_destinations[bus];
+        ::etl::span<uint8_t> const data = writer.allocate(size);
+        if (data.size() < size)
+        {
+            ++statistics.dropped;
+        }
+        else if (encoded == nullptr)
+        {
+            CanGatewayFrame::encode(canFrame, forwardedId, data);
+            encoded = &writer;
+            element = data;
+        }
+        else
+        {
+            (void)::etl::mem_copy(element.begin(), element.size(), data.begin());
+            writer.commit();
+            ++statistics.forwarded;
+        }
+    }
+    if (encoded != nullptr)
+    {
+        encoded->commit();
+        ++statistics.forwarded;
+    }
+}
+
+} // namespace can
@@ -0,0 +1,72 @@
+// Copyright 2024 Accenture.
+
+#include "can/gateway/CanGatewayRoutingTable.h"
+
+#include <etl/algorithm.h>
+#include <etl/error_handler.h>
+
+namespace can
+{
+constexpr uint32_t CanGatewayRoute::NO_REMAP;
+constexpr size_t CanGatewayRoutingTable::MAX_BUS_COUNT;
+constexpr size_t CanGatewayRoutingTable::NO_ROUTE;
+
+CanGatewayRoutingTable::CanGatewayRoutingTable(::etl::span<CanGatewayRoute const> const routes)
+: _routes(routes), _busOffsets()
+{
+    size_t bus = 0U;
+    for (size_t idx = 0U; idx < _routes.size(); ++idx)
+    {
+        CanGatewayRoute const& route = _routes[idx];
+        ETL_ASSERT(
+            static_cast<size_t>(route.sourceBus) < MAX_BUS_COUNT,
+            ETL_ERROR_GENERIC("source bus must be valid"));
+        ETL_ASSERT(route.firstId <= route.lastId, ETL_ERROR_GENERIC("range must not be empty"));
+        ETL_ASSERT(
+            static_cast<size_t>(route.sourceBus) >= bus,
+            ETL_ERROR_GENERIC("routes must be sorted by source bus"));
+        ETL_ASSERT(
+            (idx == 0U) || (route.sourceBus != _routes[idx - 1U].sourceBus)
+                || (route.firstId > _routes[idx - 1U].lastId),
+            ETL_ERROR_GENERIC("routes must be sorted by id and must not overlap"));
+        while (bus < static_cast<size_t>(route.sourceBus))
+        {
+            ++bus;
+            _busOffsets[bus] = idx;
+        }
+    }
+    while (bus < MAX_BUS_COUNT)
+    {
+        ++bus;
+        _busOffsets[bus] = _routes.size();
+    }
+}
+
+size_t CanGatewayRoutingTable::findRoute(uint8_t const sourceBus, uint32_t const id) const
+{
+    if (static_cast<size_t>(sourceBus) >= MAX_BUS_COUNT)
+    {
+        return NO_ROUTE;
+    }
+    ::etl::span<CanGatewayRoute const> const routes = getRoutes(sourceBus);
+    // first route starting behind id, the route before it is the only candidate
+    auto const it = ::etl::upper_bound(
+        routes.begin(),
+        routes.end(),
+        id,
+        [](uint32_t const value, CanGatewayRoute const& route) { return value < route.firstId; });
+    if ((it == routes.begin()) || (id > (it - 1)->lastId))
+    {
+        return NO_ROUTE;
+    }
+    return getFirstRouteIndex(sourceBus) + static_cast<size_t>((it - 1) - routes.begin());
+}
+
+::etl::span<CanGatewayRoute const> CanGatewayRoutingTable::getRoutes(uint8_t const sourceBus) const
+{
+    size_t const first = _busOffsets[static_cast<size_t>(sourceBus)];
+    size_t const last  = _busOffsets[static_cast<size_t>(sourceBus) + 1U];
+    return _routes.subspan(first, last - first);
+}
+
+} // namespace can
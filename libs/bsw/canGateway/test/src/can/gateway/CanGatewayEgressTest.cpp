@@ -0,0 +1,116 @@
+// Copyright 2024 Accenture.
+
+#include "can/gateway/CanGatewayEgress.h"
+
+#include "can/gateway/CanGatewayFrame.h"
+
+#include <can/transceiver/ICanTransceiverMock.h>
+#include <io/MemoryQueue.h>
+
+#include <gmock/gmock.h>
+
+namespace
+{
+using namespace ::can;
+using namespace ::testing;
+
+using Queue  = ::io::MemoryQueue<256U, CanGatewayFrame::MAX_ELEMENT_SIZE>;
+using Writer = ::io::MemoryQueueWriter<Queue>;
+using Reader = ::io::MemoryQueueReader<Queue>;
+
+struct CanGatewayEgressTest : public Test
+{
+    CanGatewayEgressTest() : _writer(_queue), _reader(_queue) {}
+
+    void push(uint32_t const id)
+    {
+        uint8_t const payload[] = {0x11U, 0x22U, 0x33U};
+        CANFrame const frame(id, payload, sizeof(payload));
+        ::etl::span<uint8_t> const element
+            = _writer.allocate(CanGatewayFrame::getElementSize(frame));
+        CanGatewayFrame::encode(frame, id, element);
+        _writer.commit();
+    }
+
+    static Matcher<CANFrame const&> frameWithId(uint32_t const id)
+    {
+        uint8_t const payload[] = {0x11U, 0x22U, 0x33U};
+        return Eq(CANFrame(id, payload, sizeof(payload)));
+    }
+
+    Queue _queue;
+    Writer _writer;
+    Reader _reader;
+    StrictMock<ICanTransceiverMock> _transceiverMock;
+};
+
+TEST_F(CanGatewayEgressTest, testDrainWritesQueuedFrames)
+{
+    CanGatewayEgress cut(_reader);
+    EXPECT_EQ(0U, cut.drain(_transceiverMock, 10U));
+
+    push(0x100U);
+    push(0x101U);
+    push(0x102U);
+    {
+        InSequence sequence;
+        EXPECT_CALL(_transceiverMock, write(frameWithId(0x100U)))
+            .WillOnce(Return(ICanTransceiver::ErrorCode::CAN_ERR_OK));
+        EXPECT_CALL(_transceiverMock, write(frameWithId(0x101U)))
+            .WillOnce(Return(ICanTransceiver::ErrorCode::CAN_ERR_OK));
+    }
+    EXPECT_EQ(2U, cut.drain(_transceiverMock, 2U));
+    Mock::VerifyAndClearExpectations(&_transceiverMock);
+
+    EXPECT_CALL(_transceiverMock, write(frameWithId(0x102U)))
+        .WillOnce(Return(ICanTransceiver::ErrorCode::CAN_ERR_OK));
+    EXPECT_EQ(1U, cut.drain(_transceiverMock, 2U));
+    EXPECT_EQ(0U, _reader.peek().size());
+    EXPECT_EQ(3U, cut.getSentCount());
+    EXPECT_EQ(0U, cut.getFailedCount());
+}
+
+TEST_F(CanGatewayEgressTest, testFrameIsKeptIfTransmitQueueIsFull)
+{
+    CanGatewayEgress cut(_reader);
+    push(0x100U);
+    push(0x101U);
+    EXPECT_CALL(_transceiverMock, write(frameWithId(0x100U)))
+        .WillOnce(Return(ICanTransceiver::ErrorCode::CAN_ERR_TX_HW_QUEUE_FULL));
+    EXPECT_EQ(0U, cut.drain(_transceiverMock, 10U));
+    Mock::VerifyAndClearExpectations(&_transceiverMock);
+
+    EXPECT_CALL(_transceiverMock, write(frameWithId(0x100U)))
+        .WillOnce(Return(ICanTransceiver::ErrorCode::CAN_ERR_OK));
+    EXPECT_CALL(_transceiverMock, write(frameWithId(0x101U)))
+        .WillOnce(Return(ICanTransceiver::ErrorCode::CAN_ERR_OK));
+    EXPECT_EQ(2U, cut.drain(_transceiverMock, 10U));
+    EXPECT_EQ(0U, cut.getFailedCount());
+}
+
+TEST_F(CanGatewayEgressTest, testRejectedFrameIsDropped)
+{
+    CanGatewayEgress cut(_reader);
+    push(0x100U);
+    push(0x101U);
+    EXPECT_CALL(_transceiverMock, write(frameWithId(0x100U)))
+        .WillOnce(Return(ICanTransceiver::ErrorCode::CAN_ERR_TX_OFFLINE));
+    EXPECT_CALL(_transceiverMock, write(frameWithId(0x101U)))
+        .WillOnce(Return(ICanTransceiver::ErrorCode::CAN_ERR_OK));
+    EXPECT_EQ(1U, cut.drain(_transceiverMock, 10U));
+    EXPECT_EQ(1U, cut.getSentCount());
+    EXPECT_EQ(1U, cut.getFailedCount());
+    EXPECT_EQ(0U, _reader.peek().size());
+}
+
+TEST_F(CanGatewayEgressTest, testInvalidElementIsDropped)
+{
+    CanGatewayEgress cut(_reader);
+    (void)_writer.allocate(CanGatewayFrame::HEADER_SIZE - 1U);
+    _writer.commit();
+    EXPECT_EQ(0U, cut.drain(_transceiverMock, 10U));
+    EXPECT_EQ(1U, cut.getFailedCount());
+    EXPECT_EQ(0U, _reader.peek().size());
+}
+
+} // anonymous namespace
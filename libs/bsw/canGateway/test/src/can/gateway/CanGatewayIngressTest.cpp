@@ -0,0 +1,158 @@
+// Copyright 2024 Accenture.
+
+#include "can/gateway/CanGatewayIngress.h"
+
+#include "can/gateway/CanGatewayFrame.h"
+
+#include <io/MemoryQueue.h>
+
+#include <etl/error_handler.h>
+
+#include <gmock/gmock.h>
+
+namespace
+{
+using namespace ::can;
+
+// holds two frames with a payload of 8 bytes
+size_t const QUEUE_CAPACITY = 2U * (CanGatewayFrame::HEADER_SIZE + 8U + sizeof(uint16_t));
+using Queue                 = ::io::MemoryQueue<QUEUE_CAPACITY, CanGatewayFrame::MAX_ELEMENT_SIZE>;
+using Writer                = ::io::MemoryQueueWriter<Queue>;
+using Reader                = ::io::MemoryQueueReader<Queue>;
+
+CanGatewayRoute const ROUTES[] = {
+    {0U, 0x100U, 0x10FU, 0x02U},
+    {0U, 0x200U, 0x20FU, 0x06U, 0x280U},
+    {0U, 0x300U, 0x3FFU, 0x02U},
+    {1U, 0x100U, 0x1FFU, 0x01U},
+};
+
+struct CanGatewayIngressTest : public ::testing::Test
+{
+    CanGatewayIngressTest()
+    : _routingTable(ROUTES)
+    , _writer1(_queue1)
+    , _writer2(_queue2)
+    , _reader1(_queue1)
+    , _reader2(_queue2)
+    , _destinations{nullptr, &_writer1, &_writer2}
+    , _statistics()
+    {}
+
+    static CANFrame createFrame(uint32_t const id, uint8_t const length)
+    {
+        uint8_t const payload[] = {1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U};
+        CANFrame frame(id, payload, length);
+        frame.setTimestamp(id + 1000U);
+        return frame;
+    }
+
+    static CANFrame pop(Reader& reader)
+    {
+        CANFrame frame;
+        EXPECT_TRUE(CanGatewayFrame::decode(reader.peek(), frame));
+        reader.release();
+        return frame;
+    }
+
+    CanGatewayRoutingTable _routingTable;
+    Queue _queue1;
+    Queue _queue2;
+    Writer _writer1;
+    Writer _writer2;
+    Reader _reader1;
+    Reader _reader2;
+    ::io::IWriter* _destinations[3];
+    CanGatewayRouteStatistics _statistics[4];
+};
+
+TEST_F(CanGatewayIngressTest, testFilterCoversRoutesOfSourceBus)
+{
+    CanGatewayIngress cut(0U, _routingTable, _destinations, _statistics);
+    EXPECT_FALSE(cut.getFilter().match(0x0FFU));
+    EXPECT_TRUE(cut.getFilter().match(0x100U));
+    EXPECT_TRUE(cut.getFilter().match(0x3FFU));
+    EXPECT_FALSE(cut.getFilter().match(0x400U));
+}
+
+TEST_F(CanGatewayIngressTest, testForwardFrame)
+{
+    CanGatewayIngress cut(0U, _routingTable, _destinations, _statistics);
+    CANFrame const frame = createFrame(0x105U, 5U);
+    cut.frameReceived(frame);
+
+    EXPECT_EQ(0U, _reader2.peek().size());
+    CANFrame const forwarded = pop(_reader1);
+    EXPECT_EQ(frame, forwarded);
+    EXPECT_EQ(frame.timestamp(), forwarded.timestamp());
+    EXPECT_EQ(0U, _reader1.peek().size());
+    EXPECT_EQ(1U, _statistics[0].forwarded);
+    EXPECT_EQ(0U, _statistics[0].dropped);
+}
+
+TEST_F(CanGatewayIngressTest, testForwardRemappedFrameToSeveralDestinations)
+{
+    CanGatewayIngress cut(0U, _routingTable, _destinations, _statistics);
+    cut.frameReceived(createFrame(0x203U, 8U));
+
+    CANFrame const expected = createFrame(0x283U, 8U);
+    EXPECT_EQ(expected, pop(_reader1));
+    EXPECT_EQ(expected, pop(_reader2));
+    EXPECT_EQ(2U, _statistics[1].forwarded);
+}
+
+TEST_F(CanGatewayIngressTest, testDropFrameIfQueueIsFull)
+{
+    CanGatewayIngress cut(0U, _routingTable, _destinations, _statistics);
+    cut.frameReceived(createFrame(0x300U, 8U));
+    cut.frameReceived(createFrame(0x301U, 8U));
+    EXPECT_EQ(2U, _statistics[2].forwarded);
+    cut.frameReceived(createFrame(0x302U, 8U));
+    EXPECT_EQ(1U, _statistics[2].dropped);
+
+    // a full destination doesn't block the other ones
+    cut.frameReceived(createFrame(0x200U, 0U));
+    EXPECT_EQ(1U, _statistics[1].forwarded);
+    EXPECT_EQ(1U, _statistics[1].dropped);
+    EXPECT_EQ(createFrame(0x280U, 0U), pop(_reader2));
+
+    EXPECT_EQ(createFrame(0x300U, 8U), pop(_reader1));
+    EXPECT_EQ(createFrame(0x301U, 8U), pop(_reader1));
+    EXPECT_EQ(0U, _reader1.peek().size());
+}
+
+TEST_F(CanGatewayIngressTest, testCountUnroutedFrames)
+{
+    CanGatewayIngress cut(0U, _routingTable, _destinations, _statistics);
+    cut.frameReceived(createFrame(0x110U, 1U));
+    EXPECT_EQ(1U, cut.getUnroutedCount());
+    EXPECT_EQ(0U, _reader1.peek().size());
+    EXPECT_EQ(0U, _reader2.peek().size());
+}
+
+TEST_F(CanGatewayIngressTest, testAssertsMissingDestination)
+{
+    ASSERT_THROW(
+        { CanGatewayIngress cut(1U, _routingTable, _destinations, _statistics); },
+        ::etl::exception);
+    ASSERT_THROW(
+        {
+            CanGatewayIngress cut(
+                0U,
+                _routingTable,
+                ::etl::span<::io::IWriter* const>(_destinations, 2U),
+                _statistics);
+        },
+        ::etl::exception);
+    ASSERT_THROW(
+        {
+            CanGatewayIngress cut(
+                0U,
+                _routingTable,
+                _destinations,
+                ::etl::span<CanGatewayRouteStatistics>(_statistics, 3U));
+        },
+        ::etl::exception);
+}
+
+} // anonymous namespace
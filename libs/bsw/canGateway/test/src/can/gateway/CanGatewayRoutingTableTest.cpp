@@ -0,0 +1,86 @@
+// Copyright 2024 Accenture.
+
+#include "can/gateway/CanGatewayRoutingTable.h"
+
+#include <etl/error_handler.h>
+
+#include <gmock/gmock.h>
+
+namespace
+{
+using namespace ::can;
+
+CanGatewayRoute const ROUTES[] = {
+    {0U, 0x100U, 0x10FU, 0x02U},
+    {0U, 0x200U, 0x200U, 0x06U, 0x280U},
+    {0U, CanId::extended(0x1000U), CanId::extended(0x1FFFU), 0x02U},
+    {2U, 0x100U, 0x1FFU, 0x01U},
+};
+
+TEST(CanGatewayRoutingTableTest, testFindRoute)
+{
+    CanGatewayRoutingTable const cut(ROUTES);
+    EXPECT_EQ(4U, cut.getRouteCount());
+
+    EXPECT_EQ(CanGatewayRoutingTable::NO_ROUTE, cut.findRoute(0U, 0x0FFU));
+    EXPECT_EQ(0U, cut.findRoute(0U, 0x100U));
+    EXPECT_EQ(0U, cut.findRoute(0U, 0x10FU));
+    EXPECT_EQ(CanGatewayRoutingTable::NO_ROUTE, cut.findRoute(0U, 0x110U));
+    EXPECT_EQ(1U, cut.findRoute(0U, 0x200U));
+    EXPECT_EQ(CanGatewayRoutingTable::NO_ROUTE, cut.findRoute(0U, 0x201U));
+    EXPECT_EQ(CanGatewayRoutingTable::NO_ROUTE, cut.findRoute(0U, 0x1000U));
+    EXPECT_EQ(2U, cut.findRoute(0U, CanId::extended(0x1800U)));
+
+    EXPECT_EQ(CanGatewayRoutingTable::NO_ROUTE, cut.findRoute(1U, 0x100U));
+    EXPECT_EQ(3U, cut.findRoute(2U, 0x100U));
+    EXPECT_EQ(3U, cut.findRoute(2U, 0x1FFU));
+    EXPECT_EQ(CanGatewayRoutingTable::NO_ROUTE, cut.findRoute(3U, 0x100U));
+    EXPECT_EQ(
+        CanGatewayRoutingTable::NO_ROUTE,
+        cut.findRoute(CanGatewayRoutingTable::MAX_BUS_COUNT, 0x100U));
+}
+
+TEST(CanGatewayRoutingTableTest, testGetRoutes)
+{
+    CanGatewayRoutingTable const cut(ROUTES);
+    EXPECT_EQ(3U, cut.getRoutes(0U).size());
+    EXPECT_EQ(&ROUTES[0], cut.getRoutes(0U).data());
+    EXPECT_EQ(0U, cut.getFirstRouteIndex(0U));
+    EXPECT_EQ(0U, cut.getRoutes(1U).size());
+    EXPECT_EQ(1U, cut.getRoutes(2U).size());
+    EXPECT_EQ(3U, cut.getFirstRouteIndex(2U));
+    EXPECT_EQ(0U, cut.getRoutes(3U).size());
+    EXPECT_EQ(0x280U, cut.getRoute(1U).remappedFirstId);
+    EXPECT_EQ(CanGatewayRoute::NO_REMAP, cut.getRoute(3U).remappedFirstId);
+}
+
+TEST(CanGatewayRoutingTableTest, testEmptyTable)
+{
+    CanGatewayRoutingTable const cut(::etl::span<CanGatewayRoute const>{});
+    EXPECT_EQ(0U, cut.getRouteCount());
+    EXPECT_EQ(CanGatewayRoutingTable::NO_ROUTE, cut.findRoute(0U, 0x100U));
+    EXPECT_EQ(0U, cut.getRoutes(7U).size());
+}
+
+TEST(CanGatewayRoutingTableTest, testAssertsInvalidRoutes)
+{
+    CanGatewayRoute const unsortedBuses[]
+        = {{1U, 0x100U, 0x1FFU, 0x01U}, {0U, 0x300U, 0x3FFU, 0x02U}};
+    ASSERT_THROW({ CanGatewayRoutingTable cut(unsortedBuses); }, ::etl::exception);
+
+    CanGatewayRoute const unsortedIds[]
+        = {{0U, 0x300U, 0x3FFU, 0x02U}, {0U, 0x100U, 0x1FFU, 0x02U}};
+    ASSERT_THROW({ CanGatewayRoutingTable cut(unsortedIds); }, ::etl::exception);
+
+    CanGatewayRoute const overlapping[]
+        = {{0U, 0x100U, 0x1FFU, 0x02U}, {0U, 0x1FFU, 0x2FFU, 0x04U}};
+    ASSERT_THROW({ CanGatewayRoutingTable cut(overlapping); }, ::etl::exception);
+
+    CanGatewayRoute const emptyRange[] = {{0U, 0x101U, 0x100U, 0x02U}};
+    ASSERT_THROW({ CanGatewayRoutingTable cut(emptyRange); }, ::etl::exception);
+
+    CanGatewayRoute const invalidBus[] = {{8U, 0x100U, 0x1FFU, 0x02U}};
+    ASSERT_THROW({ CanGatewayRoutingTable cut(invalidBus); }, ::etl::exception);
+}
+
+} // anonymous namespace
@@ -0,0 +1,63 @@
+// Copyright 2024 Accenture.
+
+#include "can/gateway/CanGateway.h"
+
+#include <can/transceiver/ICanTransceiverMock.h>
+
+#include <gmock/gmock.h>
+
+namespace
+{
+using namespace ::can;
+using namespace ::testing;
+
+CanGatewayRoute const ROUTES[] = {
+    {0U, 0x100U, 0x1FFU, 0x04U},
+    {1U, 0x200U, 0x2FFU, 0x05U, 0x600U},
+};
+
+TEST(CanGatewayTest, testRouteFramesBetweenBuses)
+{
+    CanGatewayRoutingTable const routingTable(ROUTES);
+    CanGateway<3U, 4U, 256U> cut(routingTable);
+    StrictMock<ICanTransceiverMock> transceiverMock0;
+    StrictMock<ICanTransceiverMock> transceiverMock2;
+
+    cut.getIngress(0U).frameReceived(CANFrame(0x123U));
+    cut.getIngress(1U).frameReceived(CANFrame(0x234U));
+    cut.getIngress(1U).frameReceived(CANFrame(0x345U));
+    cut.getIngress(0U).frameReceived(CANFrame(0x124U));
+
+    // the queues from all source buses are served round robin
+    {
+        InSequence sequence;
+        EXPECT_CALL(transceiverMock2, write(Property(&CANFrame::getId, 0x123U)))
+            .WillOnce(Return(ICanTransceiver::ErrorCode::CAN_ERR_OK));
+        EXPECT_CALL(transceiverMock2, write(Property(&CANFrame::getId, 0x634U)))
+            .WillOnce(Return(ICanTransceiver::ErrorCode::CAN_ERR_OK));
+        EXPECT_CALL(transceiverMock2, write(Property(&CANFrame::getId, 0x124U)))
+            .WillOnce(Return(ICanTransceiver::ErrorCode::CAN_ERR_OK));
+    }
+    EXPECT_EQ(3U, cut.getEgress(2U).drain(transceiverMock2, 10U));
+    EXPECT_EQ(0U, cut.getEgress(1U).drain(transceiverMock2, 10U));
+    EXPECT_CALL(transceiverMock0, write(Property(&CANFrame::getId, 0x634U)))
+        .WillOnce(Return(ICanTransceiver::ErrorCode::CAN_ERR_OK));
+    EXPECT_EQ(1U, cut.getEgress(0U).drain(transceiverMock0, 10U));
+
+    EXPECT_EQ(2U, cut.getRouteStatistics(0U).forwarded);
+    EXPECT_EQ(2U, cut.getRouteStatistics(1U).forwarded);
+    EXPECT_EQ(0U, cut.getRouteStatistics(1U).dropped);
+    EXPECT_EQ(1U, cut.getIngress(1U).getUnroutedCount());
+    EXPECT_EQ(2U, cut.getJoinReader(2U).stats[0U]);
+    EXPECT_EQ(1U, cut.getJoinReader(2U).stats[1U]);
+    EXPECT_EQ(0U, cut.getJoinReader(2U).stats[2U]);
+}
+
+TEST(CanGatewayTest, testAssertsTooManyRoutes)
+{
+    CanGatewayRoutingTable const routingTable(ROUTES);
+    using GatewayType = CanGateway<2U, 1U, 64U>;
+    ASSERT_THROW({ GatewayType cut(routingTable); }, ::etl::exception);
+}
+
+} // anonymous namespace
@@ -0,0 +1,98 @@
+// Copyright 2024 Accenture.
+
+#include <benchmark/benchmark.h>
+#include <can/canframes/CANFrame.h>
+#include <can/framemgmt/AbstractBitFieldFilteredCANFrameListener.h>
+#include <can/framemgmt/CANFrameListenerIndex.h>
+#include <can/transceiver/AbstractCANTransceiver.h>
+
+#include <vector>
+
+namespace
+{
+class BenchmarkTransceiver : public ::can::AbstractCANTransceiver
+{
+public:
+    BenchmarkTransceiver() : AbstractCANTransceiver(0U) { setState(State::OPEN); }
+
+    ErrorCode init() override { return ErrorCode::CAN_ERR_OK; }
+
+    void shutdown() override {}
+
+    ErrorCode open() override { return ErrorCode::CAN_ERR_OK; }
+
+    ErrorCode open(::can::CANFrame const& /* frame */) override { return ErrorCode::CAN_ERR_OK; }
+
+    ErrorCode close() override { return ErrorCode::CAN_ERR_OK; }
+
+    ErrorCode mute() override { return ErrorCode::CAN_ERR_OK; }
+
+    ErrorCode unmute() override { return ErrorCode::CAN_ERR_OK; }
+
+    ErrorCode write(::can::CANFrame const& /* frame */) override { return ErrorCode::CAN_ERR_OK; }
+
+    ErrorCode
+    write(::can::CANFrame const& /* frame */, ::can::ICANFrameSentListener& /* listener */) override
+    {
+        return ErrorCode::CAN_ERR_OK;
+    }
+
+    uint32_t getBaudrate() const override { return 500000U; }
+
+    uint16_t getHwQueueTimeout() const override { return 1U; }
+
+    using AbstractCANTransceiver::notifyListeners;
+};
+
+class BenchmarkListener : public ::can::AbstractBitFieldFilteredCANFrameListener
+{
+public:
+    void frameReceived(::can::CANFrame const& /* frame */) override { ++_receivedCount; }
+
+    uint32_t _receivedCount = 0U;
+};
+
+/**
+ * Registers state.range(0) listeners, each of them interested in 8 identifiers (like a DoCAN
+ * addressing filter), and dispatches frames with all base identifiers round robin.
+ */
+void runDispatch(benchmark::State& state, bool const useIndex)
+{
+    size_t const listenerCount = static_cast<size_t>(state.range(0));
+    std::vector<BenchmarkListener> listeners(listenerCount);
+    ::can::CANFrameListenerIndex index;
+    BenchmarkTransceiver transceiver;
+    if (useIndex)
+    {
+        transceiver.setListenerIndex(index);
+    }
+    for (size_t i = 0U; i < listenerCount; ++i)
+    {
+        uint32_t const from = static_cast<uint32_t>(i * 0x40U);
+        listeners[i].getFilter().add(from, from + 7U);
+        transceiver.addCANFrameListener(listeners[i]);
+    }
+
+    ::can::CANFrame frame;
+    uint32_t id = 0U;
+    while (state.KeepRunning())
+    {
+        frame.setId(id);
+        transceiver.notifyListeners(frame);
+        id = (id + 1U) & ::can::CANFrame::MAX_FRAME_ID;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+
+    for (BenchmarkListener& listener : listeners)
+    {
+        transceiver.removeCANFrameListener(listener);
+    }
+}
+} // namespace
+
+void BM_dispatch_linear(benchmark::State& state) { runDispatch(state, false); }
+
+void BM_dispatch_index(benchmark::State& state) { runDispatch(state, true); }
+
+BENCHMARK(BM_dispatch_linear)->RangeMultiplier(2)->Range(1, 32);
+BENCHMARK(BM_dispatch_index)->RangeMultiplier(2)->Range(1, 32);
@@ -0,0 +1,110 @@
+// Copyright 2024 Accenture.
+
+/**
+ * Contains CANFrameListenerIndex declaration.
+ * \file CANFrameListenerIndex.h
+ * \ingroup framemgmt
+ */
+#pragma once
+
+#include "can/canframes/CANFrame.h"
+#include "can/framemgmt/ICANFrameListener.h"
+
+#include <etl/intrusive_list.h>
+
+#include <platform/estdint.h>
+
+namespace can
+{
+/**
+ * Dispatch index mapping CAN identifiers directly to the interested ICANFrameListeners.
+ *
+ * Instead of asking the filter of every registered listener for each received frame, the index
+ * stores a bit mask of interested listeners per base identifier (11 bit). Extended identifiers
+ * are looked up in a small direct-mapped hash table which is filled on demand from the filters.
+ * The bits of a mask correspond to the positions of the listeners in the listener list, so the
+ * listeners are notified in the same order as by a linear scan, VIP listeners first.
+ *
+ * The index needs about 8.5 KiB of RAM and is rebuilt whenever the list of listeners changes. It
+ * supports up to MAX_LISTENERS listeners, with more listeners it stays invalid and the caller
+ * has to fall back to a linear scan.
+ *
+ * The index is rebuilt without locking interrupts for the whole time. Each change of the listener
+ * list increments a generation counter, and a rebuild only marks the index as valid if the
+ * generation hasn't changed while the masks were calculated. Otherwise it starts over.
+ *
+ * \see AbstractCANTransceiver::setListenerIndex()
+ */
+class CANFrameListenerIndex
+{
+public:
+    using ListenerList = ::etl::intrusive_list<ICANFrameListener, ::etl::bidirectional_link<0>>;
+
+    /// Maximum number of indexed listeners.
+    static constexpr size_t MAX_LISTENERS            = 32U;
+    /// Number of bits of the hash of the extended identifier table.
+    static constexpr size_t EXTENDED_TABLE_SIZE_BITS = 6U;
+    /// Number of entries of the extended identifier table.
+    static constexpr size_t EXTENDED_TABLE_SIZE      = 1U << EXTENDED_TABLE_SIZE_BITS;
+
+    CANFrameListenerIndex();
+
+    CANFrameListenerIndex(CANFrameListenerIndex const&)            = delete;
+    CANFrameListenerIndex& operator=(CANFrameListenerIndex const&) = delete;
+
+    /**
+     * Marks the index as outdated. This is cheap and is done inside the critical section that
+     * modifies the listener list.
+     */
+    void invalidate();
+
+    /**
+     * Rebuilds the index from the given list of listeners. The list is read with interrupts
+     * locked, the masks are calculated with interrupts enabled. If rebuild() is called while
+     * another rebuild is in progress, it returns immediately and the ongoing rebuild starts over
+     * with the modified list.
+     * \return true if the index is valid afterwards, false if there are too many listeners or
+     * another rebuild is in progress
+     */
+    bool rebuild(ListenerList& listeners);
+
+    /**
+     * \return true if the index can be used for dispatching
+     */
+    bool isValid() const { return _valid; }
+
+    /**
+     * Notifies all listeners interested in the identifier of the given frame. The generation is
+     * checked before each listener is notified.
+     *
+     * \note
+     * If the listener list is modified from within a frameReceived() callback, the dispatching
+     * of the current frame ends after that callback.
+     *
+     * \return false if the index has been invalid before any listener has been notified, the
+     * caller has to notify the listeners by a linear scan then
+     */
+    bool dispatch(CANFrame const& frame);
+
+private:
+    struct ExtendedEntry
+    {
+        uint32_t id;
+        uint32_t mask;
+    };
+
+    uint32_t getMask(uint32_t id, uint32_t generation);
+    uint32_t match(uint32_t id) const;
+
+    static size_t hash(uint32_t id);
+
+    ICANFrameListener* _listeners[MAX_LISTENERS];
+    uint32_t _baseMasks[CANFrame::MAX_FRAME_ID + 1U];
+    ExtendedEntry _extendedEntries[EXTENDED_TABLE_SIZE];
+    size_t _listenerCount;
+    uint32_t _generation;
+    bool _valid;
+    bool _rebuilding;
+};
+
+} // namespace can
@@ -10,7 +10,9 @@
 #include "can/canframes/CANFrame.h"
 #include "can/framemgmt/AbstractBitFieldFilteredCANFrameListener.h"
 #include "can/framemgmt/AbstractIntervalFilteredCANFrameListener.h"
+#include "can/framemgmt/CANFrameListenerIndex.h"
 #include "can/framemgmt/IFilteredCANFrameSentListener.h"
+#include "can/transceiver/CANLatencyHistogram.h"
 #include "can/transceiver/ICANTransceiverStateListener.h"
 #include "can/transceiver/ICanTransceiver.h"
 
@@ -142,6 +144,29 @@ public:
 
     void removeStateListener() override { _stateListener = nullptr; }
 
+    /**
+     * Enables dispatching of received frames through a CANFrameListenerIndex instead of asking
+     * the filter of every listener. The index is rebuilt whenever a listener is added or
+     * removed. Without an index, or with more listeners than the index supports, the listeners
+     * are notified by a linear scan.
+     * \param    index    index to use, it must be valid during the lifetime of the transceiver
+     */
+    void setListenerIndex(CANFrameListenerIndex& index);
+
+    /**
+     * Enables recording of the latency between the reception timestamp of a frame and the
+     * notification of the listeners. The timestamp has to be set by the implementation in the
+     * timebase of getSystemTimeUs32Bit().
+     * \param    histogram    histogram to record to, it must be valid during the lifetime of the
+     *                        transceiver
+     */
+    void setLatencyHistogram(CANLatencyHistogram& histogram) { _latencyHistogram = &histogram; }
+
+    /**
+     * \return the histogram set with setLatencyHistogram(), nullptr if there is none
+     */
+    CANLatencyHistogram* getLatencyHistogram() const { return _latencyHistogram; }
+
 protected:
     void setState(State newState);
 
@@ -155,6 +180,13 @@ protected:
 
     void notifySentListeners(can::CANFrame const& frame);
 
+    /**
+     * Called after a listener has been added to or removed from the list of CANFrameListeners.
+     * Implementations may override this to configure a hardware acceptance filter from the
+     * filters of the remaining listeners. It is called outside of the critical section.
+     */
+    virtual void listenersChanged() {}
+
     /**
      * Notifies the attached ICANTransceiverStateListener that a phy error occurred
      */
@@ -186,6 +218,12 @@ protected:
     uint8_t _busId;
     ICANTransceiverStateListener* _stateListener;
     ICANTransceiverStateListener::CANTransceiverState _transceiverState;
+
+private:
+    void rebuildListenerIndex();
+
+    CANFrameListenerIndex* _listenerIndex;
+    CANLatencyHistogram* _latencyHistogram;
 };
 
 inline ICanTransceiver::State AbstractCANTransceiver::getState() const { return _state; }
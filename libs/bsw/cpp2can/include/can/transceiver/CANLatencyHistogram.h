@@ -0,0 +1,80 @@
+// Copyright 2024 Accenture.
+
+/**
+ * Contains CANLatencyHistogram declaration.
+ * \file CANLatencyHistogram.h
+ * \ingroup transceiver
+ */
+#pragma once
+
+#include <platform/estdint.h>
+
+namespace can
+{
+/**
+ * Histogram of the latency between the reception of a CANFrame (its timestamp) and the
+ * notification of the listeners.
+ *
+ * The latencies are given in microseconds and are counted in buckets with power of two bounds:
+ * bucket 0 counts latencies of 0 us, bucket n counts latencies in [2^(n-1), 2^n) us and the last
+ * bucket additionally counts all larger latencies.
+ *
+ * \see AbstractCANTransceiver::setLatencyHistogram()
+ */
+class CANLatencyHistogram
+{
+public:
+    /// Number of buckets, the last one starts at 2^(BUCKET_COUNT - 2) us.
+    static constexpr size_t BUCKET_COUNT = 20U;
+
+    CANLatencyHistogram();
+
+    CANLatencyHistogram(CANLatencyHistogram const&)            = delete;
+    CANLatencyHistogram& operator=(CANLatencyHistogram const&) = delete;
+
+    /**
+     * Adds a single latency.
+     * \param latencyUs latency in microseconds
+     */
+    void add(uint32_t latencyUs);
+
+    /**
+     * Clears all recorded latencies.
+     */
+    void reset();
+
+    /**
+     * \return number of recorded latencies
+     */
+    uint32_t getCount() const { return _count; }
+
+    /**
+     * \return smallest recorded latency in microseconds, 0 if nothing has been recorded
+     */
+    uint32_t getMin() const { return (_count > 0U) ? _min : 0U; }
+
+    /**
+     * \return largest recorded latency in microseconds
+     */
+    uint32_t getMax() const { return _max; }
+
+    /**
+     * \return number of latencies counted in the given bucket
+     */
+    uint32_t getBucketCount(size_t bucket) const;
+
+    /**
+     * \return smallest latency in microseconds that is counted in the given bucket
+     */
+    static uint32_t getBucketLowerBound(size_t bucket);
+
+private:
+    static size_t getBucket(uint32_t latencyUs);
+
+    uint32_t _buckets[BUCKET_COUNT];
+    uint32_t _count;
+    uint32_t _min;
+    uint32_t _max;
+};
+
+} // namespace can
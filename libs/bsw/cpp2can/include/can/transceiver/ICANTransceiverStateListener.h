@@ -7,6 +7,8 @@
  */
 #pragma once
 
+#include <platform/estdint.h>
+
 namespace can
 {
 class ICanTransceiver;
@@ -0,0 +1,151 @@
+// Copyright 2024 Accenture.
+
+#include "can/framemgmt/CANFrameListenerIndex.h"
+
+#include "can/canframes/CanId.h"
+#include "can/filter/IFilter.h"
+
+#include <etl/binary.h>
+#include <interrupts/SuspendResumeAllInterruptsScopedLock.h>
+
+#include <platform/config.h>
+
+namespace can
+{
+using ::interrupts::SuspendResumeAllInterruptsScopedLock;
+
+// needed if ODR-used
+size_t const CANFrameListenerIndex::MAX_LISTENERS;
+size_t const CANFrameListenerIndex::EXTENDED_TABLE_SIZE_BITS;
+size_t const CANFrameListenerIndex::EXTENDED_TABLE_SIZE;
+
+CANFrameListenerIndex::CANFrameListenerIndex()
+: _listeners(), _baseMasks(), _extendedEntries(), _listenerCount(0U)
+, _generation(0U)
+, _valid(false)
+, _rebuilding(false)
+{}
+
+void CANFrameListenerIndex::invalidate()
+{
+    _valid = false;
+    ++_generation;
+}
+
+bool CANFrameListenerIndex::rebuild(ListenerList& listeners)
+{
+    {
+        ESR_UNUSED const SuspendResumeAllInterruptsScopedLock lock;
+        invalidate();
+        if (_rebuilding)
+        {
+            // the ongoing rebuild will notice the new generation
+            return false;
+        }
+        _rebuilding = true;
+    }
+    while (true)
+    {
+        uint32_t generation;
+        {
+            ESR_UNUSED const SuspendResumeAllInterruptsScopedLock lock;
+            if (listeners.size() > MAX_LISTENERS)
+            {
+                _rebuilding = false;
+                return false;
+            }
+            _listenerCount = 0U;
+            for (auto& listener : listeners)
+            {
+                _listeners[_listenerCount] = &listener;
+                ++_listenerCount;
+            }
+            generation = _generation;
+        }
+        for (uint32_t id = 0U; id <= CANFrame::MAX_FRAME_ID; ++id)
+        {
+            _baseMasks[id] = match(id);
+        }
+        for (ExtendedEntry& entry : _extendedEntries)
+        {
+            entry.id   = CanId::INVALID_ID;
+            entry.mask = 0U;
+        }
+        {
+            ESR_UNUSED const SuspendResumeAllInterruptsScopedLock lock;
+            if (generation == _generation)
+            {
+                _valid      = true;
+                _rebuilding = false;
+                return true;
+            }
+        }
+    }
+}
+
+bool CANFrameListenerIndex::dispatch(CANFrame const& frame)
+{
+    uint32_t const generation = _generation;
+    if (!_valid)
+    {
+        return false;
+    }
+    uint32_t mask = getMask(frame.getId(), generation);
+    bool notified = false;
+    while (mask != 0U)
+    {
+        size_t const position = ::etl::count_trailing_zeros(mask);
+        mask &= mask - 1U;
+        if ((!_valid) || (generation != _generation))
+        {
+            // the listeners have been modified, by a callback or from another context
+            return notified;
+        }
+        _listeners[position]->frameReceived(frame);
+        notified = true;
+    }
+    return true;
+}
+
+uint32_t CANFrameListenerIndex::getMask(uint32_t const id, uint32_t const generation)
+{
+    if (id <= CANFrame::MAX_FRAME_ID)
+    {
+        return _baseMasks[id];
+    }
+    ExtendedEntry& entry = _extendedEntries[hash(id)];
+    if (entry.id != id)
+    {
+        uint32_t const mask = match(id);
+        ESR_UNUSED const SuspendResumeAllInterruptsScopedLock lock;
+        // a rebuild may have reset the table meanwhile
+        if (generation == _generation)
+        {
+            entry.id   = id;
+            entry.mask = mask;
+        }
+        return mask;
+    }
+    return entry.mask;
+}
+
+uint32_t CANFrameListenerIndex::match(uint32_t const id) const
+{
+    uint32_t mask = 0U;
+    for (size_t position = 0U; position < _listenerCount; ++position)
+    {
+        if (_listeners[position]->getFilter().match(id))
+        {
+            mask |= static_cast<uint32_t>(1U) << position;
+        }
+    }
+    return mask;
+}
+
+size_t CANFrameListenerIndex::hash(uint32_t const id)
+{
+    // Fibonacci hashing spreads neighbouring identifiers over the table
+    return static_cast<size_t>((id * 0x9E3779B1U) >> (32U - EXTENDED_TABLE_SIZE_BITS));
+}
+
+} // namespace can
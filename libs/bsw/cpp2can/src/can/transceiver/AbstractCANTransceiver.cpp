@@ -23,32 +23,84 @@ AbstractCANTransceiver::AbstractCANTransceiver(uint8_t const busId)
 , _busId(busId)
 , _stateListener(nullptr)
 , _transceiverState(ICANTransceiverStateListener::CANTransceiverState::ACTIVE)
+, _listenerIndex(nullptr)
+, _latencyHistogram(nullptr)
 {}
 
 void AbstractCANTransceiver::addCANFrameListener(ICANFrameListener& listener)
 {
-    ESR_UNUSED const SuspendResumeAllInterruptsScopedLock lock;
-    if (!_listeners.contains_node(listener))
     {
+        ESR_UNUSED const SuspendResumeAllInterruptsScopedLock lock;
+        if (_listeners.contains_node(listener))
+        {
+            return;
+        }
         _listeners.push_back(listener);
         listener.getFilter().acceptMerger(_filter);
+        if (_listenerIndex != nullptr)
+        {
+            _listenerIndex->invalidate();
+        }
     }
+    rebuildListenerIndex();
+    listenersChanged();
 }
 
 void AbstractCANTransceiver::addVIPCANFrameListener(ICANFrameListener& listener)
 {
-    ESR_UNUSED const SuspendResumeAllInterruptsScopedLock lock;
-    if (!_listeners.contains_node(listener))
     {
+        ESR_UNUSED const SuspendResumeAllInterruptsScopedLock lock;
+        if (_listeners.contains_node(listener))
+        {
+            return;
+        }
         _listeners.push_front(listener);
         listener.getFilter().acceptMerger(_filter);
+        if (_listenerIndex != nullptr)
+        {
+            _listenerIndex->invalidate();
+        }
     }
+    rebuildListenerIndex();
+    listenersChanged();
 }
 
 void AbstractCANTransceiver::removeCANFrameListener(ICANFrameListener& listener)
 {
-    ESR_UNUSED const SuspendResumeAllInterruptsScopedLock lock;
-    _listeners.erase(listener);
+    {
+        ESR_UNUSED const SuspendResumeAllInterruptsScopedLock lock;
+        if (!_listeners.contains_node(listener))
+        {
+            return;
+        }
+        _listeners.erase(listener);
+        if (_listenerIndex != nullptr)
+        {
+            _listenerIndex->invalidate();
+        }
+    }
+    rebuildListenerIndex();
+    listenersChanged();
+}
+
+void AbstractCANTransceiver::setListenerIndex(CANFrameListenerIndex& index)
+{
+    {
+        ESR_UNUSED const SuspendResumeAllInterruptsScopedLock lock;
+        index.invalidate();
+        _listenerIndex = &index;
+    }
+    rebuildListenerIndex();
+}
+
+void AbstractCANTransceiver::rebuildListenerIndex()
+{
+    // The index stays invalid while being rebuilt, frames received meanwhile are dispatched by a
+    // linear scan.
+    if (_listenerIndex != nullptr)
+    {
+        (void)_listenerIndex->rebuild(_listeners);
+    }
 }
 
 void AbstractCANTransceiver::addCANFrameSentListener(IFilteredCANFrameSentListener& listener)
@@ -70,6 +122,16 @@ void AbstractCANTransceiver::notifyListeners(CANFrame const& frame)
         return; // don't receive messages in state CLOSED
     }
 
+    if (_latencyHistogram != nullptr)
+    {
+        _latencyHistogram->add(getSystemTimeUs32Bit() - frame.timestamp());
+    }
+
+    if ((_listenerIndex != nullptr) && _listenerIndex->dispatch(frame))
+    {
+        return;
+    }
+
     for (auto& listener : _listeners)
     {
         if (listener.getFilter().match(frame.getId()))
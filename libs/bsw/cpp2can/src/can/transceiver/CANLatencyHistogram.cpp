@@ -0,0 +1,56 @@
+// Copyright 2024 Accenture.
+
+#include "can/transceiver/CANLatencyHistogram.h"
+
+#include <etl/binary.h>
+
+namespace can
+{
+// needed if ODR-used
+size_t const CANLatencyHistogram::BUCKET_COUNT;
+
+CANLatencyHistogram::CANLatencyHistogram() : _buckets(), _count(0U), _min(0U), _max(0U) {}
+
+void CANLatencyHistogram::add(uint32_t const latencyUs)
+{
+    if ((_count == 0U) || (latencyUs < _min))
+    {
+        _min = latencyUs;
+    }
+    if (latencyUs > _max)
+    {
+        _max = latencyUs;
+    }
+    ++_buckets[getBucket(latencyUs)];
+    ++_count;
+}
+
+void CANLatencyHistogram::reset()
+{
+    for (uint32_t& bucket : _buckets)
+    {
+        bucket = 0U;
+    }
+    _count = 0U;
+    _min   = 0U;
+    _max   = 0U;
+}
+
+uint32_t CANLatencyHistogram::getBucketCount(size_t const bucket) const
+{
+    return (bucket < BUCKET_COUNT) ? _buckets[bucket] : 0U;
+}
+
+uint32_t CANLatencyHistogram::getBucketLowerBound(size_t const bucket)
+{
+    return (bucket == 0U) ? 0U : (static_cast<uint32_t>(1U) << (bucket - 1U));
+}
+
+size_t CANLatencyHistogram::getBucket(uint32_t const latencyUs)
+{
+    // the bucket is the number of significant bits of the latency
+    size_t const bits = 32U - static_cast<size_t>(::etl::count_leading_zeros(latencyUs));
+    return (bits < BUCKET_COUNT) ? bits : (BUCKET_COUNT - 1U);
+}
+
+} // namespace can
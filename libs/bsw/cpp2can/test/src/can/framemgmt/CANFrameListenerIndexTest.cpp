@@ -0,0 +1,223 @@
+// Copyright 2024 Accenture.
+
+#include "can/framemgmt/CANFrameListenerIndex.h"
+
+#include "can/canframes/CanId.h"
+#include "can/filter/IntervalFilter.h"
+#include "can/framemgmt/AbstractBitFieldFilteredCANFrameListener.h"
+#include "can/framemgmt/AbstractIntervalFilteredCANFrameListener.h"
+
+#include <gmock/gmock.h>
+
+#include <functional>
+#include <vector>
+
+namespace
+{
+using namespace ::can;
+using namespace ::testing;
+
+class RecordingListener : public AbstractIntervalFilteredCANFrameListener
+{
+public:
+    RecordingListener(std::vector<RecordingListener*>& calls) : _calls(calls) {}
+
+    void frameReceived(CANFrame const& /* frame */) override { _calls.push_back(this); }
+
+private:
+    std::vector<RecordingListener*>& _calls;
+};
+
+class BitFieldListener : public AbstractBitFieldFilteredCANFrameListener
+{
+public:
+    MOCK_METHOD(void, frameReceived, (CANFrame const& frame), (override));
+};
+
+/**
+ * Listener whose filter calls a hook on its first match, to modify the listeners while the index
+ * is being rebuilt.
+ */
+class HookListener : public ICANFrameListener
+{
+public:
+    class HookFilter : public IntervalFilter
+    {
+    public:
+        bool match(uint32_t const filterId) const override
+        {
+            if (_hook)
+            {
+                auto const hook = _hook;
+                _hook           = nullptr;
+                hook();
+            }
+            return IntervalFilter::match(filterId);
+        }
+
+        mutable std::function<void()> _hook;
+    };
+
+    MOCK_METHOD(void, frameReceived, (CANFrame const& frame), (override));
+
+    IFilter& getFilter() override { return _filter; }
+
+    HookFilter _filter;
+};
+
+class CANFrameListenerIndexTest : public Test
+{
+protected:
+    CANFrameListenerIndex::ListenerList _listeners;
+    CANFrameListenerIndex _cut;
+    std::vector<RecordingListener*> _calls;
+};
+
+/**
+ * \desc
+ * Verifies that a new index is invalid and an index with no listeners dispatches nothing.
+ */
+TEST_F(CANFrameListenerIndexTest, empty_index)
+{
+    EXPECT_FALSE(_cut.isValid());
+    EXPECT_TRUE(_cut.rebuild(_listeners));
+    EXPECT_TRUE(_cut.isValid());
+    _cut.dispatch(CANFrame(0x123U));
+    _cut.invalidate();
+    EXPECT_FALSE(_cut.isValid());
+}
+
+/**
+ * \desc
+ * Verifies that frames with base and extended identifiers are dispatched to the matching
+ * listeners in list order.
+ */
+TEST_F(CANFrameListenerIndexTest, dispatches_in_list_order)
+{
+    RecordingListener all(_calls);
+    all.getFilter().open();
+    RecordingListener base(_calls);
+    base.getFilter().add(0x100U, 0x1FFU);
+    RecordingListener extended(_calls);
+    extended.getFilter().add(
+        CanId::Extended<0x18DA0000U>::value, CanId::Extended<0x18DAFFFFU>::value);
+    _listeners.push_back(base);
+    _listeners.push_back(extended);
+    _listeners.push_front(all);
+    ASSERT_TRUE(_cut.rebuild(_listeners));
+
+    _cut.dispatch(CANFrame(0x123U));
+    EXPECT_THAT(_calls, ElementsAre(&all, &base));
+    _calls.clear();
+    _cut.dispatch(CANFrame(0x200U));
+    EXPECT_THAT(_calls, ElementsAre(&all));
+    _calls.clear();
+    // extended identifiers, the second lookup is served by the hash table
+    for (size_t i = 0U; i < 2U; ++i)
+    {
+        _cut.dispatch(CANFrame(CanId::Extended<0x18DA10F1U>::value));
+        EXPECT_THAT(_calls, ElementsAre(&all, &extended));
+        _calls.clear();
+        _cut.dispatch(CANFrame(CanId::Extended<0x123U>::value));
+        EXPECT_THAT(_calls, ElementsAre(&all));
+        _calls.clear();
+    }
+    _listeners.clear();
+}
+
+/**
+ * \desc
+ * Verifies that the index can't be built for more than MAX_LISTENERS listeners.
+ */
+TEST_F(CANFrameListenerIndexTest, too_many_listeners)
+{
+    std::vector<BitFieldListener> listeners(CANFrameListenerIndex::MAX_LISTENERS + 1U);
+    for (size_t i = 0U; i < CANFrameListenerIndex::MAX_LISTENERS; ++i)
+    {
+        listeners[i].getFilter().add(static_cast<uint32_t>(i));
+        _listeners.push_back(listeners[i]);
+    }
+    ASSERT_TRUE(_cut.rebuild(_listeners));
+    EXPECT_CALL(listeners[CANFrameListenerIndex::MAX_LISTENERS - 1U], frameReceived(_));
+    _cut.dispatch(CANFrame(CANFrameListenerIndex::MAX_LISTENERS - 1U));
+
+    _listeners.push_back(listeners[CANFrameListenerIndex::MAX_LISTENERS]);
+    EXPECT_FALSE(_cut.rebuild(_listeners));
+    EXPECT_FALSE(_cut.isValid());
+    _listeners.clear();
+}
+
+/**
+ * \desc
+ * Verifies that dispatching ends if the listeners are modified from within a callback.
+ */
+TEST_F(CANFrameListenerIndexTest, dispatch_ends_on_modification)
+{
+    BitFieldListener first;
+    first.getFilter().add(0x10U);
+    BitFieldListener second;
+    second.getFilter().add(0x10U);
+    _listeners.push_back(first);
+    _listeners.push_back(second);
+    ASSERT_TRUE(_cut.rebuild(_listeners));
+
+    EXPECT_CALL(first, frameReceived(_))
+        .WillOnce(InvokeWithoutArgs(
+            [this]
+            {
+                _listeners.pop_back();
+                _cut.invalidate();
+            }));
+    EXPECT_CALL(second, frameReceived(_)).Times(0);
+    _cut.dispatch(CANFrame(0x10U));
+    _listeners.clear();
+}
+
+/**
+ * \desc
+ * Verifies that a rebuild starts over if the listeners are modified while the masks are
+ * calculated, and that a rebuild requested meanwhile returns immediately.
+ */
+TEST_F(CANFrameListenerIndexTest, rebuild_starts_over_on_concurrent_modification)
+{
+    HookListener first;
+    first._filter.add(0x10U);
+    BitFieldListener second;
+    second.getFilter().add(0x20U);
+    _listeners.push_back(first);
+    first._filter._hook = [this, &second]
+    {
+        // modification from an interrupting context
+        _listeners.push_back(second);
+        EXPECT_FALSE(_cut.rebuild(_listeners));
+        EXPECT_FALSE(_cut.isValid());
+    };
+    EXPECT_TRUE(_cut.rebuild(_listeners));
+    EXPECT_TRUE(_cut.isValid());
+
+    EXPECT_CALL(first, frameReceived(_));
+    EXPECT_TRUE(_cut.dispatch(CANFrame(0x10U)));
+    EXPECT_CALL(second, frameReceived(_));
+    EXPECT_TRUE(_cut.dispatch(CANFrame(0x20U)));
+    _listeners.clear();
+}
+
+/**
+ * \desc
+ * Verifies that nothing is dispatched by an invalid index, so the caller falls back to a linear
+ * scan.
+ */
+TEST_F(CANFrameListenerIndexTest, invalid_index_does_not_dispatch)
+{
+    BitFieldListener listener;
+    listener.getFilter().add(0x10U);
+    _listeners.push_back(listener);
+    EXPECT_CALL(listener, frameReceived(_)).Times(0);
+    EXPECT_FALSE(_cut.dispatch(CANFrame(0x10U)));
+    ASSERT_TRUE(_cut.rebuild(_listeners));
+    _cut.invalidate();
+    EXPECT_FALSE(_cut.dispatch(CANFrame(0x10U)));
+    _listeners.clear();
+}
+
+} // namespace
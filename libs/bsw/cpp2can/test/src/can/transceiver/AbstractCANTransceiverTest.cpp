@@ -149,6 +149,14 @@ public:
     using AbstractCANTransceiver::notifySentListeners;
 };
 
+class tListenersChangedCanTransceiver : public AbstractCANTransceiverMock
+{
+public:
+    tListenersChangedCanTransceiver() : AbstractCANTransceiverMock(0) {}
+
+    MOCK_METHOD(void, listenersChanged, (), (override));
+};
+
 class AbstractCANTransceiverTest : public ::testing::Test
 {
 public:
@@ -279,6 +287,34 @@ TEST_F(AbstractCANTransceiverTest, testSendListeners)
     fpTransceiver->removeCANFrameSentListener(sendListener2);
 }
 
+/**
+ * @test
+ * verification that listenersChanged() is called whenever the list of listeners changes
+ */
+TEST_F(AbstractCANTransceiverTest, testListenersChanged)
+{
+    StrictMock<tListenersChangedCanTransceiver> transceiver;
+    tBitFieldListener listener;
+    tIntervalListener listener2;
+
+    EXPECT_CALL(transceiver, listenersChanged()).Times(2);
+    transceiver.addCANFrameListener(listener);
+    transceiver.addVIPCANFrameListener(listener2);
+    Mock::VerifyAndClearExpectations(&transceiver);
+
+    // adding again doesn't change anything
+    transceiver.addCANFrameListener(listener);
+    transceiver.addVIPCANFrameListener(listener2);
+
+    EXPECT_CALL(transceiver, listenersChanged()).Times(2);
+    transceiver.removeCANFrameListener(listener);
+    transceiver.removeCANFrameListener(listener2);
+    Mock::VerifyAndClearExpectations(&transceiver);
+
+    // removing again doesn't change anything
+    transceiver.removeCANFrameListener(listener);
+}
+
 /**
  * @test
  * verification of receive method
@@ -365,6 +401,77 @@ TEST_F(AbstractCANTransceiverTest, testNotifyListeners)
     fpTransceiver->removeCANFrameListener(listener5);
 }
 
+/**
+ * @test
+ * verification of receive method with a listener index
+ */
+TEST_F(AbstractCANTransceiverTest, testNotifyListenersWithIndex)
+{
+    CANFrameListenerIndex index;
+    fpTransceiver->setListenerIndex(index);
+    EXPECT_TRUE(index.isValid());
+    EXPECT_CALL(*fpTransceiver, init()).Times(1);
+    EXPECT_CALL(*fpTransceiver, open()).Times(1);
+    fpTransceiver->init();
+    fpTransceiver->open();
+
+    tBitFieldListener listener1;
+    tIntervalListener listener2;
+    listener1.getFilter().add(0x555);
+    listener2.getFilter().add(0x500, 0x5FF);
+    fpTransceiver->addCANFrameListener(listener1);
+    fpTransceiver->addVIPCANFrameListener(listener2);
+    EXPECT_TRUE(index.isValid());
+
+    CANFrame frame(0x555);
+    Sequence seq;
+    EXPECT_CALL(listener2, frameReceived(_)).InSequence(seq);
+    EXPECT_CALL(listener1, frameReceived(_)).InSequence(seq);
+    fpTransceiver->inject(frame);
+    Mock::VerifyAndClearExpectations(&listener1);
+    Mock::VerifyAndClearExpectations(&listener2);
+
+    fpTransceiver->removeCANFrameListener(listener2);
+    EXPECT_TRUE(index.isValid());
+    EXPECT_CALL(listener1, frameReceived(_)).Times(1);
+    fpTransceiver->inject(frame);
+    EXPECT_CALL(listener1, frameReceived(_)).Times(0);
+    fpTransceiver->inject(CANFrame(0x554));
+
+    fpTransceiver->removeCANFrameListener(listener1);
+}
+
+/**
+ * @test
+ * verification of the latency recording of received frames
+ */
+TEST_F(AbstractCANTransceiverTest, testNotifyListenersWithLatencyHistogram)
+{
+    CANLatencyHistogram histogram;
+    EXPECT_EQ(nullptr, fpTransceiver->getLatencyHistogram());
+    fpTransceiver->setLatencyHistogram(histogram);
+    EXPECT_EQ(&histogram, fpTransceiver->getLatencyHistogram());
+
+    CANFrame frame(0x555);
+    frame.setTimestamp(1000U);
+    // not recorded in state CLOSED
+    fpTransceiver->inject(frame);
+    EXPECT_EQ(0U, histogram.getCount());
+
+    EXPECT_CALL(*fpTransceiver, init()).Times(1);
+    EXPECT_CALL(*fpTransceiver, open()).Times(1);
+    fpTransceiver->init();
+    fpTransceiver->open();
+
+    EXPECT_CALL(fSystemTimer, getSystemTimeUs32Bit()).WillOnce(Return(1100U));
+    fpTransceiver->inject(frame);
+    EXPECT_CALL(fSystemTimer, getSystemTimeUs32Bit()).WillOnce(Return(1003U));
+    fpTransceiver->inject(frame);
+    EXPECT_EQ(2U, histogram.getCount());
+    EXPECT_EQ(3U, histogram.getMin());
+    EXPECT_EQ(100U, histogram.getMax());
+}
+
 TEST_F(AbstractCANTransceiverTest, testNotifySentListeners)
 {
     uint8_t payload[6] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05};
@@ -0,0 +1,61 @@
+// Copyright 2024 Accenture.
+
+#include "can/transceiver/CANLatencyHistogram.h"
+
+#include <gmock/gmock.h>
+
+namespace
+{
+using namespace ::can;
+
+TEST(CANLatencyHistogramTest, testEmpty)
+{
+    CANLatencyHistogram cut;
+    EXPECT_EQ(0U, cut.getCount());
+    EXPECT_EQ(0U, cut.getMin());
+    EXPECT_EQ(0U, cut.getMax());
+    for (size_t bucket = 0U; bucket < CANLatencyHistogram::BUCKET_COUNT; ++bucket)
+    {
+        EXPECT_EQ(0U, cut.getBucketCount(bucket));
+    }
+    EXPECT_EQ(0U, cut.getBucketCount(CANLatencyHistogram::BUCKET_COUNT));
+}
+
+TEST(CANLatencyHistogramTest, testBucketBounds)
+{
+    EXPECT_EQ(0U, CANLatencyHistogram::getBucketLowerBound(0U));
+    EXPECT_EQ(1U, CANLatencyHistogram::getBucketLowerBound(1U));
+    EXPECT_EQ(2U, CANLatencyHistogram::getBucketLowerBound(2U));
+    EXPECT_EQ(512U, CANLatencyHistogram::getBucketLowerBound(10U));
+}
+
+TEST(CANLatencyHistogramTest, testAdd)
+{
+    CANLatencyHistogram cut;
+    cut.add(0U);
+    cut.add(1U);
+    cut.add(2U);
+    cut.add(3U);
+    cut.add(4U);
+    cut.add(1000U);
+    cut.add(0xFFFFFFFFU);
+    EXPECT_EQ(7U, cut.getCount());
+    EXPECT_EQ(0U, cut.getMin());
+    EXPECT_EQ(0xFFFFFFFFU, cut.getMax());
+    EXPECT_EQ(1U, cut.getBucketCount(0U));
+    EXPECT_EQ(1U, cut.getBucketCount(1U));
+    EXPECT_EQ(2U, cut.getBucketCount(2U));
+    EXPECT_EQ(1U, cut.getBucketCount(3U));
+    EXPECT_EQ(1U, cut.getBucketCount(10U));
+    EXPECT_EQ(1U, cut.getBucketCount(CANLatencyHistogram::BUCKET_COUNT - 1U));
+
+    cut.reset();
+    EXPECT_EQ(0U, cut.getCount());
+    EXPECT_EQ(0U, cut.getMax());
+    EXPECT_EQ(0U, cut.getBucketCount(2U));
+    cut.add(7U);
+    EXPECT_EQ(7U, cut.getMin());
+    EXPECT_EQ(7U, cut.getMax());
+}
+
+} // namespace
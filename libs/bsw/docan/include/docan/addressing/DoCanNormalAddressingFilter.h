@@ -61,9 +61,10 @@ public:
     using DataLinkAddressPairType = typename DataLinkLayerType::AddressPairType;
     using CodecIdxType            = typename AddressEntry::CodecIdxType;
 
-    using AddressEntryType      = AddressEntry;
-    using AddressEntrySliceType = ::etl::span<AddressEntryType const>;
-    using CodecsSliceType       = ::etl::span<FrameCodecType const*>;
+    using AddressEntryType           = AddressEntry;
+    using AddressEntrySliceType      = ::etl::span<AddressEntryType const>;
+    using CodecsSliceType            = ::etl::span<FrameCodecType const*>;
+    using TransmissionIndexSliceType = ::etl::span<AddressEntryType const*>;
 
     /**
      * Default constructor. Call init() to later initialize the filter.
@@ -74,18 +75,28 @@ public:
      * Initialize the filter with a list of filter entries.
      * \param addressEntries list of consecutive entries ordered by the field _canReceptionId.
      * \param codecEntries codec search table
+     * \param transmissionIndex optional storage for an index of the entries by transport address
+     * pair, see init()
      * \note an assertion will be emitted if the frames are not in the required order!
      */
     explicit DoCanNormalAddressingFilter(
-        AddressEntrySliceType addressEntries, CodecsSliceType codecEntries);
+        AddressEntrySliceType addressEntries,
+        CodecsSliceType codecEntries,
+        TransmissionIndexSliceType transmissionIndex = TransmissionIndexSliceType());
 
     /**
      * Initialize the filter with a list of filter entries.
      * \param addressEntries list of consecutive entries ordered by the field _canReceptionId.
      * \param codecEntries codec search table
+     * \param transmissionIndex optional storage for an index of the entries by transport address
+     * pair. If given it must hold at least one element per address entry and turns the linear
+     * search of getTransmissionParameters() into a binary search.
      * \note an assertion will be emitted if the frames are not in the required order!
      */
-    void init(AddressEntrySliceType addressEntries, CodecsSliceType codecEntries);
+    void init(
+        AddressEntrySliceType addressEntries,
+        CodecsSliceType codecEntries,
+        TransmissionIndexSliceType transmissionIndex = TransmissionIndexSliceType());
 
     FrameCodecType const* getTransmissionParameters(
         DoCanTransportAddressPair const& transportAddressPair,
@@ -115,9 +126,18 @@ private:
 
     static bool lessReceptionId(AddressEntryType const& entry1, AddressEntryType const& entry2);
 
+    static uint32_t getTransportKey(uint16_t sourceId, uint16_t targetId);
+
+    static uint32_t getTransportKey(AddressEntryType const& entry);
+
+    static bool lessTransportKey(AddressEntryType const* entry, uint32_t transportKey);
+
+    void initTransmissionIndex(TransmissionIndexSliceType transmissionIndex);
+
     AddressEntrySliceType _entries;
     AddressEntrySliceType _extendedEntries;
     CodecsSliceType _codecEntries;
+    TransmissionIndexSliceType _transmissionIndex;
 };
 
 /**
@@ -125,20 +145,24 @@ private:
  */
 template<class DataLinkLayer, class AddressEntry>
 DoCanNormalAddressingFilter<DataLinkLayer, AddressEntry>::DoCanNormalAddressingFilter()
-: BitFieldFilter(), _entries(), _extendedEntries(), _codecEntries()
+: BitFieldFilter(), _entries(), _extendedEntries(), _codecEntries(), _transmissionIndex()
 {}
 
 template<class DataLinkLayer, class AddressEntry>
 DoCanNormalAddressingFilter<DataLinkLayer, AddressEntry>::DoCanNormalAddressingFilter(
-    AddressEntrySliceType const addressEntries, CodecsSliceType const codecEntries)
+    AddressEntrySliceType const addressEntries,
+    CodecsSliceType const codecEntries,
+    TransmissionIndexSliceType const transmissionIndex)
 : DoCanNormalAddressingFilter()
 {
-    init(addressEntries, codecEntries);
+    init(addressEntries, codecEntries, transmissionIndex);
 }
 
 template<class DataLinkLayer, class AddressEntry>
 void DoCanNormalAddressingFilter<DataLinkLayer, AddressEntry>::init(
-    AddressEntrySliceType const addressEntries, CodecsSliceType const codecEntries)
+    AddressEntrySliceType const addressEntries,
+    CodecsSliceType const codecEntries,
+    TransmissionIndexSliceType const transmissionIndex)
 {
     // Address entries must be non-zero in size
     ETL_ASSERT(
@@ -186,6 +210,8 @@ void DoCanNormalAddressingFilter<DataLinkLayer, AddressEntry>::init(
             !::can::CanId::isValid(it->_canReceptionId),
             ETL_ERROR_GENERIC("can reception id must be valid"));
     }
+
+    initTransmissionIndex(transmissionIndex);
 }
 
 template<class DataLinkLayer, class AddressEntry>
@@ -196,6 +222,22 @@ DoCanNormalAddressingFilter<DataLinkLayer, AddressEntry>::getTransmissionParamet
 {
     uint16_t const sourceId = transportAddressPair.getTargetId();
     uint16_t const targetId = transportAddressPair.getSourceId();
+    if (!_transmissionIndex.empty())
+    {
+        typename TransmissionIndexSliceType::iterator const it = ::etl::lower_bound(
+            _transmissionIndex.begin(),
+            _transmissionIndex.end(),
+            getTransportKey(sourceId, targetId),
+            &lessTransportKey);
+        if ((it == _transmissionIndex.end()) || ((*it)->_transportSourceId != sourceId)
+            || ((*it)->_transportTargetId != targetId))
+        {
+            return nullptr;
+        }
+        dataLinkAddressPair
+            = DataLinkAddressPairType((*it)->_canReceptionId, (*it)->_canTransmissionId);
+        return getFrameCodec((*it)->_transmissionCodecIdx);
+    }
     for (AddressEntryType const& entry : _entries)
     {
         if ((entry._transportSourceId == sourceId) && (entry._transportTargetId == targetId))
@@ -273,6 +315,56 @@ inline bool DoCanNormalAddressingFilter<DataLinkLayer, AddressEntry>::lessRecept
     return entry1._canReceptionId < entry2._canReceptionId;
 }
 
+template<class DataLinkLayer, class AddressEntry>
+inline uint32_t DoCanNormalAddressingFilter<DataLinkLayer, AddressEntry>::getTransportKey(
+    uint16_t const sourceId, uint16_t const targetId)
+{
+    return (static_cast<uint32_t>(sourceId) << 16U) | static_cast<uint32_t>(targetId);
+}
+
+template<class DataLinkLayer, class AddressEntry>
+inline uint32_t DoCanNormalAddressingFilter<DataLinkLayer, AddressEntry>::getTransportKey(
+    AddressEntryType const& entry)
+{
+    return getTransportKey(entry._transportSourceId, entry._transportTargetId);
+}
+
+template<class DataLinkLayer, class AddressEntry>
+inline bool DoCanNormalAddressingFilter<DataLinkLayer, AddressEntry>::lessTransportKey(
+    AddressEntryType const* const entry, uint32_t const transportKey)
+{
+    return getTransportKey(*entry) < transportKey;
+}
+
+template<class DataLinkLayer, class AddressEntry>
+void DoCanNormalAddressingFilter<DataLinkLayer, AddressEntry>::initTransmissionIndex(
+    TransmissionIndexSliceType const transmissionIndex)
+{
+    if (transmissionIndex.empty())
+    {
+        _transmissionIndex = TransmissionIndexSliceType();
+        return;
+    }
+    ETL_ASSERT(
+        transmissionIndex.size() >= _entries.size(),
+        ETL_ERROR_GENERIC("transmission index must hold all address entries"));
+
+    _transmissionIndex = transmissionIndex.first(_entries.size());
+    // insertion sort keeps entries with equal transport address pairs in their original order,
+    // a lookup therefore returns the same entry as the linear search
+    for (size_t i = 0U; i < _entries.size(); ++i)
+    {
+        uint32_t const transportKey = getTransportKey(_entries[i]);
+        size_t j                    = i;
+        while ((j > 0U) && (transportKey < getTransportKey(*_transmissionIndex[j - 1U])))
+        {
+            _transmissionIndex[j] = _transmissionIndex[j - 1U];
+            --j;
+        }
+        _transmissionIndex[j] = &_entries[i];
+    }
+}
+
 template<class DataLinkLayer, class AddressEntry>
 typename DoCanNormalAddressingFilter<DataLinkLayer, AddressEntry>::FrameCodecType const*
 DoCanNormalAddressingFilter<DataLinkLayer, AddressEntry>::getFrameCodec(
@@ -15,12 +15,30 @@
 #include "docan/datalink/IDoCanFrameReceiver.h"
 #include "docan/datalink/IDoCanPhysicalTransceiver.h"
 
+#include <interrupts/SuspendResumeAllInterruptsScopedLock.h>
+
+#include <etl/algorithm.h>
+#include <etl/array.h>
 #include <etl/span.h>
 
 namespace docan
 {
 /**
  * DoCAN implementation of a physical CAN transceiver.
+ *
+ * By default a single data frame is written to the CAN transceiver at a time and the next one is
+ * encoded after its transmission has been confirmed. In pipelined mode up to maxSendFrameCount
+ * consecutive frames of a send job are written at once. The DoCanTransmitter only requests more
+ * than one frame if the receiver allows a min separation time of 0, and never beyond the end of
+ * the current block. The completion of all written frames is reported with a single call to
+ * IDoCanDataFrameTransmitterCallback::dataFramesSent(). After a send job has been cancelled, new
+ * send jobs are rejected with SendResult::FULL until the frames already written are confirmed.
+ *
+ * Each written frame keeps its own slot until its transmission has been confirmed, so the CAN
+ * transceiver may either copy written frames or reference them until they are sent. Transmissions
+ * may be confirmed from within ICanTransceiver::write(), the completion is then reported before
+ * startSendDataFrames() returns.
+ *
  * \tparam Addressing class providing addressing used for encoding/decoding CAN frames
  */
 template<class Addressing>
@@ -40,17 +58,23 @@ public:
     using FrameSizeType        = typename DataLinkLayerType::FrameSizeType;
     using JobHandleType        = typename FrameTransmitterType::JobHandleType;
 
+    /// Maximum number of data frames that can be written to the CAN transceiver at once.
+    static constexpr size_t MAX_SEND_FRAME_COUNT = 4U;
+
     /**
      * Constructor.
      * \param transceiver CAN transceiver
      * \param filter filter to provider for CAN listener
      * \param codec Codec class
+     * \param maxSendFrameCount maximum number of data frames that are written to the CAN
+     *        transceiver at once, 1 disables pipelining, limited to MAX_SEND_FRAME_COUNT
      */
     DoCanPhysicalCanTransceiver(
         ::can::ICanTransceiver& transceiver,
         ::can::IFilter& filter,
         IDoCanAddressConverter<DataLinkLayerType> const& addressConverter,
-        AddressingType const& addressing);
+        AddressingType const& addressing,
+        FrameIndexType maxSendFrameCount = 1U);
 
     void init(IDoCanFrameReceiver<DataLinkLayerType>& receiver) override;
     void shutdown() override;
@@ -81,8 +105,9 @@ private:
     void frameReceived(::can::CANFrame const& canFrame) override;
     ::can::IFilter& getFilter() override;
     void canFrameSent(::can::CANFrame const& frame) override;
+    void framesSent();
 
-    ::can::CANFrame _frame;
+    ::etl::array<::can::CANFrame, MAX_SEND_FRAME_COUNT> _frames;
     ::can::ICanTransceiver& _transceiver;
     ::can::IFilter& _filter;
     IDoCanAddressConverter<DataLinkLayerType> const& _addressConverter;
@@ -90,8 +115,12 @@ private:
     IDoCanFrameReceiver<DataLinkLayerType>* _frameReceiver;
     IDoCanDataFrameTransmitterCallback<DataLinkLayerType>* _sendCallback;
     JobHandleType _sendJobHandle;
-    uint8_t _sendDataSize;
+    MessageSizeType _sendDataSize;
+    FrameIndexType const _maxSendFrameCount;
+    FrameIndexType _sendFrameCount;
+    FrameIndexType _sentFrameCount;
     bool _sendPending;
+    bool _sendQueuing;
 };
 
 /**
@@ -102,8 +131,9 @@ DoCanPhysicalCanTransceiver<Addressing>::DoCanPhysicalCanTransceiver(
     ::can::ICanTransceiver& transceiver,
     ::can::IFilter& filter,
     IDoCanAddressConverter<DataLinkLayerType> const& addressConverter,
-    AddressingType const& addressing)
-: _frame()
+    AddressingType const& addressing,
+    FrameIndexType const maxSendFrameCount)
+: _frames()
 , _transceiver(transceiver)
 , _filter(filter)
 , _addressConverter(addressConverter)
@@ -112,7 +142,14 @@ DoCanPhysicalCanTransceiver<Addressing>::DoCanPhysicalCanTransceiver(
 , _sendCallback(nullptr)
 , _sendJobHandle()
 , _sendDataSize(0U)
+, _maxSendFrameCount(::etl::clamp(
+      maxSendFrameCount,
+      static_cast<FrameIndexType>(1U),
+      static_cast<FrameIndexType>(MAX_SEND_FRAME_COUNT)))
+, _sendFrameCount(0U)
+, _sentFrameCount(0U)
 , _sendPending(false)
+, _sendQueuing(false)
 {}
 
 template<class Addressing>
@@ -140,38 +177,79 @@ SendResult DoCanPhysicalCanTransceiver<Addressing>::startSendDataFrames(
     FrameSizeType const consecutiveFrameDataSize,
     ::etl::span<uint8_t const> const& data)
 {
-    (void)lastFrameIndex;
-    if (!_sendPending)
+    if (_sendPending)
+    {
+        return SendResult::FULL;
+    }
+
+    FrameIndexType const maxFrameCount = (lastFrameIndex > firstFrameIndex)
+                                             ? ::etl::min(
+                                                 static_cast<FrameIndexType>(
+                                                     lastFrameIndex - firstFrameIndex),
+                                                 _maxSendFrameCount)
+                                             : static_cast<FrameIndexType>(1U);
+    _sendPending    = true;
+    _sendQueuing    = true;
+    _sendCallback   = &callback;
+    _sendJobHandle  = jobHandle;
+    _sendDataSize   = 0U;
+    _sendFrameCount = 0U;
+    _sentFrameCount = 0U;
+
+    SendResult result = SendResult::QUEUED_FULL;
+    ::etl::span<uint8_t const> pendingData(data);
+    while ((_sendFrameCount < maxFrameCount) && (!pendingData.empty()))
     {
+        ::can::CANFrame& frame = _frames[static_cast<size_t>(_sendFrameCount)];
         ::etl::span<uint8_t> payload(
-            _frame.getPayload(), static_cast<size_t>(_frame.getMaxPayloadLength()));
+            frame.getPayload(), static_cast<size_t>(frame.getMaxPayloadLength()));
 
+        FrameSizeType consumedDataSize = 0U;
         if (codec.encodeDataFrame(
-                payload, data, firstFrameIndex, consecutiveFrameDataSize, _sendDataSize)
+                payload,
+                pendingData,
+                static_cast<FrameIndexType>(firstFrameIndex + _sendFrameCount),
+                consecutiveFrameDataSize,
+                consumedDataSize)
             != CodecResult::OK)
         {
-            return SendResult::INVALID;
+            result = SendResult::INVALID;
+            break;
         }
 
         uint32_t canId;
         _addressing.encodeTransmissionAddress(transmissionAddress, canId, payload);
-        _frame.setId(canId);
-        _frame.setPayloadLength(static_cast<uint8_t>(payload.size()));
-        ::can::ICanTransceiver::ErrorCode const result = _transceiver.write(_frame, *this);
-        if (result == ::can::ICanTransceiver::ErrorCode::CAN_ERR_OK)
-        {
-            _sendPending   = true;
-            _sendCallback  = &callback;
-            _sendJobHandle = jobHandle;
-            return SendResult::QUEUED_FULL;
-        }
-        if (result != ::can::ICanTransceiver::ErrorCode::CAN_ERR_TX_HW_QUEUE_FULL)
+        frame.setId(canId);
+        frame.setPayloadLength(static_cast<uint8_t>(payload.size()));
+        ::can::ICanTransceiver::ErrorCode const writeResult = _transceiver.write(frame, *this);
+        if (writeResult != ::can::ICanTransceiver::ErrorCode::CAN_ERR_OK)
         {
-            return SendResult::FAILED;
+            result = (writeResult == ::can::ICanTransceiver::ErrorCode::CAN_ERR_TX_HW_QUEUE_FULL)
+                         ? SendResult::FULL
+                         : SendResult::FAILED;
+            break;
         }
-        // default return value: FULL
+        pendingData = pendingData.subspan(static_cast<size_t>(consumedDataSize));
+        _sendDataSize += consumedDataSize;
+        ++_sendFrameCount;
+    }
+
+    ::interrupts::SuspendResumeAllInterruptsScopedLock const lock;
+    _sendQueuing = false;
+
+    if (_sendFrameCount == 0U)
+    {
+        _sendPending  = false;
+        _sendCallback = nullptr;
+        return result;
     }
-    return SendResult::FULL;
+    // frames may already have been confirmed from within write()
+    if (_sentFrameCount >= _sendFrameCount)
+    {
+        framesSent();
+    }
+    // the frames written so far are reported, the rest is requested again by the transmitter
+    return SendResult::QUEUED_FULL;
 }
 
 template<class Addressing>
@@ -181,7 +259,8 @@ void DoCanPhysicalCanTransceiver<Addressing>::cancelSendDataFrames(
     // This is done under lock in DoCanTransmitter.
     if (_sendPending && (_sendCallback == &callback) && (_sendJobHandle == jobHandle))
     {
-        _sendPending  = false;
+        // The written frames are still queued in the CAN transceiver. Their confirmations are
+        // dropped and no new send job is started before all of them have arrived.
         _sendCallback = nullptr;
     }
 }
@@ -244,16 +323,27 @@ template<class Addressing>
 void DoCanPhysicalCanTransceiver<Addressing>::canFrameSent(::can::CANFrame const& frame)
 {
     (void)frame;
+    ::interrupts::SuspendResumeAllInterruptsScopedLock const lock;
     if (_sendPending)
     {
-        _sendPending = false;
-        if (_sendCallback != nullptr)
+        ++_sentFrameCount;
+        if ((!_sendQueuing) && (_sentFrameCount >= _sendFrameCount))
         {
-            _sendCallback->dataFramesSent(_sendJobHandle, 1U, _sendDataSize);
+            framesSent();
         }
     }
 }
 
+template<class Addressing>
+void DoCanPhysicalCanTransceiver<Addressing>::framesSent()
+{
+    _sendPending = false;
+    if (_sendCallback != nullptr)
+    {
+        _sendCallback->dataFramesSent(_sendJobHandle, _sendFrameCount, _sendDataSize);
+    }
+}
+
 template<class Addressing>
 ::can::ICANFrameListener& DoCanPhysicalCanTransceiver<Addressing>::getListener()
 {
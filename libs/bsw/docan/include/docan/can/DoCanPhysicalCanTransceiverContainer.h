@@ -96,8 +96,11 @@ public:
     /**
      * Create a transceiver within the container.
      * \param transceiver CAN transceiver to use
+     * \param maxSendFrameCount maximum number of data frames written at once
      */
-    DoCanPhysicalCanTransceiver<Addressing>& addTransceiver(::can::ICanTransceiver& transceiver);
+    DoCanPhysicalCanTransceiver<Addressing>& addTransceiver(
+        ::can::ICanTransceiver& transceiver,
+        typename DataLinkLayerType::FrameIndexType maxSendFrameCount = 1U);
 
 private:
     ::docan::DoCanPhysicalCanTransceiverContainer<Addressing>& _container;
@@ -147,9 +150,11 @@ DoCanPhysicalCanTransceiverContainerBuilder<Addressing>::
 template<class Addressing>
 DoCanPhysicalCanTransceiver<Addressing>&
 DoCanPhysicalCanTransceiverContainerBuilder<Addressing>::addTransceiver(
-    ::can::ICanTransceiver& transceiver)
+    ::can::ICanTransceiver& transceiver,
+    typename DataLinkLayerType::FrameIndexType const maxSendFrameCount)
 {
-    return _container.emplace_back(transceiver, _filter, _addressConverter, _addressing);
+    return _container.emplace_back(
+        transceiver, _filter, _addressConverter, _addressing, maxSendFrameCount);
 }
 
 } // namespace declare
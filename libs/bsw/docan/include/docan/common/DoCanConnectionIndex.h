@@ -0,0 +1,138 @@
+// Copyright 2024 Accenture.
+
+#pragma once
+
+#include <etl/intrusive_links.h>
+
+#include <platform/estdint.h>
+
+namespace docan
+{
+/**
+ * Intrusive hash index for message receivers and message transmitters. The indexed objects are
+ * chained into a fixed number of buckets by an additional ::etl::forward_link, no memory is
+ * allocated. Within a bucket the objects are kept in insertion order, i.e. a lookup returns the
+ * oldest matching object.
+ *
+ * The index is not synchronized, all operations are expected to be called with the same locks
+ * that protect the list holding the indexed objects.
+ *
+ * \tparam T type of the indexed objects, needs to derive from Link
+ * \tparam Link link type used for chaining the objects within a bucket
+ * \tparam BucketCount number of buckets, needs to be a power of two
+ */
+template<class T, class Link, size_t BucketCount>
+class DoCanConnectionIndex
+{
+    static_assert(
+        (BucketCount > 0U) && ((BucketCount & (BucketCount - 1U)) == 0U),
+        "bucket count must be a power of two");
+
+public:
+    DoCanConnectionIndex();
+
+    /**
+     * Removes all objects from the index.
+     */
+    void clear();
+
+    /**
+     * Adds an object to the index.
+     * \param item object to add, must not be part of the index yet
+     * \param key key (or any hash of it) the object is searched by
+     */
+    void insert(T& item, uint32_t key);
+
+    /**
+     * Removes an object from the index. Nothing happens if the object is not part of the index.
+     * \param item object to remove
+     * \param key key the object has been inserted with
+     */
+    void remove(T& item, uint32_t key);
+
+    /**
+     * Looks up the oldest object that has been inserted with the given key and additionally
+     * matches a predicate.
+     * \param key key to search for
+     * \param predicate function object called with the candidate objects to compare the full key
+     * \return pointer to the object if found, nullptr otherwise
+     */
+    template<class Predicate>
+    T* find(uint32_t key, Predicate const& predicate) const;
+
+private:
+    static size_t getBucket(uint32_t key);
+
+    Link* _buckets[BucketCount];
+};
+
+/**
+ * Inline implementation.
+ */
+template<class T, class Link, size_t BucketCount>
+DoCanConnectionIndex<T, Link, BucketCount>::DoCanConnectionIndex() : _buckets()
+{}
+
+template<class T, class Link, size_t BucketCount>
+void DoCanConnectionIndex<T, Link, BucketCount>::clear()
+{
+    for (Link*& bucket : _buckets)
+    {
+        bucket = nullptr;
+    }
+}
+
+template<class T, class Link, size_t BucketCount>
+void DoCanConnectionIndex<T, Link, BucketCount>::insert(T& item, uint32_t const key)
+{
+    Link& link    = item;
+    link.etl_next = nullptr;
+    Link** next   = &_buckets[getBucket(key)];
+    while (*next != nullptr)
+    {
+        next = &(*next)->etl_next;
+    }
+    *next = &link;
+}
+
+template<class T, class Link, size_t BucketCount>
+void DoCanConnectionIndex<T, Link, BucketCount>::remove(T& item, uint32_t const key)
+{
+    Link* const link = &static_cast<Link&>(item);
+    Link** next      = &_buckets[getBucket(key)];
+    while (*next != nullptr)
+    {
+        if (*next == link)
+        {
+            *next          = link->etl_next;
+            link->etl_next = nullptr;
+            return;
+        }
+        next = &(*next)->etl_next;
+    }
+}
+
+template<class T, class Link, size_t BucketCount>
+template<class Predicate>
+T* DoCanConnectionIndex<T, Link, BucketCount>::find(
+    uint32_t const key, Predicate const& predicate) const
+{
+    for (Link* link = _buckets[getBucket(key)]; link != nullptr; link = link->etl_next)
+    {
+        T& item = static_cast<T&>(*link);
+        if (predicate(item))
+        {
+            return &item;
+        }
+    }
+    return nullptr;
+}
+
+template<class T, class Link, size_t BucketCount>
+inline size_t DoCanConnectionIndex<T, Link, BucketCount>::getBucket(uint32_t const key)
+{
+    // Fibonacci hashing spreads neighbouring addresses and job counters over the buckets
+    return static_cast<size_t>((key * 0x9E3779B1U) >> 16U) & (BucketCount - 1U);
+}
+
+} // namespace docan
@@ -23,6 +23,10 @@ public:
 
     DoCanJobHandle() : DoCanJobHandle(static_cast<CounterType>(0), static_cast<UserDataType>(0)) {}
 
+    CounterType getCounter() const { return _counter; }
+
+    UserDataType getUserData() const { return _userData; }
+
     bool operator==(DoCanJobHandle const& other) const
     {
         return (_counter == other._counter) && (_userData == other._userData);
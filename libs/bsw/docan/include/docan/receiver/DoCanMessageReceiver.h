@@ -26,6 +26,7 @@ template<class DataLinkLayer>
 class DoCanMessageReceiver
 : public DoCanMessageReceiveProtocolHandler<typename DataLinkLayer::FrameIndexType>
 , public ::etl::bidirectional_link<0>
+, public ::etl::forward_link<1>
 {
 public:
     using DataLinkLayerType       = DataLinkLayer;
@@ -245,6 +246,7 @@ DoCanMessageReceiver<DataLinkLayer>::DoCanMessageReceiver(
     bool const blocked)
 : DoCanMessageReceiveProtocolHandler<FrameIndexType>(frameCount)
 , ::etl::bidirectional_link<0>()
+, ::etl::forward_link<1>()
 , _connection(connection)
 , _message(nullptr)
 , _firstFrameData(firstFrameData.data())
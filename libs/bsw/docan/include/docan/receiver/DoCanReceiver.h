@@ -4,6 +4,7 @@
 
 #include "docan/addressing/IDoCanAddressConverter.h"
 #include "docan/common/DoCanConnection.h"
+#include "docan/common/DoCanConnectionIndex.h"
 #include "docan/common/DoCanConstants.h"
 #include "docan/common/DoCanParameters.h"
 #include "docan/datalink/IDoCanFlowControlFrameTransmitter.h"
@@ -111,6 +112,11 @@ public:
 
 private:
     static uint8_t const FORMAT_BUFFER_SIZE = 32U;
+    // number of buckets of the index of message receivers by reception address
+    static size_t const INDEX_BUCKET_COUNT  = 16U;
+
+    using MessageReceiverIndexType
+        = DoCanConnectionIndex<MessageReceiverType, ::etl::forward_link<1>, INDEX_BUCKET_COUNT>;
 
     void processMessageReceivers();
 
@@ -158,6 +164,7 @@ private:
     ::async::MemberCall<DoCanReceiver, &DoCanReceiver::processMessageReceivers>
         _processMessageReceivers;
     MessageReceiverListType _messageReceivers;
+    MessageReceiverIndexType _messageReceiverIndex;
     DoCanParameters const& _parameters;
     FrameSizeType const _maxFirstFrameDataSize;
     ::async::ContextType const _context;
@@ -187,6 +194,7 @@ DoCanReceiver<DataLinkLayer>::DoCanReceiver(
 , _messageReceiverPool(messageReceiverBlockPool)
 , _processMessageReceivers(*this)
 , _messageReceivers()
+, _messageReceiverIndex()
 , _parameters(parameters)
 , _maxFirstFrameDataSize(static_cast<FrameSizeType>(
       static_cast<size_t>(messageReceiverBlockPool.max_item_size()) - sizeof(MessageReceiverType)))
@@ -277,6 +285,9 @@ void DoCanReceiver<DataLinkLayer>::firstDataFrameReceived(
                     firstFrameCopy,
                     blocked);
                 _messageReceivers.push_back(*messageReceiver);
+                _messageReceiverIndex.insert(
+                    *messageReceiver,
+                    static_cast<uint32_t>(dataLinkAddressPair.getReceptionAddress()));
             }
             handleTransitions(
                 *messageReceiver, handleTransition(*messageReceiver), "firstDataFrameReceived");
@@ -732,14 +743,10 @@ template<class DataLinkLayer>
 typename DoCanReceiver<DataLinkLayer>::MessageReceiverType*
 DoCanReceiver<DataLinkLayer>::findMessageReceiver(DataLinkAddressType const receptionAddress)
 {
-    for (auto& it : _messageReceivers)
-    {
-        if (it.getReceptionAddress() == receptionAddress)
-        {
-            return &it;
-        }
-    }
-    return nullptr;
+    return _messageReceiverIndex.find(
+        static_cast<uint32_t>(receptionAddress),
+        [receptionAddress](MessageReceiverType const& messageReceiver)
+        { return messageReceiver.getReceptionAddress() == receptionAddress; });
 }
 
 template<class DataLinkLayer>
@@ -769,6 +776,9 @@ void DoCanReceiver<DataLinkLayer>::releaseRemoveLock()
             {
                 MessageReceiverType& messageReceiver = *it;
                 it                                   = _messageReceivers.erase(it);
+                _messageReceiverIndex.remove(
+                    messageReceiver,
+                    static_cast<uint32_t>(messageReceiver.getReceptionAddress()));
                 _messageReceiverPool.destroy(&messageReceiver);
                 --_releasedReceiverCount;
             }
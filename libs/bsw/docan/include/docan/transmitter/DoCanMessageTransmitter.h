@@ -26,6 +26,8 @@ template<class DataLinkLayer>
 class DoCanMessageTransmitter
 : public DoCanMessageTransmitProtocolHandler<typename DataLinkLayer::FrameIndexType>
 , public ::etl::bidirectional_link<0>
+, public ::etl::forward_link<1>
+, public ::etl::forward_link<2>
 {
 public:
     using DataLinkLayerType       = DataLinkLayer;
@@ -206,6 +208,8 @@ DoCanMessageTransmitter<DataLinkLayer>::DoCanMessageTransmitter(
     FrameSizeType const consecutiveFrameDataSize)
 : DoCanMessageTransmitProtocolHandler<FrameIndexType>(frameCount)
 , ::etl::bidirectional_link<0>()
+, ::etl::forward_link<1>()
+, ::etl::forward_link<2>()
 , _codec(codec)
 , _message(message)
 , _notificationListener(notificationListener)
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "docan/addressing/IDoCanAddressConverter.h"
+#include "docan/common/DoCanConnectionIndex.h"
 #include "docan/common/DoCanConstants.h"
 #include "docan/common/DoCanParameters.h"
 #include "docan/datalink/DoCanFrameCodec.h"
@@ -124,6 +125,13 @@ public:
 
 private:
     static uint8_t const FORMAT_BUFFER_SIZE = 32U;
+    // number of buckets of the indices of message transmitters by reception address and job handle
+    static size_t const INDEX_BUCKET_COUNT  = 16U;
+
+    using ReceptionAddressIndexType
+        = DoCanConnectionIndex<MessageTransmitterType, ::etl::forward_link<1>, INDEX_BUCKET_COUNT>;
+    using JobHandleIndexType
+        = DoCanConnectionIndex<MessageTransmitterType, ::etl::forward_link<2>, INDEX_BUCKET_COUNT>;
 
     void processMessageTransmitters();
 
@@ -142,6 +150,7 @@ private:
     void dataFramesSent(
         JobHandleType jobHandle, FrameIndexType frameCount, MessageSizeType dataSize) override;
 
+    void framesSent(JobHandleType jobHandle, FrameIndexType frameCount, MessageSizeType dataSize);
     void sendNextFrames();
     void handleResult(
         MessageTransmitterType& messageTransmitter,
@@ -149,9 +158,9 @@ private:
         char const* functionName);
     void resetTimer(MessageTransmitterType& messageTransmitter);
 
-    MessageTransmitterListIterator
+    MessageTransmitterType*
     findMessageTransmitterByReceptionAddress(DataLinkAddressType receptionAddress);
-    MessageTransmitterListIterator findMessageTransmitterByJobHandle(JobHandleType jobHandle);
+    MessageTransmitterType* findMessageTransmitterByJobHandle(JobHandleType jobHandle);
 
     MessageTransmitterListIterator setSendLock();
     void releaseSendLock(bool success);
@@ -166,11 +175,17 @@ private:
     ::async::MemberCall<DoCanTransmitter, &DoCanTransmitter::processMessageTransmitters>
         _processMessageTransmitters;
     MessageTransmitterListType _messageTransmitters;
+    ReceptionAddressIndexType _receptionAddressIndex;
+    JobHandleIndexType _jobHandleIndex;
     DataFrameTransmitterType& _dataFrameTransmitter;
     IDoCanTickGenerator& _tickGenerator;
     MessageTransmitterListIterator _sendMessageTransmitterIt;
     DoCanParameters const& _parameters;
     typename JobHandleType::CounterType _jobCounter;
+    // confirmation received while the send lock is set, i.e. before the frames were marked sending
+    JobHandleType _sentJobHandle;
+    FrameIndexType _sentFrameCount;
+    MessageSizeType _sentDataSize;
     ::async::ContextType const _context;
     uint8_t const _busId;
     uint8_t const _loggerComponent;
@@ -180,6 +195,7 @@ private:
     uint8_t _sendingConsecutiveFramesCount;
     bool _sendLock;
     bool _pendingSend;
+    bool _sentWhileSendLock;
     bool _switchContext;
     bool _timersUpdated;
 };
@@ -201,11 +217,16 @@ DoCanTransmitter<DataLinkLayer>::DoCanTransmitter(
 , _messageTransmitterPool(messageTransmitterBlockPool)
 , _processMessageTransmitters(*this)
 , _messageTransmitters()
+, _receptionAddressIndex()
+, _jobHandleIndex()
 , _dataFrameTransmitter(dataFrameTransmitter)
 , _tickGenerator(tickGenerator)
 , _sendMessageTransmitterIt(_messageTransmitters.end())
 , _parameters(parameters)
 , _jobCounter(0U)
+, _sentJobHandle()
+, _sentFrameCount(0U)
+, _sentDataSize(0U)
 , _context(context)
 , _busId(busId)
 , _loggerComponent(loggerComponent)
@@ -214,6 +235,7 @@ DoCanTransmitter<DataLinkLayer>::DoCanTransmitter(
 , _sendingConsecutiveFramesCount(0U)
 , _sendLock(false)
 , _pendingSend(false)
+, _sentWhileSendLock(false)
 , _switchContext(false)
 , _timersUpdated(false)
 {}
@@ -274,7 +296,7 @@ template<class DataLinkLayer>
     ::interrupts::SuspendResumeAllInterruptsScopedLock const lock;
     if ((frameCount > 1U)
         && (findMessageTransmitterByReceptionAddress(dataLinkAddressPair.getReceptionAddress())
-            != _messageTransmitters.end()))
+            != nullptr))
     {
         ::util::logger::Logger::warn(
             _loggerComponent,
@@ -310,6 +332,9 @@ template<class DataLinkLayer>
         frameCount,
         consecutiveFrameDataSize);
     _messageTransmitters.push_back(messageTransmitter);
+    _receptionAddressIndex.insert(
+        messageTransmitter, static_cast<uint32_t>(dataLinkAddressPair.getReceptionAddress()));
+    _jobHandleIndex.insert(messageTransmitter, jobHandle.getCounter());
 
     ::async::execute(_context, _processMessageTransmitters);
     return ::transport::AbstractTransportLayer::ErrorCode::TP_OK;
@@ -321,11 +346,26 @@ void DoCanTransmitter<DataLinkLayer>::dataFramesSent(
 {
     RemoveGuard const guard(this, false);
     ::interrupts::SuspendResumeAllInterruptsScopedLock const lock;
+    if (_sendLock)
+    {
+        // frames confirmed from within startSendDataFrames() are handled by releaseSendLock()
+        _sentWhileSendLock = true;
+        _sentJobHandle     = jobHandle;
+        _sentFrameCount    = frameCount;
+        _sentDataSize      = dataSize;
+        return;
+    }
+    framesSent(jobHandle, frameCount, dataSize);
+}
+
+template<class DataLinkLayer>
+void DoCanTransmitter<DataLinkLayer>::framesSent(
+    JobHandleType const jobHandle, FrameIndexType const frameCount, MessageSizeType const dataSize)
+{
     _pendingSend = false;
 
-    MessageTransmitterListIterator const messageTransmitter
-        = findMessageTransmitterByJobHandle(jobHandle);
-    if (messageTransmitter != _messageTransmitters.end())
+    MessageTransmitterType* const messageTransmitter = findMessageTransmitterByJobHandle(jobHandle);
+    if (messageTransmitter != nullptr)
     {
         handleResult(
             *messageTransmitter,
@@ -347,9 +387,9 @@ void DoCanTransmitter<DataLinkLayer>::flowControlFrameReceived(
 {
     RemoveGuard const guard(this);
     ::interrupts::SuspendResumeAllInterruptsScopedLock const lock;
-    MessageTransmitterListIterator const messageTransmitter
+    MessageTransmitterType* const messageTransmitter
         = findMessageTransmitterByReceptionAddress(receptionAddress);
-    if (messageTransmitter == _messageTransmitters.end())
+    if (messageTransmitter == nullptr)
     {
         char formatBuffer[FORMAT_BUFFER_SIZE];
         ::util::logger::Logger::warn(
@@ -452,8 +492,8 @@ void DoCanTransmitter<DataLinkLayer>::sendNextFrames()
                 handleResult(messageTransmitter, messageTransmitter.cancel(), "sendNextFrames");
             }
             // otherwise, sending will be retried from cyclicTask
+            releaseSendLock(false);
         }
-        releaseSendLock(false);
         break;
     }
 }
@@ -475,6 +515,15 @@ void DoCanTransmitter<DataLinkLayer>::handleResult(
                     *this, messageTransmitter.getJobHandle());
                 _pendingSend = false;
             }
+            {
+                // the index keys are reset by release()
+                ::interrupts::SuspendResumeAllInterruptsScopedLock const lock;
+                _receptionAddressIndex.remove(
+                    messageTransmitter,
+                    static_cast<uint32_t>(messageTransmitter.getReceptionAddress()));
+                _jobHandleIndex.remove(
+                    messageTransmitter, messageTransmitter.getJobHandle().getCounter());
+            }
             messageTransmitter.release();
             // Ensure we don't wrap _releasedTransmitterCount back to 0
             ETL_ASSERT(
@@ -621,32 +670,24 @@ void DoCanTransmitter<DataLinkLayer>::resetTimer(MessageTransmitterType& message
 }
 
 template<class DataLinkLayer>
-typename DoCanTransmitter<DataLinkLayer>::MessageTransmitterListIterator
+typename DoCanTransmitter<DataLinkLayer>::MessageTransmitterType*
 DoCanTransmitter<DataLinkLayer>::findMessageTransmitterByReceptionAddress(
     DataLinkAddressType const receptionAddress)
 {
-    for (auto&& it = _messageTransmitters.begin(); it != _messageTransmitters.end(); ++it)
-    {
-        if (receptionAddress == it->getReceptionAddress())
-        {
-            return it;
-        }
-    }
-    return _messageTransmitters.end();
+    return _receptionAddressIndex.find(
+        static_cast<uint32_t>(receptionAddress),
+        [receptionAddress](MessageTransmitterType const& messageTransmitter)
+        { return receptionAddress == messageTransmitter.getReceptionAddress(); });
 }
 
 template<class DataLinkLayer>
-typename DoCanTransmitter<DataLinkLayer>::MessageTransmitterListIterator
+typename DoCanTransmitter<DataLinkLayer>::MessageTransmitterType*
 DoCanTransmitter<DataLinkLayer>::findMessageTransmitterByJobHandle(JobHandleType const jobHandle)
 {
-    for (auto&& it = _messageTransmitters.begin(); it != _messageTransmitters.end(); ++it)
-    {
-        if (jobHandle == it->getJobHandle())
-        {
-            return it;
-        }
-    }
-    return _messageTransmitters.end();
+    return _jobHandleIndex.find(
+        jobHandle.getCounter(),
+        [jobHandle](MessageTransmitterType const& messageTransmitter)
+        { return jobHandle == messageTransmitter.getJobHandle(); });
 }
 
 template<class DataLinkLayer>
@@ -690,6 +731,11 @@ void DoCanTransmitter<DataLinkLayer>::releaseSendLock(bool const success)
         ++_sendMessageTransmitterIt;
     }
     _sendLock = false;
+    if (_sentWhileSendLock)
+    {
+        _sentWhileSendLock = false;
+        framesSent(_sentJobHandle, _sentFrameCount, _sentDataSize);
+    }
 }
 
 template<class DataLinkLayer>
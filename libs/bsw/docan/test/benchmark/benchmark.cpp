@@ -324,7 +324,7 @@ BENCHMARK_F(TransmissionBenchmark, SendFirstConsecutiveFrame)(benchmark::State&
     }
 }
 
-template<size_t MessageSize>
+template<size_t MessageSize, uint8_t MaxSendFrameCount = 1U>
 void TransmissionFullSegmentedMessage(benchmark::State& state)
 {
     nowUs = 0;
@@ -385,7 +385,8 @@ void TransmissionFullSegmentedMessage(benchmark::State& state)
             ::etl::ref(canTransceiver),
             ::etl::ref(_doCanAddressingFilter),
             _doCanAddressingFilter,
-            _doCanCodecClassic);
+            _doCanCodecClassic,
+            MaxSendFrameCount);
 
     ::can::ICANFrameSentListener* canFrameSentListener(&doCanTransceiver);
 
@@ -439,11 +440,16 @@ void TransmissionFullSegmentedMessage(benchmark::State& state)
             _context.execute();
         }
     }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * MessageSize);
 }
 
 BENCHMARK_TEMPLATE(TransmissionFullSegmentedMessage, 100);
 BENCHMARK_TEMPLATE(TransmissionFullSegmentedMessage, 1000);
 BENCHMARK_TEMPLATE(TransmissionFullSegmentedMessage, 10000);
+// pipelined consecutive frames, compare bytes/s with the variants above
+BENCHMARK_TEMPLATE(TransmissionFullSegmentedMessage, 1000, 4);
+BENCHMARK_TEMPLATE(TransmissionFullSegmentedMessage, 10000, 2);
+BENCHMARK_TEMPLATE(TransmissionFullSegmentedMessage, 10000, 4);
 
 template<size_t MessageSize, uint16_t NoOfMessages>
 void TransmissionMultipleTransportLayersFullSegmentedMessages(benchmark::State& state)
@@ -718,9 +724,19 @@ void TransmissionMultipleFullSegmentedMessages(benchmark::State& state)
         ASSERT_TRUE(_doCanConfig.getMessageTransmitterPool().empty());
         _context.execute();
     }
+    // items are the frames sent, i.e. the time per item is the per frame cost
+    DataLinkLayerType::FrameIndexType frameCount = 0U;
+    DataLinkLayerType::FrameSizeType consecutiveFrameDataSize;
+    (void)codecClassic.getEncodedFrameCount(MessageSize, frameCount, consecutiveFrameDataSize);
+    state.SetItemsProcessed(
+        static_cast<int64_t>(state.iterations()) * NoOfMessages * static_cast<int64_t>(frameCount));
 }
 
 BENCHMARK_TEMPLATE(TransmissionMultipleFullSegmentedMessages, 10, 10);
 BENCHMARK_TEMPLATE(TransmissionMultipleFullSegmentedMessages, 100, 10);
 BENCHMARK_TEMPLATE(TransmissionMultipleFullSegmentedMessages, 10, 100);
 BENCHMARK_TEMPLATE(TransmissionMultipleFullSegmentedMessages, 100, 100);
+// per frame cost depending on the number of concurrent connections
+BENCHMARK_TEMPLATE(TransmissionMultipleFullSegmentedMessages, 100, 1);
+BENCHMARK_TEMPLATE(TransmissionMultipleFullSegmentedMessages, 100, 16);
+BENCHMARK_TEMPLATE(TransmissionMultipleFullSegmentedMessages, 100, 64);
@@ -60,6 +60,16 @@ TEST(DoCanNormalAddressingFilterTest, initAssertsIfEntriesIsEmpty)
     ASSERT_THROW(cut2.init({}, codecEntries), ::etl::exception);
 }
 
+/*
+ * init will assert if a given transmission index cannot hold all entries.
+ */
+TEST(DoCanNormalAddressingFilterTest, initAssertsIfTransmissionIndexIsTooSmall)
+{
+    DoCanNormalAddressingFilterType::AddressEntryType const* transmissionIndex[7];
+    DoCanNormalAddressingFilter<DataLinkLayerType> cut;
+    ASSERT_THROW(cut.init(testEntries, codecEntries, transmissionIndex), ::etl::exception);
+}
+
 /*
  * When all entries are valid, all entries will be added to the addressing filter
  */
@@ -84,6 +94,31 @@ TEST(DoCanNormalAddressingFilterTest, initOnlyValidEntries)
         dlPair);
 }
 
+/*
+ * With a transmission index the first entry of equal transport address pairs is found, as with the
+ * linear search.
+ */
+TEST(DoCanNormalAddressingFilterTest, testTransmissionIndexWithEqualTransportAddressPairs)
+{
+    static DoCanNormalAddressingFilter<DataLinkLayerType>::AddressEntryType const entries[]
+        = {{CanId::Base<0x100>::value, CanId::Base<0x200>::value, 0x30, 0x40, 1, 2},
+           {CanId::Base<0x101>::value, CanId::Base<0x201>::value, 0x10, 0x20, 1, 2},
+           {CanId::Base<0x102>::value, CanId::Base<0x202>::value, 0x10, 0x20, 1, 3}};
+
+    DoCanNormalAddressingFilterType::AddressEntryType const* transmissionIndex[3];
+    DoCanNormalAddressingFilter<DataLinkLayerType> cut(entries, codecEntries, transmissionIndex);
+    DataLinkAddressPairType dlPair;
+
+    EXPECT_EQ(
+        &codec2, cut.getTransmissionParameters(DoCanTransportAddressPair(0x20, 0x10), dlPair));
+    EXPECT_EQ(
+        DataLinkAddressPairType(CanId::Base<0x101>::value, CanId::Base<0x201>::value), dlPair);
+    EXPECT_EQ(
+        &codec2, cut.getTransmissionParameters(DoCanTransportAddressPair(0x40, 0x30), dlPair));
+    EXPECT_EQ(
+        DataLinkAddressPairType(CanId::Base<0x100>::value, CanId::Base<0x200>::value), dlPair);
+}
+
 /*
  * A normal addressing filter can be constructed/initialized with some invalid entries as well, but
  * only at the end of the set of entries. The handling is to stop processing new entries as soon as
@@ -92,12 +127,19 @@ TEST(DoCanNormalAddressingFilterTest, initOnlyValidEntries)
  */
 TEST(DoCanNormalAddressingFilterTest, testTransmissionParams)
 {
+    DoCanNormalAddressingFilterType::AddressEntryType const* transmissionIndex3[8];
+    DoCanNormalAddressingFilterType::AddressEntryType const* transmissionIndex4[10];
     DoCanNormalAddressingFilter<DataLinkLayerType> cut1(testEntries, codecEntries);
     DoCanNormalAddressingFilter<DataLinkLayerType> cut2;
     cut2.init(testEntries, codecEntries);
-    for (uint8_t idx = 0U; idx < 2U; ++idx)
+    DoCanNormalAddressingFilter<DataLinkLayerType> cut3(
+        testEntries, codecEntries, transmissionIndex3);
+    DoCanNormalAddressingFilter<DataLinkLayerType> cut4;
+    cut4.init(testEntries, codecEntries, transmissionIndex4);
+    DoCanNormalAddressingFilter<DataLinkLayerType>* const cuts[] = {&cut1, &cut2, &cut3, &cut4};
+    for (DoCanNormalAddressingFilter<DataLinkLayerType>* const pCut : cuts)
     {
-        DoCanNormalAddressingFilter<DataLinkLayerType>& cut = (idx == 0U) ? cut1 : cut2;
+        DoCanNormalAddressingFilter<DataLinkLayerType>& cut = *pCut;
         DataLinkAddressPairType dlPair;
         EXPECT_EQ(
             &codec2, cut.getTransmissionParameters(DoCanTransportAddressPair(0x83, 0xf54), dlPair));
@@ -191,14 +191,23 @@ TEST_F(TestWithNormalAddressing, testTransceiverSendDataFrames)
         cut.cancelSendDataFrames(_frameTransmitterCallbackMock, jobHandle);
 
         // Different data size to ensure dataFramesSent is sending this, not the previous message.
-        uint8_t const data2[]                = {0x91, 0x82, 0x71};
+        uint8_t const data2[] = {0x91, 0x82, 0x71};
+        // Even if they are the same job handle, even though they shouldnt be.
+        JobHandle jobHandle2(jobHandle);
+        // The cancelled frame is still queued
+        EXPECT_EQ(
+            SendResult::FULL,
+            cut.startSendDataFrames(
+                _codec, _frameTransmitterCallbackMock, jobHandle2, 0x1234897U, 0U, 1U, 0U, data2));
+        // Its late confirmation is dropped
+        sentListener->canFrameSent(CANFrame());
+        Mock::VerifyAndClearExpectations(&_frameTransmitterCallbackMock);
+
         ICANFrameSentListener* sentListener2 = 0L;
         EXPECT_CALL(_canTransceiverMock, write(_, _))
             .WillOnce(DoAll(
                 WithArg<1>(SaveRef<0>(&sentListener2)),
                 Return(ICanTransceiver::ErrorCode::CAN_ERR_OK)));
-        // Even if they are the same job handle, even though they shouldnt be.
-        JobHandle jobHandle2(jobHandle);
         EXPECT_EQ(
             SendResult::QUEUED_FULL,
             cut.startSendDataFrames(
@@ -206,7 +215,7 @@ TEST_F(TestWithNormalAddressing, testTransceiverSendDataFrames)
         Mock::VerifyAndClearExpectations(&_canTransceiverMock);
         EXPECT_CALL(_frameTransmitterCallbackMock, dataFramesSent(jobHandle2, 1U, sizeof(data2)));
 
-        sentListener->canFrameSent(CANFrame());
+        sentListener2->canFrameSent(CANFrame());
         Mock::VerifyAndClearExpectations(&_canTransceiverMock);
     }
     {
@@ -242,6 +251,266 @@ TEST_F(TestWithNormalAddressing, testTransceiverSendDataFrames)
     }
 }
 
+TEST_F(TestWithNormalAddressing, testTransceiverSendPipelinedDataFrames)
+{
+    DoCanPhysicalCanTransceiver<TestWithNormalAddressing::CodecType> cut(
+        _canTransceiverMock, _filterMock, _addressConverterMock, _addressing, 4U);
+    uint8_t data[20];
+    for (size_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = static_cast<uint8_t>(i);
+    }
+    ICANFrameSentListener* sentListener = 0L;
+    {
+        // frames are written up to the end of the block
+        uint8_t const expectedPayload1[] = {0x21U, 0x00U, 0x01U, 0x02U, 0x03U, 0x04U, 0x05U, 0x06U};
+        uint8_t const expectedPayload2[] = {0x22U, 0x07U, 0x08U, 0x09U, 0x0AU, 0x0BU, 0x0CU, 0x0DU};
+        Sequence seq;
+        EXPECT_CALL(
+            _canTransceiverMock,
+            write(CANFrame(0x1234897U, expectedPayload1, sizeof(expectedPayload1)), _))
+            .InSequence(seq)
+            .WillOnce(DoAll(
+                WithArg<1>(SaveRef<0>(&sentListener)),
+                Return(ICanTransceiver::ErrorCode::CAN_ERR_OK)));
+        EXPECT_CALL(
+            _canTransceiverMock,
+            write(CANFrame(0x1234897U, expectedPayload2, sizeof(expectedPayload2)), _))
+            .InSequence(seq)
+            .WillOnce(Return(ICanTransceiver::ErrorCode::CAN_ERR_OK));
+        JobHandle jobHandle(0x12, 0x34);
+        EXPECT_EQ(
+            SendResult::QUEUED_FULL,
+            cut.startSendDataFrames(
+                _codec, _frameTransmitterCallbackMock, jobHandle, 0x1234897U, 1U, 3U, 7U, data));
+        Mock::VerifyAndClearExpectations(&_canTransceiverMock);
+
+        // expect error code when sending again
+        EXPECT_EQ(
+            SendResult::FULL,
+            cut.startSendDataFrames(
+                _codec, _frameTransmitterCallbackMock, jobHandle, 0x1234897U, 1U, 3U, 7U, data));
+
+        // expect a single callback when all frames have been sent
+        sentListener->canFrameSent(CANFrame());
+        Mock::VerifyAndClearExpectations(&_frameTransmitterCallbackMock);
+        EXPECT_CALL(_frameTransmitterCallbackMock, dataFramesSent(jobHandle, 2U, 14U));
+        sentListener->canFrameSent(CANFrame());
+        Mock::VerifyAndClearExpectations(&_frameTransmitterCallbackMock);
+    }
+    {
+        // frames are written up to the end of the data
+        EXPECT_CALL(_canTransceiverMock, write(_, _))
+            .Times(3)
+            .WillRepeatedly(Return(ICanTransceiver::ErrorCode::CAN_ERR_OK));
+        JobHandle jobHandle(0x12, 0x35);
+        EXPECT_EQ(
+            SendResult::QUEUED_FULL,
+            cut.startSendDataFrames(
+                _codec, _frameTransmitterCallbackMock, jobHandle, 0x1234897U, 1U, 100U, 7U, data));
+        Mock::VerifyAndClearExpectations(&_canTransceiverMock);
+        sentListener->canFrameSent(CANFrame());
+        sentListener->canFrameSent(CANFrame());
+        EXPECT_CALL(_frameTransmitterCallbackMock, dataFramesSent(jobHandle, 3U, 20U));
+        sentListener->canFrameSent(CANFrame());
+        Mock::VerifyAndClearExpectations(&_frameTransmitterCallbackMock);
+    }
+    {
+        // frames are written up to the maximum number of frames
+        uint8_t largeData[100] = {0};
+        EXPECT_CALL(_canTransceiverMock, write(_, _))
+            .Times(4)
+            .WillRepeatedly(Return(ICanTransceiver::ErrorCode::CAN_ERR_OK));
+        JobHandle jobHandle(0x12, 0x36);
+        EXPECT_EQ(
+            SendResult::QUEUED_FULL,
+            cut.startSendDataFrames(
+                _codec,
+                _frameTransmitterCallbackMock,
+                jobHandle,
+                0x1234897U,
+                1U,
+                100U,
+                7U,
+                largeData));
+        Mock::VerifyAndClearExpectations(&_canTransceiverMock);
+        sentListener->canFrameSent(CANFrame());
+        sentListener->canFrameSent(CANFrame());
+        sentListener->canFrameSent(CANFrame());
+        EXPECT_CALL(_frameTransmitterCallbackMock, dataFramesSent(jobHandle, 4U, 28U));
+        sentListener->canFrameSent(CANFrame());
+        Mock::VerifyAndClearExpectations(&_frameTransmitterCallbackMock);
+    }
+    {
+        // only the frames accepted by the CAN transceiver are reported
+        Sequence seq;
+        EXPECT_CALL(_canTransceiverMock, write(_, _))
+            .Times(2)
+            .InSequence(seq)
+            .WillRepeatedly(Return(ICanTransceiver::ErrorCode::CAN_ERR_OK));
+        EXPECT_CALL(_canTransceiverMock, write(_, _))
+            .InSequence(seq)
+            .WillOnce(Return(ICanTransceiver::ErrorCode::CAN_ERR_TX_HW_QUEUE_FULL));
+        JobHandle jobHandle(0x12, 0x37);
+        EXPECT_EQ(
+            SendResult::QUEUED_FULL,
+            cut.startSendDataFrames(
+                _codec, _frameTransmitterCallbackMock, jobHandle, 0x1234897U, 1U, 100U, 7U, data));
+        Mock::VerifyAndClearExpectations(&_canTransceiverMock);
+        sentListener->canFrameSent(CANFrame());
+        EXPECT_CALL(_frameTransmitterCallbackMock, dataFramesSent(jobHandle, 2U, 14U));
+        sentListener->canFrameSent(CANFrame());
+        Mock::VerifyAndClearExpectations(&_frameTransmitterCallbackMock);
+    }
+    {
+        // cancelling drops the confirmations of the remaining frames before a new job starts
+        EXPECT_CALL(_canTransceiverMock, write(_, _))
+            .Times(3)
+            .WillRepeatedly(Return(ICanTransceiver::ErrorCode::CAN_ERR_OK));
+        JobHandle jobHandle(0x12, 0x38);
+        EXPECT_EQ(
+            SendResult::QUEUED_FULL,
+            cut.startSendDataFrames(
+                _codec, _frameTransmitterCallbackMock, jobHandle, 0x1234897U, 1U, 4U, 7U, data));
+        Mock::VerifyAndClearExpectations(&_canTransceiverMock);
+        sentListener->canFrameSent(CANFrame());
+        cut.cancelSendDataFrames(_frameTransmitterCallbackMock, jobHandle);
+        JobHandle nextJobHandle(0x12, 0x39);
+        EXPECT_EQ(
+            SendResult::FULL,
+            cut.startSendDataFrames(
+                _codec,
+                _frameTransmitterCallbackMock,
+                nextJobHandle,
+                0x1234897U,
+                1U,
+                3U,
+                7U,
+                data));
+        sentListener->canFrameSent(CANFrame());
+        EXPECT_EQ(
+            SendResult::FULL,
+            cut.startSendDataFrames(
+                _codec,
+                _frameTransmitterCallbackMock,
+                nextJobHandle,
+                0x1234897U,
+                1U,
+                3U,
+                7U,
+                data));
+        sentListener->canFrameSent(CANFrame());
+        Mock::VerifyAndClearExpectations(&_frameTransmitterCallbackMock);
+
+        EXPECT_CALL(_canTransceiverMock, write(_, _))
+            .Times(2)
+            .WillRepeatedly(Return(ICanTransceiver::ErrorCode::CAN_ERR_OK));
+        EXPECT_EQ(
+            SendResult::QUEUED_FULL,
+            cut.startSendDataFrames(
+                _codec,
+                _frameTransmitterCallbackMock,
+                nextJobHandle,
+                0x1234897U,
+                1U,
+                3U,
+                7U,
+                data));
+        Mock::VerifyAndClearExpectations(&_canTransceiverMock);
+        sentListener->canFrameSent(CANFrame());
+        EXPECT_CALL(_frameTransmitterCallbackMock, dataFramesSent(nextJobHandle, 2U, 14U));
+        sentListener->canFrameSent(CANFrame());
+    }
+}
+
+TEST_F(TestWithNormalAddressing, testTransceiverKeepsPipelinedDataFramesUntilSent)
+{
+    DoCanPhysicalCanTransceiver<TestWithNormalAddressing::CodecType> cut(
+        _canTransceiverMock, _filterMock, _addressConverterMock, _addressing, 3U);
+    uint8_t data[21];
+    for (size_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = static_cast<uint8_t>(i);
+    }
+    // the CAN transceiver references the written frames until they are sent
+    ICANFrameSentListener* sentListener = 0L;
+    CANFrame const* writtenFrames[3]    = {0L};
+    size_t writtenFrameCount            = 0U;
+    EXPECT_CALL(_canTransceiverMock, write(_, _))
+        .Times(3)
+        .WillRepeatedly(
+            [&](CANFrame const& frame, ICANFrameSentListener& listener)
+            {
+                writtenFrames[writtenFrameCount] = &frame;
+                ++writtenFrameCount;
+                sentListener = &listener;
+                return ICanTransceiver::ErrorCode::CAN_ERR_OK;
+            });
+    JobHandle jobHandle(0x12, 0x34);
+    EXPECT_EQ(
+        SendResult::QUEUED_FULL,
+        cut.startSendDataFrames(
+            _codec, _frameTransmitterCallbackMock, jobHandle, 0x1234897U, 1U, 100U, 7U, data));
+    Mock::VerifyAndClearExpectations(&_canTransceiverMock);
+
+    uint8_t const expectedPayload1[] = {0x21U, 0x00U, 0x01U, 0x02U, 0x03U, 0x04U, 0x05U, 0x06U};
+    uint8_t const expectedPayload2[] = {0x22U, 0x07U, 0x08U, 0x09U, 0x0AU, 0x0BU, 0x0CU, 0x0DU};
+    uint8_t const expectedPayload3[] = {0x23U, 0x0EU, 0x0FU, 0x10U, 0x11U, 0x12U, 0x13U, 0x14U};
+    ASSERT_EQ(3U, writtenFrameCount);
+    EXPECT_EQ(CANFrame(0x1234897U, expectedPayload1, sizeof(expectedPayload1)), *writtenFrames[0]);
+    EXPECT_EQ(CANFrame(0x1234897U, expectedPayload2, sizeof(expectedPayload2)), *writtenFrames[1]);
+    EXPECT_EQ(CANFrame(0x1234897U, expectedPayload3, sizeof(expectedPayload3)), *writtenFrames[2]);
+
+    sentListener->canFrameSent(*writtenFrames[0]);
+    sentListener->canFrameSent(*writtenFrames[1]);
+    EXPECT_CALL(_frameTransmitterCallbackMock, dataFramesSent(jobHandle, 3U, 21U));
+    sentListener->canFrameSent(*writtenFrames[2]);
+}
+
+TEST_F(TestWithNormalAddressing, testTransceiverSendDataFramesConfirmedWithinWrite)
+{
+    DoCanPhysicalCanTransceiver<TestWithNormalAddressing::CodecType> cut(
+        _canTransceiverMock, _filterMock, _addressConverterMock, _addressing, 4U);
+    uint8_t data[20] = {0};
+    auto const confirmWithinWrite = [](CANFrame const& frame, ICANFrameSentListener& listener)
+    {
+        listener.canFrameSent(frame);
+        return ICanTransceiver::ErrorCode::CAN_ERR_OK;
+    };
+    {
+        // all frames confirmed from within write() are reported before returning
+        EXPECT_CALL(_canTransceiverMock, write(_, _)).Times(2).WillRepeatedly(confirmWithinWrite);
+        JobHandle jobHandle(0x12, 0x34);
+        EXPECT_CALL(_frameTransmitterCallbackMock, dataFramesSent(jobHandle, 2U, 14U));
+        EXPECT_EQ(
+            SendResult::QUEUED_FULL,
+            cut.startSendDataFrames(
+                _codec, _frameTransmitterCallbackMock, jobHandle, 0x1234897U, 1U, 3U, 7U, data));
+        Mock::VerifyAndClearExpectations(&_canTransceiverMock);
+        Mock::VerifyAndClearExpectations(&_frameTransmitterCallbackMock);
+    }
+    {
+        // the next send job is accepted, remaining frames are confirmed afterwards
+        ICANFrameSentListener* sentListener = 0L;
+        Sequence seq;
+        EXPECT_CALL(_canTransceiverMock, write(_, _)).InSequence(seq).WillOnce(confirmWithinWrite);
+        EXPECT_CALL(_canTransceiverMock, write(_, _))
+            .InSequence(seq)
+            .WillOnce(DoAll(
+                WithArg<1>(SaveRef<0>(&sentListener)),
+                Return(ICanTransceiver::ErrorCode::CAN_ERR_OK)));
+        JobHandle jobHandle(0x12, 0x35);
+        EXPECT_EQ(
+            SendResult::QUEUED_FULL,
+            cut.startSendDataFrames(
+                _codec, _frameTransmitterCallbackMock, jobHandle, 0x1234897U, 1U, 3U, 7U, data));
+        Mock::VerifyAndClearExpectations(&_canTransceiverMock);
+        EXPECT_CALL(_frameTransmitterCallbackMock, dataFramesSent(jobHandle, 2U, 14U));
+        sentListener->canFrameSent(CANFrame());
+        Mock::VerifyAndClearExpectations(&_frameTransmitterCallbackMock);
+    }
+}
+
 TEST_F(TestWithNormalAddressing, testTransceiverSendDataFramesWithEscapeSequence)
 {
     DoCanPhysicalCanTransceiver<TestWithNormalAddressing::CodecType> cut(
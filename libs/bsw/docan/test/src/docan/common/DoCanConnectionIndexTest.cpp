@@ -0,0 +1,98 @@
+// Copyright 2024 Accenture.
+
+#include "docan/common/DoCanConnectionIndex.h"
+
+#include <gmock/gmock.h>
+
+namespace
+{
+using namespace ::docan;
+
+struct Item : public ::etl::forward_link<1>
+{
+    explicit Item(uint32_t const key) : key(key) {}
+
+    uint32_t key;
+};
+
+using IndexType = DoCanConnectionIndex<Item, ::etl::forward_link<1>, 4U>;
+
+struct KeyEquals
+{
+    explicit KeyEquals(uint32_t const key) : _key(key) {}
+
+    bool operator()(Item const& item) const { return item.key == _key; }
+
+    uint32_t _key;
+};
+
+/*
+ * Inserted items are found by their key, removed items are not found anymore.
+ */
+TEST(DoCanConnectionIndexTest, testInsertFindAndRemove)
+{
+    IndexType cut;
+    Item items[] = {Item(0x123U), Item(0x7FFU), Item(0x18DA00F1U), Item(0U)};
+    for (Item const& item : items)
+    {
+        EXPECT_EQ(nullptr, cut.find(item.key, KeyEquals(item.key)));
+    }
+    for (Item& item : items)
+    {
+        cut.insert(item, item.key);
+    }
+    for (Item& item : items)
+    {
+        EXPECT_EQ(&item, cut.find(item.key, KeyEquals(item.key)));
+    }
+    EXPECT_EQ(nullptr, cut.find(0x124U, KeyEquals(0x124U)));
+
+    cut.remove(items[1], items[1].key);
+    EXPECT_EQ(nullptr, cut.find(items[1].key, KeyEquals(items[1].key)));
+    EXPECT_EQ(&items[0], cut.find(items[0].key, KeyEquals(items[0].key)));
+    EXPECT_EQ(&items[2], cut.find(items[2].key, KeyEquals(items[2].key)));
+    EXPECT_EQ(&items[3], cut.find(items[3].key, KeyEquals(items[3].key)));
+
+    // removing an item that is not part of the index doesn't harm
+    cut.remove(items[1], items[1].key);
+    EXPECT_EQ(&items[3], cut.find(items[3].key, KeyEquals(items[3].key)));
+
+    cut.clear();
+    for (Item const& item : items)
+    {
+        EXPECT_EQ(nullptr, cut.find(item.key, KeyEquals(item.key)));
+    }
+}
+
+/*
+ * With more items than buckets the items share buckets. Items with equal keys are found in the
+ * order of insertion.
+ */
+TEST(DoCanConnectionIndexTest, testCollisionsAndInsertionOrder)
+{
+    IndexType cut;
+    Item items[] = {Item(1U), Item(2U), Item(3U), Item(4U), Item(5U), Item(6U), Item(7U), Item(8U)};
+    Item first(5U);
+    Item second(5U);
+    cut.insert(first, first.key);
+    for (Item& item : items)
+    {
+        cut.insert(item, item.key);
+    }
+    cut.insert(second, second.key);
+    for (Item& item : items)
+    {
+        if (item.key != 5U)
+        {
+            EXPECT_EQ(&item, cut.find(item.key, KeyEquals(item.key)));
+        }
+    }
+    EXPECT_EQ(&first, cut.find(5U, KeyEquals(5U)));
+    cut.remove(first, first.key);
+    EXPECT_EQ(&items[4], cut.find(5U, KeyEquals(5U)));
+    cut.remove(items[4], items[4].key);
+    EXPECT_EQ(&second, cut.find(5U, KeyEquals(5U)));
+    EXPECT_EQ(&items[7], cut.find(8U, KeyEquals(8U)));
+}
+
+} // namespace
@@ -192,6 +192,61 @@ TEST_F(DoCanTransmitterTest, testTransmitSingleFrameMessageAndShutdown)
     cut.shutdown();
 }
 
+TEST_F(DoCanTransmitterTest, testTransmitSingleFrameMessageConfirmedWithinStartSend)
+{
+    ::etl::generic_pool<sizeof(ItemT), alignof(ItemT), 5U> messageTransmitterBlockPool;
+    DoCanTransmitter<DataLinkLayer> cut(
+        _busId,
+        _context,
+        _dataFrameTransmitterMock,
+        _tickGeneratorMock,
+        messageTransmitterBlockPool,
+        _addressConverterMock,
+        _parameters,
+        _loggerComponent);
+    cut.init();
+
+    uint8_t data[] = {0xab, 0xcd, 0xef, 0x19, 0x28};
+    TransportMessage message;
+    auto const addrPair      = DataLinkLayer::AddressPairType(0x1234, 0x5678);
+    auto const transportPair = DoCanTransportAddressPair(0x45, 0x54);
+    initMessage(message, transportPair, addrPair, data);
+    _context.handleExecute();
+    ASSERT_EQ(
+        ::transport::AbstractTransportLayer::ErrorCode::TP_OK,
+        cut.send(message, &_processedListenerMock));
+    // the data frame transmitter confirms the frame before returning
+    EXPECT_CALL(
+        _dataFrameTransmitterMock,
+        startSendDataFrames(
+            _, _, _, addrPair.getTransmissionAddress(), 0U, 1U, 0U, ElementsAreArray(data)))
+        .WillOnce(
+            [](CodecType const&,
+               IDoCanDataFrameTransmitterCallback<DataLinkLayer>& callback,
+               JobHandle const jobHandle,
+               uint32_t,
+               uint16_t,
+               uint16_t,
+               uint8_t,
+               ::etl::span<uint8_t const> const& sendData)
+            {
+                callback.dataFramesSent(jobHandle, 1U, static_cast<uint16_t>(sendData.size()));
+                return SendResult::QUEUED_FULL;
+            });
+    // expect the message to be processed without waiting for another confirmation
+    EXPECT_CALL(
+        _processedListenerMock,
+        transportMessageProcessed(
+            Ref(message),
+            ITransportMessageProcessedListener::ProcessingResult::PROCESSED_NO_ERROR));
+    _context.execute();
+    Mock::VerifyAndClearExpectations(&_dataFrameTransmitterMock);
+    Mock::VerifyAndClearExpectations(&_processedListenerMock);
+
+    ASSERT_TRUE(messageTransmitterBlockPool.empty());
+    cut.shutdown();
+}
+
 TEST_F(DoCanTransmitterTest, testTransmitMultipleSingleFrameMessageExpectDifferentJobHandles)
 {
     constexpr size_t NUMBER_OF_SLOTS = 3;
@@ -1984,6 +2039,70 @@ TEST_F(DoCanTransmitterTest, testCanFrameSentIgnoredIfNoPendingSender)
     callback->dataFramesSent(jobHandle, 1U, 5U);
 }
 
+/**
+ * The single transmitter slot is reused for each message, it has to be removed from the lookup
+ * indexes when its message is done.
+ */
+TEST_F(DoCanTransmitterTest, testSendCompleteAndSendAgainOnSameConnection)
+{
+    ::etl::generic_pool<sizeof(ItemT), alignof(ItemT), 1U> messageTransmitterBlockPool;
+    DoCanTransmitter<DataLinkLayer> cut(
+        _busId,
+        _context,
+        _dataFrameTransmitterMock,
+        _tickGeneratorMock,
+        messageTransmitterBlockPool,
+        _addressConverterMock,
+        _parameters,
+        _loggerComponent);
+    cut.init();
+
+    uint8_t data[] = {0xab, 0xcd, 0xef, 0x19, 0x28, 0x98, 0xa1, 0x45, 0x11, 0x22};
+    TransportMessage message;
+    auto const addrPair      = DataLinkLayer::AddressPairType(0x1234, 0x5678);
+    auto const transportPair = DoCanTransportAddressPair(0x45, 0x54);
+    initMessage(message, transportPair, addrPair, data);
+    _context.handleExecute();
+    for (uint8_t i = 0U; i < 3U; ++i)
+    {
+        ASSERT_EQ(
+            ::transport::AbstractTransportLayer::ErrorCode::TP_OK,
+            cut.send(message, &_processedListenerMock));
+        // first frame
+        IDoCanDataFrameTransmitterCallback<DataLinkLayer>* callback = nullptr;
+        JobHandle jobHandle(0xff, 0x99);
+        EXPECT_CALL(
+            _dataFrameTransmitterMock,
+            startSendDataFrames(_, _, _, addrPair.getTransmissionAddress(), 0U, 1U, 7U, _))
+            .WillOnce(DoAll(
+                WithArg<1>(SaveRef<0>(&callback)),
+                SaveArg<2>(&jobHandle),
+                Return(SendResult::QUEUED_FULL)));
+        _context.execute();
+        Mock::VerifyAndClearExpectations(&_dataFrameTransmitterMock);
+        ASSERT_NE(nullptr, callback);
+        callback->dataFramesSent(jobHandle, 1U, 6U);
+        // flow control is looked up by reception address
+        EXPECT_CALL(
+            _dataFrameTransmitterMock,
+            startSendDataFrames(
+                _, Ref(*callback), jobHandle, addrPair.getTransmissionAddress(), 1U, 2U, 7U, _))
+            .WillOnce(Return(SendResult::QUEUED_FULL));
+        cut.flowControlFrameReceived(addrPair.getReceptionAddress(), FlowStatus::CTS, 0U, 0U);
+        Mock::VerifyAndClearExpectations(&_dataFrameTransmitterMock);
+        callback->dataFramesSent(jobHandle, 1U, 4U);
+        EXPECT_CALL(
+            _processedListenerMock,
+            transportMessageProcessed(
+                Ref(message),
+                ITransportMessageProcessedListener::ProcessingResult::PROCESSED_NO_ERROR));
+        _context.execute();
+        Mock::VerifyAndClearExpectations(&_processedListenerMock);
+        ASSERT_TRUE(messageTransmitterBlockPool.empty());
+    }
+    cut.shutdown();
+}
+
 void DoCanTransmitterTest::expectLog(Level const level)
 {
     EXPECT_CALL(_componentMappingMock, isEnabled(_loggerComponent, level)).WillOnce(Return(false));
@@ -111,4 +111,34 @@ void runTheLifecycle()
     lifecycleManager.transitionToLevel(0); // `shutdown()` is called on all components
     // EXAMPLE_END lifecycle_manager
 }
+
+void runTheLifecycleWithDependencies()
+{
+    // EXAMPLE_START lifecycle_dependencies
+    // #include <lifecycle/LifecycleManager.h>
+    // #include <async/Types.h>
+
+    ::async::ContextType const managerContext(1);
+    ::async::ContextType const ethernetContext(2);
+    ::async::ContextType const diagnosisContext(3);
+
+    ::lifecycle::declare::LifecycleManager<3, 2, 2> lifecycleManager(
+        managerContext,
+        ::lifecycle::LifecycleManager::GetTimestampType::create<&getSystemTimeUs32Bit>());
+    lifecycleManager.setTransitionMode(::lifecycle::LifecycleManager::TransitionMode::DEPENDENCIES);
+
+    ComponentA componentA(ethernetContext);
+    ComponentB componentB(diagnosisContext);
+    ComponentC componentC(ethernetContext);
+
+    lifecycleManager.addComponent("component A", componentA, 1);
+    lifecycleManager.addComponent("component B", componentB, 1);
+    lifecycleManager.addComponent("component C", componentC, 2);
+    // C is started as soon as A is running, without waiting for B
+    lifecycleManager.addDependency(componentC, componentA);
+
+    lifecycleManager.transitionToLevel(2); // A and B are started in parallel, C after A
+    lifecycleManager.transitionToLevel(0); // C is shut down before A, B independently of both
+    // EXAMPLE_END lifecycle_dependencies
+}
 } // namespace lifecycle
@@ -24,12 +24,32 @@ namespace lifecycle
 /// registry and triggers initialization, running, and shutdown of these components. It is declared
 /// using a `declare::LifecycleManager` with static capacities of components, runlevels, and
 /// components per runlevel.
+///
+/// By default the components are transitioned level by level. In `TransitionMode::DEPENDENCIES`
+/// each component is transitioned as soon as the components it depends on allow it, independent
+/// of the other components of its level.
 class LifecycleManager
 : public ILifecycleManager
 , private ILifecycleComponentCallback
 , private ::async::RunnableType
 {
 public:
+    /// Index of no component.
+    static uint8_t const NO_COMPONENT                  = 0xFFU;
+    /// Maximum number of components in `TransitionMode::DEPENDENCIES`.
+    static size_t const MAX_DEPENDENCY_COMPONENT_COUNT = 32U;
+
+    /// Order of the transitions of the components.
+    enum class TransitionMode : uint8_t
+    {
+        /// All components of a level finish their transition before the next level is started.
+        LEVELS,
+        /// A component is initialized and run as soon as all components it depends on are
+        /// running, and shut down as soon as all components depending on it are shut down.
+        /// Independent components are transitioned in parallel in their transition contexts.
+        DEPENDENCIES
+    };
+
     struct ComponentInfo
     {
         /// A name used during logging.
@@ -45,6 +65,15 @@ public:
         /// The type of transition that was most recently started.
         ILifecycleComponent::Transition::Type _lastTransition
             = ILifecycleComponent::Transition::Type::INIT;
+        /// The time from the start of the last startup until this component was running.
+        uint32_t _readyTime          = 0U;
+        /// The components this component depends on, a bit for each component index.
+        uint32_t _dependencyMask     = 0U;
+        /// The level the component is registered at.
+        uint8_t _level               = 0U;
+        /// The component that was running last before this component could be started in the
+        /// last startup, i.e. its predecessor on the critical path, or NO_COMPONENT.
+        uint8_t _criticalPredecessor = NO_COMPONENT;
     };
 
     /// System time callback.
@@ -62,6 +91,23 @@ public:
     /// Returns the component info at internal index `idx`.
     ComponentInfo const& getComponentInfo(size_t const idx) const { return _componentInfos[idx]; }
 
+    /// Sets the transition `mode`. Must be called before the first transition.
+    void setTransitionMode(TransitionMode mode);
+
+    /// Declares that `component` depends on `dependency`, i.e. `component` is started only when
+    /// `dependency` is running and `dependency` is shut down only when `component` is shut down.
+    /// Both components must have been added, `dependency` at the same or a lower level. The
+    /// dependencies are only considered in `TransitionMode::DEPENDENCIES`.
+    void addDependency(ILifecycleComponent& component, ILifecycleComponent& dependency);
+
+    /// Writes the indices of the components on the critical path of the last startup to `path`,
+    /// starting with the component that was started first and ending with the component that was
+    /// running last. Each component could be started only when its predecessor was running. If
+    /// `path` is too small, the beginning of the critical path is left out.
+    ///
+    /// Returns the number of indices written.
+    size_t getCriticalPath(::etl::span<uint8_t> path) const;
+
     /// Returns the highest registered component's level.
     uint8_t getLevelCount() const override { return _levelCount; }
 
@@ -85,23 +131,34 @@ protected:
     struct ComponentTransitionExecutor : public ::async::RunnableType
     {
         ComponentTransitionExecutor(
+            LifecycleManager& manager,
             ILifecycleComponent& component,
             uint8_t const componentIndex,
             ILifecycleComponent::Transition::Type const transition)
-        : _component(component)
+        : _manager(manager)
+        , _component(component)
         , _componentIndex(componentIndex)
         , _transition(transition)
         , _isPending(true)
+        , _isExecuting(true)
+        , _startTimestamp(0U)
         {}
 
         virtual ~ComponentTransitionExecutor() = default;
 
         void execute() override;
 
+        /// Returns true if the transition is done and execute() has returned, so that the
+        /// executor can be reused.
+        bool isIdle() const { return !_isPending && !_isExecuting; }
+
+        LifecycleManager& _manager;
         ILifecycleComponent& _component;
         uint8_t _componentIndex;
         ILifecycleComponent::Transition::Type _transition;
-        bool _isPending = true;
+        bool _isPending          = true;
+        bool _isExecuting        = true;
+        uint32_t _startTimestamp = 0U;
     };
 
     using ComponentInfoSliceType                = ::etl::span<ComponentInfo>;
@@ -127,6 +184,36 @@ private:
 
     bool checkLevelTransitionDone();
 
+    void executeDependencyTransitions();
+
+    void updateDependencyLevel(uint32_t pendingMask);
+
+    void startComponentTransition(
+        uint8_t componentIndex,
+        ILifecycleComponent::Transition::Type transition,
+        uint8_t criticalPredecessor,
+        uint32_t startTimestamp);
+
+    bool hasIdleTransitionExecutor() const;
+
+    void notifyListeners(ILifecycleComponent::Transition::Type transition);
+
+    uint8_t findComponent(ILifecycleComponent const& component) const;
+
+    uint32_t getLevelMask(uint8_t const level) const
+    {
+        uint8_t const validLevel = (level < _levelCount) ? level : _levelCount;
+        size_t const count = static_cast<size_t>(_levelIndices[static_cast<size_t>(validLevel)]);
+        return (count < MAX_DEPENDENCY_COMPONENT_COUNT) ? ((1U << count) - 1U) : 0xFFFFFFFFU;
+    }
+
+    static uint32_t getComponentMask(uint8_t const componentIndex)
+    {
+        return (static_cast<size_t>(componentIndex) < MAX_DEPENDENCY_COMPONENT_COUNT)
+                   ? (1U << componentIndex)
+                   : 0U;
+    }
+
     size_t getLevelComponentCount(uint8_t const level) const
     {
         return _levelIndices[static_cast<size_t>(level)]
@@ -141,8 +228,13 @@ private:
     LifecycleListenerListType _listeners;
     GetTimestampType _getTimestamp;
     uint32_t _transitionStartTimestamp = 0;
+    uint32_t _startupTimestamp         = 0;
+    uint32_t _initializedMask          = 0;
+    uint32_t _runningMask              = 0;
     ::async::ContextType _transitionContext;
+    TransitionMode _transitionMode                    = TransitionMode::LEVELS;
     bool _isTransitionPending                         = false;
+    bool _isStartingUp                                = false;
     ILifecycleComponent::Transition::Type _transition = ILifecycleComponent::Transition::Type::INIT;
     uint8_t _transitionLevel                          = 0;
     uint8_t _componentCount                           = 0;
@@ -150,6 +242,7 @@ private:
     uint8_t _initLevelCount                           = 0;
     uint8_t _currentLevel                             = 0;
     uint8_t _nextLevel                                = 0;
+    uint8_t _lastReadyComponent                       = NO_COMPONENT;
 };
 
 namespace declare
@@ -6,6 +6,8 @@
 
 #include <etl/error_handler.h>
 
+#include <new>
+
 namespace lifecycle
 {
 using ::util::logger::LIFECYCLE;
@@ -47,14 +49,70 @@ void LifecycleManager::addComponent(
         getLevelComponentCount(level) < _componentTransitionExecutors.max_size(),
         ETL_ERROR_GENERIC("transition executors must be big enough"));
 
+    ETL_ASSERT(
+        (_transitionMode != TransitionMode::DEPENDENCIES)
+            || (_componentCount < MAX_DEPENDENCY_COMPONENT_COUNT),
+        ETL_ERROR_GENERIC("not too many components must be added in dependency mode"));
+
     auto& componentInfo      = _componentInfos[static_cast<size_t>(_componentCount)];
     componentInfo._name      = name;
     componentInfo._component = &component;
+    componentInfo._level     = level;
     ++_levelIndices[static_cast<size_t>(_levelCount)];
     ++_componentCount;
     component.initCallback(*this);
 }
 
+void LifecycleManager::setTransitionMode(TransitionMode const mode)
+{
+    ETL_ASSERT(
+        (mode != TransitionMode::DEPENDENCIES)
+            || (_componentCount <= MAX_DEPENDENCY_COMPONENT_COUNT),
+        ETL_ERROR_GENERIC("not too many components must be added in dependency mode"));
+    _transitionMode = mode;
+}
+
+void LifecycleManager::addDependency(
+    ILifecycleComponent& component, ILifecycleComponent& dependency)
+{
+    uint8_t const componentIndex  = findComponent(component);
+    uint8_t const dependencyIndex = findComponent(dependency);
+    ETL_ASSERT(
+        (componentIndex != NO_COMPONENT) && (dependencyIndex != NO_COMPONENT),
+        ETL_ERROR_GENERIC("components must have been added"));
+    ETL_ASSERT(
+        _componentInfos[static_cast<size_t>(dependencyIndex)]._level
+            <= _componentInfos[static_cast<size_t>(componentIndex)]._level,
+        ETL_ERROR_GENERIC("dependency must not be at a higher level than the component"));
+    ETL_ASSERT(
+        dependencyIndex < componentIndex,
+        ETL_ERROR_GENERIC("dependency must have been added before the component"));
+    ETL_ASSERT(
+        static_cast<size_t>(dependencyIndex) < MAX_DEPENDENCY_COMPONENT_COUNT,
+        ETL_ERROR_GENERIC("dependency must be one of the first components"));
+    _componentInfos[static_cast<size_t>(componentIndex)]._dependencyMask
+        |= getComponentMask(dependencyIndex);
+}
+
+size_t LifecycleManager::getCriticalPath(::etl::span<uint8_t> const path) const
+{
+    size_t length = 0U;
+    for (uint8_t idx = _lastReadyComponent; (idx != NO_COMPONENT) && (length < _componentCount);
+         idx      = _componentInfos[static_cast<size_t>(idx)]._criticalPredecessor)
+    {
+        ++length;
+    }
+    size_t const count = (length < path.size()) ? length : path.size();
+    size_t position    = count;
+    for (uint8_t idx = _lastReadyComponent; position > 0U;
+         idx      = _componentInfos[static_cast<size_t>(idx)]._criticalPredecessor)
+    {
+        --position;
+        path[position] = idx;
+    }
+    return count;
+}
+
 void LifecycleManager::transitionToLevel(uint8_t const level)
 {
     _nextLevel = (static_cast<size_t>(level) < _levelIndices.size())
@@ -79,14 +137,33 @@ void LifecycleManager::transitionDone(ILifecycleComponent& component)
 {
     for (auto& executor : _componentTransitionExecutors)
     {
-        if (&component == &executor._component)
+        if ((&component == &executor._component) && executor._isPending)
         {
-            executor._isPending = false;
+            uint32_t const timestamp = _getTimestamp();
             ComponentInfo& componentInfo
                 = _componentInfos[static_cast<size_t>(executor._componentIndex)];
-            componentInfo._isTransitionPending = false;
-            componentInfo._transitionTimes[static_cast<uint8_t>(executor._transition)]
-                = _getTimestamp() - _transitionStartTimestamp;
+            {
+                ::async::LockType const lock;
+                executor._isPending                = false;
+                componentInfo._isTransitionPending = false;
+                componentInfo._transitionTimes[static_cast<uint8_t>(executor._transition)]
+                    = timestamp - executor._startTimestamp;
+                uint32_t const componentMask = getComponentMask(executor._componentIndex);
+                if (executor._transition == ILifecycleComponent::Transition::Type::INIT)
+                {
+                    _initializedMask |= componentMask;
+                }
+                else if (executor._transition == ILifecycleComponent::Transition::Type::RUN)
+                {
+                    _runningMask |= componentMask;
+                    componentInfo._readyTime = timestamp - _startupTimestamp;
+                    _lastReadyComponent      = executor._componentIndex;
+                }
+                else
+                {
+                    // the running flag has been cleared when the shutdown was started
+                }
+            }
             Logger::debug(
                 LIFECYCLE,
                 "%s %s done",
@@ -100,6 +177,11 @@ void LifecycleManager::transitionDone(ILifecycleComponent& component)
 
 void LifecycleManager::execute()
 {
+    if (_transitionMode == TransitionMode::DEPENDENCIES)
+    {
+        executeDependencyTransitions();
+        return;
+    }
     if ((!checkLevelTransitionDone())
         || ((_currentLevel == _nextLevel) && (_initLevelCount >= _nextLevel)))
     {
@@ -125,25 +207,28 @@ void LifecycleManager::execute()
     }
     _isTransitionPending      = true;
     _transitionStartTimestamp = _getTimestamp();
+    if (_transition == ILifecycleComponent::Transition::Type::SHUTDOWN)
+    {
+        _isStartingUp = false;
+    }
+    else if (!_isStartingUp)
+    {
+        _isStartingUp       = true;
+        _startupTimestamp   = _transitionStartTimestamp;
+        _lastReadyComponent = NO_COMPONENT;
+    }
+    else
+    {
+        // continue the running startup
+    }
     Logger::info(LIFECYCLE, "%s level %d", getTransitionString(_transition), _transitionLevel);
     for (uint8_t componentIndex = _levelIndices[static_cast<size_t>(_transitionLevel) - 1U];
          componentIndex < _levelIndices[static_cast<size_t>(_transitionLevel)];
          ++componentIndex)
     {
-        auto& componentInfo = _componentInfos[static_cast<size_t>(componentIndex)];
-        ComponentTransitionExecutor& transitionExecutor
-            = _componentTransitionExecutors.emplace_back(
-                *componentInfo._component, componentIndex, _transition);
-        componentInfo._isTransitionPending = true;
-        componentInfo._lastTransition      = _transition;
-        ::async::ContextType transitionContext
-            = componentInfo._component->getTransitionContext(_transition);
-        if (transitionContext == ::async::CONTEXT_INVALID)
-        {
-            transitionContext = _transitionContext;
-        }
-        Logger::info(LIFECYCLE, "%s %s", getTransitionString(_transition), componentInfo._name);
-        ::async::execute(transitionContext, transitionExecutor);
+        // the last component of the previous level released this level
+        startComponentTransition(
+            componentIndex, _transition, _lastReadyComponent, _transitionStartTimestamp);
     }
     if (_componentTransitionExecutors.empty())
     {
@@ -160,7 +245,7 @@ bool LifecycleManager::checkLevelTransitionDone()
 
     for (auto& executor : _componentTransitionExecutors)
     {
-        if (executor._isPending)
+        if (!executor.isIdle())
         {
             return false;
         }
@@ -173,22 +258,204 @@ bool LifecycleManager::checkLevelTransitionDone()
     {
         auto const transition = _transition;
         _transition           = ILifecycleComponent::Transition::Type::INIT;
-        LifecycleListenerListType::iterator it;
+        notifyListeners(transition);
+    }
+    return true;
+}
+
+void LifecycleManager::executeDependencyTransitions()
+{
+    uint32_t pendingMask = 0U;
+    for (uint8_t componentIndex = 0U; componentIndex < _componentCount; ++componentIndex)
+    {
+        if (_componentInfos[static_cast<size_t>(componentIndex)]._isTransitionPending)
         {
-            ::async::LockType const lock;
-            it = _listeners.begin();
+            pendingMask |= getComponentMask(componentIndex);
         }
-        while (it != _listeners.end())
+    }
+
+    uint32_t const targetMask = getLevelMask(_nextLevel);
+    for (uint8_t componentIndex = 0U;
+         (componentIndex < _componentCount) && hasIdleTransitionExecutor();
+         ++componentIndex)
+    {
+        ComponentInfo const& componentInfo = _componentInfos[static_cast<size_t>(componentIndex)];
+        uint32_t const componentMask        = getComponentMask(componentIndex);
+        if (((pendingMask & componentMask) != 0U)
+            || (((targetMask & componentMask) != 0U) == ((_runningMask & componentMask) != 0U)))
+        {
+            // transition pending or component already in its target state
+            continue;
+        }
+        ILifecycleComponent::Transition::Type transition;
+        uint8_t criticalPredecessor = NO_COMPONENT;
+        if ((targetMask & componentMask) != 0U)
         {
-            ILifecycleListener& listener = *it;
+            if ((componentInfo._dependencyMask & ~_runningMask) != 0U)
             {
-                ::async::LockType const lock;
-                ++it; // This is how an iterator is used
+                continue;
+            }
+            transition = ((_initializedMask & componentMask) != 0U)
+                             ? ILifecycleComponent::Transition::Type::RUN
+                             : ILifecycleComponent::Transition::Type::INIT;
+            if (!_isStartingUp)
+            {
+                _isStartingUp       = true;
+                _startupTimestamp   = _getTimestamp();
+                _lastReadyComponent = NO_COMPONENT;
+            }
+            // the dependency that was running last released the component
+            for (uint8_t idx = 0U; idx < componentIndex; ++idx)
+            {
+                if (((componentInfo._dependencyMask & getComponentMask(idx)) != 0U)
+                    && ((criticalPredecessor == NO_COMPONENT)
+                        || (_componentInfos[static_cast<size_t>(idx)]._readyTime
+                            >= _componentInfos[static_cast<size_t>(criticalPredecessor)]
+                                   ._readyTime)))
+                {
+                    criticalPredecessor = idx;
+                }
             }
-            listener.lifecycleLevelReached(_currentLevel, transition);
         }
+        else
+        {
+            bool hasDependents = false;
+            for (uint8_t idx = componentIndex + 1U; idx < _componentCount; ++idx)
+            {
+                hasDependents
+                    = hasDependents
+                      || (((_componentInfos[static_cast<size_t>(idx)]._dependencyMask
+                            & componentMask)
+                           != 0U)
+                          && (((_runningMask | pendingMask) & getComponentMask(idx)) != 0U));
+            }
+            if (hasDependents)
+            {
+                continue;
+            }
+            transition    = ILifecycleComponent::Transition::Type::SHUTDOWN;
+            _isStartingUp = false;
+        }
+        pendingMask |= componentMask;
+        startComponentTransition(componentIndex, transition, criticalPredecessor, _getTimestamp());
     }
-    return true;
+    updateDependencyLevel(pendingMask);
+}
+
+void LifecycleManager::updateDependencyLevel(uint32_t const pendingMask)
+{
+    while ((_currentLevel < _nextLevel)
+           && ((getLevelMask(_currentLevel + 1U) & ~_runningMask) == 0U))
+    {
+        ++_currentLevel;
+        Logger::debug(LIFECYCLE, "Run level %d done", _currentLevel);
+        notifyListeners(ILifecycleComponent::Transition::Type::RUN);
+    }
+    while ((_currentLevel > _nextLevel)
+           && (((_runningMask | pendingMask) & ~getLevelMask(_currentLevel - 1U)) == 0U))
+    {
+        Logger::debug(LIFECYCLE, "Shutdown level %d done", _currentLevel);
+        --_currentLevel;
+        notifyListeners(ILifecycleComponent::Transition::Type::SHUTDOWN);
+    }
+}
+
+void LifecycleManager::startComponentTransition(
+    uint8_t const componentIndex,
+    ILifecycleComponent::Transition::Type const transition,
+    uint8_t const criticalPredecessor,
+    uint32_t const startTimestamp)
+{
+    auto& componentInfo = _componentInfos[static_cast<size_t>(componentIndex)];
+
+    ComponentTransitionExecutor* transitionExecutor = nullptr;
+    for (auto& executor : _componentTransitionExecutors)
+    {
+        if (executor.isIdle())
+        {
+            // the executor has returned from execute() and its transition is done, so it can be
+            // reused
+            executor.~ComponentTransitionExecutor();
+            transitionExecutor = new (&executor) ComponentTransitionExecutor(
+                *this, *componentInfo._component, componentIndex, transition);
+            break;
+        }
+    }
+    if (transitionExecutor == nullptr)
+    {
+        transitionExecutor = &_componentTransitionExecutors.emplace_back(
+            *this, *componentInfo._component, componentIndex, transition);
+    }
+    transitionExecutor->_startTimestamp = startTimestamp;
+    if ((transition == ILifecycleComponent::Transition::Type::INIT)
+        || ((transition == ILifecycleComponent::Transition::Type::RUN)
+            && (componentInfo._lastTransition == ILifecycleComponent::Transition::Type::SHUTDOWN)))
+    {
+        componentInfo._criticalPredecessor = criticalPredecessor;
+    }
+    {
+        ::async::LockType const lock;
+        if (transition == ILifecycleComponent::Transition::Type::SHUTDOWN)
+        {
+            _runningMask &= ~getComponentMask(componentIndex);
+        }
+        componentInfo._isTransitionPending = true;
+        componentInfo._lastTransition      = transition;
+    }
+    ::async::ContextType transitionContext
+        = componentInfo._component->getTransitionContext(transition);
+    if (transitionContext == ::async::CONTEXT_INVALID)
+    {
+        transitionContext = _transitionContext;
+    }
+    Logger::info(LIFECYCLE, "%s %s", getTransitionString(transition), componentInfo._name);
+    ::async::execute(transitionContext, *transitionExecutor);
+}
+
+bool LifecycleManager::hasIdleTransitionExecutor() const
+{
+    if (!_componentTransitionExecutors.full())
+    {
+        return true;
+    }
+    for (auto const& executor : _componentTransitionExecutors)
+    {
+        if (executor.isIdle())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void LifecycleManager::notifyListeners(ILifecycleComponent::Transition::Type const transition)
+{
+    LifecycleListenerListType::iterator it;
+    {
+        ::async::LockType const lock;
+        it = _listeners.begin();
+    }
+    while (it != _listeners.end())
+    {
+        ILifecycleListener& listener = *it;
+        {
+            ::async::LockType const lock;
+            ++it; // This is how an iterator is used
+        }
+        listener.lifecycleLevelReached(_currentLevel, transition);
+    }
+}
+
+uint8_t LifecycleManager::findComponent(ILifecycleComponent const& component) const
+{
+    for (uint8_t componentIndex = 0U; componentIndex < _componentCount; ++componentIndex)
+    {
+        if (_componentInfos[static_cast<size_t>(componentIndex)]._component == &component)
+        {
+            return componentIndex;
+        }
+    }
+    return NO_COMPONENT;
 }
 
 char const*
@@ -214,7 +481,20 @@ LifecycleManager::getTransitionString(ILifecycleComponent::Transition::Type cons
 
 void LifecycleManager::ComponentTransitionExecutor::execute()
 {
+    LifecycleManager& manager = _manager;
     _component.startTransition(_transition);
+    bool isDone = false;
+    {
+        ::async::LockType const lock;
+        _isExecuting = false;
+        isDone       = !_isPending;
+    }
+    if (isDone)
+    {
+        // the transition has been done before this executor was idle, so the manager may be
+        // waiting for it
+        ::async::execute(manager._transitionContext, manager);
+    }
 }
 
 } // namespace lifecycle
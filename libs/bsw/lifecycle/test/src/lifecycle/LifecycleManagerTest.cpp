@@ -240,6 +240,217 @@ TEST_F(LifecycleManagerTest, testCompleteLifecycle)
     cut.removeLifecycleListener(_listenerMock);
 }
 
+TEST_F(LifecycleManagerTest, testCriticalPathOfLevelTransitions)
+{
+    ::lifecycle::declare::LifecycleManager<4, 3, 2> cut(_context, _getTimestamp);
+    NiceMock<LifecycleComponentMock> componentMock1;
+    NiceMock<LifecycleComponentMock> componentMock2;
+    ILifecycleComponentCallback* callback = nullptr;
+    EXPECT_CALL(componentMock1, initCallback(_)).WillOnce(WithArg<0>(SaveRef<0>(&callback)));
+    cut.addComponent("comp1", componentMock1, 1U);
+    cut.addComponent("comp2", componentMock2, 2U);
+    ON_CALL(componentMock1, getTransitionContext(_))
+        .WillByDefault(Return(::async::CONTEXT_INVALID));
+    ON_CALL(componentMock2, getTransitionContext(_))
+        .WillByDefault(Return(::async::CONTEXT_INVALID));
+
+    ::etl::array<uint8_t, 3U> path{};
+    EXPECT_EQ(0U, cut.getCriticalPath(path));
+
+    cut.transitionToLevel(2U);
+    EXPECT_CALL(*this, getTimestamp()).WillRepeatedly(Return(100U));
+    _context.execute();
+    for (uint32_t timestamp : {110U, 120U, 140U, 170U})
+    {
+        EXPECT_CALL(*this, getTimestamp()).WillRepeatedly(Return(timestamp));
+        callback->transitionDone(timestamp < 140U ? componentMock1 : componentMock2);
+        _context.execute();
+    }
+    EXPECT_EQ(20U, cut.getComponentInfo(0U)._readyTime);
+    EXPECT_EQ(70U, cut.getComponentInfo(1U)._readyTime);
+    ASSERT_EQ(2U, cut.getCriticalPath(path));
+    EXPECT_EQ(0U, path[0U]);
+    EXPECT_EQ(1U, path[1U]);
+}
+
+TEST_F(LifecycleManagerTest, testDependencyTransitions)
+{
+    ::lifecycle::declare::LifecycleManager<4, 3, 2> cut(_context, _getTimestamp);
+    cut.setTransitionMode(LifecycleManager::TransitionMode::DEPENDENCIES);
+    cut.addLifecycleListener(_listenerMock);
+
+    ILifecycleComponentCallback* callback = nullptr;
+    EXPECT_CALL(_componentMock1, initCallback(_)).WillOnce(WithArg<0>(SaveRef<0>(&callback)));
+    cut.addComponent("comp1", _componentMock1, 1U);
+    EXPECT_CALL(_componentMock2, initCallback(_));
+    cut.addComponent("comp2", _componentMock2, 1U);
+    EXPECT_CALL(_componentMock3, initCallback(_));
+    cut.addComponent("comp3", _componentMock3, 2U);
+    cut.addDependency(_componentMock3, _componentMock2);
+    LifecycleManager::ComponentInfo const& componentInfo3 = cut.getComponentInfo(2U);
+    EXPECT_CALL(_componentMock1, getTransitionContext(_))
+        .WillRepeatedly(Return(::async::CONTEXT_INVALID));
+    EXPECT_CALL(_componentMock2, getTransitionContext(_))
+        .WillRepeatedly(Return(::async::CONTEXT_INVALID));
+    EXPECT_CALL(_componentMock3, getTransitionContext(_))
+        .WillRepeatedly(Return(::async::CONTEXT_INVALID));
+
+    // expect independent components to be initialized in parallel
+    cut.transitionToLevel(2U);
+    EXPECT_CALL(*this, getTimestamp()).WillRepeatedly(Return(100U));
+    EXPECT_CALL(_componentMock1, startTransition(ILifecycleComponent::Transition::Type::INIT));
+    EXPECT_CALL(_componentMock2, startTransition(ILifecycleComponent::Transition::Type::INIT));
+    _context.execute();
+
+    // expect a component to be run as soon as it is initialized
+    EXPECT_CALL(*this, getTimestamp()).WillRepeatedly(Return(120U));
+    EXPECT_CALL(_componentMock1, startTransition(ILifecycleComponent::Transition::Type::RUN));
+    callback->transitionDone(_componentMock1);
+    _context.execute();
+    EXPECT_CALL(*this, getTimestamp()).WillRepeatedly(Return(130U));
+    callback->transitionDone(_componentMock1);
+    _context.execute();
+
+    // expect the dependent component to wait for its dependency
+    EXPECT_CALL(*this, getTimestamp()).WillRepeatedly(Return(150U));
+    EXPECT_CALL(_componentMock2, startTransition(ILifecycleComponent::Transition::Type::RUN));
+    callback->transitionDone(_componentMock2);
+    _context.execute();
+    EXPECT_FALSE(componentInfo3._isTransitionPending);
+
+    EXPECT_CALL(*this, getTimestamp()).WillRepeatedly(Return(200U));
+    EXPECT_CALL(_componentMock3, startTransition(ILifecycleComponent::Transition::Type::INIT));
+    EXPECT_CALL(
+        _listenerMock, lifecycleLevelReached(1U, ILifecycleComponent::Transition::Type::RUN));
+    callback->transitionDone(_componentMock2);
+    _context.execute();
+    EXPECT_TRUE(componentInfo3._isTransitionPending);
+
+    EXPECT_CALL(*this, getTimestamp()).WillRepeatedly(Return(250U));
+    EXPECT_CALL(_componentMock3, startTransition(ILifecycleComponent::Transition::Type::RUN));
+    callback->transitionDone(_componentMock3);
+    _context.execute();
+    EXPECT_EQ(
+        50U,
+        componentInfo3
+            ._transitionTimes[static_cast<uint8_t>(ILifecycleComponent::Transition::Type::INIT)]);
+
+    EXPECT_CALL(*this, getTimestamp()).WillRepeatedly(Return(300U));
+    EXPECT_CALL(
+        _listenerMock, lifecycleLevelReached(2U, ILifecycleComponent::Transition::Type::RUN));
+    callback->transitionDone(_componentMock3);
+    _context.execute();
+    Mock::VerifyAndClearExpectations(&_listenerMock);
+
+    EXPECT_EQ(30U, cut.getComponentInfo(0U)._readyTime);
+    EXPECT_EQ(100U, cut.getComponentInfo(1U)._readyTime);
+    EXPECT_EQ(200U, componentInfo3._readyTime);
+    ::etl::array<uint8_t, 3U> path{};
+    ASSERT_EQ(2U, cut.getCriticalPath(path));
+    EXPECT_EQ(1U, path[0U]);
+    EXPECT_EQ(2U, path[1U]);
+    // the beginning of the critical path is left out if the buffer is too small
+    ASSERT_EQ(1U, cut.getCriticalPath(::etl::span<uint8_t>(path.data(), 1U)));
+    EXPECT_EQ(2U, path[0U]);
+
+    // expect a dependency to be shut down after the dependent component
+    cut.transitionToLevel(0U);
+    EXPECT_CALL(*this, getTimestamp()).WillRepeatedly(Return(400U));
+    EXPECT_CALL(_componentMock1, startTransition(ILifecycleComponent::Transition::Type::SHUTDOWN));
+    EXPECT_CALL(_componentMock3, startTransition(ILifecycleComponent::Transition::Type::SHUTDOWN));
+    _context.execute();
+
+    EXPECT_CALL(*this, getTimestamp()).WillRepeatedly(Return(450U));
+    EXPECT_CALL(_componentMock2, startTransition(ILifecycleComponent::Transition::Type::SHUTDOWN));
+    EXPECT_CALL(
+        _listenerMock, lifecycleLevelReached(1U, ILifecycleComponent::Transition::Type::SHUTDOWN));
+    callback->transitionDone(_componentMock3);
+    _context.execute();
+    Mock::VerifyAndClearExpectations(&_listenerMock);
+
+    callback->transitionDone(_componentMock1);
+    _context.execute();
+    EXPECT_CALL(
+        _listenerMock, lifecycleLevelReached(0U, ILifecycleComponent::Transition::Type::SHUTDOWN));
+    callback->transitionDone(_componentMock2);
+    _context.execute();
+    Mock::VerifyAndClearExpectations(&_listenerMock);
+
+    // No initialization when doing next transition to level 1
+    cut.transitionToLevel(1U);
+    EXPECT_CALL(_componentMock1, startTransition(ILifecycleComponent::Transition::Type::RUN));
+    EXPECT_CALL(_componentMock2, startTransition(ILifecycleComponent::Transition::Type::RUN));
+    _context.execute();
+
+    cut.removeLifecycleListener(_listenerMock);
+}
+
+TEST_F(LifecycleManagerTest, testExecutingTransitionExecutorIsNotReused)
+{
+    ::lifecycle::declare::LifecycleManager<4, 2, 1> cut(_context, _getTimestamp);
+    cut.setTransitionMode(LifecycleManager::TransitionMode::DEPENDENCIES);
+    NiceMock<LifecycleComponentMock> componentMock1;
+    NiceMock<LifecycleComponentMock> componentMock2;
+    ILifecycleComponentCallback* callback = nullptr;
+    EXPECT_CALL(componentMock1, initCallback(_)).WillOnce(WithArg<0>(SaveRef<0>(&callback)));
+    cut.addComponent("comp1", componentMock1, 1U);
+    cut.addComponent("comp2", componentMock2, 2U);
+    ON_CALL(componentMock1, getTransitionContext(_))
+        .WillByDefault(Return(::async::CONTEXT_INVALID));
+    ON_CALL(componentMock2, getTransitionContext(_))
+        .WillByDefault(Return(::async::CONTEXT_INVALID));
+    EXPECT_CALL(*this, getTimestamp()).WillRepeatedly(Return(100U));
+
+    // expect the only executor not to be reused by a transition that preempts its execution
+    cut.transitionToLevel(2U);
+    {
+        Sequence seq;
+        EXPECT_CALL(componentMock1, startTransition(ILifecycleComponent::Transition::Type::INIT))
+            .InSequence(seq)
+            .WillOnce(Invoke(
+                [&]()
+                {
+                    callback->transitionDone(componentMock1);
+                    _context.execute();
+                    EXPECT_FALSE(cut.getComponentInfo(0U)._isTransitionPending);
+                    EXPECT_FALSE(cut.getComponentInfo(1U)._isTransitionPending);
+                }));
+        // expect the executor to be reused once it has returned
+        EXPECT_CALL(componentMock1, startTransition(ILifecycleComponent::Transition::Type::RUN))
+            .InSequence(seq);
+        _context.execute();
+    }
+    EXPECT_TRUE(cut.getComponentInfo(0U)._isTransitionPending);
+}
+
+TEST_F(LifecycleManagerTest, testAddDependencyAssertsDependencyIsAddedBefore)
+{
+    ::lifecycle::declare::LifecycleManager<4, 4, 4> cut(_context, _getTimestamp);
+    NiceMock<LifecycleComponentMock> componentMock1;
+    NiceMock<LifecycleComponentMock> componentMock2;
+    NiceMock<LifecycleComponentMock> componentMock3;
+    cut.addComponent("comp1", componentMock1, 1U);
+    cut.addComponent("comp2", componentMock2, 1U);
+    cut.addDependency(componentMock2, componentMock1);
+    ASSERT_THROW({ cut.addDependency(componentMock1, componentMock2); }, ::etl::exception);
+    ASSERT_THROW({ cut.addDependency(componentMock1, componentMock1); }, ::etl::exception);
+    ASSERT_THROW({ cut.addDependency(componentMock3, componentMock1); }, ::etl::exception);
+}
+
+TEST_F(LifecycleManagerTest, testAddDependencyAssertsDependencyIsNotAtHigherLevel)
+{
+    ::lifecycle::declare::LifecycleManager<4, 4, 4> cut(_context, _getTimestamp);
+    NiceMock<LifecycleComponentMock> componentMock1;
+    NiceMock<LifecycleComponentMock> componentMock2;
+    NiceMock<LifecycleComponentMock> componentMock3;
+    cut.addComponent("comp1", componentMock1, 1U);
+    cut.addComponent("comp2", componentMock2, 2U);
+    cut.addComponent("comp3", componentMock3, 2U);
+    cut.addDependency(componentMock2, componentMock1);
+    cut.addDependency(componentMock3, componentMock2);
+    ASSERT_THROW({ cut.addDependency(componentMock1, componentMock3); }, ::etl::exception);
+}
+
 TEST_F(LifecycleManagerTest, testAddComponentAssertsComponentsAreAddedWithLevelGreater0)
 {
     ::lifecycle::declare::LifecycleManager<4, 4, 4> cut(_context, _getTimestamp);
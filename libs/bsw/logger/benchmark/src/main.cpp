@@ -0,0 +1,118 @@
+// Copyright 2025 Accenture.
+
+#include <benchmark/benchmark.h>
+#include <logger/BufferedLoggerOutput.h>
+#include <logger/ComponentMapping.h>
+#include <logger/ILoggerTime.h>
+#include <util/format/StringWriter.h>
+#include <util/logger/Logger.h>
+#include <util/logger/TypedLogger.h>
+
+#include <cstdint>
+
+namespace util
+{
+namespace logger
+{
+static uint8_t BENCHMARK = COMPONENT_NONE;
+} // namespace logger
+} // namespace util
+
+namespace
+{
+using ::util::logger::Logger;
+using ::util::logger::TypedLogger;
+
+struct NoLock
+{};
+
+class CounterTime : public ::logger::ILoggerTime<uint32_t>
+{
+public:
+    uint32_t getTimestamp() const override { return ++_timestamp; }
+
+    void formatTimestamp(
+        ::util::stream::IOutputStream& stream, uint32_t const& timestamp) const override
+    {
+        (void)::util::format::StringWriter(stream).printf("%d", timestamp);
+    }
+
+private:
+    mutable uint32_t _timestamp = 0U;
+};
+
+START_LOGGER_COMPONENT_MAPPING_INFO_TABLE(componentInfoTable)
+LOGGER_COMPONENT_MAPPING_INFO(LEVEL_DEBUG, BENCHMARK)
+END_LOGGER_COMPONENT_MAPPING_INFO_TABLE();
+
+DEFINE_LOGGER_COMPONENT_MAPPING(
+    BenchmarkMappingType,
+    benchmarkMapping,
+    componentInfoTable,
+    ::util::logger::LevelInfo::getDefaultTable(),
+    BENCHMARK);
+
+/// All strings are treated as read-only, so format strings are stored by address on both paths.
+::logger::SectionPredicate const READ_ONLY_ALL(
+    nullptr, reinterpret_cast<void const*>(UINTPTR_MAX));
+
+using Output = ::logger::declare::BufferedLoggerOutput<8192U, NoLock>;
+
+/**
+ * Measures a call of Logger::info() with state.range(0) integer arguments into a
+ * BufferedLoggerOutput. Each argument is read from the va_list with the datatype given by the
+ * format string and stored with its datatype.
+ */
+void BM_legacyLog(benchmark::State& state)
+{
+    CounterTime time;
+    Output output(benchmarkMapping, time, READ_ONLY_ALL);
+    benchmarkMapping.applyMapping();
+    Logger::init(benchmarkMapping, output);
+    uint32_t value = 0U;
+    while (state.KeepRunning())
+    {
+        ++value;
+        switch (state.range(0))
+        {
+            case 0: Logger::info(::util::logger::BENCHMARK, "no arguments"); break;
+            case 2: Logger::info(::util::logger::BENCHMARK, "%d %u", value, value); break;
+            default:
+                Logger::info(
+                    ::util::logger::BENCHMARK, "%d %u %x %d", value, value, value, value);
+                break;
+        }
+    }
+    Logger::shutdown();
+}
+
+/**
+ * Measures the same calls as BM_legacyLog() with TypedLogger::info(). The signature is determined
+ * at compile time and the arguments are copied as a single block.
+ */
+void BM_typedLog(benchmark::State& state)
+{
+    CounterTime time;
+    Output output(benchmarkMapping, time, READ_ONLY_ALL);
+    benchmarkMapping.applyMapping();
+    Logger::init(benchmarkMapping, output);
+    uint32_t value = 0U;
+    while (state.KeepRunning())
+    {
+        ++value;
+        switch (state.range(0))
+        {
+            case 0: TypedLogger::info(::util::logger::BENCHMARK, "no arguments"); break;
+            case 2: TypedLogger::info(::util::logger::BENCHMARK, "%d %u", value, value); break;
+            default:
+                TypedLogger::info(
+                    ::util::logger::BENCHMARK, "%d %u %x %d", value, value, value, value);
+                break;
+        }
+    }
+    Logger::shutdown();
+}
+} // namespace
+
+BENCHMARK(BM_legacyLog)->Arg(0)->Arg(2)->Arg(4);
+BENCHMARK(BM_typedLog)->Arg(0)->Arg(2)->Arg(4);
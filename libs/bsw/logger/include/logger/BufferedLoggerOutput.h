@@ -50,6 +50,44 @@ public:
         char const* str,
         va_list ap) override;
 
+    /**
+     * Stores the raw arguments of a typed log message. The message is formatted when it is
+     * output with outputEntry().
+     */
+    void logTypedOutput(
+        ::util::logger::ComponentInfo const& componentInfo,
+        ::util::logger::LevelInfo const& levelInfo,
+        char const* str,
+        ::util::format::PrintfArgumentSignature signature,
+        ::etl::span<uint8_t const> const& arguments) override;
+
+protected:
+    /**
+     * Serializes a log message into \p entryBuffer and returns the size of the entry.
+     */
+    T serializeEntry(
+        ::etl::span<uint8_t> const& entryBuffer,
+        ::util::logger::ComponentInfo const& componentInfo,
+        ::util::logger::LevelInfo const& levelInfo,
+        char const* str,
+        va_list ap) const;
+
+    /**
+     * Serializes a typed log message into \p entryBuffer and returns the size of the entry.
+     */
+    T serializeEntry(
+        ::etl::span<uint8_t> const& entryBuffer,
+        ::util::logger::ComponentInfo const& componentInfo,
+        ::util::logger::LevelInfo const& levelInfo,
+        char const* str,
+        ::util::format::PrintfArgumentSignature signature,
+        ::etl::span<uint8_t const> const& arguments) const;
+
+    /**
+     * Adds a serialized entry to the buffer under Lock and notifies the listeners.
+     */
+    void addEntry(::etl::span<uint8_t const> const& entry);
+
 private:
     class EntryOutputAdapter : public IEntrySerializerCallback<Timestamp>
     {
@@ -245,12 +283,92 @@ void BufferedLoggerOutput<Lock, MaxEntrySize, T, E, Timestamp, ReadOnlyPredicate
     va_list ap)
 {
     uint8_t entryBuffer[MaxEntrySize];
-    Timestamp const timestamp = _timestamp.getTimestamp();
-    T const size              = _entrySerializer.serialize(
-        entryBuffer, timestamp, componentInfo.getIndex(), levelInfo.getLevel(), str, ap);
+    T const size = serializeEntry(entryBuffer, componentInfo, levelInfo, str, ap);
+    addEntry(::etl::span<uint8_t>(entryBuffer).first(size));
+}
+
+template<
+    class Lock,
+    uint8_t MaxEntrySize,
+    class T,
+    class E,
+    class Timestamp,
+    class ReadOnlyPredicate>
+void BufferedLoggerOutput<Lock, MaxEntrySize, T, E, Timestamp, ReadOnlyPredicate>::logTypedOutput(
+    ::util::logger::ComponentInfo const& componentInfo,
+    ::util::logger::LevelInfo const& levelInfo,
+    char const* const str,
+    ::util::format::PrintfArgumentSignature const signature,
+    ::etl::span<uint8_t const> const& arguments)
+{
+    uint8_t entryBuffer[MaxEntrySize];
+    T const size = serializeEntry(entryBuffer, componentInfo, levelInfo, str, signature, arguments);
+    addEntry(::etl::span<uint8_t>(entryBuffer).first(size));
+}
+
+template<
+    class Lock,
+    uint8_t MaxEntrySize,
+    class T,
+    class E,
+    class Timestamp,
+    class ReadOnlyPredicate>
+T BufferedLoggerOutput<Lock, MaxEntrySize, T, E, Timestamp, ReadOnlyPredicate>::serializeEntry(
+    ::etl::span<uint8_t> const& entryBuffer,
+    ::util::logger::ComponentInfo const& componentInfo,
+    ::util::logger::LevelInfo const& levelInfo,
+    char const* const str,
+    va_list ap) const
+{
+    T const size = _entrySerializer.serialize(
+        entryBuffer,
+        _timestamp.getTimestamp(),
+        componentInfo.getIndex(),
+        levelInfo.getLevel(),
+        str,
+        ap);
+    return (size < entryBuffer.size()) ? size : static_cast<T>(entryBuffer.size());
+}
+
+template<
+    class Lock,
+    uint8_t MaxEntrySize,
+    class T,
+    class E,
+    class Timestamp,
+    class ReadOnlyPredicate>
+T BufferedLoggerOutput<Lock, MaxEntrySize, T, E, Timestamp, ReadOnlyPredicate>::serializeEntry(
+    ::etl::span<uint8_t> const& entryBuffer,
+    ::util::logger::ComponentInfo const& componentInfo,
+    ::util::logger::LevelInfo const& levelInfo,
+    char const* const str,
+    ::util::format::PrintfArgumentSignature const signature,
+    ::etl::span<uint8_t const> const& arguments) const
+{
+    T const size = _entrySerializer.serialize(
+        entryBuffer,
+        _timestamp.getTimestamp(),
+        componentInfo.getIndex(),
+        levelInfo.getLevel(),
+        str,
+        signature,
+        arguments);
+    return (size < entryBuffer.size()) ? size : static_cast<T>(entryBuffer.size());
+}
+
+template<
+    class Lock,
+    uint8_t MaxEntrySize,
+    class T,
+    class E,
+    class Timestamp,
+    class ReadOnlyPredicate>
+void BufferedLoggerOutput<Lock, MaxEntrySize, T, E, Timestamp, ReadOnlyPredicate>::addEntry(
+    ::etl::span<uint8_t const> const& entry)
+{
     {
         Lock const lock;
-        _entryBuffer.addEntry(::etl::span<uint8_t>(entryBuffer).first(size));
+        _entryBuffer.addEntry(entry);
     }
     for (auto& it : _listeners)
     {
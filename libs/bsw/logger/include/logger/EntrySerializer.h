@@ -7,6 +7,7 @@
 #include <etl/uncopyable.h>
 #include <util/format/IPrintfArgumentReader.h>
 #include <util/format/PrintfArgumentReader.h>
+#include <util/format/PrintfArgumentSignature.h>
 #include <util/format/PrintfFormatScanner.h>
 #include <util/logger/Logger.h>
 
@@ -44,6 +45,14 @@ public:
         ::util::logger::Level level,
         char const* formatString,
         va_list ap) const;
+    T serialize(
+        ::etl::span<uint8_t> const& destBuffer,
+        Timestamp timestamp,
+        uint8_t componentIndex,
+        ::util::logger::Level level,
+        char const* formatString,
+        ::util::format::PrintfArgumentSignature signature,
+        ::etl::span<uint8_t const> const& arguments) const;
     static void deserialize(
         ::etl::span<uint8_t const> const& srcBuffer, IEntrySerializerCallback<Timestamp>& callback);
 
@@ -61,6 +70,7 @@ private:
         DATATYPE_CHARPTR      = static_cast<uint8_t>(::util::format::ParamDatatype::CHARPTR),
         DATATYPE_SIZEDCHARPTR = static_cast<uint8_t>(::util::format::ParamDatatype::SIZEDCHARPTR),
         DATATYPE_CHARARRAY    = static_cast<uint8_t>(::util::format::ParamDatatype::COUNT),
+        DATATYPE_SIGNATURE    = DATATYPE_CHARARRAY + 1,
         DATATYPE_NONE         = 0xff
     };
 
@@ -99,12 +109,17 @@ private:
 
     private:
         void readParamVariant();
+        void readRawArgument(
+            ::util::format::ParamDatatype storedDatatype, ::util::format::ParamDatatype datatype);
         char const* readCharArray();
 
     private:
         uint8_t const* _bufferStart;
         uint8_t const* _bufferEnd;
         uint8_t const* _read;
+        ::util::format::PrintfArgumentSignature _signature;
+        size_t _argumentIndex;
+        bool _hasSignature;
         ::util::format::ParamVariant _variant;
         ::util::string::PlainSizedString _plainSizedString;
     };
@@ -170,6 +185,62 @@ T EntrySerializer<T, Timestamp, ReadOnlyPredicate>::serialize(
     return writer.getSize();
 }
 
+/**
+ * Serializes an entry with arguments in the raw layout of PrintfArgumentWriter. The signature is
+ * stored instead of a datatype per argument, only strings are stored with their datatype to be
+ * copied if needed.
+ */
+template<class T, class Timestamp, class ReadOnlyPredicate>
+T EntrySerializer<T, Timestamp, ReadOnlyPredicate>::serialize(
+    ::etl::span<uint8_t> const& destBuffer,
+    Timestamp const timestamp,
+    uint8_t const componentIndex,
+    ::util::logger::Level const level,
+    char const* const formatString,
+    ::util::format::PrintfArgumentSignature const signature,
+    ::etl::span<uint8_t const> const& arguments) const
+{
+    using ::util::format::ParamDatatype;
+    using ::util::format::PrintfArgumentSignature;
+    uint8_t* const dest = destBuffer.data();
+
+    EntryWriter writer(dest, dest + destBuffer.size(), _readOnlyPredicate);
+    writer.writeBytes(&timestamp, static_cast<T>(sizeof(timestamp)));
+    writer.writeBytes(&componentIndex, static_cast<T>(sizeof(componentIndex)));
+    uint8_t const levelByte = static_cast<uint8_t>(level);
+    writer.writeBytes(&levelByte, static_cast<T>(sizeof(levelByte)));
+    uint32_t const signatureValue = signature.getValue();
+    writer.writeData(
+        static_cast<uint8_t>(DATATYPE_SIGNATURE),
+        &signatureValue,
+        static_cast<T>(sizeof(signatureValue)));
+    writer.writeString(formatString);
+
+    size_t offset = 0U;
+    for (size_t i = 0U; i < signature.getCount(); ++i)
+    {
+        ParamDatatype const datatype = signature.getDatatype(i);
+        size_t const size            = PrintfArgumentSignature::getStorageSize(datatype);
+        if ((offset + size) > arguments.size())
+        {
+            break;
+        }
+        if ((datatype == ParamDatatype::CHARPTR) || (datatype == ParamDatatype::SIZEDCHARPTR))
+        {
+            ::util::format::ParamVariant variant;
+            ::util::format::PrintfArgumentSignatureReader::readValue(
+                datatype, &arguments[offset], datatype, variant);
+            writer.writeParamVariant(datatype, variant);
+        }
+        else
+        {
+            writer.writeBytes(&arguments[offset], static_cast<T>(size));
+        }
+        offset += size;
+    }
+    return writer.getSize();
+}
+
 template<class T, class Timestamp, class ReadOnlyPredicate>
 void EntrySerializer<T, Timestamp, ReadOnlyPredicate>::deserialize(
     ::etl::span<uint8_t const> const& srcBuffer, IEntrySerializerCallback<Timestamp>& callback)
@@ -367,6 +438,9 @@ EntrySerializer<T, Timestamp, ReadOnlyPredicate>::EntryReader::EntryReader(
 , _bufferStart(bufferStart)
 , _bufferEnd(bufferEnd)
 , _read(bufferStart)
+, _signature()
+, _argumentIndex(0U)
+, _hasSignature(false)
 , _variant()
 , _plainSizedString()
 {}
@@ -374,8 +448,24 @@ EntrySerializer<T, Timestamp, ReadOnlyPredicate>::EntryReader::EntryReader(
 template<class T, class Timestamp, class ReadOnlyPredicate>
 ::util::format::ParamVariant const*
     EntrySerializer<T, Timestamp, ReadOnlyPredicate>::EntryReader::readArgument(
-        ::util::format::ParamDatatype /*datatype*/)
+        ::util::format::ParamDatatype const datatype)
 {
+    if (_hasSignature)
+    {
+        ::util::format::ParamDatatype const storedDatatype
+            = _signature.getDatatype(_argumentIndex);
+        if (storedDatatype == ::util::format::ParamDatatype::COUNT)
+        {
+            return nullptr;
+        }
+        ++_argumentIndex;
+        if ((storedDatatype != ::util::format::ParamDatatype::CHARPTR)
+            && (storedDatatype != ::util::format::ParamDatatype::SIZEDCHARPTR))
+        {
+            readRawArgument(storedDatatype, datatype);
+            return (_read <= _bufferEnd) ? &_variant : nullptr;
+        }
+    }
     readParamVariant();
     return (_read <= _bufferEnd) ? &_variant : nullptr;
 }
@@ -449,6 +539,17 @@ void EntrySerializer<T, Timestamp, ReadOnlyPredicate>::EntryReader::readParamVar
             _plainSizedString._length = ::etl::strlen(_plainSizedString._data, limit);
             break;
         }
+        case DATATYPE_SIGNATURE:
+        {
+            uint32_t signatureValue = 0U;
+            readBytes(&signatureValue, static_cast<T>(sizeof(signatureValue)));
+            _signature     = ::util::format::PrintfArgumentSignature(signatureValue);
+            _argumentIndex = 0U;
+            _hasSignature  = true;
+            // the format string follows the signature
+            readParamVariant();
+            break;
+        }
         default:
         {
             _variant._voidPtrValue = nullptr;
@@ -457,6 +558,18 @@ void EntrySerializer<T, Timestamp, ReadOnlyPredicate>::EntryReader::readParamVar
     }
 }
 
+template<class T, class Timestamp, class ReadOnlyPredicate>
+void EntrySerializer<T, Timestamp, ReadOnlyPredicate>::EntryReader::readRawArgument(
+    ::util::format::ParamDatatype const storedDatatype,
+    ::util::format::ParamDatatype const datatype)
+{
+    size_t const size = ::util::format::PrintfArgumentSignature::getStorageSize(storedDatatype);
+    uint8_t value[sizeof(uint64_t)] = {};
+    readBytes(&value[0], static_cast<T>(size));
+    ::util::format::PrintfArgumentSignatureReader::readValue(
+        storedDatatype, &value[0], datatype, _variant);
+}
+
 template<class T, class Timestamp, class ReadOnlyPredicate>
 char const* EntrySerializer<T, Timestamp, ReadOnlyPredicate>::EntryReader::readCharArray()
 {
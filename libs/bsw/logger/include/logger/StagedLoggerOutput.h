@@ -0,0 +1,455 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "logger/BufferedLoggerOutput.h"
+
+#include <etl/array.h>
+#include <etl/atomic.h>
+#include <etl/type_traits.h>
+#include <io/MemoryQueue.h>
+
+#include <cstdarg>
+#include <cstring>
+
+namespace logger
+{
+/**
+ * BufferedLoggerOutput that stages log messages in one lock free ring per task context.
+ *
+ * A log message emitted from a task context is serialized directly into the ring of the context,
+ * without taking Lock. The entries are moved into the global buffer by drain(), which merges the
+ * rings in timestamp order and takes Lock only for copying a single entry. Each ring is an
+ * io::MemoryQueue with the logging context as the only producer and the caller of drain() as the
+ * only consumer.
+ *
+ * Messages that cannot be staged are added to the global buffer directly, the same way as by
+ * BufferedLoggerOutput. This is the case if the current context has no ring (e.g. an interrupt),
+ * if the ring of the context is in use by a preempted log call, if the ring is full or if the
+ * message could not be serialized into the ring.
+ *
+ * \tparam Lock            Lock for the global buffer
+ * \tparam ContextProvider Class with a static method getCurrentContext() returning the index of
+ *                         the ring for the current context. Indices not below ContextCount
+ *                         denote contexts without a ring.
+ * \tparam ContextCount    Number of rings
+ * \tparam StagingSize     Size of each ring in bytes
+ */
+template<
+    class Lock,
+    class ContextProvider,
+    size_t ContextCount,
+    size_t StagingSize,
+    uint8_t MaxEntrySize    = 64,
+    class T                 = uint16_t,
+    class E                 = uint32_t,
+    class Timestamp         = uint32_t,
+    class ReadOnlyPredicate = SectionPredicate>
+class StagedLoggerOutput
+: public BufferedLoggerOutput<Lock, MaxEntrySize, T, E, Timestamp, ReadOnlyPredicate>
+{
+    using Base = BufferedLoggerOutput<Lock, MaxEntrySize, T, E, Timestamp, ReadOnlyPredicate>;
+
+public:
+    StagedLoggerOutput(
+        ::util::logger::IComponentMapping& componentMapping,
+        ILoggerTime<Timestamp>& timestamp,
+        ::etl::span<uint8_t> outputBuffer);
+    StagedLoggerOutput(
+        ::util::logger::IComponentMapping& componentMapping,
+        ILoggerTime<Timestamp>& timestamp,
+        ::etl::span<uint8_t> outputBuffer,
+        ReadOnlyPredicate const& readOnlyPredicate);
+
+    void logOutput(
+        ::util::logger::ComponentInfo const& componentInfo,
+        ::util::logger::LevelInfo const& levelInfo,
+        char const* str,
+        va_list ap) override;
+
+    void logTypedOutput(
+        ::util::logger::ComponentInfo const& componentInfo,
+        ::util::logger::LevelInfo const& levelInfo,
+        char const* str,
+        ::util::format::PrintfArgumentSignature signature,
+        ::etl::span<uint8_t const> const& arguments) override;
+
+    /**
+     * Moves all staged entries into the global buffer, oldest first. The listeners are notified
+     * for each moved entry. This method must not be called from different contexts concurrently.
+     * \return number of moved entries
+     */
+    size_t drain();
+
+    /**
+     * Returns the number of messages that have been added to the global buffer directly.
+     */
+    uint32_t getDirectEntryCount() const;
+
+private:
+    using QueueType = ::io::MemoryQueue<StagingSize, MaxEntrySize, uint16_t>;
+
+    struct Ring
+    {
+        QueueType _queue;
+        ::etl::atomic<bool> _isBusy{false};
+    };
+
+    template<class Serialize>
+    bool stageEntry(Serialize const& serialize);
+
+    static bool isBefore(Timestamp lhs, Timestamp rhs);
+
+    ::etl::array<Ring, ContextCount> _rings;
+    ::etl::atomic<uint32_t> _directEntryCount{0U};
+};
+
+namespace declare
+{
+/**
+ * A StagedLoggerOutput with its own global buffer of BufferSize bytes.
+ * \see ::logger::StagedLoggerOutput
+ */
+template<
+    uint32_t BufferSize,
+    class Lock,
+    class ContextProvider,
+    size_t ContextCount,
+    size_t StagingSize,
+    uint8_t MaxEntrySize    = 64,
+    class T                 = uint16_t,
+    class E                 = uint32_t,
+    class Timestamp         = uint32_t,
+    class ReadOnlyPredicate = SectionPredicate>
+class StagedLoggerOutput
+: public ::logger::StagedLoggerOutput<
+      Lock,
+      ContextProvider,
+      ContextCount,
+      StagingSize,
+      MaxEntrySize,
+      T,
+      E,
+      Timestamp,
+      ReadOnlyPredicate>
+{
+    using Base = ::logger::StagedLoggerOutput<
+        Lock,
+        ContextProvider,
+        ContextCount,
+        StagingSize,
+        MaxEntrySize,
+        T,
+        E,
+        Timestamp,
+        ReadOnlyPredicate>;
+
+public:
+    StagedLoggerOutput(
+        ::util::logger::IComponentMapping& componentMapping, ILoggerTime<Timestamp>& timestamp)
+    : Base(componentMapping, timestamp, _buffer), _buffer()
+    {}
+
+    StagedLoggerOutput(
+        ::util::logger::IComponentMapping& componentMapping,
+        ILoggerTime<Timestamp>& timestamp,
+        ReadOnlyPredicate const readOnlyPredicate)
+    : Base(componentMapping, timestamp, _buffer, readOnlyPredicate), _buffer()
+    {}
+
+private:
+    uint8_t _buffer[BufferSize];
+};
+
+} // namespace declare
+
+template<
+    class Lock,
+    class ContextProvider,
+    size_t ContextCount,
+    size_t StagingSize,
+    uint8_t MaxEntrySize,
+    class T,
+    class E,
+    class Timestamp,
+    class ReadOnlyPredicate>
+StagedLoggerOutput<
+    Lock,
+    ContextProvider,
+    ContextCount,
+    StagingSize,
+    MaxEntrySize,
+    T,
+    E,
+    Timestamp,
+    ReadOnlyPredicate>::
+    StagedLoggerOutput(
+        ::util::logger::IComponentMapping& componentMapping,
+        ILoggerTime<Timestamp>& timestamp,
+        ::etl::span<uint8_t> const outputBuffer)
+: Base(componentMapping, timestamp, outputBuffer), _rings()
+{}
+
+template<
+    class Lock,
+    class ContextProvider,
+    size_t ContextCount,
+    size_t StagingSize,
+    uint8_t MaxEntrySize,
+    class T,
+    class E,
+    class Timestamp,
+    class ReadOnlyPredicate>
+StagedLoggerOutput<
+    Lock,
+    ContextProvider,
+    ContextCount,
+    StagingSize,
+    MaxEntrySize,
+    T,
+    E,
+    Timestamp,
+    ReadOnlyPredicate>::
+    StagedLoggerOutput(
+        ::util::logger::IComponentMapping& componentMapping,
+        ILoggerTime<Timestamp>& timestamp,
+        ::etl::span<uint8_t> const outputBuffer,
+        ReadOnlyPredicate const& readOnlyPredicate)
+: Base(componentMapping, timestamp, outputBuffer, readOnlyPredicate), _rings()
+{}
+
+template<
+    class Lock,
+    class ContextProvider,
+    size_t ContextCount,
+    size_t StagingSize,
+    uint8_t MaxEntrySize,
+    class T,
+    class E,
+    class Timestamp,
+    class ReadOnlyPredicate>
+void StagedLoggerOutput<
+    Lock,
+    ContextProvider,
+    ContextCount,
+    StagingSize,
+    MaxEntrySize,
+    T,
+    E,
+    Timestamp,
+    ReadOnlyPredicate>::
+    logOutput(
+        ::util::logger::ComponentInfo const& componentInfo,
+        ::util::logger::LevelInfo const& levelInfo,
+        char const* const str,
+        va_list ap)
+{
+    // the arguments may have to be read again if the message is added directly
+    va_list stagedAp;
+    va_copy(stagedAp, ap);
+    bool const isStaged = stageEntry(
+        [&](::etl::span<uint8_t> const& entryBuffer)
+        { return this->serializeEntry(entryBuffer, componentInfo, levelInfo, str, stagedAp); });
+    va_end(stagedAp);
+    if (!isStaged)
+    {
+        (void)_directEntryCount.fetch_add(1U);
+        Base::logOutput(componentInfo, levelInfo, str, ap);
+    }
+}
+
+template<
+    class Lock,
+    class ContextProvider,
+    size_t ContextCount,
+    size_t StagingSize,
+    uint8_t MaxEntrySize,
+    class T,
+    class E,
+    class Timestamp,
+    class ReadOnlyPredicate>
+void StagedLoggerOutput<
+    Lock,
+    ContextProvider,
+    ContextCount,
+    StagingSize,
+    MaxEntrySize,
+    T,
+    E,
+    Timestamp,
+    ReadOnlyPredicate>::
+    logTypedOutput(
+        ::util::logger::ComponentInfo const& componentInfo,
+        ::util::logger::LevelInfo const& levelInfo,
+        char const* const str,
+        ::util::format::PrintfArgumentSignature const signature,
+        ::etl::span<uint8_t const> const& arguments)
+{
+    bool const isStaged = stageEntry(
+        [&](::etl::span<uint8_t> const& entryBuffer)
+        {
+            return this->serializeEntry(
+                entryBuffer, componentInfo, levelInfo, str, signature, arguments);
+        });
+    if (!isStaged)
+    {
+        (void)_directEntryCount.fetch_add(1U);
+        Base::logTypedOutput(componentInfo, levelInfo, str, signature, arguments);
+    }
+}
+
+template<
+    class Lock,
+    class ContextProvider,
+    size_t ContextCount,
+    size_t StagingSize,
+    uint8_t MaxEntrySize,
+    class T,
+    class E,
+    class Timestamp,
+    class ReadOnlyPredicate>
+size_t StagedLoggerOutput<
+    Lock,
+    ContextProvider,
+    ContextCount,
+    StagingSize,
+    MaxEntrySize,
+    T,
+    E,
+    Timestamp,
+    ReadOnlyPredicate>::drain()
+{
+    size_t count = 0U;
+    while (true)
+    {
+        Ring* oldestRing = nullptr;
+        Timestamp oldestTimestamp{};
+        for (Ring& ring : _rings)
+        {
+            typename QueueType::Reader const reader(ring._queue);
+            ::etl::span<uint8_t> const entry = reader.peek();
+            if (entry.size() < sizeof(Timestamp))
+            {
+                // an empty ring or an entry without timestamp, which is dropped
+                reader.release();
+                continue;
+            }
+            Timestamp timestamp{};
+            (void)::memcpy(&timestamp, entry.data(), sizeof(timestamp));
+            if ((oldestRing == nullptr) || isBefore(timestamp, oldestTimestamp))
+            {
+                oldestRing      = &ring;
+                oldestTimestamp = timestamp;
+            }
+        }
+        if (oldestRing == nullptr)
+        {
+            return count;
+        }
+        typename QueueType::Reader const reader(oldestRing->_queue);
+        this->addEntry(reader.peek());
+        reader.release();
+        ++count;
+    }
+}
+
+template<
+    class Lock,
+    class ContextProvider,
+    size_t ContextCount,
+    size_t StagingSize,
+    uint8_t MaxEntrySize,
+    class T,
+    class E,
+    class Timestamp,
+    class ReadOnlyPredicate>
+uint32_t StagedLoggerOutput<
+    Lock,
+    ContextProvider,
+    ContextCount,
+    StagingSize,
+    MaxEntrySize,
+    T,
+    E,
+    Timestamp,
+    ReadOnlyPredicate>::getDirectEntryCount() const
+{
+    return _directEntryCount.load();
+}
+
+template<
+    class Lock,
+    class ContextProvider,
+    size_t ContextCount,
+    size_t StagingSize,
+    uint8_t MaxEntrySize,
+    class T,
+    class E,
+    class Timestamp,
+    class ReadOnlyPredicate>
+template<class Serialize>
+bool StagedLoggerOutput<
+    Lock,
+    ContextProvider,
+    ContextCount,
+    StagingSize,
+    MaxEntrySize,
+    T,
+    E,
+    Timestamp,
+    ReadOnlyPredicate>::stageEntry(Serialize const& serialize)
+{
+    size_t const context = static_cast<size_t>(ContextProvider::getCurrentContext());
+    if (context >= ContextCount)
+    {
+        return false;
+    }
+    Ring& ring = _rings[context];
+    if (ring._isBusy.exchange(true))
+    {
+        return false;
+    }
+    typename QueueType::Writer writer(ring._queue);
+    ::etl::span<uint8_t> const entryBuffer = writer.allocate(MaxEntrySize);
+    bool isStaged                          = false;
+    if (entryBuffer.size() > 0U)
+    {
+        T const size = serialize(entryBuffer);
+        if (size > 0U)
+        {
+            (void)writer.allocate(size);
+            writer.commit();
+            isStaged = true;
+        }
+    }
+    ring._isBusy.store(false);
+    return isStaged;
+}
+
+template<
+    class Lock,
+    class ContextProvider,
+    size_t ContextCount,
+    size_t StagingSize,
+    uint8_t MaxEntrySize,
+    class T,
+    class E,
+    class Timestamp,
+    class ReadOnlyPredicate>
+bool StagedLoggerOutput<
+    Lock,
+    ContextProvider,
+    ContextCount,
+    StagingSize,
+    MaxEntrySize,
+    T,
+    E,
+    Timestamp,
+    ReadOnlyPredicate>::isBefore(Timestamp const lhs, Timestamp const rhs)
+{
+    // compare the difference to handle a wrap around of the timestamp
+    using SignedTimestamp = typename ::etl::make_signed<Timestamp>::type;
+    return static_cast<SignedTimestamp>(lhs - rhs) < 0;
+}
+
+} // namespace logger
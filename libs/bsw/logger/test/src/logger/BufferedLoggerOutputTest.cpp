@@ -6,6 +6,7 @@
 #include "logger/ILoggerTime.h"
 
 #include <util/format/StringWriter.h>
+#include <util/logger/TypedLogger.h>
 #include <util/stream/StringBufferOutputStream.h>
 
 #include <gtest/gtest.h>
@@ -155,4 +156,22 @@ TEST_F(BufferedLoggerOutputTest, testConstructorWithPredicate)
     ASSERT_TRUE(checkAndResetEntry("1 2348 1 0 ver<?>"));
 }
 
+TEST_F(BufferedLoggerOutputTest, testTypedLogOutput)
+{
+    declare::BufferedLoggerOutput<4096, TestLock> cut(testMapping, *this);
+    cut.addListener(*this);
+    ::util::logger::Logger::init(testMapping, cut);
+    setTimestamp(2349);
+    ::util::logger::TypedLogger::info(1U, "typed format string %d %s", -17, "218439");
+    ::util::logger::Logger::shutdown();
+    ASSERT_EQ(1U, _totalLockCount);
+    ASSERT_EQ(1U, _availableLogCount);
+    BufferedLoggerOutput<TestLock>::EntryRefType entryRef;
+    cut.outputEntry(*this, entryRef);
+    ASSERT_TRUE(checkAndResetEntry("1 2349 1 1 typed format string -17 218439"));
+    cut.outputEntry(*this, entryRef);
+    ASSERT_TRUE(checkAndResetEntry(""));
+    cut.removeListener(*this);
+}
+
 } // namespace
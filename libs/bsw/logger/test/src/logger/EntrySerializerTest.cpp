@@ -42,6 +42,38 @@ struct EntrySerializerTest
         return _entry;
     }
 
+    template<class... Args>
+    std::string const& serializeTypedAndDeserialize(
+        uint32_t bufferSize,
+        uint32_t timestamp,
+        uint8_t componentIdx,
+        uint8_t level,
+        char const* formatString,
+        Args const&... args)
+    {
+        EntrySerializer<> serializer(
+            SectionPredicate(_constStrings, _constStrings + sizeof(_constStrings)));
+        memset(_buffer, 0xaf, sizeof(_buffer));
+        uint8_t arguments[::util::format::PrintfArgumentWriter::getSize<Args...>() + 1U];
+        ::util::format::PrintfArgumentWriter::write(arguments, args...);
+        ::etl::span<uint8_t> entryBuffer
+            = ::etl::span<uint8_t>(_buffer, sizeof(_buffer)).subspan(1, bufferSize);
+        _usedBufferSize = serializer.serialize(
+            entryBuffer,
+            timestamp,
+            componentIdx,
+            static_cast<Level>(level),
+            formatString,
+            ::util::format::PrintfArgumentSignature::create<Args...>(),
+            ::etl::span<uint8_t const>(arguments).first(sizeof(arguments) - 1U));
+        _usedBufferSize = _usedBufferSize < bufferSize ? _usedBufferSize : bufferSize;
+        _entry.clear();
+        EXPECT_EQ(0xaf, _buffer[0]);
+        EXPECT_EQ(0xaf, _buffer[bufferSize + 1]);
+        serializer.deserialize(entryBuffer.first(_usedBufferSize), *this);
+        return _entry;
+    }
+
     char const* addConstString(char const* string)
     {
         size_t const maxSize = sizeof(_constStrings) - _nextConstStringOffset;
@@ -207,3 +239,51 @@ TEST_F(EntrySerializerTest, testPrintfDatatypes)
     ASSERT_EQ("124:2:3:", serializeAndDeserialize(300, 124, 2, 3, "%n", 0));
     ASSERT_EQ("124:2:3:    0017", serializeAndDeserialize(300, 124, 2, 3, "%*.*d", 8, 4, 17));
 }
+
+TEST_F(EntrySerializerTest, testTypedLogWithArguments)
+{
+    ASSERT_EQ("123:1:2:simpleLog", serializeTypedAndDeserialize(300, 123, 1, 2, "simpleLog"));
+    ASSERT_EQ(
+        "123:1:2:simpleArgLog(arg-value, 123, f)",
+        serializeTypedAndDeserialize(
+            300, 123, 1, 2, "simpleArgLog(%s, %d, %c)", "arg-value", 123, 'f'));
+    ASSERT_EQ(
+        "123:1:2:simpleArgLog(arg-value, 123, <?>)",
+        serializeTypedAndDeserialize(
+            _usedBufferSize - 1, 123, 1, 2, "simpleArgLog(%s, %d, %c)", "arg-value", 123, 'f'));
+    ASSERT_EQ(
+        "123:1:2:simpleArgLog(arg-value)",
+        serializeTypedAndDeserialize(300, 123, 1, 2, "simpleArgLog(%s)", "arg-value"));
+    ASSERT_EQ(
+        "123:1:2:simpleArgLog(arg-v<?>)",
+        serializeTypedAndDeserialize(
+            _usedBufferSize - 1, 123, 1, 2, "simpleArgLog(%s)", "arg-value"));
+}
+
+TEST_F(EntrySerializerTest, testTypedLogWithConstStrings)
+{
+    char const* pConstFormat = addConstString("constLog(%s, %S)");
+    char const* pConstString = addConstString("arg-value");
+    ::util::string::ConstString sizedString("sized-value", 5U);
+    ASSERT_EQ(
+        "123:1:2:constLog(arg-value, sized)",
+        serializeTypedAndDeserialize(
+            300, 123, 1, 2, pConstFormat, pConstString, sizedString.plain_str()));
+}
+
+TEST_F(EntrySerializerTest, testTypedPrintfDatatypes)
+{
+    ASSERT_EQ(
+        "124:2:3:-17 18 -19",
+        serializeTypedAndDeserialize(
+            300, 124, 2, 3, "%d %hd %lld", -17, static_cast<int16_t>(18), -19LL));
+    ASSERT_EQ(
+        "124:2:3:17 65535 19",
+        serializeTypedAndDeserialize(300, 124, 2, 3, "%u %hu %llu", 17U, -1, 19ULL));
+    ASSERT_EQ(
+        "124:2:3:12345678",
+        serializeTypedAndDeserialize(
+            300, 124, 2, 3, "%p", reinterpret_cast<void const*>(0x12345678)));
+    ASSERT_EQ("124:2:3:    0017", serializeTypedAndDeserialize(300, 124, 2, 3, "%*.*d", 8, 4, 17));
+    ASSERT_EQ("124:2:3:17 <?>", serializeTypedAndDeserialize(300, 124, 2, 3, "%d %d", 17));
+}
@@ -0,0 +1,241 @@
+// Copyright 2025 Accenture.
+
+#include "logger/StagedLoggerOutput.h"
+
+#include "logger/ComponentMapping.h"
+#include "logger/ILoggerTime.h"
+
+#include <util/format/PrintfArgumentSignature.h>
+#include <util/format/StringWriter.h>
+#include <util/stream/StringBufferOutputStream.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace util
+{
+namespace logger
+{
+static uint8_t STAGED1 = COMPONENT_NONE;
+static uint8_t STAGED2 = COMPONENT_NONE;
+} // namespace logger
+} // namespace util
+
+namespace
+{
+using namespace logger;
+using namespace ::util;
+
+uint32_t _lockCount;
+size_t _currentContext;
+
+struct TestLock
+{
+    TestLock() { ++_lockCount; }
+};
+
+struct TestContextProvider
+{
+    static size_t getCurrentContext() { return _currentContext; }
+};
+
+START_LOGGER_COMPONENT_MAPPING_INFO_TABLE(componentInfoTable)
+LOGGER_COMPONENT_MAPPING_INFO(LEVEL_DEBUG, STAGED1)
+LOGGER_COMPONENT_MAPPING_INFO(LEVEL_DEBUG, STAGED2)
+END_LOGGER_COMPONENT_MAPPING_INFO_TABLE();
+
+// NOLINTBEGIN(cert-err58-cpp): Instantiation of variable is done by macro.
+DEFINE_LOGGER_COMPONENT_MAPPING(
+    TestMappingType,
+    testMapping,
+    componentInfoTable,
+    ::util::logger::LevelInfo::getDefaultTable(),
+    STAGED1);
+
+// NOLINTEND(cert-err58-cpp)
+
+using OutputType = declare::StagedLoggerOutput<1024, TestLock, TestContextProvider, 2U, 64U, 32U>;
+
+struct StagedLoggerOutputTest
+: ::testing::Test
+, ILoggerListener
+, IEntryOutput<uint32_t, uint32_t>
+, ILoggerTime<uint32_t>
+{
+    StagedLoggerOutputTest() : _cut(testMapping, *this)
+    {
+        _lockCount      = 0U;
+        _currentContext = 0U;
+        _cut.addListener(*this);
+    }
+
+    ~StagedLoggerOutputTest() override { _cut.removeListener(*this); }
+
+    void logAvailable() override { ++_availableLogCount; }
+
+    void outputEntry(
+        uint32_t /* entryIndex */,
+        uint32_t timestamp,
+        ::util::logger::ComponentInfo const& /* componentInfo */,
+        ::util::logger::LevelInfo const& /* levelInfo */,
+        char const* str,
+        format::IPrintfArgumentReader& argReader) override
+    {
+        stream::declare::StringBufferOutputStream<100> outputStream;
+        format::StringWriter writer(outputStream);
+        writer.printf("%d ", timestamp);
+        writer.vprintf(str, argReader);
+        _entries.push_back(outputStream.getString());
+    }
+
+    uint32_t getTimestamp() const override
+    {
+        if (_nestedContext)
+        {
+            // simulate a log call that preempts a log call of the same context
+            _nestedContext = false;
+            const_cast<StagedLoggerOutputTest*>(this)->log(_timestamp, "nested");
+        }
+        return _timestamp;
+    }
+
+    void formatTimestamp(stream::IOutputStream& /* stream */, uint32_t const& /* timestamp */)
+        const override
+    {}
+
+    // NOLINTNEXTLINE(cert-dcl50-cpp): va_list usage only for this test file.
+    void log(uint32_t timestamp, char const* str, ...)
+    {
+        _timestamp = timestamp;
+        va_list ap;
+        va_start(ap, str);
+        _cut.logOutput(
+            testMapping.getComponentInfo(0),
+            testMapping.getLevelInfo(::util::logger::LEVEL_INFO),
+            str,
+            ap);
+        va_end(ap);
+    }
+
+    std::vector<std::string> const& readEntries()
+    {
+        _entries.clear();
+        OutputType::EntryRefType entryRef;
+        while (_cut.outputEntry(*this, entryRef)) {}
+        return _entries;
+    }
+
+    OutputType _cut;
+    uint32_t _timestamp         = 0U;
+    mutable bool _nestedContext = false;
+    uint32_t _availableLogCount = 0U;
+    std::vector<std::string> _entries;
+};
+
+TEST_F(StagedLoggerOutputTest, testStagedEntriesAreAddedByDrain)
+{
+    _currentContext = 0U;
+    log(10U, "first %d", 1);
+    _currentContext = 1U;
+    log(11U, "second %s", "log");
+    EXPECT_EQ(0U, _lockCount);
+    EXPECT_EQ(0U, _availableLogCount);
+    EXPECT_TRUE(readEntries().empty());
+
+    EXPECT_EQ(2U, _cut.drain());
+    EXPECT_EQ(2U, _availableLogCount);
+    EXPECT_EQ(0U, _cut.getDirectEntryCount());
+    std::vector<std::string> const expected{"10 first 1", "11 second log"};
+    EXPECT_EQ(expected, readEntries());
+    EXPECT_EQ(0U, _cut.drain());
+}
+
+TEST_F(StagedLoggerOutputTest, testDrainMergesInTimestampOrder)
+{
+    _currentContext = 1U;
+    log(5U, "b");
+    log(7U, "d");
+    _currentContext = 0U;
+    log(4U, "a");
+    log(6U, "c");
+    log(8U, "e");
+
+    EXPECT_EQ(5U, _cut.drain());
+    std::vector<std::string> const expected{"4 a", "5 b", "6 c", "7 d", "8 e"};
+    EXPECT_EQ(expected, readEntries());
+}
+
+TEST_F(StagedLoggerOutputTest, testDrainHandlesTimestampWrapAround)
+{
+    _currentContext = 1U;
+    log(2U, "after");
+    _currentContext = 0U;
+    log(0xFFFFFFFEU, "before");
+
+    EXPECT_EQ(2U, _cut.drain());
+    std::vector<std::string> const expected{"-2 before", "2 after"};
+    EXPECT_EQ(expected, readEntries());
+}
+
+TEST_F(StagedLoggerOutputTest, testContextWithoutRingIsAddedDirectly)
+{
+    _currentContext = 2U;
+    log(3U, "isr %d", 17);
+    EXPECT_EQ(1U, _lockCount);
+    EXPECT_EQ(1U, _availableLogCount);
+    EXPECT_EQ(1U, _cut.getDirectEntryCount());
+    std::vector<std::string> const expected{"3 isr 17"};
+    EXPECT_EQ(expected, readEntries());
+}
+
+TEST_F(StagedLoggerOutputTest, testFullRingIsAddedDirectly)
+{
+    _currentContext = 0U;
+    uint32_t count  = 0U;
+    while (_cut.getDirectEntryCount() == 0U)
+    {
+        log(count, "entry");
+        ++count;
+    }
+    EXPECT_LT(1U, count);
+    EXPECT_EQ(count - 1U, _cut.drain());
+    std::vector<std::string> const& entries = readEntries();
+    ASSERT_EQ(count, entries.size());
+    // the direct entry is the newest but has been added first
+    EXPECT_EQ(std::to_string(count - 1U) + " entry", entries.front());
+    EXPECT_EQ("0 entry", entries[1]);
+}
+
+TEST_F(StagedLoggerOutputTest, testPreemptingLogOfSameContextIsAddedDirectly)
+{
+    _currentContext = 0U;
+    _nestedContext  = true;
+    log(9U, "outer");
+    EXPECT_EQ(1U, _cut.getDirectEntryCount());
+    EXPECT_EQ(1U, _cut.drain());
+    std::vector<std::string> const expected{"9 nested", "9 outer"};
+    EXPECT_EQ(expected, readEntries());
+}
+
+TEST_F(StagedLoggerOutputTest, testTypedEntriesAreStaged)
+{
+    _currentContext = 1U;
+    _timestamp      = 12U;
+    int32_t const value = -3;
+    uint8_t arguments[format::PrintfArgumentWriter::getSize<int32_t>()];
+    format::PrintfArgumentWriter::write(arguments, value);
+    _cut.logTypedOutput(
+        testMapping.getComponentInfo(1),
+        testMapping.getLevelInfo(::util::logger::LEVEL_INFO),
+        "typed %d",
+        format::PrintfArgumentSignature::create<int32_t>(),
+        arguments);
+    EXPECT_EQ(0U, _lockCount);
+    EXPECT_EQ(1U, _cut.drain());
+    std::vector<std::string> const expected{"12 typed -3"};
+    EXPECT_EQ(expected, readEntries());
+}
+
+} // namespace
@@ -2,20 +2,38 @@
 
 #pragma once
 
+#include "logger/MeasuredLock.h"
+
+#include <async/AsyncBinding.h>
 #include <interrupts/SuspendResumeAllInterruptsScopedLock.h>
-#include <logger/BufferedLoggerOutput.h>
+#include <logger/StagedLoggerOutput.h>
 
 namespace logger
 {
 using EntryIndexType = uint32_t;
 using TimestampType  = uint32_t;
 
-using BufferedLoggerOutputType = ::logger::declare::BufferedLoggerOutput<
-    1024u * 8u,                                         // BufferSize
-    ::interrupts::SuspendResumeAllInterruptsScopedLock, // Lock
-    128,                                                // MaxEntrySize
-    uint16_t,                                           // T
-    EntryIndexType,                                     // EntryIndexType
-    TimestampType>;                                     // TimestampType
+/**
+ * Maps the current task context to its staging ring. Interrupts are mapped to CONTEXT_INVALID and
+ * therefore log into the global buffer directly.
+ */
+struct LoggerContextProvider
+{
+    static ::async::ContextType getCurrentContext()
+    {
+        return ::async::AsyncBinding::AdapterType::getCurrentTaskContext();
+    }
+};
+
+using BufferedLoggerOutputType = ::logger::declare::StagedLoggerOutput<
+    1024u * 8u,                                                       // BufferSize
+    MeasuredLock<::interrupts::SuspendResumeAllInterruptsScopedLock>, // Lock
+    LoggerContextProvider,                                            // ContextProvider
+    ::async::AsyncBinding::AdapterType::OS_TASK_COUNT,                // ContextCount
+    512u,                                                             // StagingSize
+    128,                                                              // MaxEntrySize
+    uint16_t,                                                         // T
+    EntryIndexType,                                                   // EntryIndexType
+    TimestampType>;                                                   // TimestampType
 
 } // namespace logger
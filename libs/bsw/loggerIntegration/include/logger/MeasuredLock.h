@@ -0,0 +1,52 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <bsp/timer/SystemTimer.h>
+#include <runtime/RuntimeStatistics.h>
+
+#include <cstdint>
+
+namespace logger
+{
+/**
+ * Statistics of the time in system ticks a MeasuredLock has been held.
+ */
+class LockStatistics
+{
+public:
+    /**
+     * Returns the statistics since the last call to reset(). The statistics are updated while the
+     * lock is held, so they should be read under the same lock.
+     */
+    static ::runtime::RuntimeStatistics const& getStatistics() { return _statistics; }
+
+    static void reset() { _statistics.reset(); }
+
+private:
+    template<class Lock>
+    friend class MeasuredLock;
+
+    static ::runtime::RuntimeStatistics _statistics;
+};
+
+/**
+ * Scoped lock that holds a Lock and adds the time it has been held to LockStatistics.
+ */
+template<class Lock>
+class MeasuredLock
+{
+public:
+    MeasuredLock() : _lock(), _start(getSystemTicks32Bit()) {}
+
+    ~MeasuredLock() { LockStatistics::_statistics.addRun(getSystemTicks32Bit() - _start); }
+
+    MeasuredLock(MeasuredLock const&)            = delete;
+    MeasuredLock& operator=(MeasuredLock const&) = delete;
+
+private:
+    Lock const _lock;
+    uint32_t const _start;
+};
+
+} // namespace logger
@@ -22,11 +22,13 @@ void LoggerComposition::start(ConfigStart const& configStart)
 
 void LoggerComposition::run()
 {
+    (void)_bufferedLoggerOutput.drain();
     (void)_bufferedLoggerOutput.outputEntry(_consoleLoggerOutput, _entryRef);
 }
 
 void LoggerComposition::stop(ConfigStop const& configStop)
 {
+    (void)_bufferedLoggerOutput.drain();
     while (_bufferedLoggerOutput.outputEntry(_consoleLoggerOutput, _entryRef)) {}
     configStop();
 }
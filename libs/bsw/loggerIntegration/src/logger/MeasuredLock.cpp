@@ -0,0 +1,9 @@
+// Copyright 2025 Accenture.
+
+#include "logger/MeasuredLock.h"
+
+namespace logger
+{
+::runtime::RuntimeStatistics LockStatistics::_statistics;
+
+} // namespace logger
@@ -0,0 +1,117 @@
+// Copyright 2025 BMW AG
+
+#include <benchmark/benchmark.h>
+#include <middleware/queue/LockFreeQueue.h>
+#include <middleware/queue/Queue.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+/**
+ * Serializes the producers of the locked queue like ScopedECULock does on target, by spinning on
+ * the mutex byte of the queue.
+ */
+struct SpinLock
+{
+    explicit SpinLock(uint8_t volatile* const lock) : _lock(lock)
+    {
+        while (__atomic_test_and_set(_lock, __ATOMIC_ACQUIRE)) {}
+    }
+
+    ~SpinLock() { __atomic_clear(_lock, __ATOMIC_RELEASE); }
+
+    SpinLock(SpinLock const&)            = delete;
+    SpinLock& operator=(SpinLock const&) = delete;
+
+private:
+    uint8_t volatile* _lock;
+};
+
+using Item = uint32_t;
+
+using LockedQueue
+    = ::middleware::queue::Queue<::middleware::queue::QueueTraits<Item, 64U, SpinLock>>;
+using LockFreeQueue
+    = ::middleware::queue::LockFreeQueue<::middleware::queue::QueueTraits<Item, 64U>>;
+
+template<class Queue>
+Queue& getQueue()
+{
+    static Queue queue;
+    return queue;
+}
+} // namespace
+
+/**
+ * Writes and reads one element without contention, which is the latency a single sender sees.
+ */
+template<class Queue>
+void BM_queueRoundTrip(benchmark::State& state)
+{
+    Queue& queue = getQueue<Queue>();
+    queue.init();
+    typename Queue::Sender sender(queue);
+    typename Queue::Receiver receiver(queue);
+    Item value = 0U;
+    while (state.KeepRunning())
+    {
+        benchmark::DoNotOptimize(sender.write(value));
+        benchmark::DoNotOptimize(receiver.peek());
+        receiver.advance();
+        ++value;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+/**
+ * Reads elements written by range(0) producer threads, the throughput is reported in elements
+ * per second of the consumer.
+ */
+template<class Queue>
+void BM_queueMultiProducer(benchmark::State& state)
+{
+    Queue& queue = getQueue<Queue>();
+    queue.init();
+    std::atomic<bool> running{true};
+    std::vector<std::thread> producers;
+    for (int64_t producer = 0; producer < state.range(0); ++producer)
+    {
+        producers.emplace_back(
+            [&queue, &running]()
+            {
+                typename Queue::Sender sender(queue);
+                Item value = 0U;
+                while (running.load(std::memory_order_relaxed))
+                {
+                    if (sender.write(value))
+                    {
+                        ++value;
+                    }
+                }
+            });
+    }
+
+    typename Queue::Receiver receiver(queue);
+    while (state.KeepRunning())
+    {
+        while (receiver.isEmpty()) {}
+        benchmark::DoNotOptimize(receiver.peek());
+        receiver.advance();
+    }
+
+    running.store(false);
+    for (std::thread& producer : producers)
+    {
+        producer.join();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK_TEMPLATE(BM_queueRoundTrip, LockedQueue);
+BENCHMARK_TEMPLATE(BM_queueRoundTrip, LockFreeQueue);
+
+BENCHMARK_TEMPLATE(BM_queueMultiProducer, LockedQueue)->DenseRange(1, 4);
+BENCHMARK_TEMPLATE(BM_queueMultiProducer, LockFreeQueue)->DenseRange(1, 4);
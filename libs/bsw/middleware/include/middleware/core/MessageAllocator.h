@@ -0,0 +1,71 @@
+// Copyright 2025 BMW AG
+
+#pragma once
+
+#include "middleware/core/Message.h"
+#include "middleware/core/types.h"
+
+#include <etl/span.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace middleware
+{
+namespace core
+{
+
+/**
+ * Manages the payload memory of messages.
+ * Payloads of up to Message::MAX_PAYLOAD_SIZE bytes are stored inside the message. Bigger payloads
+ * are allocated from the pool returned by memory::getPayloadPool() and the message only carries an
+ * ExternalHandle to it, so the message can be copied and passed between clusters without copying
+ * the payload.
+ *
+ * An allocated payload has one reference, which is consumed by sending the message: the cluster
+ * connection releases it after the message has been dispatched, or if it could not be sent. A
+ * message that is sent several times, e.g. an event to multiple clusters, needs one reference per
+ * send, which are added with share(). All recipients then access the same payload, which is
+ * released automatically after the last dispatch.
+ */
+class MessageAllocator
+{
+public:
+    /**
+     * Provides \p size bytes of payload for \p msg.
+     *
+     * \param msg the message to allocate the payload for
+     * \param size the size of the payload in bytes
+     * \param payload set to the memory of the payload, which can be written by the caller
+     * \return HRESULT::Ok on success or HRESULT::CannotAllocatePayload if no memory is available
+     */
+    static HRESULT allocate(Message& msg, size_t size, etl::span<uint8_t>& payload);
+
+    /**
+     * Adds \p count references to the external payload of \p msg and marks the payload as shared.
+     * Messages with payload stored inside the message are left unchanged.
+     *
+     * \return HRESULT::Ok on success or HRESULT::InvalidPayload if the payload is not allocated
+     */
+    static HRESULT share(Message& msg, uint16_t count = 1U);
+
+    /**
+     * Returns the external payload of \p msg or an empty span if \p msg doesn't have one.
+     */
+    static etl::span<uint8_t const> getPayload(Message const& msg);
+
+    /**
+     * Releases one reference to the external payload of \p msg. Messages without external payload
+     * are ignored.
+     *
+     * \return HRESULT::Ok on success or HRESULT::CannotDeallocatePayload if the payload is not
+     * allocated
+     */
+    static HRESULT deallocate(Message const& msg);
+
+private:
+    static bool hasExternalPayload(Message const& msg);
+};
+
+} // namespace core
+} // namespace middleware
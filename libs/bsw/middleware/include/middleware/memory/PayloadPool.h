@@ -0,0 +1,247 @@
+// Copyright 2025 BMW AG
+
+#pragma once
+
+#include <etl/atomic.h>
+#include <etl/span.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace middleware
+{
+namespace memory
+{
+
+/**
+ * A struct that aggregates the statistics of one size class of a PayloadPool.
+ *
+ */
+struct PayloadPoolStats
+{
+    /** Size of each block in bytes. */
+    uint32_t blockSize;
+    /** Number of blocks allocated over the lifetime of the pool. */
+    uint32_t allocations;
+    /**
+     * Number of allocations that could not be served by this or any bigger size class. Requests
+     * that exceed the biggest block are counted by the biggest size class.
+     */
+    uint32_t failedAllocations;
+    /** Total number of blocks. */
+    uint16_t blockCount;
+    /** Number of blocks that are currently in use. */
+    uint16_t usedBlocks;
+    /** Maximum number of blocks that have been in use at the same time. */
+    uint16_t maxUsedBlocks;
+};
+
+/**
+ * Lock-free pool of reference counted memory blocks for message payloads that exceed
+ * core::Message::MAX_PAYLOAD_SIZE.
+ *
+ * The memory is divided into size classes. Size class i consists of blocks of
+ * (minBlockSize << i) bytes, an allocation is served by the smallest size class with a free block
+ * that is big enough. Each size class keeps its free blocks in a list whose head is changed with
+ * compare and swap only, together with a tag that protects against ABA. The pool can therefore
+ * be used concurrently from all tasks and cores, as long as it is located in memory that is shared
+ * between them.
+ *
+ * A block is identified by its offset from the beginning of the memory, which can be stored in a
+ * core::Message::ExternalHandle. Each block has a reference count, which is set to one on
+ * allocation. The block is returned to its size class once all references have been released.
+ *
+ * \see declare::PayloadPool
+ */
+class PayloadPool
+{
+public:
+    /** Offset returned if an allocation fails. */
+    static constexpr ptrdiff_t INVALID_OFFSET = -1;
+
+    /** Management data of a single block. */
+    struct Block
+    {
+        /** Index of the next free block within the size class. */
+        ::etl::atomic<uint16_t> next;
+        /** Number of references to the block, zero if the block is free. */
+        ::etl::atomic<uint16_t> referenceCount;
+    };
+
+    /** Free list and statistics of one size class. */
+    class SizeClass
+    {
+    public:
+        SizeClass();
+
+        SizeClass(SizeClass const&)            = delete;
+        SizeClass& operator=(SizeClass const&) = delete;
+
+    private:
+        friend class PayloadPool;
+
+        uint16_t pop();
+        void push(uint16_t index);
+
+        ::etl::span<Block> _blocks;
+        size_t _blockSize;
+        size_t _offset;
+        ::etl::atomic<uint32_t> _freeList;
+        ::etl::atomic<uint32_t> _allocations;
+        ::etl::atomic<uint32_t> _failedAllocations;
+        ::etl::atomic<uint16_t> _usedBlocks;
+        ::etl::atomic<uint16_t> _maxUsedBlocks;
+    };
+
+    PayloadPool(PayloadPool const&)            = delete;
+    PayloadPool& operator=(PayloadPool const&) = delete;
+
+    /**
+     * Allocates a block of at least \p size bytes with a reference count of one.
+     *
+     * \return the offset of the block or INVALID_OFFSET if no block is available
+     */
+    ptrdiff_t allocate(size_t size);
+
+    /**
+     * Adds \p count references to the block at \p offset.
+     *
+     * \return false if \p offset doesn't refer to an allocated block
+     */
+    bool acquire(ptrdiff_t offset, uint16_t count = 1U);
+
+    /**
+     * Releases one reference to the block at \p offset. The block is freed with the last one.
+     *
+     * \return false if \p offset doesn't refer to an allocated block
+     */
+    bool release(ptrdiff_t offset);
+
+    /**
+     * Returns the first \p size bytes of the block at \p offset or an empty span if \p offset
+     * doesn't refer to an allocated block or the block is smaller than \p size.
+     */
+    ::etl::span<uint8_t> getMemory(ptrdiff_t offset, size_t size) const;
+
+    /** Returns the number of references to the block at \p offset, zero for invalid offsets. */
+    uint16_t getReferenceCount(ptrdiff_t offset) const;
+
+    /** Returns the size of the biggest block. */
+    size_t getMaxSize() const;
+
+    /** Returns the number of size classes. */
+    size_t getSizeClassCount() const { return _sizeClasses.size(); }
+
+    /** Returns the statistics of the size class with index \p sizeClass. */
+    PayloadPoolStats getStats(size_t sizeClass) const;
+
+    /**
+     * Resets the allocation counters and sets the maximum number of used blocks to the current
+     * number of each size class.
+     */
+    void resetStats();
+
+protected:
+    PayloadPool(::etl::span<SizeClass> sizeClasses, ::etl::span<uint8_t> memory);
+
+    /**
+     * Divides the memory into blocks, size class i gets \p blockCounts[i] blocks of
+     * (\p minBlockSize << i) bytes and their management data is taken from \p blocks. Must be
+     * called by the derived class once the size classes and blocks have been constructed.
+     */
+    void init(
+        size_t minBlockSize, ::etl::span<uint16_t const> blockCounts, ::etl::span<Block> blocks);
+
+private:
+    /**
+     * Returns the size class of the block at \p offset and sets \p index to the index of the
+     * block within it, or returns nullptr if \p offset doesn't refer to the start of a block.
+     */
+    SizeClass* findSizeClass(ptrdiff_t offset, size_t& index) const;
+
+    ::etl::span<SizeClass> _sizeClasses;
+    ::etl::span<uint8_t> _memory;
+};
+
+namespace internal
+{
+constexpr size_t getBlockCount() { return 0U; }
+
+template<class... Counts>
+constexpr size_t getBlockCount(uint16_t const count, Counts const... counts)
+{
+    return count + getBlockCount(counts...);
+}
+
+constexpr size_t getMemorySize(size_t const) { return 0U; }
+
+template<class... Counts>
+constexpr size_t getMemorySize(size_t const blockSize, uint16_t const count, Counts const... counts)
+{
+    return (count * blockSize) + getMemorySize(blockSize * 2U, counts...);
+}
+} // namespace internal
+
+namespace declare
+{
+/**
+ * A PayloadPool with its own memory. Size class i has BlockCounts[i] blocks of
+ * (MinBlockSize << i) bytes.
+ *
+ * \tparam MinBlockSize Size of the blocks of the smallest size class, multiple of 8.
+ * \tparam BlockCounts  Number of blocks of each size class.
+ */
+template<size_t MinBlockSize, uint16_t... BlockCounts>
+class PayloadPool : public ::middleware::memory::PayloadPool
+{
+    static_assert(sizeof...(BlockCounts) > 0U, "At least one size class is required");
+    static_assert(
+        (MinBlockSize > 0U) && ((MinBlockSize % 8U) == 0U),
+        "MinBlockSize must be a multiple of 8");
+
+public:
+    /** Number of blocks of each size class. */
+    static constexpr uint16_t BLOCK_COUNTS[] = {BlockCounts...};
+    /** Total number of blocks. */
+    static constexpr size_t BLOCK_COUNT = internal::getBlockCount(BlockCounts...);
+    /** Size of the memory of all blocks. */
+    static constexpr size_t MEMORY_SIZE = internal::getMemorySize(MinBlockSize, BlockCounts...);
+
+    static_assert(BLOCK_COUNT > 0U, "At least one block is required");
+
+    PayloadPool()
+    : ::middleware::memory::PayloadPool(
+        ::etl::span<SizeClass>(_sizeClasses), ::etl::span<uint8_t>(_memory))
+    {
+        init(MinBlockSize, ::etl::span<uint16_t const>(BLOCK_COUNTS), ::etl::span<Block>(_blocks));
+    }
+
+private:
+    SizeClass _sizeClasses[sizeof...(BlockCounts)];
+    Block _blocks[BLOCK_COUNT];
+    alignas(8) uint8_t _memory[MEMORY_SIZE];
+};
+
+template<size_t MinBlockSize, uint16_t... BlockCounts>
+constexpr uint16_t PayloadPool<MinBlockSize, BlockCounts...>::BLOCK_COUNTS[];
+
+template<size_t MinBlockSize, uint16_t... BlockCounts>
+constexpr size_t PayloadPool<MinBlockSize, BlockCounts...>::BLOCK_COUNT;
+
+template<size_t MinBlockSize, uint16_t... BlockCounts>
+constexpr size_t PayloadPool<MinBlockSize, BlockCounts...>::MEMORY_SIZE;
+} // namespace declare
+
+/**
+ * Get the payload pool.
+ * Platform-specific function that returns the pool used for message payloads that don't fit
+ * into a message. The pool must be located in memory that is shared between all clusters which
+ * exchange such messages. The implementation must be provided for each platform integration and
+ * may return nullptr if no external payloads are used.
+ *
+ * \return pointer to the payload pool
+ */
+extern PayloadPool* getPayloadPool();
+
+} // namespace memory
+} // namespace middleware
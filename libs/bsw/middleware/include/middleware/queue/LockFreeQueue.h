@@ -0,0 +1,274 @@
+// Copyright 2025 BMW AG
+
+#pragma once
+
+#include "middleware/queue/Queue.h"
+#include "middleware/queue/QueueBase.h"
+
+#include <etl/array.h>
+#include <etl/type_traits.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace middleware
+{
+namespace queue
+{
+
+/**
+ * A multi-producer single-consumer queue that doesn't need a lock.
+ * It provides the same Sender, Receiver and QueueStats interface as Queue and is declared with
+ * the same QueueTraits, whose LockStrategy must be void.
+ *
+ * The queue is a bounded ring of slots, each tagged with a sequence number. A producer claims
+ * the slot at the writing position by advancing it with compare and swap, copies the element and
+ * publishes it by setting the sequence number of the slot. The consumer reads a slot once it is
+ * published and hands it back to the producers by setting the sequence number of the next round.
+ * The reading and writing positions are placed in separate cache lines, so producers and the
+ * consumer don't invalidate each other's cache lines when only one side is active.
+ *
+ * Elements are read in the order their slots have been claimed. A producer that is interrupted
+ * between claiming and publishing a slot therefore delays the reading of all elements written
+ * after it until it has published its element.
+ *
+ * \tparam Traits which will be of QueueTraits type, ELEMENT_COUNT must be a power of two.
+ */
+template<typename Traits>
+class LockFreeQueue final
+{
+public:
+    using QueueItem                  = typename Traits::T;
+    static constexpr size_t MAX_SIZE = Traits::ELEMENT_COUNT;
+
+    /** Size of the cache lines the positions are aligned to. */
+    static constexpr size_t CACHE_LINE_SIZE = 64U;
+
+    static_assert(
+        etl::is_void<typename Traits::LockStrategy>::value,
+        "LockFreeQueue doesn't use a LockStrategy");
+    static_assert(
+        (MAX_SIZE > 0U) && ((MAX_SIZE & (MAX_SIZE - 1U)) == 0U),
+        "ELEMENT_COUNT must be a power of two");
+
+    /**
+     * Default constructor is intentionally empty, since queues will be placed in shared RAM
+     * and they will be asynchronously initialized by all cores.
+     *
+     */
+    LockFreeQueue() {}
+
+    /**
+     * Init method which needs to be called before doing any work with the queue.
+     *
+     */
+    void init(char const* const = nullptr)
+    {
+        for (size_t i = 0U; i < MAX_SIZE; ++i)
+        {
+            _slots[i].item = QueueItem{};
+            store(_slots[i].sequence, static_cast<uint32_t>(i));
+        }
+        store(_received, 0U);
+        store(_sent, 0U);
+        resetStats();
+    }
+
+    /**
+     * Returns a const reference to the queue statistics, which is updated with the values
+     * counted by the producers.
+     * \remark Must be called by the consumer only.
+     *
+     */
+    QueueStats const& getStats() const
+    {
+        _stats.lostMessages = __atomic_load_n(&_lostMessages, __ATOMIC_RELAXED);
+        _stats.maxLoad      = __atomic_load_n(&_maxLoad, __ATOMIC_RELAXED);
+        _stats.startupLoad  = __atomic_load_n(&_startupLoad, __ATOMIC_RELAXED);
+        return _stats;
+    }
+
+    /**
+     * Resets the queues statistics.
+     * \remark Must be called by the consumer only.
+     *
+     */
+    void resetStats()
+    {
+        _stats = QueueStats();
+        __atomic_store_n(&_lostMessages, 0U, __ATOMIC_RELAXED);
+        __atomic_store_n(&_maxLoad, 0U, __ATOMIC_RELAXED);
+        __atomic_store_n(&_startupLoad, 0U, __ATOMIC_RELAXED);
+    }
+
+    /**
+     * Returns the current number of elements in the queue, including elements that are being
+     * written.
+     */
+    uint32_t size() const { return load(_sent) - load(_received); }
+
+    /** Returns true if the queue is full, false otherwise. */
+    bool isFull() const { return size() >= MAX_SIZE; }
+
+    /** Returns true if the next element to read hasn't been published yet. */
+    bool isEmpty() const
+    {
+        uint32_t const received = load(_received);
+        return load(_slots[received % MAX_SIZE].sequence) != (received + 1U);
+    }
+
+    /**
+     * Update some of the statistic values of the queue, like the max fill rate and the
+     * processingCounter. This method is useful to be called before processing the queue
+     * elements (reading and advancing).
+     * \remark Must be called by the consumer only.
+     *
+     */
+    void takeSnapshot() { updateSnapshotStats(_stats, size()); }
+
+    /**
+     * Nested class to read elements from the queue.
+     * After reading an element, the advance method needs to be called in order to clear
+     * the current element in the queue and get the to next element.
+     *
+     */
+    class Receiver
+    {
+    public:
+        explicit constexpr Receiver(LockFreeQueue& queue) : _queue(queue) {}
+
+        /** Returns the current number of elements in the queue. */
+        uint32_t size() const { return _queue.size(); }
+
+        /** Returns true if the queue is empty. */
+        bool isEmpty() const { return _queue.isEmpty(); }
+
+        /** Returns a const reference to the top element, which must have been published. */
+        QueueItem const& peek() const { return _queue._slots[_queue._received % MAX_SIZE].item; }
+
+        /** Advances the reading cursor, effectively removing the top element. */
+        void advance()
+        {
+            uint32_t const received = _queue._received;
+            // hand the slot over to the producers of the next round
+            store(_queue._slots[received % MAX_SIZE].sequence, received + MAX_SIZE);
+            store(_queue._received, received + 1U);
+            ++_queue._stats.processedMessages;
+        }
+
+    private:
+        LockFreeQueue& _queue;
+    };
+
+    /**
+     * Nested class to write elements to the queue.
+     * Any number of senders may write to the queue concurrently.
+     *
+     */
+    class Sender
+    {
+    public:
+        explicit constexpr Sender(LockFreeQueue& queue) : _queue(queue) {}
+
+        /** Returns the current number of elements in the queue. */
+        uint32_t size() const { return _queue.size(); }
+
+        /** Returns true if the queue is full. */
+        bool isFull() const { return _queue.isFull(); }
+
+        /** Appends \p value to the queue, returns true on success. */
+        bool write(QueueItem const& value)
+        {
+            uint32_t sent = __atomic_load_n(&_queue._sent, __ATOMIC_RELAXED);
+            while (true)
+            {
+                Slot& slot              = _queue._slots[sent % MAX_SIZE];
+                uint32_t const sequence = load(slot.sequence);
+                auto const difference
+                    = static_cast<int32_t>(static_cast<uint32_t>(sequence - sent));
+                if (difference == 0)
+                {
+                    if (__atomic_compare_exchange_n(
+                            &_queue._sent,
+                            &sent,
+                            sent + 1U,
+                            true,
+                            __ATOMIC_RELAXED,
+                            __ATOMIC_RELAXED))
+                    {
+                        slot.item = value;
+                        store(slot.sequence, sent + 1U);
+                        _queue.updateWriteStats();
+                        return true;
+                    }
+                    // sent has been reloaded by the failed compare and swap
+                }
+                else if (difference < 0)
+                {
+                    // the slot still holds the element of the previous round
+                    static_cast<void>(
+                        __atomic_fetch_add(&_queue._lostMessages, 1U, __ATOMIC_RELAXED));
+                    return false;
+                }
+                else
+                {
+                    // another producer claimed the slot meanwhile
+                    sent = __atomic_load_n(&_queue._sent, __ATOMIC_RELAXED);
+                }
+            }
+        }
+
+    private:
+        LockFreeQueue& _queue;
+    };
+
+private:
+    struct Slot
+    {
+        uint32_t sequence;
+        QueueItem item;
+    };
+
+    static uint32_t load(uint32_t const& value)
+    {
+        return __atomic_load_n(&value, __ATOMIC_ACQUIRE);
+    }
+
+    static void store(uint32_t& value, uint32_t const newValue)
+    {
+        __atomic_store_n(&value, newValue, __ATOMIC_RELEASE);
+    }
+
+    void updateWriteStats()
+    {
+        auto const currentSize = static_cast<uint8_t>(size());
+        uint8_t maxLoad        = __atomic_load_n(&_maxLoad, __ATOMIC_RELAXED);
+        while ((currentSize > maxLoad)
+               && (!__atomic_compare_exchange_n(
+                   &_maxLoad, &maxLoad, currentSize, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)))
+        {}
+        if (0U == load(_received))
+        {
+            static_cast<void>(__atomic_fetch_add(&_startupLoad, 1U, __ATOMIC_RELAXED));
+        }
+    }
+
+    // written by the producers
+    alignas(CACHE_LINE_SIZE) uint32_t _sent;
+    uint32_t _lostMessages;
+    uint8_t _maxLoad;
+    uint8_t _startupLoad;
+    // written by the consumer
+    alignas(CACHE_LINE_SIZE) uint32_t _received;
+    mutable QueueStats _stats;
+    alignas(CACHE_LINE_SIZE) etl::array<Slot, MAX_SIZE> _slots;
+};
+
+template<typename Traits>
+constexpr size_t LockFreeQueue<Traits>::MAX_SIZE;
+
+template<typename Traits>
+constexpr size_t LockFreeQueue<Traits>::CACHE_LINE_SIZE;
+
+} // namespace queue
+} // namespace middleware
@@ -30,6 +30,39 @@ struct QueueStats
     uint8_t maxFillRate;
 };
 
+/**
+ * Updates the snapshot related values of \p stats, like the max fill rate and the
+ * processingCounter, with the \p currentSize of a queue.
+ *
+ */
+inline void updateSnapshotStats(QueueStats& stats, uint32_t const currentSize)
+{
+    if (0U != currentSize)
+    {
+        stats.loadSnapshot += static_cast<uint16_t>(currentSize);
+        ++stats.processingCounter;
+    }
+    stats.realLoadSnapshot += static_cast<uint16_t>(currentSize);
+    ++stats.realProcessingCounter;
+    if (stats.previousSnapshot == 0U)
+    {
+        stats.maxFillRate      = static_cast<uint8_t>(currentSize);
+        stats.previousSnapshot = static_cast<uint8_t>(currentSize);
+    }
+    else
+    {
+        if (currentSize > stats.previousSnapshot)
+        {
+            auto const diff = (currentSize - stats.previousSnapshot);
+            if (diff > stats.maxFillRate)
+            {
+                stats.maxFillRate = static_cast<uint8_t>(diff);
+            }
+        }
+        stats.previousSnapshot = static_cast<uint8_t>(currentSize);
+    }
+}
+
 /**
  * Base class for a multi-producer single-consumer queue, that is based on a circular buffer
  * implementation. This class contains a sent_ and received_ attributes which represent
@@ -91,34 +124,7 @@ public:
      * called by a unique consumer.
      *
      */
-    void takeSnapshot()
-    {
-        uint32_t const currentSize = size();
-        if (0U != currentSize)
-        {
-            _stats.loadSnapshot += static_cast<uint16_t>(currentSize);
-            ++_stats.processingCounter;
-        }
-        _stats.realLoadSnapshot += static_cast<uint16_t>(currentSize);
-        ++_stats.realProcessingCounter;
-        if (_stats.previousSnapshot == 0U)
-        {
-            _stats.maxFillRate      = static_cast<uint8_t>(currentSize);
-            _stats.previousSnapshot = static_cast<uint8_t>(currentSize);
-        }
-        else
-        {
-            if (currentSize > _stats.previousSnapshot)
-            {
-                auto const diff = (currentSize - _stats.previousSnapshot);
-                if (diff > _stats.maxFillRate)
-                {
-                    _stats.maxFillRate = static_cast<uint8_t>(diff);
-                }
-            }
-            _stats.previousSnapshot = static_cast<uint8_t>(currentSize);
-        }
-    }
+    void takeSnapshot() { updateSnapshotStats(_stats, size()); }
 
 protected:
     QueueBase() {}
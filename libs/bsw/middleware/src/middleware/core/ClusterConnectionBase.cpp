@@ -9,7 +9,7 @@
 #include "middleware/core/ITimeoutHandler.h"
 #include "middleware/core/LoggerApi.h"
 #include "middleware/core/Message.h"
-// #include "middleware/core/MessageAllocator.h"
+#include "middleware/core/MessageAllocator.h"
 #include "middleware/core/types.h"
 #include "middleware/logger/Logger.h"
 
@@ -25,7 +25,7 @@ ClusterConnectionBase::ClusterConnectionBase(IClusterConnectionConfigurationBase
 void ClusterConnectionBase::processMessage(Message const& msg) const
 {
     static_cast<void>(dispatchMessage(msg));
-    // MessageAllocator::deallocate(msg);
+    static_cast<void>(MessageAllocator::deallocate(msg));
 }
 
 void ClusterConnectionBase::respondWithError(ErrorState const error, Message const& msg) const
@@ -53,7 +53,7 @@ HRESULT ClusterConnectionBase::sendMessage(Message const& msg) const
     if ((msg.getHeader().srcClusterId == msg.getHeader().tgtClusterId))
     {
         res = dispatchMessage(msg);
-        // MessageAllocator::deallocate(msg);
+        static_cast<void>(MessageAllocator::deallocate(msg));
     }
     else
     {
@@ -63,6 +63,8 @@ HRESULT ClusterConnectionBase::sendMessage(Message const& msg) const
         }
         else
         {
+            // the receiving cluster won't release the payload of a message it never gets
+            static_cast<void>(MessageAllocator::deallocate(msg));
             logger::logMessageSendingFailure(
                 logger::LogLevel::Error, logger::Error::SendMessage, res, msg);
         }
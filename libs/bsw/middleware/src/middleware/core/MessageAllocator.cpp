@@ -0,0 +1,108 @@
+// Copyright 2025 BMW AG
+
+#include "middleware/core/MessageAllocator.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#include <etl/span.h>
+
+#include "middleware/core/LoggerApi.h"
+#include "middleware/core/Message.h"
+#include "middleware/core/types.h"
+#include "middleware/logger/Logger.h"
+#include "middleware/memory/PayloadPool.h"
+
+namespace middleware
+{
+namespace core
+{
+
+HRESULT MessageAllocator::allocate(Message& msg, size_t const size, etl::span<uint8_t>& payload)
+{
+    if (size <= Message::MAX_PAYLOAD_SIZE)
+    {
+        msg.unsetFlag(Message::Flags::UniqueExternalPayload);
+        msg.unsetFlag(Message::Flags::SharedExternalPayload);
+        payload = etl::span<uint8_t>(msg._payload.internalBuffer.data(), size);
+        return HRESULT::Ok;
+    }
+
+    memory::PayloadPool* const pool = memory::getPayloadPool();
+    ptrdiff_t const offset
+        = (pool != nullptr) ? pool->allocate(size) : memory::PayloadPool::INVALID_OFFSET;
+    if (offset == memory::PayloadPool::INVALID_OFFSET)
+    {
+        payload = etl::span<uint8_t>();
+        logger::logAllocationFailure(
+            logger::LogLevel::Error,
+            logger::Error::Allocation,
+            HRESULT::CannotAllocatePayload,
+            msg,
+            static_cast<uint32_t>(size));
+        return HRESULT::CannotAllocatePayload;
+    }
+
+    msg.unsetFlag(Message::Flags::SharedExternalPayload);
+    msg.setExternalHandle(offset, size, false);
+    payload = pool->getMemory(offset, size);
+    return HRESULT::Ok;
+}
+
+HRESULT MessageAllocator::share(Message& msg, uint16_t const count)
+{
+    if (!hasExternalPayload(msg))
+    {
+        return HRESULT::Ok;
+    }
+
+    memory::PayloadPool* const pool = memory::getPayloadPool();
+    if ((pool == nullptr) || (!pool->acquire(msg.getExternalHandle().offset, count)))
+    {
+        return HRESULT::InvalidPayload;
+    }
+    msg.unsetFlag(Message::Flags::UniqueExternalPayload);
+    msg.setFlag(Message::Flags::SharedExternalPayload);
+    return HRESULT::Ok;
+}
+
+etl::span<uint8_t const> MessageAllocator::getPayload(Message const& msg)
+{
+    memory::PayloadPool* const pool = memory::getPayloadPool();
+    if ((!hasExternalPayload(msg)) || (pool == nullptr))
+    {
+        return etl::span<uint8_t const>();
+    }
+    Message::ExternalHandle const& handle = msg.getExternalHandle();
+    return pool->getMemory(handle.offset, handle.size);
+}
+
+HRESULT MessageAllocator::deallocate(Message const& msg)
+{
+    if (!hasExternalPayload(msg))
+    {
+        return HRESULT::Ok;
+    }
+
+    memory::PayloadPool* const pool       = memory::getPayloadPool();
+    Message::ExternalHandle const& handle = msg.getExternalHandle();
+    if ((pool == nullptr) || (!pool->release(handle.offset)))
+    {
+        logger::logAllocationFailure(
+            logger::LogLevel::Error,
+            logger::Error::Deallocation,
+            HRESULT::CannotDeallocatePayload,
+            msg,
+            static_cast<uint32_t>(handle.size));
+        return HRESULT::CannotDeallocatePayload;
+    }
+    return HRESULT::Ok;
+}
+
+bool MessageAllocator::hasExternalPayload(Message const& msg)
+{
+    return (!msg.isError()) && (msg.hasUniqueExternalPayload() || msg.hasSharedExternalPayload());
+}
+
+} // namespace core
+} // namespace middleware
@@ -0,0 +1,268 @@
+// Copyright 2025 BMW AG
+
+#include "middleware/memory/PayloadPool.h"
+
+#include <etl/atomic.h>
+#include <etl/span.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace middleware
+{
+namespace memory
+{
+namespace
+{
+constexpr uint16_t NO_BLOCK    = 0xFFFFU;
+constexpr uint32_t INDEX_MASK  = 0x0000FFFFU;
+constexpr uint32_t TAG_MASK    = 0xFFFF0000U;
+constexpr uint32_t TAG_ADVANCE = 0x00010000U;
+
+/** Returns a new free list head with \p index and the tag of \p head advanced by one. */
+uint32_t makeHead(uint32_t const head, uint16_t const index)
+{
+    return ((head + TAG_ADVANCE) & TAG_MASK) | index;
+}
+} // namespace
+
+constexpr ptrdiff_t PayloadPool::INVALID_OFFSET;
+
+PayloadPool::SizeClass::SizeClass()
+: _blocks()
+, _blockSize(0U)
+, _offset(0U)
+, _freeList(NO_BLOCK)
+, _allocations(0U)
+, _failedAllocations(0U)
+, _usedBlocks(0U)
+, _maxUsedBlocks(0U)
+{}
+
+uint16_t PayloadPool::SizeClass::pop()
+{
+    uint32_t head = _freeList.load();
+    while (true)
+    {
+        auto const index = static_cast<uint16_t>(head & INDEX_MASK);
+        if (index == NO_BLOCK)
+        {
+            return NO_BLOCK;
+        }
+        // next may be outdated if the block has been taken meanwhile, the tag will differ then
+        uint16_t const next = _blocks[index].next.load();
+        if (_freeList.compare_exchange_weak(head, makeHead(head, next)))
+        {
+            return index;
+        }
+    }
+}
+
+void PayloadPool::SizeClass::push(uint16_t const index)
+{
+    uint32_t head = _freeList.load();
+    do
+    {
+        _blocks[index].next.store(static_cast<uint16_t>(head & INDEX_MASK));
+    } while (!_freeList.compare_exchange_weak(head, makeHead(head, index)));
+}
+
+PayloadPool::PayloadPool(
+    ::etl::span<SizeClass> const sizeClasses, ::etl::span<uint8_t> const memory)
+: _sizeClasses(sizeClasses), _memory(memory)
+{}
+
+void PayloadPool::init(
+    size_t const minBlockSize,
+    ::etl::span<uint16_t const> const blockCounts,
+    ::etl::span<Block> const blocks)
+{
+    size_t blockSize  = minBlockSize;
+    size_t offset     = 0U;
+    size_t firstBlock = 0U;
+    for (size_t i = 0U; i < _sizeClasses.size(); ++i)
+    {
+        SizeClass& sizeClass = _sizeClasses[i];
+        sizeClass._blocks    = blocks.subspan(firstBlock, blockCounts[i]);
+        sizeClass._blockSize = blockSize;
+        sizeClass._offset    = offset;
+        for (size_t index = sizeClass._blocks.size(); index > 0U; --index)
+        {
+            sizeClass._blocks[index - 1U].referenceCount.store(0U);
+            sizeClass.push(static_cast<uint16_t>(index - 1U));
+        }
+        firstBlock += blockCounts[i];
+        offset += blockCounts[i] * blockSize;
+        blockSize *= 2U;
+    }
+}
+
+ptrdiff_t PayloadPool::allocate(size_t const size)
+{
+    SizeClass* firstFit = nullptr;
+    for (SizeClass& sizeClass : _sizeClasses)
+    {
+        if ((sizeClass._blockSize < size) || sizeClass._blocks.empty())
+        {
+            continue;
+        }
+        if (firstFit == nullptr)
+        {
+            firstFit = &sizeClass;
+        }
+        uint16_t const index = sizeClass.pop();
+        if (index != NO_BLOCK)
+        {
+            sizeClass._blocks[index].referenceCount.store(1U);
+            ++sizeClass._allocations;
+            uint16_t const usedBlocks = ++sizeClass._usedBlocks;
+            uint16_t maxUsedBlocks    = sizeClass._maxUsedBlocks.load();
+            while ((usedBlocks > maxUsedBlocks)
+                   && (!sizeClass._maxUsedBlocks.compare_exchange_weak(maxUsedBlocks, usedBlocks)))
+            {}
+            return static_cast<ptrdiff_t>(sizeClass._offset + (index * sizeClass._blockSize));
+        }
+    }
+    if ((firstFit == nullptr) && (!_sizeClasses.empty()))
+    {
+        // requests that exceed all blocks are accounted to the biggest size class
+        firstFit = &_sizeClasses[_sizeClasses.size() - 1U];
+    }
+    if (firstFit != nullptr)
+    {
+        ++firstFit->_failedAllocations;
+    }
+    return INVALID_OFFSET;
+}
+
+bool PayloadPool::acquire(ptrdiff_t const offset, uint16_t const count)
+{
+    size_t index               = 0U;
+    SizeClass* const sizeClass = findSizeClass(offset, index);
+    if (sizeClass == nullptr)
+    {
+        return false;
+    }
+    Block& block            = sizeClass->_blocks[index];
+    uint16_t referenceCount = block.referenceCount.load();
+    do
+    {
+        if (referenceCount == 0U)
+        {
+            return false;
+        }
+    } while (!block.referenceCount.compare_exchange_weak(
+        referenceCount, static_cast<uint16_t>(referenceCount + count)));
+    return true;
+}
+
+bool PayloadPool::release(ptrdiff_t const offset)
+{
+    size_t index               = 0U;
+    SizeClass* const sizeClass = findSizeClass(offset, index);
+    if (sizeClass == nullptr)
+    {
+        return false;
+    }
+    Block& block            = sizeClass->_blocks[index];
+    uint16_t referenceCount = block.referenceCount.load();
+    do
+    {
+        if (referenceCount == 0U)
+        {
+            return false;
+        }
+    } while (!block.referenceCount.compare_exchange_weak(
+        referenceCount, static_cast<uint16_t>(referenceCount - 1U)));
+
+    if (referenceCount == 1U)
+    {
+        --sizeClass->_usedBlocks;
+        sizeClass->push(static_cast<uint16_t>(index));
+    }
+    return true;
+}
+
+::etl::span<uint8_t> PayloadPool::getMemory(ptrdiff_t const offset, size_t const size) const
+{
+    size_t index                     = 0U;
+    SizeClass const* const sizeClass = findSizeClass(offset, index);
+    if ((sizeClass == nullptr) || (size > sizeClass->_blockSize)
+        || (sizeClass->_blocks[index].referenceCount.load() == 0U))
+    {
+        return ::etl::span<uint8_t>();
+    }
+    return _memory.subspan(static_cast<size_t>(offset), size);
+}
+
+uint16_t PayloadPool::getReferenceCount(ptrdiff_t const offset) const
+{
+    size_t index                     = 0U;
+    SizeClass const* const sizeClass = findSizeClass(offset, index);
+    return (sizeClass != nullptr) ? sizeClass->_blocks[index].referenceCount.load() : 0U;
+}
+
+size_t PayloadPool::getMaxSize() const
+{
+    size_t maxSize = 0U;
+    for (SizeClass const& sizeClass : _sizeClasses)
+    {
+        if (!sizeClass._blocks.empty())
+        {
+            maxSize = sizeClass._blockSize;
+        }
+    }
+    return maxSize;
+}
+
+PayloadPoolStats PayloadPool::getStats(size_t const sizeClass) const
+{
+    PayloadPoolStats stats{};
+    if (sizeClass < _sizeClasses.size())
+    {
+        SizeClass const& data   = _sizeClasses[sizeClass];
+        stats.blockSize         = static_cast<uint32_t>(data._blockSize);
+        stats.allocations       = data._allocations.load();
+        stats.failedAllocations = data._failedAllocations.load();
+        stats.blockCount        = static_cast<uint16_t>(data._blocks.size());
+        stats.usedBlocks        = data._usedBlocks.load();
+        stats.maxUsedBlocks     = data._maxUsedBlocks.load();
+    }
+    return stats;
+}
+
+void PayloadPool::resetStats()
+{
+    for (SizeClass& sizeClass : _sizeClasses)
+    {
+        sizeClass._allocations.store(0U);
+        sizeClass._failedAllocations.store(0U);
+        sizeClass._maxUsedBlocks.store(sizeClass._usedBlocks.load());
+    }
+}
+
+PayloadPool::SizeClass* PayloadPool::findSizeClass(ptrdiff_t const offset, size_t& index) const
+{
+    if (offset < 0)
+    {
+        return nullptr;
+    }
+    auto const position = static_cast<size_t>(offset);
+    for (SizeClass& sizeClass : _sizeClasses)
+    {
+        if (position < sizeClass._offset)
+        {
+            break;
+        }
+        size_t const relative = position - sizeClass._offset;
+        index                 = relative / sizeClass._blockSize;
+        if (index < sizeClass._blocks.size())
+        {
+            return ((relative % sizeClass._blockSize) == 0U) ? &sizeClass : nullptr;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace memory
+} // namespace middleware
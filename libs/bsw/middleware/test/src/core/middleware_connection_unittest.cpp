@@ -1,6 +1,7 @@
 #include <cstdint>
 
 #include <etl/optional.h>
+#include <etl/span.h>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -8,6 +9,7 @@
 #include "middleware/core/ClusterConnection.h"
 #include "middleware/core/IClusterConnectionConfigurationBase.h"
 #include "middleware/core/Message.h"
+#include "middleware/core/MessageAllocator.h"
 #include "middleware/core/ProxyBase.h"
 #include "middleware/core/SkeletonBase.h"
 #include "middleware/core/TransceiverContainer.h"
@@ -691,6 +693,65 @@ TEST_F(ConnectionBaseTest, processMessageFromReceivingSide)
     EXPECT_EQ(lastReceivedMsg.value().getErrorState(), ErrorState::NoError);
 }
 
+TEST_F(ConnectionBaseTest, processMessageReleasesExternalPayload)
+{
+    Message msg = Message::createRequest(
+        1,
+        123,
+        321,
+        2,
+        ClusterConfigurationMockBase::sourceClusterId,
+        ClusterConfigurationMockBase::sourceClusterId,
+        4);
+    etl::span<uint8_t> payload;
+    ASSERT_EQ(HRESULT::Ok, MessageAllocator::allocate(msg, 100U, payload));
+
+    SkeletonMock skeletonInstance(1, 2);
+    ClusterConnectionConfigurationSkeletonOnlyMock confSkeletonOnly;
+    ::middleware::core::ClusterConnectionTypeSelector<
+        ClusterConnectionConfigurationSkeletonOnlyMock>::type actualConnection(confSkeletonOnly);
+    ::middleware::core::IClusterConnection* ptrToBase = &actualConnection;
+
+    EXPECT_EQ(::middleware::core::HRESULT::Ok, actualConnection.subscribe(skeletonInstance, 1));
+    ptrToBase->processMessage(msg);
+
+    EXPECT_TRUE(MessageAllocator::getPayload(msg).empty());
+}
+
+TEST_F(ConnectionBaseTest, SendMessageClusterToClusterFailedReleasesExternalPayload)
+{
+    Message msg = Message::createRequest(
+        1,
+        123,
+        321,
+        2,
+        ClusterConfigurationMockBase::sourceClusterId,
+        ClusterConfigurationMockBase::targetClusterId,
+        4);
+    etl::span<uint8_t> payload;
+    ASSERT_EQ(HRESULT::Ok, MessageAllocator::allocate(msg, 100U, payload));
+    // one reference for each of the two sends below
+    ASSERT_EQ(HRESULT::Ok, MessageAllocator::share(msg));
+
+    SkeletonMock skeletonInstance(1, 2);
+    ClusterConnectionConfigurationSkeletonOnlyMock confSkeletonOnly;
+    ::middleware::core::ClusterConnectionTypeSelector<
+        ClusterConnectionConfigurationSkeletonOnlyMock>::type actualConnection(confSkeletonOnly);
+    ::middleware::core::IClusterConnection* ptrToBase = &actualConnection;
+
+    EXPECT_EQ(::middleware::core::HRESULT::Ok, actualConnection.subscribe(skeletonInstance, 1));
+
+    // the successfully written message is owned by the receiving cluster
+    EXPECT_EQ(::middleware::core::HRESULT::Ok, ptrToBase->sendMessage(msg));
+    confSkeletonOnly.setNextWriteResult(false);
+    EXPECT_EQ(::middleware::core::HRESULT::QueueFull, ptrToBase->sendMessage(msg));
+    EXPECT_EQ(payload.data(), MessageAllocator::getPayload(msg).data());
+
+    // release the reference of the receiving cluster
+    EXPECT_EQ(HRESULT::Ok, MessageAllocator::deallocate(msg));
+    EXPECT_TRUE(MessageAllocator::getPayload(msg).empty());
+}
+
 TEST_F(ConnectionBaseTest, ProxyRegistersAsTimeoutTransceiver)
 {
     ProxyMockWithTimeout proxyInstance(1, 2);
@@ -0,0 +1,190 @@
+// Copyright 2025 BMW AG
+
+#include "middleware/core/MessageAllocator.h"
+
+#include "logger/DslLogger.h"
+#include "middleware/core/Message.h"
+#include "middleware/core/types.h"
+#include "middleware/memory/PayloadPool.h"
+
+#include <etl/span.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+namespace middleware
+{
+namespace core
+{
+namespace test
+{
+
+class MessageAllocatorTest : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        logger_mock_.setup();
+        memory::getPayloadPool()->resetStats();
+    }
+
+    void TearDown() override
+    {
+        // every test must release all payloads it allocated
+        for (size_t i = 0U; i < memory::getPayloadPool()->getSizeClassCount(); ++i)
+        {
+            EXPECT_EQ(0U, memory::getPayloadPool()->getStats(i).usedBlocks);
+        }
+        logger_mock_.teardown();
+    }
+
+protected:
+    static Message createEvent() { return Message::createEvent(0x1000U, 0x8001U, 0x0001U, 1U); }
+
+    middleware::logger::test::DslLogger logger_mock_{};
+};
+
+/**
+ * \brief Test that small payloads are stored inside the message
+ *
+ */
+TEST_F(MessageAllocatorTest, TestAllocateInternalPayload)
+{
+    // ARRANGE
+    Message msg = createEvent();
+    etl::span<uint8_t> payload;
+    size_t const size = Message::MAX_PAYLOAD_SIZE;
+
+    // ACT
+    HRESULT const res = MessageAllocator::allocate(msg, size, payload);
+
+    // ASSERT
+    EXPECT_EQ(HRESULT::Ok, res);
+    EXPECT_EQ(size, payload.size());
+    EXPECT_FALSE(msg.hasUniqueExternalPayload());
+    EXPECT_FALSE(msg.hasSharedExternalPayload());
+    EXPECT_TRUE(MessageAllocator::getPayload(msg).empty());
+    EXPECT_EQ(0U, memory::getPayloadPool()->getStats(0U).allocations);
+    EXPECT_EQ(HRESULT::Ok, MessageAllocator::deallocate(msg));
+}
+
+/**
+ * \brief Test that big payloads are allocated from the pool and released again
+ *
+ */
+TEST_F(MessageAllocatorTest, TestAllocateExternalPayload)
+{
+    // ARRANGE
+    Message msg = createEvent();
+    etl::span<uint8_t> payload;
+
+    // ACT
+    HRESULT const res = MessageAllocator::allocate(msg, 100U, payload);
+    payload[99U]      = 0xAAU;
+
+    // ASSERT
+    EXPECT_EQ(HRESULT::Ok, res);
+    EXPECT_EQ(100U, payload.size());
+    EXPECT_TRUE(msg.hasUniqueExternalPayload());
+    EXPECT_EQ(100U, MessageAllocator::getPayload(msg).size());
+
+    Message const copy                  = msg;
+    etl::span<uint8_t const> const data = MessageAllocator::getPayload(copy);
+    EXPECT_EQ(payload.data(), data.data());
+    EXPECT_EQ(0xAAU, data[99U]);
+    EXPECT_EQ(1U, memory::getPayloadPool()->getStats(1U).usedBlocks);
+
+    EXPECT_EQ(HRESULT::Ok, MessageAllocator::deallocate(copy));
+    EXPECT_TRUE(MessageAllocator::getPayload(msg).empty());
+}
+
+/**
+ * \brief Test that a shared payload is released after the last message referring to it
+ *
+ */
+TEST_F(MessageAllocatorTest, TestSharePayload)
+{
+    // ARRANGE
+    Message msg = createEvent();
+    etl::span<uint8_t> payload;
+    ASSERT_EQ(HRESULT::Ok, MessageAllocator::allocate(msg, 64U, payload));
+
+    // ACT
+    HRESULT const res = MessageAllocator::share(msg, 2U);
+
+    // ASSERT
+    EXPECT_EQ(HRESULT::Ok, res);
+    EXPECT_FALSE(msg.hasUniqueExternalPayload());
+    EXPECT_TRUE(msg.hasSharedExternalPayload());
+
+    EXPECT_EQ(HRESULT::Ok, MessageAllocator::deallocate(msg));
+    EXPECT_EQ(HRESULT::Ok, MessageAllocator::deallocate(msg));
+    EXPECT_EQ(payload.data(), MessageAllocator::getPayload(msg).data());
+    EXPECT_EQ(1U, memory::getPayloadPool()->getStats(0U).usedBlocks);
+    EXPECT_EQ(HRESULT::Ok, MessageAllocator::deallocate(msg));
+    EXPECT_TRUE(MessageAllocator::getPayload(msg).empty());
+}
+
+/**
+ * \brief Test that sharing an internal payload doesn't change the message
+ *
+ */
+TEST_F(MessageAllocatorTest, TestShareInternalPayload)
+{
+    Message msg = createEvent();
+    etl::span<uint8_t> payload;
+    ASSERT_EQ(HRESULT::Ok, MessageAllocator::allocate(msg, 4U, payload));
+
+    EXPECT_EQ(HRESULT::Ok, MessageAllocator::share(msg));
+    EXPECT_FALSE(msg.hasSharedExternalPayload());
+}
+
+/**
+ * \brief Test that a failed allocation is reported and logged
+ *
+ */
+TEST_F(MessageAllocatorTest, TestAllocateFailure)
+{
+    // ARRANGE
+    Message msg = createEvent();
+    etl::span<uint8_t> payload;
+    size_t const size = memory::getPayloadPool()->getMaxSize() + 1U;
+
+    // ACT && ASSERT
+    logger_mock_.EXPECT_LOG(
+        logger::LogLevel::Error,
+        "e:%d r:%d SC:%d TC:%d S:%d I:%d M:%d R:%d s:%d",
+        logger::Error::Allocation,
+        HRESULT::CannotAllocatePayload,
+        msg.getHeader().srcClusterId,
+        msg.getHeader().tgtClusterId,
+        msg.getHeader().serviceId,
+        msg.getHeader().serviceInstanceId,
+        msg.getHeader().memberId,
+        msg.getHeader().requestId,
+        static_cast<uint32_t>(size));
+    EXPECT_EQ(HRESULT::CannotAllocatePayload, MessageAllocator::allocate(msg, size, payload));
+    EXPECT_TRUE(payload.empty());
+    EXPECT_FALSE(msg.hasUniqueExternalPayload());
+}
+
+/**
+ * \brief Test that releasing a payload twice is reported
+ *
+ */
+TEST_F(MessageAllocatorTest, TestDeallocateTwice)
+{
+    // ARRANGE
+    Message msg = createEvent();
+    etl::span<uint8_t> payload;
+    ASSERT_EQ(HRESULT::Ok, MessageAllocator::allocate(msg, 40U, payload));
+    ASSERT_EQ(HRESULT::Ok, MessageAllocator::deallocate(msg));
+
+    // ACT && ASSERT
+    EXPECT_EQ(HRESULT::CannotDeallocatePayload, MessageAllocator::deallocate(msg));
+    EXPECT_EQ(HRESULT::InvalidPayload, MessageAllocator::share(msg));
+}
+
+} // namespace test
+} // namespace core
+} // namespace middleware
@@ -0,0 +1,17 @@
+// Copyright 2025 BMW AG
+
+#include "middleware/memory/PayloadPool.h"
+
+namespace middleware
+{
+namespace memory
+{
+
+PayloadPool* getPayloadPool()
+{
+    static declare::PayloadPool<64U, 4U, 2U> pool;
+    return &pool;
+}
+
+} // namespace memory
+} // namespace middleware
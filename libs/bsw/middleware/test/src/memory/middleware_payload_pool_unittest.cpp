@@ -0,0 +1,190 @@
+// Copyright 2025 BMW AG
+
+#include "middleware/memory/PayloadPool.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace middleware
+{
+namespace memory
+{
+namespace test
+{
+
+class PayloadPoolTest : public ::testing::Test
+{
+protected:
+    declare::PayloadPool<64U, 2U, 1U> _pool;
+};
+
+/**
+ * \brief Test the layout of the memory of a declared pool
+ *
+ */
+TEST_F(PayloadPoolTest, TestDeclaredSizes)
+{
+    EXPECT_EQ(3U, (declare::PayloadPool<64U, 2U, 1U>::BLOCK_COUNT));
+    EXPECT_EQ(256U, (declare::PayloadPool<64U, 2U, 1U>::MEMORY_SIZE));
+    EXPECT_EQ(2U, _pool.getSizeClassCount());
+    EXPECT_EQ(128U, _pool.getMaxSize());
+
+    PayloadPoolStats const stats = _pool.getStats(1U);
+    EXPECT_EQ(128U, stats.blockSize);
+    EXPECT_EQ(1U, stats.blockCount);
+    EXPECT_EQ(0U, stats.usedBlocks);
+}
+
+/**
+ * \brief Test that allocations are served by the smallest size class with a free block
+ *
+ */
+TEST_F(PayloadPoolTest, TestAllocateFromSmallestFittingSizeClass)
+{
+    // ACT
+    ptrdiff_t const first  = _pool.allocate(33U);
+    ptrdiff_t const second = _pool.allocate(64U);
+    ptrdiff_t const third  = _pool.allocate(10U);
+    ptrdiff_t const fourth = _pool.allocate(1U);
+
+    // ASSERT
+    EXPECT_EQ(0, first);
+    EXPECT_EQ(64, second);
+    EXPECT_EQ(128, third);
+    EXPECT_EQ(PayloadPool::INVALID_OFFSET, fourth);
+    EXPECT_EQ(64U, _pool.getMemory(first, 64U).size());
+    EXPECT_EQ(_pool.getMemory(first, 1U).data() + 64, _pool.getMemory(second, 1U).data());
+    EXPECT_EQ(1U, _pool.getReferenceCount(third));
+
+    PayloadPoolStats const small = _pool.getStats(0U);
+    EXPECT_EQ(2U, small.allocations);
+    EXPECT_EQ(1U, small.failedAllocations);
+    EXPECT_EQ(2U, small.maxUsedBlocks);
+    PayloadPoolStats const big = _pool.getStats(1U);
+    EXPECT_EQ(1U, big.allocations);
+    EXPECT_EQ(0U, big.failedAllocations);
+}
+
+/**
+ * \brief Test that allocations bigger than the biggest block fail
+ *
+ */
+TEST_F(PayloadPoolTest, TestAllocateTooBig)
+{
+    EXPECT_EQ(PayloadPool::INVALID_OFFSET, _pool.allocate(129U));
+    EXPECT_EQ(1U, _pool.getStats(0U).failedAllocations + _pool.getStats(1U).failedAllocations);
+}
+
+/**
+ * \brief Test that a block is freed with the last reference only
+ *
+ */
+TEST_F(PayloadPoolTest, TestReferenceCounting)
+{
+    // ARRANGE
+    ptrdiff_t const offset = _pool.allocate(100U);
+    ASSERT_NE(PayloadPool::INVALID_OFFSET, offset);
+
+    // ACT && ASSERT
+    EXPECT_TRUE(_pool.acquire(offset, 2U));
+    EXPECT_EQ(3U, _pool.getReferenceCount(offset));
+    EXPECT_TRUE(_pool.release(offset));
+    EXPECT_TRUE(_pool.release(offset));
+    EXPECT_EQ(1U, _pool.getStats(1U).usedBlocks);
+    EXPECT_TRUE(_pool.release(offset));
+    EXPECT_EQ(0U, _pool.getStats(1U).usedBlocks);
+    EXPECT_EQ(1U, _pool.getStats(1U).maxUsedBlocks);
+
+    EXPECT_FALSE(_pool.release(offset));
+    EXPECT_FALSE(_pool.acquire(offset));
+    EXPECT_TRUE(_pool.getMemory(offset, 1U).empty());
+    EXPECT_EQ(offset, _pool.allocate(100U));
+}
+
+/**
+ * \brief Test that offsets which don't refer to the start of a block are rejected
+ *
+ */
+TEST_F(PayloadPoolTest, TestInvalidOffsets)
+{
+    ptrdiff_t const offset = _pool.allocate(10U);
+    ASSERT_EQ(0, offset);
+
+    EXPECT_FALSE(_pool.release(1));
+    EXPECT_FALSE(_pool.release(-1));
+    EXPECT_FALSE(_pool.release(256));
+    EXPECT_FALSE(_pool.acquire(64));
+    EXPECT_TRUE(_pool.getMemory(offset, 65U).empty());
+    EXPECT_EQ(0U, _pool.getReferenceCount(1));
+    EXPECT_EQ(1U, _pool.getReferenceCount(offset));
+}
+
+/**
+ * \brief Test that resetting the statistics keeps the current usage
+ *
+ */
+TEST_F(PayloadPoolTest, TestResetStats)
+{
+    ptrdiff_t const first = _pool.allocate(10U);
+    static_cast<void>(_pool.allocate(10U));
+    static_cast<void>(_pool.allocate(200U));
+    ASSERT_TRUE(_pool.release(first));
+
+    _pool.resetStats();
+
+    PayloadPoolStats const stats = _pool.getStats(0U);
+    EXPECT_EQ(0U, stats.allocations);
+    EXPECT_EQ(0U, stats.failedAllocations);
+    EXPECT_EQ(1U, stats.usedBlocks);
+    EXPECT_EQ(1U, stats.maxUsedBlocks);
+}
+
+/**
+ * \brief Test concurrent allocations and releases from several threads
+ *
+ */
+TEST(PayloadPoolConcurrencyTest, TestConcurrentAllocateAndRelease)
+{
+    // ARRANGE
+    static constexpr size_t THREAD_COUNT    = 4U;
+    static constexpr size_t ITERATION_COUNT = 10000U;
+    declare::PayloadPool<64U, 8U> pool;
+    std::vector<std::thread> threads;
+
+    // ACT
+    for (size_t thread = 0U; thread < THREAD_COUNT; ++thread)
+    {
+        threads.emplace_back(
+            [&pool, thread]()
+            {
+                for (size_t i = 0U; i < ITERATION_COUNT; ++i)
+                {
+                    ptrdiff_t const offset = pool.allocate(64U);
+                    if (offset != PayloadPool::INVALID_OFFSET)
+                    {
+                        pool.getMemory(offset, 64U)[0] = static_cast<uint8_t>(thread);
+                        EXPECT_EQ(thread, pool.getMemory(offset, 64U)[0]);
+                        EXPECT_TRUE(pool.release(offset));
+                    }
+                }
+            });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    // ASSERT
+    PayloadPoolStats const stats = pool.getStats(0U);
+    EXPECT_EQ(0U, stats.usedBlocks);
+    EXPECT_EQ(THREAD_COUNT * ITERATION_COUNT, stats.allocations + stats.failedAllocations);
+    EXPECT_GE(THREAD_COUNT, stats.maxUsedBlocks);
+}
+
+} // namespace test
+} // namespace memory
+} // namespace middleware
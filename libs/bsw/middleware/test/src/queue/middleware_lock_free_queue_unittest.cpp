@@ -0,0 +1,180 @@
+// Copyright 2025 BMW AG
+
+#include "middleware/queue/LockFreeQueue.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace middleware
+{
+namespace queue
+{
+namespace test
+{
+
+using TestLockFreeQueue = ::middleware::queue::LockFreeQueue<QueueTraits<uint32_t, 64U>>;
+
+TEST(TestLockFreeQueue, GetInitialSize)
+{
+    TestLockFreeQueue t;
+    t.init();
+    EXPECT_EQ(t.size(), 0U);
+    EXPECT_TRUE(t.isEmpty());
+    EXPECT_FALSE(t.isFull());
+}
+
+TEST(TestLockFreeQueue, InsertTest)
+{
+    TestLockFreeQueue t;
+    t.init();
+    TestLockFreeQueue::Sender sender(t);
+    TestLockFreeQueue::Receiver receiver(t);
+
+    EXPECT_TRUE(sender.write(1U));
+    EXPECT_TRUE(sender.write(2U));
+    EXPECT_EQ(receiver.size(), 2U);
+    EXPECT_EQ(t.getStats().maxLoad, 2U);
+    EXPECT_EQ(t.getStats().startupLoad, 2U);
+
+    EXPECT_FALSE(receiver.isEmpty());
+    EXPECT_EQ(receiver.peek(), 1U);
+    receiver.advance();
+    EXPECT_EQ(receiver.peek(), 2U);
+    receiver.advance();
+    EXPECT_TRUE(receiver.isEmpty());
+    EXPECT_EQ(t.getStats().processedMessages, 2U);
+
+    EXPECT_TRUE(sender.write(3U));
+    EXPECT_EQ(t.getStats().startupLoad, 2U);
+}
+
+TEST(TestLockFreeQueue, LostMessagesTest)
+{
+    TestLockFreeQueue t;
+    t.init();
+    TestLockFreeQueue::Sender sender(t);
+    TestLockFreeQueue::Receiver receiver(t);
+
+    for (uint32_t i = 0U; i < TestLockFreeQueue::MAX_SIZE; ++i)
+    {
+        EXPECT_TRUE(sender.write(i));
+    }
+    EXPECT_TRUE(sender.isFull());
+    EXPECT_FALSE(sender.write(100U));
+    EXPECT_FALSE(sender.write(101U));
+    EXPECT_EQ(t.getStats().lostMessages, 2U);
+    EXPECT_EQ(t.getStats().maxLoad, TestLockFreeQueue::MAX_SIZE);
+
+    receiver.advance();
+    EXPECT_TRUE(sender.write(102U));
+    EXPECT_EQ(receiver.peek(), 1U);
+
+    t.resetStats();
+    EXPECT_EQ(t.getStats().lostMessages, 0U);
+    EXPECT_EQ(t.getStats().maxLoad, 0U);
+}
+
+TEST(TestLockFreeQueue, WrapAroundTest)
+{
+    TestLockFreeQueue t;
+    t.init();
+    TestLockFreeQueue::Sender sender(t);
+    TestLockFreeQueue::Receiver receiver(t);
+
+    for (uint32_t i = 0U; i < (TestLockFreeQueue::MAX_SIZE * 10U); ++i)
+    {
+        EXPECT_TRUE(sender.write(i));
+        EXPECT_TRUE(sender.write(i + 1U));
+        EXPECT_EQ(receiver.peek(), i);
+        receiver.advance();
+        EXPECT_EQ(receiver.peek(), i + 1U);
+        receiver.advance();
+    }
+    EXPECT_TRUE(receiver.isEmpty());
+    EXPECT_EQ(t.getStats().processedMessages, TestLockFreeQueue::MAX_SIZE * 20U);
+    EXPECT_EQ(t.getStats().lostMessages, 0U);
+}
+
+TEST(TestLockFreeQueue, TakeSnapshotTest)
+{
+    TestLockFreeQueue t;
+    t.init();
+    TestLockFreeQueue::Sender sender(t);
+
+    EXPECT_TRUE(sender.write(1U));
+    EXPECT_TRUE(sender.write(2U));
+    t.takeSnapshot();
+    EXPECT_EQ(t.getStats().loadSnapshot, 2U);
+    EXPECT_EQ(t.getStats().processingCounter, 1U);
+    EXPECT_EQ(t.getStats().maxFillRate, 2U);
+}
+
+/**
+ * \brief Several producer threads write concurrently while a single consumer reads
+ *
+ * Each element carries the index of its producer and a sequence number, the consumer checks that
+ * every element is received exactly once and in the order of its producer.
+ */
+TEST(TestLockFreeQueue, MultiProducerStressTest)
+{
+    static constexpr uint32_t PRODUCER_COUNT = 4U;
+    static constexpr uint32_t MESSAGE_COUNT  = 100000U;
+    static TestLockFreeQueue t;
+    t.init();
+
+    std::vector<std::thread> producers;
+    for (uint32_t producer = 0U; producer < PRODUCER_COUNT; ++producer)
+    {
+        producers.emplace_back(
+            [producer]()
+            {
+                TestLockFreeQueue::Sender sender(t);
+                for (uint32_t i = 0U; i < MESSAGE_COUNT; ++i)
+                {
+                    while (!sender.write((producer << 24U) | i))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+    }
+
+    std::array<uint32_t, PRODUCER_COUNT> expected{};
+    TestLockFreeQueue::Receiver receiver(t);
+    uint32_t received = 0U;
+    uint32_t errors   = 0U;
+    while (received < (PRODUCER_COUNT * MESSAGE_COUNT))
+    {
+        if (receiver.isEmpty())
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        uint32_t const value    = receiver.peek();
+        uint32_t const producer = (value >> 24U) % PRODUCER_COUNT;
+        if (expected[producer] != (value & 0xFFFFFFU))
+        {
+            ++errors;
+        }
+        ++expected[producer];
+        receiver.advance();
+        ++received;
+    }
+    for (std::thread& producer : producers)
+    {
+        producer.join();
+    }
+
+    EXPECT_EQ(errors, 0U);
+    EXPECT_TRUE(receiver.isEmpty());
+    EXPECT_EQ(t.getStats().processedMessages, PRODUCER_COUNT * MESSAGE_COUNT);
+    EXPECT_LE(t.getStats().maxLoad, TestLockFreeQueue::MAX_SIZE);
+}
+
+} // namespace test
+} // namespace queue
+} // namespace middleware
@@ -0,0 +1,65 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup runtime
+ */
+#pragma once
+
+#include "runtime/LatencyHistogram.h"
+#include "runtime/RuntimeStatistics.h"
+
+#include <cstdint>
+
+namespace runtime
+{
+/**
+ * Runtime statistics that additionally keep a LatencyHistogram of the runtimes, which can be used
+ * in place of Statistics as ContextStatistics or FunctionStatistics of a RuntimeMonitor.
+ *
+ * \tparam Statistics the statistics to extend, e.g. RuntimeStatistics or FunctionRuntimeStatistics
+ * \tparam SubBucketBits precision of the histogram, see LatencyHistogram
+ */
+template<class Statistics = RuntimeStatistics, uint8_t SubBucketBits = 3U>
+class HistogramRuntimeStatistics : public Statistics
+{
+public:
+    using HistogramType = LatencyHistogram<SubBucketBits>;
+
+    HistogramRuntimeStatistics() = default;
+
+    void addRun(uint32_t const runtime)
+    {
+        _histogram.add(runtime);
+        Statistics::addRun(runtime);
+    }
+
+    void addRun(uint32_t const startTimestamp, uint32_t const runtime, uint32_t const suspendedTime)
+    {
+        _histogram.add(runtime);
+        Statistics::addRun(startTimestamp, runtime, suspendedTime);
+    }
+
+    void reset()
+    {
+        Statistics::reset();
+        _histogram.reset();
+    }
+
+    HistogramType const& getHistogram() const { return _histogram; }
+
+    /**
+     * Returns the runtime below which perMille/1000 of all runs have finished. The value is
+     * rounded up to the precision of the histogram but never exceeds the maximum runtime.
+     */
+    uint32_t getPercentileRuntime(uint32_t const perMille) const
+    {
+        uint32_t const percentile = _histogram.getPercentile(perMille);
+        uint32_t const maxRuntime = Statistics::getMaxRuntime();
+        return (percentile < maxRuntime) ? percentile : maxRuntime;
+    }
+
+private:
+    HistogramType _histogram;
+};
+
+} // namespace runtime
@@ -0,0 +1,128 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup runtime
+ */
+#pragma once
+
+#include <etl/array.h>
+#include <etl/binary.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace runtime
+{
+/**
+ * Histogram of 32 bit values with logarithmic buckets that are divided linearly (HDR style).
+ *
+ * Values below 2^SubBucketBits have a bucket of their own. Above, each power of two range is split
+ * into 2^SubBucketBits buckets of equal width, so the width of a bucket is at most
+ * 1/2^SubBucketBits of its values. Adding a value is a constant time operation, the memory is
+ * fixed at BUCKET_COUNT counters.
+ *
+ * \tparam SubBucketBits number of bits of a value that select the linear bucket within its power
+ * of two range, i.e. the precision of the histogram
+ */
+template<uint8_t SubBucketBits = 3U>
+class LatencyHistogram
+{
+    static_assert((SubBucketBits > 0U) && (SubBucketBits < 16U), "unsupported precision");
+
+public:
+    static constexpr uint32_t SUB_BUCKET_COUNT = 1U << SubBucketBits;
+    static constexpr size_t BUCKET_COUNT       = (33U - SubBucketBits) * SUB_BUCKET_COUNT;
+
+    LatencyHistogram() = default;
+
+    void add(uint32_t const value)
+    {
+        ++_counts[getBucketIndex(value)];
+        ++_totalCount;
+    }
+
+    void reset()
+    {
+        _counts.fill(0U);
+        _totalCount = 0U;
+    }
+
+    uint32_t getTotalCount() const { return _totalCount; }
+
+    uint32_t getCount(size_t const bucketIdx) const { return _counts[bucketIdx]; }
+
+    /**
+     * Returns the smallest value v for which at least perMille/1000 of all added values are not
+     * bigger than v, rounded up to the upper bound of the bucket of v. Returns 0 if no value has
+     * been added.
+     */
+    uint32_t getPercentile(uint32_t const perMille) const
+    {
+        if (_totalCount == 0U)
+        {
+            return 0U;
+        }
+        uint64_t const scaledRank = static_cast<uint64_t>(_totalCount) * perMille;
+        uint64_t rank             = (scaledRank + 999U) / 1000U;
+        if (rank == 0U)
+        {
+            rank = 1U;
+        }
+        uint64_t count = 0U;
+        for (size_t idx = 0U; idx < BUCKET_COUNT; ++idx)
+        {
+            count += _counts[idx];
+            if (count >= rank)
+            {
+                return getBucketUpperBound(idx);
+            }
+        }
+        return getBucketUpperBound(BUCKET_COUNT - 1U);
+    }
+
+    static size_t getBucketIndex(uint32_t const value)
+    {
+        if (value < SUB_BUCKET_COUNT)
+        {
+            return value;
+        }
+        uint32_t const exponent = 31U - static_cast<uint32_t>(::etl::count_leading_zeros(value));
+        uint32_t const shift    = exponent - SubBucketBits;
+        return (static_cast<size_t>(shift + 1U) * SUB_BUCKET_COUNT)
+               + ((value >> shift) - SUB_BUCKET_COUNT);
+    }
+
+    static uint32_t getBucketLowerBound(size_t const bucketIdx)
+    {
+        if (bucketIdx < SUB_BUCKET_COUNT)
+        {
+            return static_cast<uint32_t>(bucketIdx);
+        }
+        uint32_t const shift = static_cast<uint32_t>(bucketIdx / SUB_BUCKET_COUNT) - 1U;
+        uint32_t const mantissa
+            = SUB_BUCKET_COUNT + static_cast<uint32_t>(bucketIdx % SUB_BUCKET_COUNT);
+        return mantissa << shift;
+    }
+
+    static uint32_t getBucketUpperBound(size_t const bucketIdx)
+    {
+        if (bucketIdx < SUB_BUCKET_COUNT)
+        {
+            return static_cast<uint32_t>(bucketIdx);
+        }
+        uint32_t const shift = static_cast<uint32_t>(bucketIdx / SUB_BUCKET_COUNT) - 1U;
+        return getBucketLowerBound(bucketIdx) + ((1U << shift) - 1U);
+    }
+
+private:
+    ::etl::array<uint32_t, BUCKET_COUNT> _counts{};
+    uint32_t _totalCount = 0U;
+};
+
+template<uint8_t SubBucketBits>
+constexpr uint32_t LatencyHistogram<SubBucketBits>::SUB_BUCKET_COUNT;
+
+template<uint8_t SubBucketBits>
+constexpr size_t LatencyHistogram<SubBucketBits>::BUCKET_COUNT;
+
+} // namespace runtime
@@ -0,0 +1,362 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup runtime
+ */
+#pragma once
+
+#include "async/Types.h"
+#include "bsp/timer/SystemTimer.h"
+#include "runtime/RunnableStatistics.h"
+#include "runtime/StatisticsContainer.h"
+
+#include <etl/array.h>
+#include <etl/error_handler.h>
+#include <etl/limits.h>
+#include <etl/span.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace runtime
+{
+/**
+ * Accounts the execution of single runnables. It provides the functions of a runnable hook, so
+ * it can be attached to the RunnableExecutor and the timeout dispatch of all task contexts with
+ * ::async::StaticRunnableHook.
+ *
+ * Each runnable gets an entry on its first appearance, which is named by registerRunnable() or
+ * by the address of the runnable otherwise. Runs of runnables that don't fit into the entries
+ * are only counted by getUntrackedRunCount(). The entries are found by the address of the
+ * runnable in a hash index with twice as many slots as entries, so that the hook functions don't
+ * search all entries.
+ *
+ * The runtime is measured from entering to leaving the runnable. If the monitor also gets the
+ * context switches, i.e. its enterTask()/leaveTask() and enterIsrGroup()/leaveIsrGroup()
+ * functions are called by the context hook of the binding, the time the task is switched out in
+ * between is not accounted. The delay is measured from enqueuing the runnable for execution to
+ * entering it, runnables that are executed on expiry of a timeout have no delay. All times are in
+ * system ticks.
+ *
+ * \tparam Statistics the statistics of a runnable, e.g. RunnableStatistics
+ */
+template<class Statistics = RunnableStatistics>
+class RunnableRuntimeMonitor
+{
+public:
+    using StatisticsType = Statistics;
+
+    class Entry : public Statistics
+    {
+    public:
+        Entry() = default;
+
+    private:
+        friend class RunnableRuntimeMonitor<Statistics>;
+
+        static constexpr size_t ADDRESS_LENGTH = 2U + (2U * sizeof(void*));
+
+        void init(::async::RunnableType const& runnable)
+        {
+            static char const DIGITS[] = "0123456789abcdef";
+            auto value                 = reinterpret_cast<uintptr_t>(&runnable);
+            for (size_t idx = ADDRESS_LENGTH; idx > 2U; --idx)
+            {
+                _address[idx - 1U] = DIGITS[value & 0xFU];
+                value >>= 4U;
+            }
+            _address[0U]             = '0';
+            _address[1U]             = 'x';
+            _address[ADDRESS_LENGTH] = '\0';
+            _runnable                = &runnable;
+        }
+
+        char const* getName() const { return (_name != nullptr) ? _name : _address; }
+
+        void switchOut(uint32_t const timestamp) { _switchOutTimestamp = timestamp; }
+
+        void switchIn(uint32_t const timestamp)
+        {
+            _switchedOutTime += timestamp - _switchOutTimestamp;
+        }
+
+        ::async::RunnableType const* _runnable = nullptr;
+        char const* _name                      = nullptr;
+        uint32_t _enqueueTimestamp             = 0U;
+        uint32_t _enterTimestamp               = 0U;
+        uint32_t _switchOutTimestamp           = 0U;
+        uint32_t _switchedOutTime              = 0U;
+        bool _isEnqueued                       = false;
+        char _address[ADDRESS_LENGTH + 1U]     = {};
+    };
+
+    using EntryType = Entry;
+    /// Index of an entry in the hash index, 0 marks a free slot.
+    using IndexType = uint16_t;
+
+    using StatisticsContainerType = StatisticsContainer<Statistics, Entry>;
+
+    /**
+     * \param entries the entries for the runnables
+     * \param index the slots of the hash index, should be at least twice as many as entries
+     * \param runningEntries the entry running in each task, indexed by the task index of the
+     *        context hook
+     */
+    RunnableRuntimeMonitor(
+        ::etl::span<Entry> const entries,
+        ::etl::span<IndexType> const index,
+        ::etl::span<Entry*> const runningEntries)
+    : _statistics(
+        entries,
+        StatisticsContainerType::GetNameType::
+            template create<RunnableRuntimeMonitor, &RunnableRuntimeMonitor::getName>(*this))
+    , _index(index)
+    , _runningEntries(runningEntries)
+    , _entryCount(0U)
+    , _untrackedRunCount(0U)
+    , _taskIdx(NO_TASK)
+    , _isrNestingCount(0U)
+    {
+        ETL_ASSERT(index.size() > entries.size(), ETL_ERROR_GENERIC("index needs a free slot"));
+    }
+
+    StatisticsContainerType const& getStatistics() const { return _statistics; }
+
+    /**
+     * Returns the number of runs of runnables that have no entry because all entries are in use.
+     */
+    uint32_t getUntrackedRunCount() const { return _untrackedRunCount; }
+
+    /**
+     * Names the entry of a runnable. The name must remain valid for the lifetime of the monitor.
+     * \return false if there's no free entry for the runnable
+     */
+    bool registerRunnable(::async::RunnableType const& runnable, char const* const name)
+    {
+        ::async::LockType const lock;
+        Entry* const entry = getEntry(runnable);
+        if (entry == nullptr)
+        {
+            return false;
+        }
+        entry->_name = name;
+        return true;
+    }
+
+    /**
+     * Resets the statistics of all entries, the entries and their names are kept.
+     */
+    void reset()
+    {
+        ::async::LockType const lock;
+        _statistics.reset();
+        _untrackedRunCount = 0U;
+    }
+
+    void enqueueRunnable(::async::RunnableType const& runnable)
+    {
+        ::async::LockType const lock;
+        Entry* const entry = getEntry(runnable);
+        if (entry != nullptr)
+        {
+            entry->_enqueueTimestamp = getSystemTicks32Bit();
+            entry->_isEnqueued       = true;
+        }
+    }
+
+    void enterRunnable(::async::RunnableType const& runnable)
+    {
+        ::async::LockType const lock;
+        Entry* const entry = getEntry(runnable);
+        if (entry != nullptr)
+        {
+            uint32_t const timestamp = getSystemTicks32Bit();
+            if (entry->_isEnqueued)
+            {
+                entry->addDelay(timestamp - entry->_enqueueTimestamp);
+                entry->_isEnqueued = false;
+            }
+            entry->_enterTimestamp  = timestamp;
+            entry->_switchedOutTime = 0U;
+        }
+        setRunningEntry(entry);
+    }
+
+    void leaveRunnable(::async::RunnableType const& runnable)
+    {
+        ::async::LockType const lock;
+        Entry* const entry = getEntry(runnable);
+        if (entry != nullptr)
+        {
+            entry->addRun(
+                getSystemTicks32Bit() - entry->_enterTimestamp - entry->_switchedOutTime);
+        }
+        else
+        {
+            ++_untrackedRunCount;
+        }
+        setRunningEntry(nullptr);
+    }
+
+    void enterTask(size_t const taskIdx)
+    {
+        ::async::LockType const lock;
+        _taskIdx = taskIdx;
+        if (_isrNestingCount == 0U)
+        {
+            switchIn();
+        }
+    }
+
+    void leaveTask(size_t const taskIdx)
+    {
+        ::async::LockType const lock;
+        if (_isrNestingCount == 0U)
+        {
+            switchOut();
+        }
+        if (_taskIdx == taskIdx)
+        {
+            _taskIdx = NO_TASK;
+        }
+    }
+
+    void enterIsrGroup(size_t const /* isrGroupIdx */)
+    {
+        ::async::LockType const lock;
+        if (_isrNestingCount == 0U)
+        {
+            switchOut();
+        }
+        ++_isrNestingCount;
+    }
+
+    void leaveIsrGroup(size_t const /* isrGroupIdx */)
+    {
+        ::async::LockType const lock;
+        if (_isrNestingCount > 0U)
+        {
+            --_isrNestingCount;
+            if (_isrNestingCount == 0U)
+            {
+                switchIn();
+            }
+        }
+    }
+
+private:
+    static constexpr size_t NO_TASK = static_cast<size_t>(-1);
+
+    Entry* getEntry(::async::RunnableType const& runnable)
+    {
+        size_t slot = getSlot(runnable);
+        while (_index[slot] != 0U)
+        {
+            Entry& entry = _statistics.getEntry(static_cast<size_t>(_index[slot]) - 1U);
+            if (entry._runnable == &runnable)
+            {
+                return &entry;
+            }
+            slot = (slot + 1U) % _index.size();
+        }
+        if (_entryCount < _statistics.getSize())
+        {
+            Entry& entry = _statistics.getEntry(_entryCount);
+            entry.init(runnable);
+            ++_entryCount;
+            _index[slot] = static_cast<IndexType>(_entryCount);
+            return &entry;
+        }
+        return nullptr;
+    }
+
+    size_t getSlot(::async::RunnableType const& runnable) const
+    {
+        // multiplicative hashing of the address, the lowest bits are equal due to the alignment
+        uint32_t const address
+            = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(&runnable) >> 2U);
+        return static_cast<size_t>(address * 2654435761U) % _index.size();
+    }
+
+    Entry* getRunningEntry() const
+    {
+        return (_taskIdx < _runningEntries.size()) ? _runningEntries[_taskIdx] : nullptr;
+    }
+
+    void setRunningEntry(Entry* const entry)
+    {
+        if (_taskIdx < _runningEntries.size())
+        {
+            _runningEntries[_taskIdx] = entry;
+        }
+    }
+
+    void switchOut()
+    {
+        Entry* const entry = getRunningEntry();
+        if (entry != nullptr)
+        {
+            entry->switchOut(getSystemTicks32Bit());
+        }
+    }
+
+    void switchIn()
+    {
+        Entry* const entry = getRunningEntry();
+        if (entry != nullptr)
+        {
+            entry->switchIn(getSystemTicks32Bit());
+        }
+    }
+
+    char const* getName(size_t const idx) const
+    {
+        return (idx < _entryCount) ? _statistics.getEntries()[idx].getName() : nullptr;
+    }
+
+    StatisticsContainerType _statistics;
+    ::etl::span<IndexType> _index;
+    ::etl::span<Entry*> _runningEntries;
+    size_t _entryCount;
+    uint32_t _untrackedRunCount;
+    size_t _taskIdx;
+    size_t _isrNestingCount;
+};
+
+template<class Statistics>
+constexpr size_t RunnableRuntimeMonitor<Statistics>::Entry::ADDRESS_LENGTH;
+
+template<class Statistics>
+constexpr size_t RunnableRuntimeMonitor<Statistics>::NO_TASK;
+
+namespace declare
+{
+/**
+ * \tparam N number of entries
+ * \tparam TASK_COUNT number of tasks reported by enterTask()/leaveTask(), 0 if the monitor doesn't
+ *         get the context switches
+ */
+template<size_t N, size_t TASK_COUNT = 0U, class Statistics = RunnableStatistics>
+class RunnableRuntimeMonitor : public ::runtime::RunnableRuntimeMonitor<Statistics>
+{
+public:
+    using EntryType = typename ::runtime::RunnableRuntimeMonitor<Statistics>::EntryType;
+    using IndexType = typename ::runtime::RunnableRuntimeMonitor<Statistics>::IndexType;
+
+    static_assert(N < ::etl::numeric_limits<IndexType>::max(), "too many entries");
+
+    RunnableRuntimeMonitor()
+    : ::runtime::RunnableRuntimeMonitor<Statistics>(_entries, _index, _runningEntries)
+    , _entries()
+    , _index()
+    , _runningEntries()
+    {}
+
+private:
+    ::etl::array<EntryType, N> _entries;
+    ::etl::array<IndexType, 2U * N + 1U> _index;
+    ::etl::array<EntryType*, TASK_COUNT> _runningEntries;
+};
+
+} // namespace declare
+} // namespace runtime
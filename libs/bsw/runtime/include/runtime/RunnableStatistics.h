@@ -0,0 +1,58 @@
+// Copyright 2025 Accenture.
+
+/**
+ * \ingroup runtime
+ */
+#pragma once
+
+#include "runtime/RuntimeStatistics.h"
+
+#include <cstdint>
+
+namespace runtime
+{
+/**
+ * Runtime statistics of a runnable that additionally keep the delay between enqueuing the
+ * runnable and the start of its execution.
+ */
+class RunnableStatistics : public RuntimeStatistics
+{
+public:
+    RunnableStatistics() = default;
+
+    void addDelay(uint32_t const delay)
+    {
+        _totalDelay += delay;
+        if (_maxDelay < delay)
+        {
+            _maxDelay = delay;
+        }
+        ++_delayCount;
+    }
+
+    void reset()
+    {
+        RuntimeStatistics::reset();
+        _totalDelay = 0U;
+        _delayCount = 0U;
+        _maxDelay   = 0U;
+    }
+
+    uint32_t getTotalDelay() const { return _totalDelay; }
+
+    uint32_t getDelayCount() const { return _delayCount; }
+
+    uint32_t getMaxDelay() const { return _maxDelay; }
+
+    uint32_t getAverageDelay() const
+    {
+        return (_delayCount != 0U) ? (_totalDelay / _delayCount) : 0U;
+    }
+
+private:
+    uint32_t _totalDelay = 0;
+    uint32_t _delayCount = 0;
+    uint32_t _maxDelay   = 0;
+};
+
+} // namespace runtime
@@ -45,6 +45,13 @@ public:
     void writeRuntimePercentage(char const* const title, uint32_t runtime);
     void writePercentage(char const* const title, uint32_t const value, uint32_t const total);
 
+    /**
+     * Writes the p50, p90, p99 and p99.9 runtimes of statistics that provide
+     * getPercentileRuntime(perMille), e.g. HistogramRuntimeStatistics.
+     */
+    template<class Statistics>
+    void writePercentileRuntimes(uint32_t minWidth, Statistics const& statistics);
+
     template<class Statistics>
     void formatStatisticsLine(
         typename FormatStatistics<Statistics>::Type formatStatistics,
@@ -93,6 +100,16 @@ void StatisticsWriter::formatStatisticsLine(
     writeEol();
 }
 
+template<class Statistics>
+void StatisticsWriter::writePercentileRuntimes(
+    uint32_t const minWidth, Statistics const& statistics)
+{
+    writeRuntime("p50 ", minWidth, statistics.getPercentileRuntime(500U));
+    writeRuntime("p90 ", minWidth, statistics.getPercentileRuntime(900U));
+    writeRuntime("p99 ", minWidth, statistics.getPercentileRuntime(990U));
+    writeRuntime("p99.9 ", minWidth, statistics.getPercentileRuntime(999U));
+}
+
 template<class StatisticsIterator>
 void StatisticsWriter::formatStatisticsGroup(
     typename FormatStatistics<typename StatisticsIterator::StatisticsType>::Type const
@@ -0,0 +1,60 @@
+// Copyright 2025 Accenture.
+
+#include "runtime/HistogramRuntimeStatistics.h"
+
+#include "runtime/FunctionRuntimeStatistics.h"
+
+#include <gmock/gmock.h>
+
+namespace
+{
+using namespace ::testing;
+using namespace ::runtime;
+
+TEST(HistogramRuntimeStatisticsTest, testAddRun)
+{
+    HistogramRuntimeStatistics<> cut;
+    cut.addRun(10U);
+    cut.addRun(500U, 20U, 7500U);
+    for (uint32_t idx = 0U; idx < 98U; ++idx)
+    {
+        cut.addRun(100U);
+    }
+    EXPECT_EQ(100U, cut.getTotalRunCount());
+    EXPECT_EQ(100U, cut.getHistogram().getTotalCount());
+    EXPECT_EQ(10U, cut.getMinRuntime());
+    EXPECT_EQ(100U, cut.getMaxRuntime());
+    // 100 is in bucket 96..103, the percentile must not exceed the maximum
+    EXPECT_EQ(100U, cut.getPercentileRuntime(500U));
+    EXPECT_EQ(100U, cut.getPercentileRuntime(999U));
+    EXPECT_EQ(10U, cut.getPercentileRuntime(10U));
+    // 20 is in bucket 20..21
+    EXPECT_EQ(21U, cut.getPercentileRuntime(20U));
+}
+
+TEST(HistogramRuntimeStatisticsTest, testReset)
+{
+    HistogramRuntimeStatistics<> cut;
+    cut.addRun(10U);
+    cut.reset();
+    EXPECT_EQ(0U, cut.getTotalRunCount());
+    EXPECT_EQ(0U, cut.getHistogram().getTotalCount());
+    EXPECT_EQ(0U, cut.getPercentileRuntime(500U));
+}
+
+TEST(HistogramRuntimeStatisticsTest, testFunctionRuntimeStatistics)
+{
+    HistogramRuntimeStatistics<FunctionRuntimeStatistics> cut;
+    cut.addRun(1000U, 30U, 0U);
+    cut.addRun(1500U, 40U, 0U);
+    EXPECT_EQ(2U, cut.getHistogram().getTotalCount());
+    EXPECT_EQ(500U, cut.getMinJitter());
+    // 30 is in bucket 30..31
+    EXPECT_EQ(31U, cut.getPercentileRuntime(500U));
+    EXPECT_EQ(40U, cut.getPercentileRuntime(999U));
+    cut.reset();
+    EXPECT_EQ(0U, cut.getMaxJitter());
+    EXPECT_EQ(0U, cut.getHistogram().getTotalCount());
+}
+
+} // namespace
@@ -0,0 +1,102 @@
+// Copyright 2025 Accenture.
+
+#include "runtime/LatencyHistogram.h"
+
+#include <gmock/gmock.h>
+
+namespace
+{
+using namespace ::testing;
+using namespace ::runtime;
+
+TEST(LatencyHistogramTest, testConstructor)
+{
+    LatencyHistogram<> cut;
+    EXPECT_EQ(240U, LatencyHistogram<>::BUCKET_COUNT);
+    EXPECT_EQ(0U, cut.getTotalCount());
+    EXPECT_EQ(0U, cut.getPercentile(500U));
+}
+
+TEST(LatencyHistogramTest, testBucketIndex)
+{
+    // values below 8 have buckets of their own
+    EXPECT_EQ(0U, LatencyHistogram<>::getBucketIndex(0U));
+    EXPECT_EQ(7U, LatencyHistogram<>::getBucketIndex(7U));
+    // 8..15 still have a width of one
+    EXPECT_EQ(8U, LatencyHistogram<>::getBucketIndex(8U));
+    EXPECT_EQ(15U, LatencyHistogram<>::getBucketIndex(15U));
+    // 16..31 have a width of two
+    EXPECT_EQ(16U, LatencyHistogram<>::getBucketIndex(16U));
+    EXPECT_EQ(16U, LatencyHistogram<>::getBucketIndex(17U));
+    EXPECT_EQ(23U, LatencyHistogram<>::getBucketIndex(31U));
+    EXPECT_EQ(24U, LatencyHistogram<>::getBucketIndex(32U));
+    EXPECT_EQ(
+        LatencyHistogram<>::BUCKET_COUNT - 1U, LatencyHistogram<>::getBucketIndex(0xFFFFFFFFU));
+}
+
+TEST(LatencyHistogramTest, testBucketBounds)
+{
+    for (size_t idx = 0U; idx < LatencyHistogram<>::BUCKET_COUNT; ++idx)
+    {
+        uint32_t const lower = LatencyHistogram<>::getBucketLowerBound(idx);
+        uint32_t const upper = LatencyHistogram<>::getBucketUpperBound(idx);
+        EXPECT_EQ(idx, LatencyHistogram<>::getBucketIndex(lower));
+        EXPECT_EQ(idx, LatencyHistogram<>::getBucketIndex(upper));
+        if (idx + 1U < LatencyHistogram<>::BUCKET_COUNT)
+        {
+            EXPECT_EQ(upper + 1U, LatencyHistogram<>::getBucketLowerBound(idx + 1U));
+        }
+        // the width of a bucket is at most 1/8 of its values
+        EXPECT_LE(static_cast<uint64_t>(upper - lower) * 8U, lower);
+    }
+    EXPECT_EQ(
+        0xFFFFFFFFU,
+        LatencyHistogram<>::getBucketUpperBound(LatencyHistogram<>::BUCKET_COUNT - 1U));
+}
+
+TEST(LatencyHistogramTest, testPercentile)
+{
+    LatencyHistogram<> cut;
+    for (uint32_t value = 1U; value <= 1000U; ++value)
+    {
+        cut.add(value);
+    }
+    EXPECT_EQ(1000U, cut.getTotalCount());
+    EXPECT_EQ(1U, cut.getPercentile(0U));
+    // 500 is in bucket 480..511
+    EXPECT_EQ(511U, cut.getPercentile(500U));
+    // 900 is in bucket 896..959
+    EXPECT_EQ(959U, cut.getPercentile(900U));
+    // 990 and 999 are in bucket 960..1023
+    EXPECT_EQ(1023U, cut.getPercentile(990U));
+    EXPECT_EQ(1023U, cut.getPercentile(999U));
+    EXPECT_EQ(1023U, cut.getPercentile(1000U));
+}
+
+TEST(LatencyHistogramTest, testTail)
+{
+    LatencyHistogram<> cut;
+    for (uint32_t idx = 0U; idx < 999U; ++idx)
+    {
+        cut.add(5U);
+    }
+    cut.add(100000U);
+    EXPECT_EQ(5U, cut.getPercentile(500U));
+    EXPECT_EQ(5U, cut.getPercentile(990U));
+    EXPECT_EQ(5U, cut.getPercentile(999U));
+    // 100000 is in bucket 98304..106495
+    EXPECT_EQ(106495U, cut.getPercentile(1000U));
+}
+
+TEST(LatencyHistogramTest, testReset)
+{
+    LatencyHistogram<2U> cut;
+    cut.add(12U);
+    EXPECT_EQ(1U, cut.getCount(LatencyHistogram<2U>::getBucketIndex(12U)));
+    cut.reset();
+    EXPECT_EQ(0U, cut.getTotalCount());
+    EXPECT_EQ(0U, cut.getCount(LatencyHistogram<2U>::getBucketIndex(12U)));
+    EXPECT_EQ(0U, cut.getPercentile(999U));
+}
+
+} // namespace
@@ -0,0 +1,196 @@
+// Copyright 2025 Accenture.
+
+#include "runtime/RunnableRuntimeMonitor.h"
+
+#include "bsp/timer/SystemTimerMock.h"
+
+#include <cstring>
+
+namespace
+{
+using namespace ::testing;
+using namespace ::runtime;
+
+class TestRunnable : public ::async::RunnableType
+{
+public:
+    void execute() override {}
+};
+
+class RunnableRuntimeMonitorTest : public Test
+{
+protected:
+    using CutType = declare::RunnableRuntimeMonitor<2U>;
+
+    template<class Cut>
+    void run(Cut& cut, TestRunnable const& runnable, uint32_t enter, uint32_t leave)
+    {
+        EXPECT_CALL(_systemTimerMock, getSystemTicks32Bit())
+            .WillOnce(Return(enter))
+            .WillOnce(Return(leave));
+        cut.enterRunnable(runnable);
+        cut.leaveRunnable(runnable);
+        Mock::VerifyAndClearExpectations(&_systemTimerMock);
+    }
+
+    StrictMock<SystemTimerMock> _systemTimerMock;
+    TestRunnable _runnable1;
+    TestRunnable _runnable2;
+    TestRunnable _runnable3;
+};
+
+TEST_F(RunnableRuntimeMonitorTest, testRunsAreAccountedPerRunnable)
+{
+    CutType cut;
+    run(cut, _runnable1, 100U, 130U);
+    run(cut, _runnable2, 200U, 205U);
+    run(cut, _runnable1, 300U, 310U);
+
+    auto const& statistics = cut.getStatistics();
+    EXPECT_EQ(2U, statistics.getStatistics(0U).getTotalRunCount());
+    EXPECT_EQ(40U, statistics.getStatistics(0U).getTotalRuntime());
+    EXPECT_EQ(30U, statistics.getStatistics(0U).getMaxRuntime());
+    EXPECT_EQ(1U, statistics.getStatistics(1U).getTotalRunCount());
+    EXPECT_EQ(5U, statistics.getStatistics(1U).getTotalRuntime());
+    // runs without enqueuing, e.g. on expiry of a timeout, have no delay
+    EXPECT_EQ(0U, statistics.getStatistics(0U).getDelayCount());
+}
+
+TEST_F(RunnableRuntimeMonitorTest, testDelayIsMeasuredFromEnqueue)
+{
+    CutType cut;
+    EXPECT_CALL(_systemTimerMock, getSystemTicks32Bit()).WillOnce(Return(0xFFFFFFF0U));
+    cut.enqueueRunnable(_runnable1);
+    Mock::VerifyAndClearExpectations(&_systemTimerMock);
+    run(cut, _runnable1, 0x10U, 0x20U);
+    run(cut, _runnable1, 0x30U, 0x40U);
+
+    auto const& statistics = cut.getStatistics().getStatistics(0U);
+    EXPECT_EQ(2U, statistics.getTotalRunCount());
+    EXPECT_EQ(1U, statistics.getDelayCount());
+    EXPECT_EQ(0x20U, statistics.getMaxDelay());
+}
+
+TEST_F(RunnableRuntimeMonitorTest, testNames)
+{
+    CutType cut;
+    EXPECT_TRUE(cut.registerRunnable(_runnable1, "first"));
+    run(cut, _runnable2, 0U, 1U);
+
+    auto iterator = cut.getStatistics().getIterator();
+    ASSERT_TRUE(iterator.hasValue());
+    EXPECT_STREQ("first", iterator.getName());
+    iterator.next();
+    ASSERT_TRUE(iterator.hasValue());
+    // unregistered runnables are named by their address
+    EXPECT_EQ(0, std::strncmp("0x", iterator.getName(), 2U));
+    EXPECT_EQ(2U + (2U * sizeof(void*)), std::strlen(iterator.getName()));
+    EXPECT_EQ(1U, iterator.getStatistics().getTotalRunCount());
+    iterator.next();
+    EXPECT_FALSE(iterator.hasValue());
+
+    // a runnable that is already known can be renamed
+    EXPECT_TRUE(cut.registerRunnable(_runnable2, "second"));
+    EXPECT_STREQ("second", cut.getStatistics().getName(1U));
+    EXPECT_EQ(nullptr, cut.getStatistics().getName(2U));
+}
+
+TEST_F(RunnableRuntimeMonitorTest, testRunsBeyondCapacityAreUntracked)
+{
+    CutType cut;
+    run(cut, _runnable1, 0U, 1U);
+    run(cut, _runnable2, 0U, 1U);
+    EXPECT_FALSE(cut.registerRunnable(_runnable3, "third"));
+    cut.enterRunnable(_runnable3);
+    cut.leaveRunnable(_runnable3);
+    EXPECT_EQ(1U, cut.getUntrackedRunCount());
+}
+
+TEST_F(RunnableRuntimeMonitorTest, testEntriesAreFoundForManyRunnables)
+{
+    declare::RunnableRuntimeMonitor<32U> cut;
+    TestRunnable runnables[33];
+    for (size_t idx = 0U; idx < 32U; ++idx)
+    {
+        EXPECT_TRUE(cut.registerRunnable(runnables[idx], "runnable"));
+    }
+    EXPECT_FALSE(cut.registerRunnable(runnables[32], "runnable"));
+    EXPECT_CALL(_systemTimerMock, getSystemTicks32Bit()).WillRepeatedly(Return(0U));
+    for (size_t idx = 0U; idx < 33U; ++idx)
+    {
+        for (size_t run = 0U; run <= idx; ++run)
+        {
+            cut.enterRunnable(runnables[idx]);
+            cut.leaveRunnable(runnables[idx]);
+        }
+    }
+    // each runnable has its own entry in the order of registration
+    for (size_t idx = 0U; idx < 32U; ++idx)
+    {
+        EXPECT_EQ(idx + 1U, cut.getStatistics().getStatistics(idx).getTotalRunCount());
+    }
+    EXPECT_EQ(33U, cut.getUntrackedRunCount());
+}
+
+TEST_F(RunnableRuntimeMonitorTest, testSwitchedOutTimeIsNotAccounted)
+{
+    declare::RunnableRuntimeMonitor<2U, 2U> cut;
+    // no runnable is running, so no time is taken
+    cut.enterTask(1U);
+    EXPECT_CALL(_systemTimerMock, getSystemTicks32Bit())
+        .WillOnce(Return(100U))  // enter runnable
+        .WillOnce(Return(110U))  // switch to task 0
+        .WillOnce(Return(150U))  // switch back to task 1
+        .WillOnce(Return(160U))  // enter ISR
+        .WillOnce(Return(165U))  // leave ISR
+        .WillOnce(Return(200U)); // leave runnable
+    cut.enterRunnable(_runnable1);
+    cut.leaveTask(1U);
+    cut.enterTask(0U);
+    cut.enterIsrGroup(0U);
+    cut.leaveIsrGroup(0U);
+    cut.leaveTask(0U);
+    cut.enterTask(1U);
+    cut.enterIsrGroup(0U);
+    // nested ISRs are switched out only once
+    cut.enterIsrGroup(1U);
+    cut.leaveIsrGroup(1U);
+    cut.leaveIsrGroup(0U);
+    cut.leaveRunnable(_runnable1);
+    Mock::VerifyAndClearExpectations(&_systemTimerMock);
+
+    EXPECT_EQ(55U, cut.getStatistics().getStatistics(0U).getTotalRuntime());
+
+    // without context switches the whole time is accounted
+    run(cut, _runnable1, 300U, 310U);
+    EXPECT_EQ(65U, cut.getStatistics().getStatistics(0U).getTotalRuntime());
+}
+
+TEST_F(RunnableRuntimeMonitorTest, testResetKeepsEntries)
+{
+    CutType cut;
+    EXPECT_TRUE(cut.registerRunnable(_runnable1, "first"));
+    run(cut, _runnable1, 0U, 10U);
+    run(cut, _runnable2, 0U, 1U);
+    cut.enterRunnable(_runnable3);
+    cut.leaveRunnable(_runnable3);
+    cut.reset();
+
+    EXPECT_EQ(0U, cut.getStatistics().getStatistics(0U).getTotalRunCount());
+    EXPECT_EQ(0U, cut.getUntrackedRunCount());
+    EXPECT_STREQ("first", cut.getStatistics().getName(0U));
+}
+
+TEST_F(RunnableRuntimeMonitorTest, testCopyToStatisticsContainer)
+{
+    CutType cut;
+    EXPECT_TRUE(cut.registerRunnable(_runnable1, "first"));
+    run(cut, _runnable1, 0U, 10U);
+
+    declare::StatisticsContainer<RunnableStatistics, 2U> copy;
+    copy.copyFrom(cut.getStatistics());
+    EXPECT_EQ(10U, copy.getStatistics(0U).getTotalRuntime());
+    EXPECT_STREQ("first", copy.getName(0U));
+}
+
+} // namespace
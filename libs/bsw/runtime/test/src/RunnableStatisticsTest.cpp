@@ -0,0 +1,49 @@
+// Copyright 2025 Accenture.
+
+#include "runtime/RunnableStatistics.h"
+
+#include <gmock/gmock.h>
+
+namespace
+{
+using namespace ::testing;
+using namespace ::runtime;
+
+TEST(RunnableStatisticsTest, testConstructor)
+{
+    RunnableStatistics cut;
+    EXPECT_EQ(0U, cut.getTotalRunCount());
+    EXPECT_EQ(0U, cut.getTotalDelay());
+    EXPECT_EQ(0U, cut.getDelayCount());
+    EXPECT_EQ(0U, cut.getMaxDelay());
+    EXPECT_EQ(0U, cut.getAverageDelay());
+}
+
+TEST(RunnableStatisticsTest, testAddDelay)
+{
+    RunnableStatistics cut;
+    cut.addDelay(20U);
+    cut.addDelay(50U);
+    cut.addDelay(10U);
+    EXPECT_EQ(80U, cut.getTotalDelay());
+    EXPECT_EQ(3U, cut.getDelayCount());
+    EXPECT_EQ(50U, cut.getMaxDelay());
+    EXPECT_EQ(26U, cut.getAverageDelay());
+    // runs are accounted independently
+    EXPECT_EQ(0U, cut.getTotalRunCount());
+}
+
+TEST(RunnableStatisticsTest, testReset)
+{
+    RunnableStatistics cut;
+    cut.addRun(15U);
+    cut.addDelay(20U);
+    cut.reset();
+    EXPECT_EQ(0U, cut.getTotalRunCount());
+    EXPECT_EQ(0U, cut.getTotalRuntime());
+    EXPECT_EQ(0U, cut.getTotalDelay());
+    EXPECT_EQ(0U, cut.getDelayCount());
+    EXPECT_EQ(0U, cut.getMaxDelay());
+}
+
+} // namespace
@@ -3,6 +3,7 @@
 #include "runtime/StatisticsWriter.h"
 
 #include "bsp/timer/SystemTimerMock.h"
+#include "runtime/HistogramRuntimeStatistics.h"
 #include "runtime/RuntimeStatistics.h"
 #include "runtime/StatisticsIterator.h"
 #include "util/stream/StringBufferOutputStream.h"
@@ -165,6 +166,29 @@ TEST_F(StatisticsWriterTest, testFormatGroup)
     EXPECT_STREQ(expected, stream.getString());
 }
 
+TEST_F(StatisticsWriterTest, testPercentileRuntimes)
+{
+    ::util::stream::declare::StringBufferOutputStream<300U> stream;
+    ::util::format::StringWriter writer(stream);
+    HistogramRuntimeStatistics<> statistics;
+    for (uint32_t idx = 0U; idx < 1000U; ++idx)
+    {
+        statistics.addRun((idx < 990U) ? 5000U : 50000U);
+    }
+    StatisticsWriter cut(writer, 10000000U, 50U);
+    cut.setMode(StatisticsWriter::Mode::Type::HEADER);
+    cut.writePercentileRuntimes(5U, statistics);
+    cut.writeEol();
+    cut.setMode(StatisticsWriter::Mode::Type::VALUE);
+    cut.writePercentileRuntimes(5U, statistics);
+    cut.writeEol();
+    // 5000 is in bucket 4864..5119
+    EXPECT_STREQ(
+        "    p50      p90      p99    p99.9 \n"
+        "  102 us   102 us   102 us  1000 us\n",
+        stream.getString());
+}
+
 TEST_F(StatisticsWriterTest, testBuiltinTicksConverter)
 {
     {
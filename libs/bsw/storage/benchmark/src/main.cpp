@@ -0,0 +1,181 @@
+// Copyright 2025 Accenture.
+
+#include <async/Async.h>
+#include <benchmark/benchmark.h>
+#include <bsp/flash/IFlashDriver.h>
+#include <storage/FeeStorage.h>
+#include <storage/StorageJob.h>
+
+#include <etl/array.h>
+#include <etl/span.h>
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace async
+{
+// runnables are executed by the benchmark loop in between jobs, like in the storage context
+std::vector<RunnableType*> pendingRunnables;
+
+void execute(ContextType, RunnableType& runnable) { pendingRunnables.push_back(&runnable); }
+} // namespace async
+
+namespace
+{
+using ::storage::StorageJob;
+
+constexpr uint32_t SECTOR_SIZE   = 16U * 1024U;
+constexpr size_t SECTOR_COUNT    = 4U;
+constexpr size_t BLOCK_COUNT     = 16U;
+constexpr size_t MAX_DATA_SIZE   = 256U;
+constexpr uint32_t FLASH_SIZE    = SECTOR_SIZE * SECTOR_COUNT;
+
+/**
+ * NOR flash memory in RAM.
+ */
+class RamFlash : public ::flash::IFlashDriver
+{
+public:
+    RamFlash() : memory(FLASH_SIZE, 0xFFU) {}
+
+    FlashOperationStatus
+    write(uint32_t const destination, uint8_t const* const source, uint32_t const size) override
+    {
+        for (uint32_t i = 0U; i < size; ++i)
+        {
+            memory[destination + i] &= source[i];
+        }
+        return FLASH_OP_SUCCESSFUL;
+    }
+
+    FlashOperationStatus erase(uint32_t const address, uint32_t const size) override
+    {
+        memset(&memory[address], 0xFF, size);
+        return FLASH_OP_SUCCESSFUL;
+    }
+
+    FlashOperationStatus flush() override { return FLASH_OP_SUCCESSFUL; }
+
+    FlashOperationStatus
+    getBlockSize(uint32_t const blockStartAddress, uint32_t& blockSize) override
+    {
+        blockSize = ((blockStartAddress % SECTOR_SIZE) == 0U) ? SECTOR_SIZE : 0U;
+        return (blockSize != 0U) ? FLASH_OP_SUCCESSFUL : FLASH_OP_FAILED;
+    }
+
+    ::etl::span<uint8_t const> getMemory() const { return {memory.data(), memory.size()}; }
+
+private:
+    std::vector<uint8_t> memory;
+};
+
+::storage::FeeBlockConfig const FEE_BLOCK_CONFIG[BLOCK_COUNT] = {
+    {MAX_DATA_SIZE},
+    {MAX_DATA_SIZE},
+    {MAX_DATA_SIZE},
+    {MAX_DATA_SIZE},
+    {MAX_DATA_SIZE},
+    {MAX_DATA_SIZE},
+    {MAX_DATA_SIZE},
+    {MAX_DATA_SIZE},
+    {MAX_DATA_SIZE},
+    {MAX_DATA_SIZE},
+    {MAX_DATA_SIZE},
+    {MAX_DATA_SIZE},
+    {MAX_DATA_SIZE},
+    {MAX_DATA_SIZE},
+    {MAX_DATA_SIZE},
+    {MAX_DATA_SIZE},
+};
+
+using FeeStorage = ::storage::declare::FeeStorage<BLOCK_COUNT, MAX_DATA_SIZE>;
+
+std::unique_ptr<FeeStorage> createStorage(RamFlash& flash)
+{
+    return std::unique_ptr<FeeStorage>(
+        new FeeStorage(FEE_BLOCK_CONFIG, flash, flash.getMemory(), 0U, SECTOR_SIZE, 0U));
+}
+
+void runPending()
+{
+    while (!::async::pendingRunnables.empty())
+    {
+        ::async::RunnableType* const runnable = ::async::pendingRunnables.front();
+        ::async::pendingRunnables.erase(::async::pendingRunnables.begin());
+        runnable->execute();
+    }
+}
+
+void write(FeeStorage& storage, uint32_t const id, ::etl::span<uint8_t const> const data)
+{
+    StorageJob::Type::Write::BufferType buf(data);
+    StorageJob job;
+    job.init(id, StorageJob::JobDoneCallback());
+    job.initWrite(buf);
+    storage.process(job);
+}
+} // namespace
+
+/**
+ * Writes range(0) bytes to the blocks one after another. With BACKGROUND the garbage collection
+ * runs in between the jobs, otherwise the writes have to finish it. Reports the write
+ * amplification (programmed bytes per written byte) and the share of writes that had to finish a
+ * collection.
+ */
+template<bool BACKGROUND>
+void BM_write(benchmark::State& state)
+{
+    RamFlash flash;
+    auto const storage = createStorage(flash);
+    (void)storage->init();
+    ::async::pendingRunnables.clear();
+    std::vector<uint8_t> data(static_cast<size_t>(state.range(0)), 0x5AU);
+    uint32_t id = 0U;
+    while (state.KeepRunning())
+    {
+        write(*storage, id, {data.data(), data.size()});
+        id = (id + 1U) % BLOCK_COUNT;
+        if (BACKGROUND)
+        {
+            state.PauseTiming();
+            runPending();
+            state.ResumeTiming();
+        }
+    }
+    auto const& statistics = storage->getStatistics();
+    state.counters["amplification"]
+        = static_cast<double>(statistics.programmedBytes) / statistics.writtenBytes;
+    state.counters["forced"]
+        = static_cast<double>(statistics.forcedCollections) / state.iterations();
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+/**
+ * Rebuilds the index of a log holding range(0) records of 32 bytes.
+ */
+void BM_init(benchmark::State& state)
+{
+    RamFlash flash;
+    {
+        auto const storage = createStorage(flash);
+        (void)storage->init();
+        ::etl::array<uint8_t, 32U> data;
+        data.fill(0xA5U);
+        for (int64_t i = 0; i < state.range(0); ++i)
+        {
+            write(*storage, static_cast<uint32_t>(i) % BLOCK_COUNT, data);
+            runPending();
+        }
+    }
+    auto const storage = createStorage(flash);
+    while (state.KeepRunning())
+    {
+        benchmark::DoNotOptimize(storage->init());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_write, true)->RangeMultiplier(4)->Range(4, 256);
+BENCHMARK_TEMPLATE(BM_write, false)->RangeMultiplier(4)->Range(4, 256);
+BENCHMARK(BM_init)->RangeMultiplier(4)->Range(16, 1024);
@@ -2,41 +2,192 @@
 
 #pragma once
 
-// TODO: uses IEepromEmulationDriver interface, gets a config with table of block
-// IDs and maximum allowed size, processes synchronously each job
-
+#include <async/Async.h>
+#include <bsp/flash/IFlashDriver.h>
+#include <etl/array.h>
+#include <etl/span.h>
 #include <storage/IStorage.h>
 #include <storage/StorageJob.h>
 
 namespace storage
 {
 
-class FeeStorage : public IStorage
+struct FeeBlockConfig
+{
+    uint16_t const dataSize;
+};
+
+/**
+ * Flash EEPROM emulation that stores blocks as records in a log in flash memory.
+ *
+ * The flash area is split into sectors which are used as a ring. Every write appends a new
+ * record (block index, data size and CRC followed by the data) to the active sector, and a RAM
+ * index maps each block to its latest record, so neither reading nor writing needs to search
+ * the flash memory. The index is rebuilt by init(), which scans the headers of all records.
+ *
+ * When a write has to open a new sector and only one erased sector is left, the oldest sector
+ * is garbage collected in the background: its records that are still referenced by the index
+ * are copied to the head of the log one at a time, each step being a separate runnable in the
+ * storage context, and the sector is erased afterwards. Only if writes outpace the collection,
+ * the remaining steps are done synchronously by the write that runs out of space.
+ *
+ * All blocks plus one more record must fit into a single sector, which guarantees that a
+ * collection never runs out of space. Adding sectors reduces the number of collections and
+ * with that the write amplification.
+ *
+ * The flash memory is programmed and erased with an IFlashDriver and read directly from the
+ * given memory, which has to reflect programming and erasing immediately (memory mapped flash).
+ */
+class FeeStorage
+: public IStorage
+, private ::async::RunnableType
 {
 public:
-    explicit FeeStorage() {}
+    static constexpr size_t SECTOR_HEADER_SIZE = 8U;
+    static constexpr size_t RECORD_HEADER_SIZE = 8U;
+    static constexpr size_t RECORD_ALIGNMENT   = 8U;
+
+    struct Statistics
+    {
+        // number of data bytes given by write jobs
+        uint32_t writtenBytes;
+        // number of bytes programmed into flash memory, including copies and headers
+        uint32_t programmedBytes;
+        uint32_t erasedSectors;
+        // number of collections that had to be finished by a write job
+        uint32_t forcedCollections;
+    };
 
     ~FeeStorage()                            = default;
     FeeStorage(FeeStorage const&)            = delete;
     FeeStorage& operator=(FeeStorage const&) = delete;
 
-    void process(StorageJob& job) final
+    /**
+     * Rebuilds the index from the flash memory and erases sectors that are neither part of the
+     * log nor blank. Must be called within the storage context before processing any job.
+     * \return false if the configuration doesn't match the flash memory, all jobs will fail then
+     */
+    bool init();
+
+    void process(StorageJob& job) final;
+
+    Statistics const& getStatistics() const { return _statistics; }
+
+    static constexpr size_t getRecordSize(size_t const dataSize)
     {
-        StorageJob::ResultType result = StorageJob::Result::Error();
-        if (job.is<StorageJob::Type::Write>())
-        {
-            result = StorageJob::Result::Success();
-        }
-        else if (job.is<StorageJob::Type::Read>())
-        {
-            auto& readJob                       = job.getRead();
-            // return fake data for now
-            readJob.getBuffer().getBuffer()[0U] = 222U;
-            readJob.setReadSize(1U);
-            result = StorageJob::Result::Success();
-        }
-        job.sendResult(result);
+        return ((RECORD_HEADER_SIZE + dataSize + RECORD_ALIGNMENT) - 1U)
+               & ~(RECORD_ALIGNMENT - 1U);
     }
+
+protected:
+    /**
+     * \param config Table of block configurations, indexed by the block ID of a job
+     * \param configSize Number of entries in config
+     * \param flash Driver used to program and erase the flash area
+     * \param memory Readable view on the flash area
+     * \param flashAddress Address of the flash area for the driver
+     * \param sectorSize Size of a sector, which must be a flash block of the driver
+     * \param context Storage context, in which the garbage collection runs as well
+     * \param index One entry per block
+     * \param recordBuffer Buffer for the largest record
+     */
+    explicit FeeStorage(
+        FeeBlockConfig const* config,
+        size_t configSize,
+        ::flash::IFlashDriver& flash,
+        ::etl::span<uint8_t const> memory,
+        uint32_t flashAddress,
+        uint32_t sectorSize,
+        ::async::ContextType context,
+        ::etl::span<uint32_t> index,
+        ::etl::span<uint8_t> recordBuffer);
+
+private:
+    enum class RecordState : uint8_t
+    {
+        END,
+        VALID,
+        INVALID,
+        CORRUPT
+    };
+
+    void execute() final;
+    StorageJob::ResultType write(StorageJob& job, FeeBlockConfig const& confEntry);
+    StorageJob::ResultType read(StorageJob& job, FeeBlockConfig const& confEntry) const;
+    bool isConfigValid() const;
+    RecordState checkRecord(uint32_t offset, uint32_t end) const;
+    uint32_t scanSector(size_t sector);
+    bool isBlank(uint32_t offset, uint32_t size) const;
+    bool eraseSector(size_t sector);
+    bool openSector(size_t sector);
+    bool program(uint32_t offset, uint8_t const* data, uint32_t size);
+    bool reserve(uint32_t recordSize);
+    bool appendRecord(uint32_t recordSize);
+    void startCollection();
+    bool collectStep();
+    bool finishCollection();
+    void scheduleCollection();
+    uint16_t getDataSize(uint32_t recordOffset) const;
+    uint32_t getSectorStart(size_t sector) const;
+    size_t getNextSector(size_t sector) const;
+    size_t getOldestSector() const;
+
+    FeeBlockConfig const* const _config;
+    size_t const _configSize;
+    ::flash::IFlashDriver& _flash;
+    ::etl::span<uint8_t const> const _memory;
+    uint32_t const _flashAddress;
+    uint32_t const _sectorSize;
+    size_t const _sectorCount;
+    ::async::ContextType const _context;
+    ::etl::span<uint32_t> const _index;
+    ::etl::span<uint8_t> const _recordBuffer;
+    Statistics _statistics;
+    uint32_t _sequence;
+    uint32_t _writeOffset;
+    size_t _activeSector;
+    size_t _erasedSectors;
+    size_t _collectedSector;
+    uint32_t _collectOffset;
+    bool _initialized;
+    bool _collectionScheduled;
+};
+
+namespace declare
+{
+// CONFIG_SIZE: number of entries in the config
+// MAX_DATA_SIZE: maximum data size present in the config
+template<size_t CONFIG_SIZE, size_t MAX_DATA_SIZE>
+class FeeStorage : public ::storage::FeeStorage
+{
+    static_assert(CONFIG_SIZE > 0U, "number of blocks must be bigger than 0");
+    static_assert(MAX_DATA_SIZE > 0U, "maximum data size must be bigger than 0");
+    static_assert(MAX_DATA_SIZE < 0xFFFFU, "maximum data size must fit into the record header");
+
+public:
+    explicit FeeStorage(
+        FeeBlockConfig const (&config)[CONFIG_SIZE],
+        ::flash::IFlashDriver& flash,
+        ::etl::span<uint8_t const> const memory,
+        uint32_t const flashAddress,
+        uint32_t const sectorSize,
+        ::async::ContextType const context)
+    : ::storage::FeeStorage(
+        reinterpret_cast<FeeBlockConfig const*>(&config),
+        CONFIG_SIZE,
+        flash,
+        memory,
+        flashAddress,
+        sectorSize,
+        context,
+        _index,
+        _recordBuffer)
+    {}
+
+private:
+    ::etl::array<uint32_t, CONFIG_SIZE> _index;
+    ::etl::array<uint8_t, getRecordSize(MAX_DATA_SIZE)> _recordBuffer;
 };
+} // namespace declare
 
 } // namespace storage
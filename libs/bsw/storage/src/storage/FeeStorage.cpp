@@ -0,0 +1,575 @@
+// Copyright 2025 Accenture.
+
+#include <etl/algorithm.h>
+#include <etl/crc16_aug_ccitt.h>
+#include <etl/memory.h>
+#include <etl/unaligned_type.h>
+#include <storage/FeeStorage.h>
+#include <storage/StorageJob.h>
+
+namespace
+{
+
+using CrcType = ::etl::crc16_aug_ccitt_t256;
+
+// layout of the sector header: magic (4 bytes), sequence number (4 bytes)
+uint32_t const SECTOR_MAGIC     = 0x46454531U; // "FEE1"
+// layout of the record header: block index, data size, inverted data size, CRC (2 bytes each)
+// NOTE: the inverted data size allows to skip records with corrupt data, while an interrupted
+// write of the header itself stops the scan of the sector
+size_t const RECORD_SIZE_OFFSET = 2U;
+size_t const RECORD_INV_OFFSET  = 4U;
+size_t const RECORD_CRC_OFFSET  = 6U;
+uint16_t const ERASED_ID        = 0xFFFFU;
+uint32_t const NO_RECORD        = 0xFFFFFFFFU;
+size_t const NO_SECTOR          = static_cast<size_t>(-1);
+uint8_t const ERASED_VALUE      = 0xFFU;
+
+uint16_t calculateCrc(uint8_t const* const record, uint16_t const dataSize)
+{
+    CrcType c;
+    c.add(record, record + RECORD_INV_OFFSET);
+    c.add(
+        record + ::storage::FeeStorage::RECORD_HEADER_SIZE,
+        record + ::storage::FeeStorage::RECORD_HEADER_SIZE + dataSize);
+    return c.value();
+}
+
+} // anonymous namespace
+
+namespace storage
+{
+
+constexpr size_t FeeStorage::SECTOR_HEADER_SIZE;
+constexpr size_t FeeStorage::RECORD_HEADER_SIZE;
+constexpr size_t FeeStorage::RECORD_ALIGNMENT;
+
+FeeStorage::FeeStorage(
+    FeeBlockConfig const* const config,
+    size_t const configSize,
+    ::flash::IFlashDriver& flash,
+    ::etl::span<uint8_t const> const memory,
+    uint32_t const flashAddress,
+    uint32_t const sectorSize,
+    ::async::ContextType const context,
+    ::etl::span<uint32_t> const index,
+    ::etl::span<uint8_t> const recordBuffer)
+: _config(config)
+, _configSize(configSize)
+, _flash(flash)
+, _memory(memory)
+, _flashAddress(flashAddress)
+, _sectorSize(sectorSize)
+, _sectorCount((sectorSize > 0U) ? (memory.size() / sectorSize) : 0U)
+, _context(context)
+, _index(index)
+, _recordBuffer(recordBuffer)
+, _statistics()
+, _sequence(0U)
+, _writeOffset(0U)
+, _activeSector(0U)
+, _erasedSectors(0U)
+, _collectedSector(NO_SECTOR)
+, _collectOffset(0U)
+, _initialized(false)
+, _collectionScheduled(false)
+{}
+
+bool FeeStorage::init()
+{
+    _initialized     = false;
+    _collectedSector = NO_SECTOR;
+    if (!isConfigValid())
+    {
+        return false;
+    }
+    for (auto& entry : _index)
+    {
+        entry = NO_RECORD;
+    }
+
+    // the sector with the highest sequence number is the head of the log
+    size_t head = NO_SECTOR;
+    for (size_t sector = 0U; sector < _sectorCount; ++sector)
+    {
+        uint8_t const* const header = _memory.data() + getSectorStart(sector);
+        if ((::etl::be_uint32_t{header} == SECTOR_MAGIC)
+            && ((head == NO_SECTOR)
+                || (::etl::be_uint32_t{header + 4U}
+                    > ::etl::be_uint32_t{_memory.data() + getSectorStart(head) + 4U})))
+        {
+            head = sector;
+        }
+    }
+    if (head == NO_SECTOR)
+    {
+        // no log yet: start with blank memory
+        _sequence      = 0U;
+        _erasedSectors = _sectorCount;
+        for (size_t sector = 0U; sector < _sectorCount; ++sector)
+        {
+            if ((!isBlank(getSectorStart(sector), _sectorSize)) && (!eraseSector(sector)))
+            {
+                return false;
+            }
+        }
+        if (!openSector(0U))
+        {
+            return false;
+        }
+        _initialized = true;
+        return true;
+    }
+
+    // the log consists of the sectors with continuous sequence numbers up to the head
+    _sequence        = ::etl::be_uint32_t{_memory.data() + getSectorStart(head) + 4U};
+    size_t oldest    = head;
+    size_t logLength = 1U;
+    while (logLength < _sectorCount)
+    {
+        size_t const prev           = ((oldest + _sectorCount) - 1U) % _sectorCount;
+        uint8_t const* const header = _memory.data() + getSectorStart(prev);
+        if ((::etl::be_uint32_t{header} != SECTOR_MAGIC)
+            || ((::etl::be_uint32_t{header + 4U} + 1U)
+                != ::etl::be_uint32_t{_memory.data() + getSectorStart(oldest) + 4U}))
+        {
+            break;
+        }
+        oldest = prev;
+        ++logLength;
+    }
+    size_t sector = oldest;
+    for (size_t i = 0U; i < logLength; ++i)
+    {
+        _writeOffset = scanSector(sector);
+        sector       = getNextSector(sector);
+    }
+    _activeSector  = head;
+    _erasedSectors = _sectorCount - logLength;
+    // everything else must be blank, e.g. a collection may have been interrupted while erasing
+    for (size_t i = 0U; i < _erasedSectors; ++i)
+    {
+        if ((!isBlank(getSectorStart(sector), _sectorSize)) && (!eraseSector(sector)))
+        {
+            return false;
+        }
+        sector = getNextSector(sector);
+    }
+    _initialized = true;
+    if (_erasedSectors == 0U)
+    {
+        // interrupted while a collection used the last erased sector
+        startCollection();
+        _initialized = finishCollection();
+    }
+    return _initialized;
+}
+
+void FeeStorage::process(StorageJob& job)
+{
+    if ((!_initialized) || (job.getId() >= _configSize))
+    {
+        job.sendResult(StorageJob::Result::Error());
+        return;
+    }
+
+    auto const& confEntry         = _config[job.getId()];
+    StorageJob::ResultType result = StorageJob::Result::Error();
+    if (job.is<StorageJob::Type::Write>())
+    {
+        result = write(job, confEntry);
+        scheduleCollection();
+    }
+    else if (job.is<StorageJob::Type::Read>())
+    {
+        result = read(job, confEntry);
+    }
+    job.sendResult(result);
+}
+
+void FeeStorage::execute()
+{
+    _collectionScheduled = false;
+    if ((_collectedSector != NO_SECTOR) && collectStep())
+    {
+        scheduleCollection();
+    }
+}
+
+StorageJob::ResultType FeeStorage::write(StorageJob& job, FeeBlockConfig const& confEntry)
+{
+    auto& writeJob    = job.getWrite();
+    auto const offset = writeJob.getOffset();
+    size_t writeSize  = 0U;
+    for (auto const& writeBuf : writeJob.getBuffer())
+    {
+        writeSize += writeBuf.size();
+    }
+    if ((writeSize == 0U) || (offset >= confEntry.dataSize)
+        || (writeSize > (confEntry.dataSize - offset)))
+    {
+        // writing zero bytes or more data than configured is not allowed
+        return StorageJob::Result::Error();
+    }
+    auto const id           = static_cast<uint16_t>(job.getId());
+    uint16_t const usedSize = ::etl::min(getDataSize(_index[id]), confEntry.dataSize);
+    uint16_t const newSize  = ::etl::max(usedSize, static_cast<uint16_t>(offset + writeSize));
+    auto const recSize      = static_cast<uint32_t>(getRecordSize(newSize));
+    // NOTE: making room may run the garbage collection, which moves records and uses the record
+    // buffer, so the existing data can only be looked up afterwards
+    if (!reserve(recSize))
+    {
+        return StorageJob::Result::Error();
+    }
+
+    uint8_t* const record = _recordBuffer.data();
+    uint8_t* const data   = record + RECORD_HEADER_SIZE;
+    if (_index[id] != NO_RECORD)
+    {
+        (void)::etl::mem_copy(_memory.data() + _index[id] + RECORD_HEADER_SIZE, usedSize, data);
+    }
+    if (offset > usedSize)
+    {
+        // use known values for any data before the offset that hasn't been written before
+        (void)::etl::mem_set(data + usedSize, offset - usedSize, static_cast<uint8_t>(0U));
+    }
+    auto progressInBlock = offset;
+    for (auto const& writeBuf : writeJob.getBuffer())
+    {
+        (void)::etl::mem_copy(writeBuf.data(), writeBuf.size(), data + progressInBlock);
+        progressInBlock += writeBuf.size();
+    }
+    (void)::etl::mem_set(data + newSize, recSize - RECORD_HEADER_SIZE - newSize, ERASED_VALUE);
+    ::etl::be_uint16_ext_t{record}                      = id;
+    ::etl::be_uint16_ext_t{record + RECORD_SIZE_OFFSET} = newSize;
+    ::etl::be_uint16_ext_t{record + RECORD_INV_OFFSET}  = static_cast<uint16_t>(~newSize);
+    ::etl::be_uint16_ext_t{record + RECORD_CRC_OFFSET}  = calculateCrc(record, newSize);
+
+    uint32_t const recordOffset = _writeOffset;
+    if ((!appendRecord(recSize)) || (_flash.flush() != ::flash::IFlashDriver::FLASH_OP_SUCCESSFUL))
+    {
+        return StorageJob::Result::Error();
+    }
+    _index[id] = recordOffset;
+    _statistics.writtenBytes += static_cast<uint32_t>(writeSize);
+    return StorageJob::Result::Success();
+}
+
+StorageJob::ResultType FeeStorage::read(StorageJob& job, FeeBlockConfig const& confEntry) const
+{
+    auto const recordOffset = _index[job.getId()];
+    if (recordOffset == NO_RECORD)
+    {
+        // block has never been written
+        return StorageJob::Result::DataLoss();
+    }
+    uint8_t const* const record = _memory.data() + recordOffset;
+    uint16_t const storedSize   = getDataSize(recordOffset);
+    if (calculateCrc(record, storedSize) != ::etl::be_uint16_t{record + RECORD_CRC_OFFSET})
+    {
+        return StorageJob::Result::DataLoss();
+    }
+    // NOTE: if more data was stored using another SW where the data size was bigger, only the
+    // configured size can be read
+    auto const usedDataSize = ::etl::min(storedSize, confEntry.dataSize);
+    auto& readJob           = job.getRead();
+    auto progressInBlock    = readJob.getOffset();
+    size_t progressForUser  = 0U;
+    for (auto& readBuf : readJob.getBuffer())
+    {
+        if (progressInBlock >= usedDataSize)
+        {
+            break;
+        }
+        auto const sizeToCopy = ::etl::min(readBuf.size(), usedDataSize - progressInBlock);
+        (void)::etl::mem_copy(
+            record + RECORD_HEADER_SIZE + progressInBlock, sizeToCopy, readBuf.data());
+        progressForUser += sizeToCopy;
+        progressInBlock += sizeToCopy;
+    }
+    readJob.setReadSize(progressForUser);
+    return StorageJob::Result::Success();
+}
+
+bool FeeStorage::isConfigValid() const
+{
+    if ((_sectorCount < 2U) || (_index.size() < _configSize) || (_sectorSize <= SECTOR_HEADER_SIZE)
+        || ((_sectorSize % RECORD_ALIGNMENT) != 0U))
+    {
+        return false;
+    }
+    size_t allRecords = 0U;
+    size_t maxRecord  = 0U;
+    for (size_t i = 0U; i < _configSize; ++i)
+    {
+        size_t const recSize = getRecordSize(_config[i].dataSize);
+        allRecords += recSize;
+        maxRecord = ::etl::max(maxRecord, recSize);
+    }
+    if ((maxRecord > _recordBuffer.size())
+        || ((allRecords + maxRecord) > (_sectorSize - SECTOR_HEADER_SIZE)))
+    {
+        return false;
+    }
+    for (size_t sector = 0U; sector < _sectorCount; ++sector)
+    {
+        uint32_t blockSize = 0U;
+        if ((_flash.getBlockSize(_flashAddress + getSectorStart(sector), blockSize)
+             != ::flash::IFlashDriver::FLASH_OP_SUCCESSFUL)
+            || (blockSize != _sectorSize))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+FeeStorage::RecordState FeeStorage::checkRecord(uint32_t const offset, uint32_t const end) const
+{
+    if ((offset + RECORD_HEADER_SIZE) > end)
+    {
+        return RecordState::END;
+    }
+    uint8_t const* const record = _memory.data() + offset;
+    uint16_t const id           = ::etl::be_uint16_t{record};
+    uint16_t const dataSize     = ::etl::be_uint16_t{record + RECORD_SIZE_OFFSET};
+    uint16_t const invDataSize  = ::etl::be_uint16_t{record + RECORD_INV_OFFSET};
+    if ((id == ERASED_ID) && (dataSize == 0xFFFFU) && (invDataSize == 0xFFFFU)
+        && (::etl::be_uint16_t{record + RECORD_CRC_OFFSET} == 0xFFFFU))
+    {
+        return RecordState::END;
+    }
+    if ((static_cast<uint16_t>(~dataSize) != invDataSize)
+        || (getRecordSize(dataSize) > (end - offset)))
+    {
+        return RecordState::CORRUPT;
+    }
+    if ((id >= _configSize)
+        || (calculateCrc(record, dataSize) != ::etl::be_uint16_t{record + RECORD_CRC_OFFSET}))
+    {
+        return RecordState::INVALID;
+    }
+    return RecordState::VALID;
+}
+
+uint32_t FeeStorage::scanSector(size_t const sector)
+{
+    uint32_t const end = getSectorStart(sector) + _sectorSize;
+    uint32_t offset    = getSectorStart(sector) + SECTOR_HEADER_SIZE;
+    while (true)
+    {
+        switch (checkRecord(offset, end))
+        {
+            case RecordState::VALID:
+            {
+                _index[::etl::be_uint16_t{_memory.data() + offset}] = offset;
+                break;
+            }
+            case RecordState::INVALID:
+            {
+                break;
+            }
+            case RecordState::CORRUPT:
+            {
+                // the rest of the sector can't be used anymore
+                return end;
+            }
+            default:
+            {
+                return offset;
+            }
+        }
+        offset += static_cast<uint32_t>(getRecordSize(getDataSize(offset)));
+    }
+}
+
+bool FeeStorage::isBlank(uint32_t const offset, uint32_t const size) const
+{
+    uint8_t const* const begin = _memory.data() + offset;
+    return ::etl::all_of(begin, begin + size, [](uint8_t const b) { return b == ERASED_VALUE; });
+}
+
+bool FeeStorage::eraseSector(size_t const sector)
+{
+    if (_flash.erase(_flashAddress + getSectorStart(sector), _sectorSize)
+        != ::flash::IFlashDriver::FLASH_OP_SUCCESSFUL)
+    {
+        return false;
+    }
+    ++_statistics.erasedSectors;
+    return isBlank(getSectorStart(sector), _sectorSize);
+}
+
+bool FeeStorage::openSector(size_t const sector)
+{
+    uint8_t header[SECTOR_HEADER_SIZE];
+    ::etl::be_uint32_ext_t{header}      = SECTOR_MAGIC;
+    ::etl::be_uint32_ext_t{header + 4U} = _sequence + 1U;
+    // NOTE: the sector is used even if programming the header fails, it will be erased later
+    ++_sequence;
+    --_erasedSectors;
+    _activeSector = sector;
+    _writeOffset  = getSectorStart(sector) + SECTOR_HEADER_SIZE;
+    return program(getSectorStart(sector), header, SECTOR_HEADER_SIZE);
+}
+
+bool FeeStorage::program(uint32_t const offset, uint8_t const* const data, uint32_t const size)
+{
+    _statistics.programmedBytes += size;
+    return (_flash.write(_flashAddress + offset, data, size)
+            == ::flash::IFlashDriver::FLASH_OP_SUCCESSFUL)
+           && (::etl::equal(data, data + size, _memory.data() + offset));
+}
+
+bool FeeStorage::reserve(uint32_t const recordSize)
+{
+    if ((_erasedSectors == 0U) && (!finishCollection()))
+    {
+        return false;
+    }
+    // NOTE: this terminates because each collection erases a sector, and a sector only holding
+    // copies of all blocks has room for another record
+    while (recordSize > ((getSectorStart(_activeSector) + _sectorSize) - _writeOffset))
+    {
+        if (_erasedSectors > 1U)
+        {
+            // keep the last erased sector for the garbage collection
+            if (!openSector(getNextSector(_activeSector)))
+            {
+                return false;
+            }
+            if ((_erasedSectors == 1U) && (_collectedSector == NO_SECTOR))
+            {
+                startCollection();
+            }
+        }
+        else
+        {
+            if (_collectedSector == NO_SECTOR)
+            {
+                startCollection();
+            }
+            ++_statistics.forcedCollections;
+            if (!finishCollection())
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool FeeStorage::appendRecord(uint32_t const recordSize)
+{
+    uint32_t const offset = _writeOffset;
+    // NOTE: the space is used even if programming fails, the record will be skipped by the scan
+    _writeOffset += recordSize;
+    return program(offset, _recordBuffer.data(), recordSize);
+}
+
+void FeeStorage::startCollection()
+{
+    _collectedSector = getOldestSector();
+    _collectOffset   = getSectorStart(_collectedSector) + SECTOR_HEADER_SIZE;
+}
+
+bool FeeStorage::collectStep()
+{
+    if (_activeSector == _collectedSector)
+    {
+        // the log consists of this sector only, continue it in the last erased sector
+        if ((_erasedSectors == 0U) || (!openSector(getNextSector(_activeSector))))
+        {
+            return false;
+        }
+    }
+    uint32_t const end = getSectorStart(_collectedSector) + _sectorSize;
+    while (true)
+    {
+        uint32_t const offset   = _collectOffset;
+        RecordState const state = checkRecord(offset, end);
+        if ((state == RecordState::END) || (state == RecordState::CORRUPT))
+        {
+            break;
+        }
+        uint32_t const recSize = static_cast<uint32_t>(getRecordSize(getDataSize(offset)));
+        _collectOffset += recSize;
+        uint16_t const id = ::etl::be_uint16_t{_memory.data() + offset};
+        if ((state == RecordState::VALID) && (_index[id] == offset))
+        {
+            // the record is still in use: move it to the head of the log
+            if ((recSize > ((getSectorStart(_activeSector) + _sectorSize) - _writeOffset))
+                && ((_erasedSectors == 0U) || (!openSector(getNextSector(_activeSector)))))
+            {
+                _collectOffset = offset;
+                return false;
+            }
+            (void)::etl::mem_copy(_memory.data() + offset, recSize, _recordBuffer.data());
+            uint32_t const newOffset = _writeOffset;
+            if (!appendRecord(recSize))
+            {
+                _collectOffset = offset;
+                return false;
+            }
+            _index[id] = newOffset;
+            return true;
+        }
+    }
+    // all records have been moved, the copies must be persistent before erasing the originals
+    if ((_flash.flush() != ::flash::IFlashDriver::FLASH_OP_SUCCESSFUL)
+        || (!eraseSector(_collectedSector)))
+    {
+        return false;
+    }
+    ++_erasedSectors;
+    _collectedSector = NO_SECTOR;
+    return false;
+}
+
+bool FeeStorage::finishCollection()
+{
+    while (_collectedSector != NO_SECTOR)
+    {
+        if ((!collectStep()) && (_collectedSector != NO_SECTOR))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void FeeStorage::scheduleCollection()
+{
+    if ((_collectedSector != NO_SECTOR) && (!_collectionScheduled))
+    {
+        _collectionScheduled = true;
+        ::async::execute(_context, *this);
+    }
+}
+
+uint16_t FeeStorage::getDataSize(uint32_t const recordOffset) const
+{
+    if (recordOffset == NO_RECORD)
+    {
+        return 0U;
+    }
+    return ::etl::be_uint16_t{_memory.data() + recordOffset + RECORD_SIZE_OFFSET};
+}
+
+uint32_t FeeStorage::getSectorStart(size_t const sector) const
+{
+    return static_cast<uint32_t>(sector * _sectorSize);
+}
+
+size_t FeeStorage::getNextSector(size_t const sector) const
+{
+    return (sector + 1U) % _sectorCount;
+}
+
+size_t FeeStorage::getOldestSector() const
+{
+    // the erased sectors follow the active sector, the oldest sector of the log follows them
+    return (_activeSector + _erasedSectors + 1U) % _sectorCount;
+}
+
+} // namespace storage
@@ -0,0 +1,102 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <bsp/flash/IFlashDriver.h>
+#include <etl/array.h>
+#include <etl/span.h>
+
+namespace storage
+{
+namespace test
+{
+/**
+ * IFlashDriver emulating NOR flash memory in RAM: programming can only clear bits and erasing
+ * sets a whole sector to 0xFF. A power loss can be emulated by limiting the number of bytes
+ * that can still be programmed.
+ */
+template<uint32_t SECTOR_SIZE, size_t SECTOR_COUNT>
+class FlashMemoryFake : public ::flash::IFlashDriver
+{
+public:
+    static constexpr uint32_t SIZE     = SECTOR_SIZE * SECTOR_COUNT;
+    static constexpr uint32_t NO_LIMIT = 0xFFFFFFFFU;
+
+    FlashMemoryFake() : programLimit(NO_LIMIT), writeCount(0U), eraseCount(0U), flushCount(0U)
+    {
+        memory.fill(0xFFU);
+    }
+
+    FlashOperationStatus
+    write(uint32_t const destination, uint8_t const* const source, uint32_t const size) override
+    {
+        ++writeCount;
+        if ((destination > SIZE) || (size > (SIZE - destination)))
+        {
+            return FLASH_OP_FAILED;
+        }
+        for (uint32_t i = 0U; i < size; ++i)
+        {
+            if (programLimit == 0U)
+            {
+                return FLASH_OP_FAILED;
+            }
+            if (programLimit != NO_LIMIT)
+            {
+                --programLimit;
+            }
+            memory[destination + i] &= source[i];
+        }
+        return FLASH_OP_SUCCESSFUL;
+    }
+
+    FlashOperationStatus erase(uint32_t const address, uint32_t const size) override
+    {
+        ++eraseCount;
+        if ((programLimit == 0U) || ((address % SECTOR_SIZE) != 0U) || ((size % SECTOR_SIZE) != 0U)
+            || (address > SIZE) || (size > (SIZE - address)))
+        {
+            return FLASH_OP_FAILED;
+        }
+        for (uint32_t i = 0U; i < size; ++i)
+        {
+            memory[address + i] = 0xFFU;
+        }
+        return FLASH_OP_SUCCESSFUL;
+    }
+
+    FlashOperationStatus flush() override
+    {
+        ++flushCount;
+        return FLASH_OP_SUCCESSFUL;
+    }
+
+    FlashOperationStatus
+    getBlockSize(uint32_t const blockStartAddress, uint32_t& blockSize) override
+    {
+        if ((blockStartAddress >= SIZE) || ((blockStartAddress % SECTOR_SIZE) != 0U))
+        {
+            blockSize = 0U;
+            return FLASH_OP_FAILED;
+        }
+        blockSize = SECTOR_SIZE;
+        return FLASH_OP_SUCCESSFUL;
+    }
+
+    ::etl::span<uint8_t const> getMemory() const { return memory; }
+
+    ::etl::array<uint8_t, SIZE> memory;
+    // number of bytes that can be programmed before the emulated power loss
+    uint32_t programLimit;
+    uint32_t writeCount;
+    uint32_t eraseCount;
+    uint32_t flushCount;
+};
+
+template<uint32_t SECTOR_SIZE, size_t SECTOR_COUNT>
+constexpr uint32_t FlashMemoryFake<SECTOR_SIZE, SECTOR_COUNT>::SIZE;
+template<uint32_t SECTOR_SIZE, size_t SECTOR_COUNT>
+constexpr uint32_t FlashMemoryFake<SECTOR_SIZE, SECTOR_COUNT>::NO_LIMIT;
+
+} // namespace test
+} // namespace storage
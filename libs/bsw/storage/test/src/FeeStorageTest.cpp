@@ -0,0 +1,363 @@
+// Copyright 2025 Accenture.
+
+#include <async/AsyncMock.h>
+#include <async/TestContext.h>
+#include <etl/array.h>
+#include <etl/span.h>
+#include <storage/FeeStorage.h>
+#include <storage/FlashMemoryFake.h>
+#include <storage/StorageJob.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+namespace
+{
+using namespace ::testing;
+using ::storage::FeeStorage;
+using ::storage::StorageJob;
+
+static constexpr uint32_t SECTOR_SIZE  = 256U;
+static constexpr size_t SECTOR_COUNT   = 4U;
+static constexpr size_t MAX_DATA_SIZE  = 16U;
+static constexpr uint32_t BLOCK_SMALL  = 0U;
+static constexpr uint32_t BLOCK_TINY   = 2U;
+static constexpr uint32_t BLOCK_UNUSED = 3U;
+
+static constexpr ::storage::FeeBlockConfig FEE_BLOCK_CONFIG[] = {
+    {8U /* size in bytes */},
+    {MAX_DATA_SIZE},
+    {3U},
+};
+
+static constexpr size_t CONFIG_SIZE = sizeof(FEE_BLOCK_CONFIG) / sizeof(::storage::FeeBlockConfig);
+
+using Flash   = ::storage::test::FlashMemoryFake<SECTOR_SIZE, SECTOR_COUNT>;
+using Storage = ::storage::declare::FeeStorage<CONFIG_SIZE, MAX_DATA_SIZE>;
+
+class FeeStorageTest : public Test
+{
+public:
+    FeeStorageTest() : storage(FEE_BLOCK_CONFIG, flash, flash.getMemory(), 0U, SECTOR_SIZE, context)
+    {}
+
+    static StorageJob::ResultType write(
+        Storage& fee,
+        uint32_t const id,
+        ::etl::span<uint8_t const> const data,
+        size_t const offset = 0U)
+    {
+        StorageJob::Type::Write::BufferType buf(data);
+        StorageJob job;
+        job.init(id, StorageJob::JobDoneCallback());
+        job.initWrite(buf, offset);
+        fee.process(job);
+        return job.getResult();
+    }
+
+    static StorageJob::ResultType read(
+        Storage& fee,
+        uint32_t const id,
+        ::etl::span<uint8_t> const data,
+        size_t& readSize,
+        size_t const offset = 0U)
+    {
+        StorageJob::Type::Read::BufferType buf(data);
+        StorageJob job;
+        job.init(id, StorageJob::JobDoneCallback());
+        job.initRead(buf, offset);
+        fee.process(job);
+        readSize = job.getRead().getReadSize();
+        return job.getResult();
+    }
+
+    StorageJob::ResultType write(uint32_t const id, ::etl::span<uint8_t const> const data)
+    {
+        return write(storage, id, data);
+    }
+
+    // writes the value to every block
+    void writeAll(uint8_t const value)
+    {
+        ::etl::array<uint8_t, MAX_DATA_SIZE> data;
+        data.fill(value);
+        for (uint32_t id = 0U; id < CONFIG_SIZE; ++id)
+        {
+            ASSERT_TRUE(::etl::holds_alternative<StorageJob::Result::Success>(write(
+                id, ::etl::span<uint8_t const>(data).first(FEE_BLOCK_CONFIG[id].dataSize))));
+        }
+    }
+
+    // checks that every block contains the value
+    void expectAll(Storage& fee, uint8_t const value)
+    {
+        for (uint32_t id = 0U; id < CONFIG_SIZE; ++id)
+        {
+            ::etl::array<uint8_t, MAX_DATA_SIZE> data{};
+            size_t readSize = 0U;
+            EXPECT_TRUE(::etl::holds_alternative<StorageJob::Result::Success>(
+                read(fee, id, data, readSize)));
+            EXPECT_EQ(FEE_BLOCK_CONFIG[id].dataSize, readSize);
+            for (size_t i = 0U; i < readSize; ++i)
+            {
+                EXPECT_EQ(value, data[i]);
+            }
+        }
+    }
+
+protected:
+    StrictMock<::async::AsyncMock> asyncMock;
+    ::async::TestContext context{1};
+    Flash flash;
+    Storage storage;
+};
+
+TEST_F(FeeStorageTest, InitStartsLogInBlankMemory)
+{
+    ASSERT_TRUE(storage.init());
+    // sector header: magic and sequence number 1
+    uint8_t const header[] = {0x46U, 0x45U, 0x45U, 0x31U, 0x00U, 0x00U, 0x00U, 0x01U};
+    EXPECT_THAT(flash.getMemory().first(sizeof(header)), ElementsAreArray(header));
+    EXPECT_EQ(0U, flash.eraseCount);
+
+    ::etl::array<uint8_t, 8U> data{};
+    size_t readSize = 0U;
+    EXPECT_TRUE(::etl::holds_alternative<StorageJob::Result::DataLoss>(
+        read(storage, BLOCK_SMALL, data, readSize)));
+    EXPECT_EQ(0U, readSize);
+}
+
+TEST_F(FeeStorageTest, JobsFailWithoutInit)
+{
+    uint8_t const data[] = {1U};
+    EXPECT_TRUE(::etl::holds_alternative<StorageJob::Result::Error>(write(BLOCK_SMALL, data)));
+}
+
+TEST_F(FeeStorageTest, InitFailsForInvalidConfig)
+{
+    // all blocks plus one more record don't fit into a sector
+    static constexpr ::storage::FeeBlockConfig BIG_CONFIG[] = {{100U}, {100U}};
+    ::storage::declare::FeeStorage<2U, 100U> fee(
+        BIG_CONFIG, flash, flash.getMemory(), 0U, SECTOR_SIZE, context);
+    EXPECT_FALSE(fee.init());
+
+    // sector size doesn't match the flash blocks
+    Storage fee2(FEE_BLOCK_CONFIG, flash, flash.getMemory(), 0U, SECTOR_SIZE * 2U, context);
+    EXPECT_FALSE(fee2.init());
+
+    // a single sector isn't enough
+    Storage fee3(
+        FEE_BLOCK_CONFIG, flash, flash.getMemory().first(SECTOR_SIZE), 0U, SECTOR_SIZE, context);
+    EXPECT_FALSE(fee3.init());
+}
+
+TEST_F(FeeStorageTest, WriteAndRead)
+{
+    ASSERT_TRUE(storage.init());
+    uint8_t const data[] = {1U, 2U, 3U};
+    EXPECT_TRUE(::etl::holds_alternative<StorageJob::Result::Success>(write(BLOCK_SMALL, data)));
+    uint8_t const data2[] = {4U, 5U};
+    EXPECT_TRUE(::etl::holds_alternative<StorageJob::Result::Success>(write(BLOCK_SMALL, data2)));
+
+    ::etl::array<uint8_t, 8U> readData{};
+    size_t readSize = 0U;
+    EXPECT_TRUE(::etl::holds_alternative<StorageJob::Result::Success>(
+        read(storage, BLOCK_SMALL, readData, readSize)));
+    EXPECT_EQ(3U, readSize);
+    EXPECT_THAT(::etl::span<uint8_t>(readData).first(3U), ElementsAre(4U, 5U, 3U));
+
+    // read with offset into a smaller buffer
+    ::etl::array<uint8_t, 1U> readData2{};
+    EXPECT_TRUE(::etl::holds_alternative<StorageJob::Result::Success>(
+        read(storage, BLOCK_SMALL, readData2, readSize, 2U)));
+    EXPECT_EQ(1U, readSize);
+    EXPECT_EQ(3U, readData2[0U]);
+
+    // each write appends a record
+    EXPECT_EQ(3U, flash.writeCount);
+    EXPECT_EQ(2U, flash.flushCount);
+    EXPECT_EQ(5U, storage.getStatistics().writtenBytes);
+}
+
+TEST_F(FeeStorageTest, WriteWithOffset)
+{
+    ASSERT_TRUE(storage.init());
+    uint8_t const data[] = {7U, 8U};
+    EXPECT_TRUE(::etl::holds_alternative<StorageJob::Result::Success>(
+        write(storage, BLOCK_SMALL, data, 3U)));
+
+    ::etl::array<uint8_t, 8U> readData{};
+    size_t readSize = 0U;
+    EXPECT_TRUE(::etl::holds_alternative<StorageJob::Result::Success>(
+        read(storage, BLOCK_SMALL, readData, readSize)));
+    EXPECT_EQ(5U, readSize);
+    // data before the offset is initialized with zeros
+    EXPECT_THAT(::etl::span<uint8_t>(readData).first(5U), ElementsAre(0U, 0U, 0U, 7U, 8U));
+
+    uint8_t const data2[] = {9U};
+    EXPECT_TRUE(::etl::holds_alternative<StorageJob::Result::Success>(
+        write(storage, BLOCK_SMALL, data2, 1U)));
+    EXPECT_TRUE(::etl::holds_alternative<StorageJob::Result::Success>(
+        read(storage, BLOCK_SMALL, readData, readSize)));
+    EXPECT_EQ(5U, readSize);
+    EXPECT_THAT(::etl::span<uint8_t>(readData).first(5U), ElementsAre(0U, 9U, 0U, 7U, 8U));
+}
+
+TEST_F(FeeStorageTest, InvalidWrites)
+{
+    ASSERT_TRUE(storage.init());
+    uint8_t const data[] = {1U, 2U, 3U, 4U};
+    // too much data
+    EXPECT_TRUE(::etl::holds_alternative<StorageJob::Result::Error>(
+        write(storage, BLOCK_TINY, data, 0U)));
+    EXPECT_TRUE(::etl::holds_alternative<StorageJob::Result::Error>(
+        write(storage, BLOCK_SMALL, data, 5U)));
+    // offset out of range
+    EXPECT_TRUE(::etl::holds_alternative<StorageJob::Result::Error>(
+        write(storage, BLOCK_TINY, ::etl::span<uint8_t const>(data).first(1U), 3U)));
+    // no data
+    EXPECT_TRUE(::etl::holds_alternative<StorageJob::Result::Error>(
+        write(BLOCK_SMALL, ::etl::span<uint8_t const>())));
+    // unknown block
+    EXPECT_TRUE(::etl::holds_alternative<StorageJob::Result::Error>(write(BLOCK_UNUSED, data)));
+    // only the sector header has been programmed
+    EXPECT_EQ(1U, flash.writeCount);
+}
+
+TEST_F(FeeStorageTest, IndexIsRebuiltByInit)
+{
+    ASSERT_TRUE(storage.init());
+    for (uint8_t value = 0U; value < 20U; ++value)
+    {
+        context.handleExecute();
+        writeAll(value);
+        context.execute();
+    }
+    expectAll(storage, 19U);
+
+    Storage storage2(FEE_BLOCK_CONFIG, flash, flash.getMemory(), 0U, SECTOR_SIZE, context);
+    ASSERT_TRUE(storage2.init());
+    expectAll(storage2, 19U);
+    // log continues where it ended
+    uint8_t const data[] = {42U};
+    EXPECT_TRUE(::etl::holds_alternative<StorageJob::Result::Success>(
+        write(storage2, BLOCK_TINY, data)));
+    Storage storage3(FEE_BLOCK_CONFIG, flash, flash.getMemory(), 0U, SECTOR_SIZE, context);
+    ASSERT_TRUE(storage3.init());
+    ::etl::array<uint8_t, 3U> readData{};
+    size_t readSize = 0U;
+    EXPECT_TRUE(::etl::holds_alternative<StorageJob::Result::Success>(
+        read(storage3, BLOCK_TINY, readData, readSize)));
+    EXPECT_THAT(readData, ElementsAre(42U, 19U, 19U));
+}
+
+TEST_F(FeeStorageTest, GarbageCollectionRunsInBackground)
+{
+    ASSERT_TRUE(storage.init());
+    context.handleExecute();
+    for (uint8_t value = 0U; value < 100U; ++value)
+    {
+        writeAll(value);
+        // garbage collection steps run in between jobs
+        context.execute();
+    }
+    expectAll(storage, 99U);
+    auto const& statistics = storage.getStatistics();
+    EXPECT_LT(0U, statistics.erasedSectors);
+    EXPECT_EQ(0U, statistics.forcedCollections);
+    EXPECT_EQ(100U * (8U + 16U + 3U), statistics.writtenBytes);
+    // only the latest records are copied, so the write amplification stays small
+    EXPECT_LT(statistics.programmedBytes, 3U * 100U * (16U + 24U + 16U));
+}
+
+TEST_F(FeeStorageTest, GarbageCollectionIsFinishedByWrite)
+{
+    ASSERT_TRUE(storage.init());
+    context.handleExecute();
+    // context isn't executed, so the writes have to collect the garbage themselves
+    for (uint8_t value = 0U; value < 100U; ++value)
+    {
+        writeAll(value);
+    }
+    expectAll(storage, 99U);
+    EXPECT_LT(0U, storage.getStatistics().forcedCollections);
+    context.execute();
+    expectAll(storage, 99U);
+}
+
+TEST_F(FeeStorageTest, TwoSectors)
+{
+    Storage fee(
+        FEE_BLOCK_CONFIG,
+        flash,
+        flash.getMemory().first(2U * SECTOR_SIZE),
+        0U,
+        SECTOR_SIZE,
+        context);
+    ASSERT_TRUE(fee.init());
+    context.handleExecute();
+    ::etl::array<uint8_t, MAX_DATA_SIZE> data;
+    for (uint8_t value = 0U; value < 50U; ++value)
+    {
+        data.fill(value);
+        ASSERT_TRUE(::etl::holds_alternative<StorageJob::Result::Success>(
+            write(fee, value % CONFIG_SIZE, ::etl::span<uint8_t const>(data).first(3U))));
+        context.execute();
+    }
+    Storage fee2(
+        FEE_BLOCK_CONFIG,
+        flash,
+        flash.getMemory().first(2U * SECTOR_SIZE),
+        0U,
+        SECTOR_SIZE,
+        context);
+    ASSERT_TRUE(fee2.init());
+    ::etl::array<uint8_t, 3U> readData{};
+    size_t readSize = 0U;
+    EXPECT_TRUE(::etl::holds_alternative<StorageJob::Result::Success>(
+        read(fee2, BLOCK_SMALL, readData, readSize)));
+    EXPECT_THAT(readData, ElementsAre(48U, 48U, 48U));
+    EXPECT_TRUE(::etl::holds_alternative<StorageJob::Result::Success>(
+        read(fee2, BLOCK_TINY, readData, readSize)));
+    EXPECT_THAT(readData, ElementsAre(47U, 47U, 47U));
+}
+
+TEST_F(FeeStorageTest, InterruptedWriteKeepsPreviousData)
+{
+    ASSERT_TRUE(storage.init());
+    uint8_t const data[] = {1U, 2U, 3U};
+    EXPECT_TRUE(::etl::holds_alternative<StorageJob::Result::Success>(write(BLOCK_SMALL, data)));
+
+    // power loss after header and first data byte of the next record
+    flash.programLimit    = FeeStorage::RECORD_HEADER_SIZE + 1U;
+    uint8_t const data2[] = {4U, 5U, 6U};
+    EXPECT_TRUE(::etl::holds_alternative<StorageJob::Result::Error>(write(BLOCK_SMALL, data2)));
+    flash.programLimit = Flash::NO_LIMIT;
+
+    Storage storage2(FEE_BLOCK_CONFIG, flash, flash.getMemory(), 0U, SECTOR_SIZE, context);
+    ASSERT_TRUE(storage2.init());
+    ::etl::array<uint8_t, 3U> readData{};
+    size_t readSize = 0U;
+    EXPECT_TRUE(::etl::holds_alternative<StorageJob::Result::Success>(
+        read(storage2, BLOCK_SMALL, readData, readSize)));
+    EXPECT_THAT(readData, ElementsAre(1U, 2U, 3U));
+    // the corrupt record is skipped
+    uint8_t const data3[] = {7U};
+    EXPECT_TRUE(::etl::holds_alternative<StorageJob::Result::Success>(
+        write(storage2, BLOCK_TINY, data3)));
+    EXPECT_TRUE(::etl::holds_alternative<StorageJob::Result::Success>(
+        read(storage2, BLOCK_TINY, readData, readSize)));
+    EXPECT_EQ(1U, readSize);
+    EXPECT_EQ(7U, readData[0U]);
+}
+
+TEST_F(FeeStorageTest, InitErasesSectorsOutsideOfLog)
+{
+    // garbage in a sector that doesn't belong to the log
+    flash.memory[3U * SECTOR_SIZE + 100U] = 0U;
+    ASSERT_TRUE(storage.init());
+    EXPECT_EQ(1U, flash.eraseCount);
+    EXPECT_EQ(0xFFU, flash.memory[3U * SECTOR_SIZE + 100U]);
+}
+
+} // anonymous namespace
@@ -10,6 +10,7 @@
 #include <etl/span.h>
 #include <storage/EepStorage.h>
 #include <storage/FeeStorage.h>
+#include <storage/FlashMemoryFake.h>
 #include <storage/IStorageMock.h>
 #include <storage/MappingStorage.h>
 #include <storage/QueuingStorage.h>
@@ -55,6 +56,10 @@ static constexpr ::storage::EepBlockConfig EEP_BLOCK_CONFIG[] = {
     {38U, 5U, true}, // invalid data size (bigger than the limit given for eepStorage)
 };
 
+static constexpr ::storage::FeeBlockConfig FEE_BLOCK_CONFIG[] = {
+    {4U /* size */},
+};
+
 class StorageTest : public Test
 {
 public:
@@ -62,6 +67,7 @@ public:
 
     StorageTest()
     : eepStorage(EEP_BLOCK_CONFIG, eepMock)
+    , feeStorage(FEE_BLOCK_CONFIG, feeFlash, feeFlash.getMemory(), 0U, FEE_SECTOR_SIZE, context)
     , eepQueuingStorage(eepStorage, context)
     , feeQueuingStorage(feeStorage, context)
     , storage(
@@ -90,6 +96,13 @@ public:
         eepData[13U] = 3U;
         eepData[32U] = 0U;
         eepData[33U] = 1U; // NOTE: smaller than the defined dataSize
+        // store initial data for BLOCKID2
+        (void)feeStorage.init();
+        uint8_t const feeData[] = {FEE_INITVAL};
+        StorageJob::Type::Write::BufferType feeBuf(feeData);
+        StorageJob feeJob;
+        feeJob.initWrite(feeBuf);
+        feeStorage.process(feeJob);
     }
 
     void eepRead(uint32_t address, uint8_t* dst, uint32_t length)
@@ -149,7 +162,12 @@ protected:
         (sizeof(EEP_BLOCK_CONFIG) / sizeof(::storage::EepBlockConfig)),
         4U /* max data size */>
         eepStorage;
-    ::storage::FeeStorage feeStorage;
+    static constexpr uint32_t FEE_SECTOR_SIZE = 64U;
+    ::storage::test::FlashMemoryFake<FEE_SECTOR_SIZE, 2U> feeFlash;
+    ::storage::declare::FeeStorage<
+        (sizeof(FEE_BLOCK_CONFIG) / sizeof(::storage::FeeBlockConfig)),
+        4U /* max data size */>
+        feeStorage;
     ::storage::IStorageMock storageMock;
     ::storage::QueuingStorage eepQueuingStorage;
     ::storage::QueuingStorage feeQueuingStorage;
@@ -203,7 +221,6 @@ TEST_F(StorageTest, MultipleJobsAtOnce)
 
     EXPECT_CALL(eepMock, read(0U, _, 6U))
         .WillOnce(DoAll(Invoke(this, &StorageTest::eepRead), Return(::bsp::BSP_OK)));
-    // NOTE: FeeStorage still not implemented, no FEE mock needed
     context.execute();
 
     EXPECT_TRUE(hasSucceeded(BLOCKID1));
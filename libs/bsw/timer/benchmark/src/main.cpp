@@ -0,0 +1,87 @@
+// Copyright 2024 Accenture.
+
+#include <benchmark/benchmark.h>
+#include <timer/Timeout.h>
+#include <timer/Timer.h>
+#include <timer/TimerWheel.h>
+
+#include <vector>
+
+namespace
+{
+struct NoLock
+{};
+
+struct BenchmarkTimeout : public ::timer::Timeout
+{
+    void expired() override { ++_expiredCount; }
+
+    uint32_t _expiredCount = 0U;
+};
+
+using List  = ::timer::Timer<NoLock>;
+using Wheel = ::timer::TimerWheel<NoLock>;
+
+/// Cyclic periods similar to those of an ECU (DoCAN, DoIP, UDS S3, lifecycle and safety).
+constexpr uint32_t PERIODS[] = {1000U, 5000U, 10000U, 20000U, 50000U, 100000U, 1000000U};
+constexpr size_t PERIOD_COUNT = sizeof(PERIODS) / sizeof(PERIODS[0]);
+
+template<class T>
+void setupCyclicTimeouts(T& timer, std::vector<BenchmarkTimeout>& timeouts)
+{
+    for (size_t i = 0U; i < timeouts.size(); ++i)
+    {
+        (void)timer.setCyclic(timeouts[i], PERIODS[i % PERIOD_COUNT], static_cast<uint32_t>(i));
+    }
+}
+} // namespace
+
+/**
+ * Benchmarks setting and cancelling a one shot timeout while state.range(0) cyclic timeouts
+ * are active.
+ */
+template<class T>
+void BM_set_cancel(benchmark::State& state)
+{
+    std::vector<BenchmarkTimeout> timeouts(static_cast<size_t>(state.range(0)));
+    BenchmarkTimeout timeout;
+    T timer;
+    setupCyclicTimeouts(timer, timeouts);
+
+    uint32_t now = 0U;
+    while (state.KeepRunning())
+    {
+        (void)timer.set(timeout, 30000U, now);
+        timer.cancel(timeout);
+        ++now;
+    }
+}
+
+/**
+ * Benchmarks the processing of state.range(0) cyclic timeouts over one second of simulated
+ * time, i.e. expiry including the rescheduling of the cyclic timeouts.
+ */
+template<class T>
+void BM_process_cyclic(benchmark::State& state)
+{
+    std::vector<BenchmarkTimeout> timeouts(static_cast<size_t>(state.range(0)));
+    T timer;
+    setupCyclicTimeouts(timer, timeouts);
+
+    uint32_t now = 0U;
+    while (state.KeepRunning())
+    {
+        uint32_t const end = now + 1000000U;
+        uint32_t nextDelta = 0U;
+        while (timer.getNextDelta(now, nextDelta) && (static_cast<int32_t>(now - end) < 0))
+        {
+            now += nextDelta;
+            while (timer.processNextTimeout(now)) {}
+        }
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_set_cancel, List)->RangeMultiplier(4)->Range(16, 1024);
+BENCHMARK_TEMPLATE(BM_set_cancel, Wheel)->RangeMultiplier(4)->Range(16, 1024);
+BENCHMARK_TEMPLATE(BM_process_cyclic, List)->RangeMultiplier(4)->Range(16, 1024);
+BENCHMARK_TEMPLATE(BM_process_cyclic, Wheel)->RangeMultiplier(4)->Range(16, 1024);
@@ -2,7 +2,7 @@
 
 #pragma once
 
-#include <etl/intrusive_forward_list.h>
+#include <etl/intrusive_links.h>
 
 #include <cstdint>
 
@@ -14,8 +14,10 @@ class Timer;
 /**
  * A class providing interface for Timeout objects.
  *
+ * The doubly linked base allows all timer engines (\ref Timer, \ref TimerWheel) to unlink a
+ * timeout without searching for its predecessor.
  */
-struct Timeout : public ::etl::forward_link<0>
+struct Timeout : public ::etl::bidirectional_link<0>
 {
     Timeout() = default;
 
@@ -4,6 +4,8 @@
 
 #include "timer/Timeout.h"
 
+#include <etl/intrusive_list.h>
+
 #include <cstdint>
 
 namespace timer
@@ -21,7 +23,7 @@ template<class LockGuard>
 class Timer
 {
 public:
-    using TimeoutList = ::etl::intrusive_forward_list<Timeout, ::etl::forward_link<0>>;
+    using TimeoutList = ::etl::intrusive_list<Timeout, ::etl::bidirectional_link<0>>;
 
     /**
      * Called by the system to process the next elapsed timeout.
@@ -199,21 +201,19 @@ bool Timer<LockGuard>::addTimeout(
 
     LockGuard const lock;
 
-    int32_t const timeoutDiff  = diff(timeout._time, now);
-    TimeoutList::iterator prev = _timeoutList.before_begin();
+    int32_t const timeoutDiff = diff(timeout._time, now);
+    TimeoutList::iterator next = _timeoutList.begin();
 
-    for (TimeoutList::iterator current = _timeoutList.begin(); current != _timeoutList.end();
-         ++current)
+    for (; next != _timeoutList.end(); ++next)
     {
-        int32_t const nextDiff = diff(current->_time, now);
+        int32_t const nextDiff = diff(next->_time, now);
         if (nextDiff > timeoutDiff)
         {
             break;
         }
-        prev = current;
     }
 
-    TimeoutList::iterator const insertPos = _timeoutList.insert_after(prev, timeout);
+    TimeoutList::iterator const insertPos = _timeoutList.insert(next, timeout);
     return _timeoutList.begin() == insertPos; // will expire before all other
 }
 
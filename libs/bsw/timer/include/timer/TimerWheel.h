@@ -0,0 +1,512 @@
+// Copyright 2024 Accenture.
+
+#pragma once
+
+#include "timer/Timeout.h"
+
+#include <etl/binary.h>
+#include <etl/intrusive_links.h>
+
+#include <cstdint>
+
+namespace timer
+{
+
+/**
+ * A hierarchical timing wheel serving as collection of timeouts.
+ * It provides the same interface as \ref Timer and can be used as a drop-in replacement for it.
+ *
+ * Timeouts are hashed into slots of LEVEL_COUNT wheels with SLOT_COUNT slots each. A wheel on
+ * level n covers SLOT_COUNT slots of the width of the complete wheel on level n - 1, the slot
+ * width on level 0 is 2^TickShift microseconds. Timeouts on a higher level are moved (cascaded)
+ * towards level 0 when the wheel reaches their slot. Compared to the sorted list used by
+ * \ref Timer this results in:
+ * - O(1) set() and cancel()
+ * - expired timeouts of a slot being collected in a single batch by processNextTimeout()
+ * - LEVEL_COUNT * SLOT_COUNT slot anchors (two pointers each) as memory overhead.
+ *
+ * Timeouts never expire early, the expiry time is checked exactly. Timeouts expiring within
+ * the same slot on level 0 however are processed in insertion order rather than in order of
+ * their exact expiry time.
+ *
+ * \tparam LockGuard is the type that implements RAII-based lock for secure section.
+ * \tparam TickShift is the binary logarithm of the width of a slot on level 0 in microseconds.
+ * \tparam SlotBits is the binary logarithm of the number of slots per level (max. 5).
+ */
+template<class LockGuard, uint8_t TickShift = 7U, uint8_t SlotBits = 5U>
+class TimerWheel
+{
+public:
+    static_assert(SlotBits <= 5U, "slot occupation of a level is tracked in 32 bits");
+    static_assert(TickShift < 32U, "slot width must fit into 32 bits");
+
+    static uint32_t const SLOT_COUNT = static_cast<uint32_t>(1U) << SlotBits;
+    static uint8_t const LEVEL_COUNT
+        = static_cast<uint8_t>((32U - TickShift + SlotBits - 1U) / SlotBits);
+    static uint32_t const TICK_IN_US = static_cast<uint32_t>(1U) << TickShift;
+
+    TimerWheel();
+
+    TimerWheel(TimerWheel const&)            = delete;
+    TimerWheel& operator=(TimerWheel const&) = delete;
+
+    /**
+     * Called by the system to process the next elapsed timeout.
+     * All timeouts that have been elapsed since the last call are collected in one batch,
+     * one of them is processed per call.
+     * \param now Current system time
+     * \return
+     * - true if a timeout has been processed and a next timeout should be processed
+     * - false otherwise
+     */
+    bool processNextTimeout(uint32_t now);
+
+    /**
+     * Get the next timeout delta to set.
+     * The caller has to make sure, that now is the current system time.
+     * The delta may point to an internal cascading point of the wheel that precedes the
+     * next expiry. In this case processNextTimeout() will not process a timeout when called
+     * at this point but advance the wheel.
+     * \param now Current system time
+     * \param nextDelta reference to variable that receives next delta to set
+     * \return
+     * - true && nextDelta > 0 if the systems timeout should be rescheduled with nextTimeout
+     * - true && nextDelta == 0 if an event in the system should be triggered immediately
+     * - false otherwise
+     */
+    bool getNextDelta(uint32_t now, uint32_t& nextDelta) const;
+
+    /**
+     * Check whether a timer is active.
+     * \param timeout Reference to Timeout
+     * \return
+     * - true if timer is event
+     * - false otherwise
+     */
+    bool isActive(Timeout const& timeout) const;
+
+    /**
+     * Set a single shot timeout.
+     * \param timeout Reference to Timeout
+     * \param Delay relative value, indicating when the timer will be triggered
+     * \param now Current system time
+     * \return
+     * - true if an event in the system should be triggered, i.e. the timeout expires before
+     *   the point of time reported by the last call to getNextDelta() or by a previous call
+     *   to set() that returned true
+     * - false otherwise
+     */
+    bool set(Timeout& timeout, uint32_t delay, uint32_t now);
+
+    /**
+     * Set a cyclic timeout.
+     * \param timeout Reference to Timeout
+     * \param period Time between cyclic timeouts
+     * \param now Current system time
+     * \return
+     * - true if an event in the system should be triggered
+     * - false otherwise
+     */
+    bool setCyclic(Timeout& timeout, uint32_t period, uint32_t now);
+
+    /**
+     * Cancel running timeout.
+     * If the timeout is not scheduled, cancel won't do anything.
+     *
+     * \param timeout Reference to Timeout
+     */
+    void cancel(Timeout& timeout);
+
+private:
+    using Link = ::etl::bidirectional_link<0>;
+
+    static uint32_t const SLOT_MASK = SLOT_COUNT - 1U;
+
+    struct Level
+    {
+        Link _slots[SLOT_COUNT];
+        uint32_t _occupied;
+    };
+
+    void rescheduleCyclicTimeout(Timeout& timeout, uint32_t now);
+
+    bool addTimeout(Timeout& timeout, uint32_t absoluteTimeout, uint32_t cycleTime, uint32_t now);
+
+    void insert(Timeout& timeout);
+    void collect(uint32_t now);
+    void cascade();
+    void drainCurrentSlot(uint32_t now);
+    bool findNextTick(uint32_t& nextTick) const;
+    bool findNextExpiry(uint32_t now, int32_t& nextDiff) const;
+
+    static uint32_t slotIndex(uint32_t time, uint8_t level);
+    static uint32_t levelShift(uint8_t level);
+    static bool findSlot(Level const& level, uint32_t start, uint32_t& distance);
+    static bool isEmpty(Link const& anchor);
+    static void append(Link& anchor, Link& link);
+    static int32_t diff(uint32_t a, uint32_t const b);
+
+    Level _levels[LEVEL_COUNT];
+    Link _expired;
+    uint32_t _current;
+    uint32_t _count;
+    mutable uint32_t _nextExpiry;
+    mutable bool _hasNextExpiry;
+};
+
+template<class LockGuard, uint8_t TickShift, uint8_t SlotBits>
+TimerWheel<LockGuard, TickShift, SlotBits>::TimerWheel()
+: _expired(&_expired, &_expired)
+, _current(0U)
+, _count(0U)
+, _nextExpiry(0U)
+, _hasNextExpiry(false)
+{
+    for (Level& level : _levels)
+    {
+        for (Link& slot : level._slots)
+        {
+            slot.etl_previous = &slot;
+            slot.etl_next     = &slot;
+        }
+        level._occupied = 0U;
+    }
+}
+
+template<class LockGuard, uint8_t TickShift, uint8_t SlotBits>
+bool TimerWheel<LockGuard, TickShift, SlotBits>::processNextTimeout(uint32_t const now)
+{
+    Timeout* timeout = nullptr;
+    {
+        LockGuard const scopedLock;
+        if (isEmpty(_expired))
+        {
+            collect(now);
+            if (isEmpty(_expired))
+            {
+                return false;
+            }
+        }
+        timeout = static_cast<Timeout*>(_expired.etl_next);
+        timeout->unlink();
+        --_count;
+    }
+
+    rescheduleCyclicTimeout(*timeout, now);
+    timeout->expired();
+    return true;
+}
+
+template<class LockGuard, uint8_t TickShift, uint8_t SlotBits>
+bool TimerWheel<LockGuard, TickShift, SlotBits>::getNextDelta(
+    uint32_t const now, uint32_t& nextDelta) const
+{
+    LockGuard const scopedLock;
+    int32_t nextDiff = 0;
+    if (findNextExpiry(now, nextDiff))
+    {
+        nextDelta      = (nextDiff < 0) ? 0U : static_cast<uint32_t>(nextDiff);
+        _nextExpiry    = now + nextDelta;
+        _hasNextExpiry = true;
+        return true;
+    }
+
+    nextDelta      = 0U;
+    _hasNextExpiry = false;
+    return false;
+}
+
+template<class LockGuard, uint8_t TickShift, uint8_t SlotBits>
+bool TimerWheel<LockGuard, TickShift, SlotBits>::isActive(Timeout const& timeout) const
+{
+    return timeout.is_linked();
+}
+
+template<class LockGuard, uint8_t TickShift, uint8_t SlotBits>
+bool TimerWheel<LockGuard, TickShift, SlotBits>::set(
+    Timeout& timeout, uint32_t const delay, uint32_t const now)
+{
+    return addTimeout(timeout, delay + now, 0U, now);
+}
+
+template<class LockGuard, uint8_t TickShift, uint8_t SlotBits>
+bool TimerWheel<LockGuard, TickShift, SlotBits>::setCyclic(
+    Timeout& timeout, uint32_t const period, uint32_t const now)
+{
+    return addTimeout(timeout, period + now, period, now);
+}
+
+template<class LockGuard, uint8_t TickShift, uint8_t SlotBits>
+void TimerWheel<LockGuard, TickShift, SlotBits>::cancel(Timeout& timeout)
+{
+    if (timeout.is_linked())
+    {
+        LockGuard const scopedLock;
+        // The occupation bit of the slot is left set and cleared lazily when visiting the slot.
+        timeout.unlink();
+        --_count;
+    }
+}
+
+template<class LockGuard, uint8_t TickShift, uint8_t SlotBits>
+void TimerWheel<LockGuard, TickShift, SlotBits>::rescheduleCyclicTimeout(
+    Timeout& timeout, uint32_t const now)
+{
+    if (timeout._cycleTime > 0U)
+    {
+        (void)addTimeout(timeout, timeout._cycleTime + timeout._time, timeout._cycleTime, now);
+    }
+}
+
+template<class LockGuard, uint8_t TickShift, uint8_t SlotBits>
+bool TimerWheel<LockGuard, TickShift, SlotBits>::addTimeout(
+    Timeout& timeout, uint32_t const absoluteTimeout, uint32_t const cycleTime, uint32_t const now)
+{
+    if (timeout.is_linked())
+    {
+        return false;
+    }
+
+    timeout._time      = absoluteTimeout;
+    timeout._cycleTime = cycleTime;
+
+    LockGuard const lock;
+
+    if (_count == 0U)
+    {
+        // nothing to cascade, catch up with the current time
+        _current = now & ~(TICK_IN_US - 1U);
+    }
+    insert(timeout);
+    ++_count;
+    // will expire before the point of time the system has been told to wake up
+    if (_hasNextExpiry && (diff(timeout._time, _nextExpiry) >= 0))
+    {
+        return false;
+    }
+    _nextExpiry    = timeout._time;
+    _hasNextExpiry = true;
+    return true;
+}
+
+template<class LockGuard, uint8_t TickShift, uint8_t SlotBits>
+void TimerWheel<LockGuard, TickShift, SlotBits>::insert(Timeout& timeout)
+{
+    uint32_t const tick  = timeout._time & ~(TICK_IN_US - 1U);
+    int32_t const delta  = diff(tick, _current);
+    uint32_t const ticks = (delta > 0) ? (static_cast<uint32_t>(delta) >> TickShift) : 0U;
+
+    uint8_t level = 0U;
+    while ((level < (LEVEL_COUNT - 1U))
+           && ((ticks >> (static_cast<uint32_t>(SlotBits) * (level + 1U))) != 0U))
+    {
+        ++level;
+    }
+
+    // expired timeouts are put into the current slot
+    uint32_t const index = slotIndex((delta > 0) ? tick : _current, level);
+    append(_levels[level]._slots[index], timeout);
+    _levels[level]._occupied |= (static_cast<uint32_t>(1U) << index);
+}
+
+template<class LockGuard, uint8_t TickShift, uint8_t SlotBits>
+void TimerWheel<LockGuard, TickShift, SlotBits>::collect(uint32_t const now)
+{
+    uint32_t const nowTick = now & ~(TICK_IN_US - 1U);
+    while (true)
+    {
+        drainCurrentSlot(now);
+        if (diff(nowTick, _current) <= 0)
+        {
+            break;
+        }
+        uint32_t nextTick = 0U;
+        if ((!findNextTick(nextTick)) || (diff(nextTick, nowTick) > 0))
+        {
+            nextTick = nowTick;
+        }
+        _current = nextTick;
+        cascade();
+    }
+}
+
+template<class LockGuard, uint8_t TickShift, uint8_t SlotBits>
+void TimerWheel<LockGuard, TickShift, SlotBits>::cascade()
+{
+    for (uint8_t level = 1U; level < LEVEL_COUNT; ++level)
+    {
+        if (slotIndex(_current, level - 1U) != 0U)
+        {
+            break;
+        }
+        uint32_t const index = slotIndex(_current, level);
+        Link& slot           = _levels[level]._slots[index];
+        Link* link           = slot.etl_next;
+        slot.etl_previous    = &slot;
+        slot.etl_next        = &slot;
+        _levels[level]._occupied &= ~(static_cast<uint32_t>(1U) << index);
+        while (link != &slot)
+        {
+            Link* const next = link->etl_next;
+            link->clear();
+            insert(*static_cast<Timeout*>(link));
+            link = next;
+        }
+    }
+}
+
+template<class LockGuard, uint8_t TickShift, uint8_t SlotBits>
+void TimerWheel<LockGuard, TickShift, SlotBits>::drainCurrentSlot(uint32_t const now)
+{
+    uint32_t const index = slotIndex(_current, 0U);
+    Link& slot           = _levels[0U]._slots[index];
+    Link* link           = slot.etl_next;
+    while (link != &slot)
+    {
+        Link* const next = link->etl_next;
+        if (diff(static_cast<Timeout*>(link)->_time, now) <= 0)
+        {
+            link->unlink();
+            append(_expired, *link);
+        }
+        link = next;
+    }
+    if (isEmpty(slot))
+    {
+        _levels[0U]._occupied &= ~(static_cast<uint32_t>(1U) << index);
+    }
+}
+
+template<class LockGuard, uint8_t TickShift, uint8_t SlotBits>
+bool TimerWheel<LockGuard, TickShift, SlotBits>::findNextTick(uint32_t& nextTick) const
+{
+    bool found       = false;
+    int32_t nextDiff = 0;
+    for (uint8_t level = 0U; level < LEVEL_COUNT; ++level)
+    {
+        uint32_t const index = slotIndex(_current, level);
+        uint32_t distance    = 0U;
+        // the current slot of a higher level has already been cascaded
+        if (findSlot(_levels[level], index + 1U, distance))
+        {
+            uint32_t const tick
+                = ((_current >> levelShift(level)) + distance + 1U) << levelShift(level);
+            int32_t const tickDiff = diff(tick, _current);
+            if ((!found) || (tickDiff < nextDiff))
+            {
+                found    = true;
+                nextDiff = tickDiff;
+                nextTick = tick;
+            }
+        }
+    }
+    return found;
+}
+
+template<class LockGuard, uint8_t TickShift, uint8_t SlotBits>
+bool TimerWheel<LockGuard, TickShift, SlotBits>::findNextExpiry(
+    uint32_t const now, int32_t& nextDiff) const
+{
+    if (!isEmpty(_expired))
+    {
+        nextDiff = 0;
+        return true;
+    }
+
+    bool found = false;
+    // exact expiry of the earliest populated slot of level 0
+    uint32_t distance = 0U;
+    if (findSlot(_levels[0U], slotIndex(_current, 0U), distance))
+    {
+        Link const& slot = _levels[0U]._slots[(slotIndex(_current, 0U) + distance) & SLOT_MASK];
+        for (Link const* link = slot.etl_next; link != &slot; link = link->etl_next)
+        {
+            int32_t const timeDiff = diff(static_cast<Timeout const*>(link)->_time, now);
+            if ((!found) || (timeDiff < nextDiff))
+            {
+                found    = true;
+                nextDiff = timeDiff;
+            }
+        }
+    }
+    // cascading points of higher levels
+    for (uint8_t level = 1U; level < LEVEL_COUNT; ++level)
+    {
+        uint32_t const levelIndex = slotIndex(_current, level);
+        if (findSlot(_levels[level], levelIndex + 1U, distance))
+        {
+            uint32_t const tick
+                = ((_current >> levelShift(level)) + distance + 1U) << levelShift(level);
+            int32_t const tickDiff = diff(tick, now);
+            if ((!found) || (tickDiff < nextDiff))
+            {
+                found    = true;
+                nextDiff = tickDiff;
+            }
+        }
+    }
+    return found;
+}
+
+template<class LockGuard, uint8_t TickShift, uint8_t SlotBits>
+inline uint32_t
+TimerWheel<LockGuard, TickShift, SlotBits>::slotIndex(uint32_t const time, uint8_t const level)
+{
+    return (time >> levelShift(level)) & SLOT_MASK;
+}
+
+template<class LockGuard, uint8_t TickShift, uint8_t SlotBits>
+inline uint32_t TimerWheel<LockGuard, TickShift, SlotBits>::levelShift(uint8_t const level)
+{
+    return static_cast<uint32_t>(TickShift) + (static_cast<uint32_t>(SlotBits) * level);
+}
+
+template<class LockGuard, uint8_t TickShift, uint8_t SlotBits>
+bool TimerWheel<LockGuard, TickShift, SlotBits>::findSlot(
+    Level const& level, uint32_t const start, uint32_t& distance)
+{
+    // rotate the occupation bits so that bit 0 corresponds to the start slot
+    uint32_t const shift    = start & SLOT_MASK;
+    uint32_t const occupied = level._occupied;
+    uint32_t rotated        = occupied >> shift;
+    if (shift != 0U)
+    {
+        rotated |= occupied << (SLOT_COUNT - shift);
+    }
+    if (SLOT_COUNT < 32U)
+    {
+        rotated &= (static_cast<uint32_t>(1U) << (SLOT_COUNT & 31U)) - 1U;
+    }
+    // skip slots whose timeouts have been cancelled
+    while (rotated != 0U)
+    {
+        uint32_t const offset = ::etl::count_trailing_zeros(rotated);
+        if (!isEmpty(level._slots[(shift + offset) & SLOT_MASK]))
+        {
+            distance = offset;
+            return true;
+        }
+        rotated &= rotated - 1U;
+    }
+    return false;
+}
+
+template<class LockGuard, uint8_t TickShift, uint8_t SlotBits>
+inline bool TimerWheel<LockGuard, TickShift, SlotBits>::isEmpty(Link const& anchor)
+{
+    return anchor.etl_next == &anchor;
+}
+
+template<class LockGuard, uint8_t TickShift, uint8_t SlotBits>
+inline void TimerWheel<LockGuard, TickShift, SlotBits>::append(Link& anchor, Link& link)
+{
+    ::etl::link_splice<Link>(*anchor.etl_previous, link);
+}
+
+template<class LockGuard, uint8_t TickShift, uint8_t SlotBits>
+inline int32_t TimerWheel<LockGuard, TickShift, SlotBits>::diff(uint32_t const a, uint32_t const b)
+{
+    return static_cast<int32_t>(a - b);
+}
+
+} // namespace timer
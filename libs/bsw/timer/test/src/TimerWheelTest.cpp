@@ -0,0 +1,282 @@
+// Copyright 2024 Accenture.
+
+#include "timer/TimerWheel.h"
+
+#include "timer/Timeout.h"
+#include "timer/Timer.h"
+
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace
+{
+using ::timer::Timeout;
+using ::timer::Timer;
+using ::timer::TimerWheel;
+using namespace ::testing;
+
+struct LockGuard
+{
+    LockGuard()
+    {
+        EXPECT_EQ(lockCounter, 0U) << "cyclic lock discovered";
+        ++lockCounter;
+    }
+
+    ~LockGuard() { --lockCounter; }
+
+    static uint8_t lockCounter;
+};
+
+uint8_t LockGuard::lockCounter = 0U;
+
+struct RecordingTimeout : public Timeout
+{
+    void expired() override { _expiries.push_back(*_now); }
+
+    uint32_t const* _now = nullptr;
+    std::vector<uint32_t> _expiries;
+};
+
+using TimerWheel_t = TimerWheel<LockGuard>;
+using FineWheel_t  = TimerWheel<LockGuard, 0U, 3U>;
+using TimerList_t  = Timer<LockGuard>;
+
+size_t const TIMEOUT_COUNT = 5U;
+
+class TimerWheelTest : public Test
+{
+public:
+    TimerWheelTest() : _now(0U)
+    {
+        for (RecordingTimeout& timeout : _timeouts)
+        {
+            timeout._now = &_now;
+        }
+    }
+
+protected:
+    template<class T>
+    void process(T& timer)
+    {
+        uint32_t nextDelta = 0U;
+        do
+        {
+            while (timer.processNextTimeout(_now)) {}
+        } while (timer.getNextDelta(_now, nextDelta) && (nextDelta == 0U));
+    }
+
+    /**
+     * Lets the time elapse as an RTOS task would do it, i.e. always sleeping exactly for the
+     * delta returned by getNextDelta().
+     */
+    template<class T>
+    void runUntil(T& timer, uint32_t end)
+    {
+        process(timer);
+        uint32_t nextDelta = 0U;
+        while (timer.getNextDelta(_now, nextDelta)
+               && (static_cast<int32_t>((_now + nextDelta) - end) <= 0))
+        {
+            _now += nextDelta;
+            process(timer);
+        }
+        _now = end;
+        process(timer);
+    }
+
+    uint32_t _now;
+    RecordingTimeout _timeouts[TIMEOUT_COUNT];
+};
+
+TEST_F(TimerWheelTest, empty_timer_has_no_next_delta)
+{
+    TimerWheel_t cut;
+    uint32_t nextDelta = 17U;
+    EXPECT_FALSE(cut.getNextDelta(_now, nextDelta));
+    EXPECT_EQ(0U, nextDelta);
+    EXPECT_FALSE(cut.processNextTimeout(_now));
+}
+
+TEST_F(TimerWheelTest, single_timeout_expires_exactly_once_and_not_early)
+{
+    TimerWheel_t cut;
+    EXPECT_TRUE(cut.set(_timeouts[0], 1000U, _now));
+    EXPECT_TRUE(cut.isActive(_timeouts[0]));
+
+    uint32_t nextDelta = 0U;
+    EXPECT_TRUE(cut.getNextDelta(_now, nextDelta));
+    EXPECT_EQ(1000U, nextDelta);
+
+    _now = 999U;
+    EXPECT_FALSE(cut.processNextTimeout(_now));
+    EXPECT_TRUE(cut.getNextDelta(_now, nextDelta));
+    EXPECT_EQ(1U, nextDelta);
+
+    _now = 1000U;
+    EXPECT_TRUE(cut.processNextTimeout(_now));
+    EXPECT_FALSE(cut.processNextTimeout(_now));
+    EXPECT_FALSE(cut.isActive(_timeouts[0]));
+    EXPECT_THAT(_timeouts[0]._expiries, ElementsAre(1000U));
+    EXPECT_FALSE(cut.getNextDelta(_now, nextDelta));
+}
+
+TEST_F(TimerWheelTest, cyclic_timeout_is_rescheduled_relative_to_its_expiry)
+{
+    TimerWheel_t cut;
+    EXPECT_TRUE(cut.setCyclic(_timeouts[0], 10000U, _now));
+    runUntil(cut, 35000U);
+    EXPECT_THAT(_timeouts[0]._expiries, ElementsAre(10000U, 20000U, 30000U));
+    EXPECT_TRUE(cut.isActive(_timeouts[0]));
+
+    // a late processing doesn't shift the cycle
+    _now = 41234U;
+    process(cut);
+    runUntil(cut, 50000U);
+    EXPECT_THAT(_timeouts[0]._expiries, ElementsAre(10000U, 20000U, 30000U, 41234U, 50000U));
+}
+
+TEST_F(TimerWheelTest, timeouts_on_all_levels_expire_in_order)
+{
+    FineWheel_t cut;
+    uint32_t const delays[TIMEOUT_COUNT] = {5U, 70U, 600U, 100000U, 0x7FFFFFFFU};
+    for (size_t i = TIMEOUT_COUNT; i > 0U; --i)
+    {
+        (void)cut.set(_timeouts[i - 1U], delays[i - 1U], _now);
+    }
+    runUntil(cut, 0x7FFFFFFFU);
+    for (size_t i = 0U; i < TIMEOUT_COUNT; ++i)
+    {
+        EXPECT_THAT(_timeouts[i]._expiries, ElementsAre(delays[i])) << i;
+    }
+}
+
+TEST_F(TimerWheelTest, set_returns_true_only_if_timeout_precedes_next_wakeup)
+{
+    TimerWheel_t cut;
+    EXPECT_TRUE(cut.set(_timeouts[0], 3000U, _now));
+    EXPECT_FALSE(cut.set(_timeouts[3], 4000U, _now));
+    uint32_t nextDelta = 0U;
+    EXPECT_TRUE(cut.getNextDelta(_now, nextDelta));
+    EXPECT_EQ(3000U, nextDelta);
+    EXPECT_FALSE(cut.set(_timeouts[1], 3500U, _now));
+    EXPECT_TRUE(cut.set(_timeouts[2], 2000U, _now));
+    EXPECT_FALSE(cut.set(_timeouts[2], 1000U, _now));
+    EXPECT_TRUE(cut.getNextDelta(_now, nextDelta));
+    EXPECT_EQ(2000U, nextDelta);
+}
+
+TEST_F(TimerWheelTest, cancelled_timeouts_do_not_expire)
+{
+    FineWheel_t cut;
+    (void)cut.set(_timeouts[0], 3U, _now);
+    (void)cut.set(_timeouts[1], 1000U, _now);
+    (void)cut.setCyclic(_timeouts[2], 200U, _now);
+    cut.cancel(_timeouts[0]);
+    cut.cancel(_timeouts[1]);
+    EXPECT_FALSE(cut.isActive(_timeouts[0]));
+    EXPECT_FALSE(cut.isActive(_timeouts[1]));
+    // cancelling twice is allowed
+    cut.cancel(_timeouts[1]);
+
+    runUntil(cut, 500U);
+    cut.cancel(_timeouts[2]);
+    runUntil(cut, 5000U);
+    EXPECT_THAT(_timeouts[0]._expiries, IsEmpty());
+    EXPECT_THAT(_timeouts[1]._expiries, IsEmpty());
+    EXPECT_THAT(_timeouts[2]._expiries, ElementsAre(200U, 400U));
+    uint32_t nextDelta = 0U;
+    EXPECT_FALSE(cut.getNextDelta(_now, nextDelta));
+}
+
+TEST_F(TimerWheelTest, timeout_can_be_cancelled_after_it_has_been_collected)
+{
+    TimerWheel_t cut;
+    (void)cut.set(_timeouts[0], 100U, _now);
+    (void)cut.set(_timeouts[1], 100U, _now);
+    _now = 200U;
+    EXPECT_TRUE(cut.processNextTimeout(_now));
+    cut.cancel(_timeouts[1]);
+    EXPECT_FALSE(cut.processNextTimeout(_now));
+    EXPECT_THAT(_timeouts[0]._expiries, ElementsAre(200U));
+    EXPECT_THAT(_timeouts[1]._expiries, IsEmpty());
+}
+
+TEST_F(TimerWheelTest, handles_wrap_around_of_system_time)
+{
+    TimerWheel_t cut;
+    _now = 0xFFFFF000U;
+    (void)cut.set(_timeouts[0], 0x2000U, _now);
+    (void)cut.setCyclic(_timeouts[1], 0x800U, _now);
+    runUntil(cut, 0x00001000U);
+    EXPECT_THAT(_timeouts[0]._expiries, ElementsAre(0x00001000U));
+    EXPECT_THAT(
+        _timeouts[1]._expiries, ElementsAre(0xFFFFF800U, 0x00000000U, 0x00000800U, 0x00001000U));
+}
+
+TEST_F(TimerWheelTest, expires_at_the_same_points_of_time_as_timer_list)
+{
+    std::mt19937 random(1234U);
+    size_t const count = 64U;
+    std::vector<RecordingTimeout> wheelTimeouts(count);
+    std::vector<RecordingTimeout> listTimeouts(count);
+    TimerWheel_t wheel;
+    TimerList_t list;
+    for (size_t i = 0U; i < count; ++i)
+    {
+        wheelTimeouts[i]._now = &_now;
+        listTimeouts[i]._now  = &_now;
+    }
+
+    _now = 0xFFF00000U;
+    for (size_t step = 0U; step < 5000U; ++step)
+    {
+        size_t const i = random() % count;
+        switch (random() % 4U)
+        {
+            case 0U:
+            {
+                uint32_t const delay = random() % ((random() % 2U) != 0U ? 2000U : 2000000U);
+                (void)wheel.set(wheelTimeouts[i], delay, _now);
+                (void)list.set(listTimeouts[i], delay, _now);
+                break;
+            }
+            case 1U:
+            {
+                uint32_t const period = 1U + (random() % 50000U);
+                (void)wheel.setCyclic(wheelTimeouts[i], period, _now);
+                (void)list.setCyclic(listTimeouts[i], period, _now);
+                break;
+            }
+            case 2U:
+            {
+                wheel.cancel(wheelTimeouts[i]);
+                list.cancel(listTimeouts[i]);
+                break;
+            }
+            default:
+            {
+                _now += random() % 3000U;
+                break;
+            }
+        }
+        process(wheel);
+        process(list);
+        for (size_t j = 0U; j < count; ++j)
+        {
+            ASSERT_EQ(listTimeouts[j]._expiries, wheelTimeouts[j]._expiries) << step;
+            ASSERT_EQ(list.isActive(listTimeouts[j]), wheel.isActive(wheelTimeouts[j])) << step;
+        }
+        uint32_t wheelDelta = 0U;
+        uint32_t listDelta  = 0U;
+        bool const hasWheelDelta = wheel.getNextDelta(_now, wheelDelta);
+        ASSERT_EQ(list.getNextDelta(_now, listDelta), hasWheelDelta);
+        // a cascading point may be reported before the next expiry
+        ASSERT_LE(wheelDelta, listDelta);
+    }
+}
+
+} // namespace
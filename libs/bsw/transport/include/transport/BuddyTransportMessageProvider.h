@@ -0,0 +1,179 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "transport/ITransportMessageProvider.h"
+#include "transport/TransportMessage.h"
+
+#include <etl/pool.h>
+#include <etl/span.h>
+#include <etl/uncopyable.h>
+#include <util/memory/BuddyMemoryManager.h>
+
+#include <platform/estdint.h>
+
+namespace transport
+{
+/**
+ * Provides TransportMessage objects with buffers of the requested size.
+ *
+ * The buffers are taken from a memory area which is divided into buckets of equal size and
+ * managed by a BuddyMemoryManager. A message occupies the smallest power of two number of buckets
+ * its size fits into, so a short request only takes a small part of the memory while a message
+ * of the maximum size is still possible. The TransportMessage objects are taken from a pool,
+ * which returns a free object in constant time.
+ *
+ * A minimum buffer size can be configured for users that reuse the buffer of a received message
+ * for a larger answer, like the diagnosis builds its response in the buffer of the request.
+ *
+ * All methods may be called from different task contexts.
+ *
+ * \see declare::BuddyTransportMessageProvider
+ */
+class BuddyTransportMessageProvider
+: public ITransportMessageProvider
+, public ::etl::uncopyable
+{
+public:
+    /**
+     * Usage statistics of a BuddyTransportMessageProvider.
+     */
+    struct Statistics
+    {
+        /** Number of messages currently in use */
+        size_t usedMessages;
+        /** Maximum number of messages in use at the same time */
+        size_t maxUsedMessages;
+        /** Number of bytes currently occupied by messages, including rounding to chunks */
+        size_t usedBytes;
+        /** Maximum number of bytes occupied at the same time */
+        size_t maxUsedBytes;
+        /** Number of occupied bytes that have not been requested (internal fragmentation) */
+        size_t unusedBytes;
+        /** Size of the largest message that can currently be provided */
+        size_t largestFreeBytes;
+        /** Number of requests that could not be served because no memory was available */
+        size_t failedRequests;
+    };
+
+    /**
+     * Constructs an instance of BuddyTransportMessageProvider.
+     * \param memoryManager memory manager for the buckets of memory
+     * \param memory        memory area of memoryManager.numBuckets() buckets
+     * \param bucketSize    size of a single bucket in bytes
+     * \param messagePool   pool of TransportMessage objects
+     * \param minimumBufferSize minimum size of a message buffer in bytes
+     */
+    BuddyTransportMessageProvider(
+        ::util::memory::BuddyMemoryManager& memoryManager,
+        ::etl::span<uint8_t> memory,
+        size_t bucketSize,
+        ::etl::ipool& messagePool,
+        size_t minimumBufferSize = 0U);
+
+    /**
+     * Returns a TransportMessage with a buffer of \p size bytes, but at least of the minimum buffer
+     * size. All other parameters are ignored.
+     * \return
+     *          - TPMSG_OK: pTransportMessage has been set
+     *          - TPMSG_SIZE_TOO_LARGE: size exceeds the complete memory
+     *          - TPMSG_NO_MSG_AVAILABLE: no message object or not enough memory available
+     *
+     * \see ITransportMessageProvider::getTransportMessage()
+     */
+    ErrorCode getTransportMessage(
+        uint8_t srcBusId,
+        uint16_t sourceAddress,
+        uint16_t targetAddress,
+        uint16_t size,
+        ::etl::span<uint8_t const> const& peek,
+        TransportMessage*& pTransportMessage) override;
+
+    /**
+     * Returns \p transportMessage and its buffer. Messages of other providers are ignored.
+     * \see ITransportMessageProvider::releaseTransportMessage()
+     */
+    void releaseTransportMessage(TransportMessage& transportMessage) override;
+
+    /**
+     * Logs the current statistics.
+     */
+    void dump() override;
+
+    /**
+     * Checks whether \p transportMessage has been provided by this provider.
+     */
+    bool isOwnMessage(TransportMessage const& transportMessage) const;
+
+    /**
+     * Returns the maximum size of a message.
+     */
+    size_t getMaxMessageSize() const;
+
+    Statistics getStatistics() const;
+
+private:
+    ::util::memory::BuddyMemoryManager& _memoryManager;
+    ::etl::ipool& _messagePool;
+    ::etl::span<uint8_t> const _memory;
+    size_t const _bucketSize;
+    size_t const _minimumBufferSize;
+    size_t _usedBuckets;
+    size_t _maxUsedBuckets;
+    size_t _maxUsedMessages;
+    size_t _requestedBytes;
+    size_t _failedRequests;
+};
+
+inline size_t BuddyTransportMessageProvider::getMaxMessageSize() const { return _memory.size(); }
+
+namespace declare
+{
+/**
+ * A BuddyTransportMessageProvider with its own memory and message objects.
+ *
+ * \tparam MEMORY_SIZE  Minimum size of the memory for the message buffers in bytes. It will be
+ *                      adjusted to the next power of 2 number of buckets.
+ * \tparam BUCKET_SIZE  Size of the smallest buffer in bytes.
+ * \tparam NUM_MESSAGES Maximum number of messages in use at the same time.
+ * \tparam MIN_BUFFER_SIZE Minimum size of a message buffer in bytes.
+ *
+ * \see ::transport::BuddyTransportMessageProvider
+ */
+template<size_t MEMORY_SIZE, size_t BUCKET_SIZE, size_t NUM_MESSAGES, size_t MIN_BUFFER_SIZE = 0U>
+class BuddyTransportMessageProvider : public ::transport::BuddyTransportMessageProvider
+{
+    using MemoryManager = ::util::memory::declare::BuddyMemoryManager<
+        (MEMORY_SIZE + BUCKET_SIZE - 1U) / BUCKET_SIZE>;
+
+public:
+    /** Size of the memory for the message buffers */
+    static size_t const BUFFER_MEMORY_SIZE = MemoryManager::NUM_BUCKETS * BUCKET_SIZE;
+
+    static_assert(MIN_BUFFER_SIZE <= BUFFER_MEMORY_SIZE, "minimum buffer size exceeds memory");
+
+    BuddyTransportMessageProvider();
+
+private:
+    MemoryManager _memoryManager;
+    ::etl::pool<TransportMessage, NUM_MESSAGES> _messagePool;
+    uint8_t _memoryArray[BUFFER_MEMORY_SIZE];
+};
+
+template<size_t MEMORY_SIZE, size_t BUCKET_SIZE, size_t NUM_MESSAGES, size_t MIN_BUFFER_SIZE>
+size_t const
+    BuddyTransportMessageProvider<MEMORY_SIZE, BUCKET_SIZE, NUM_MESSAGES, MIN_BUFFER_SIZE>::
+        BUFFER_MEMORY_SIZE;
+
+template<size_t MEMORY_SIZE, size_t BUCKET_SIZE, size_t NUM_MESSAGES, size_t MIN_BUFFER_SIZE>
+BuddyTransportMessageProvider<MEMORY_SIZE, BUCKET_SIZE, NUM_MESSAGES, MIN_BUFFER_SIZE>::
+    BuddyTransportMessageProvider()
+: ::transport::BuddyTransportMessageProvider(
+    _memoryManager,
+    ::etl::span<uint8_t>(_memoryArray),
+    BUCKET_SIZE,
+    _messagePool,
+    MIN_BUFFER_SIZE)
+{}
+} // namespace declare
+} // namespace transport
@@ -0,0 +1,138 @@
+// Copyright 2025 Accenture.
+
+#include "transport/BuddyTransportMessageProvider.h"
+
+#include "transport/TransportLogger.h"
+
+#include <async/Async.h>
+#include <etl/algorithm.h>
+
+namespace transport
+{
+using ::util::logger::Logger;
+using ::util::logger::TRANSPORT;
+
+BuddyTransportMessageProvider::BuddyTransportMessageProvider(
+    ::util::memory::BuddyMemoryManager& memoryManager,
+    ::etl::span<uint8_t> const memory,
+    size_t const bucketSize,
+    ::etl::ipool& messagePool,
+    size_t const minimumBufferSize)
+: _memoryManager(memoryManager)
+, _messagePool(messagePool)
+, _memory(memory)
+, _bucketSize(bucketSize)
+, _minimumBufferSize(minimumBufferSize)
+, _usedBuckets(0U)
+, _maxUsedBuckets(0U)
+, _maxUsedMessages(0U)
+, _requestedBytes(0U)
+, _failedRequests(0U)
+{}
+
+ITransportMessageProvider::ErrorCode BuddyTransportMessageProvider::getTransportMessage(
+    uint8_t const /* srcBusId */,
+    uint16_t const /* sourceAddress */,
+    uint16_t const /* targetAddress */,
+    uint16_t const size,
+    ::etl::span<uint8_t const> const& /* peek */,
+    TransportMessage*& pTransportMessage)
+{
+    pTransportMessage = nullptr;
+    if (size > _memory.size())
+    {
+        return ErrorCode::TPMSG_SIZE_TOO_LARGE;
+    }
+    size_t const bufferSize = ::etl::max(static_cast<size_t>(size), _minimumBufferSize);
+
+    ::async::LockType const lock;
+    if (_messagePool.full())
+    {
+        ++_failedRequests;
+        return ErrorCode::TPMSG_NO_MSG_AVAILABLE;
+    }
+    auto const chunk = _memoryManager.acquireMemory((bufferSize + _bucketSize - 1U) / _bucketSize);
+    if (!chunk.isValid())
+    {
+        ++_failedRequests;
+        return ErrorCode::TPMSG_NO_MSG_AVAILABLE;
+    }
+
+    pTransportMessage = _messagePool.create<TransportMessage>();
+    pTransportMessage->init(
+        &_memory[chunk.firstBucketIndex() * _bucketSize], static_cast<uint32_t>(bufferSize));
+
+    _usedBuckets += chunk.numBuckets();
+    _requestedBytes += bufferSize;
+    if (_usedBuckets > _maxUsedBuckets)
+    {
+        _maxUsedBuckets = _usedBuckets;
+    }
+    if (_messagePool.size() > _maxUsedMessages)
+    {
+        _maxUsedMessages = _messagePool.size();
+    }
+    return ErrorCode::TPMSG_OK;
+}
+
+void BuddyTransportMessageProvider::releaseTransportMessage(TransportMessage& transportMessage)
+{
+    if (!isOwnMessage(transportMessage))
+    {
+        return;
+    }
+
+    ::async::LockType const lock;
+    size_t const offset     = static_cast<size_t>(transportMessage.getBuffer() - _memory.data());
+    size_t const numBuckets = _memoryManager.releaseMemoryExtended(offset / _bucketSize);
+    if (numBuckets == 0U)
+    {
+        Logger::error(
+            TRANSPORT,
+            "BuddyTransportMessageProvider::releaseTransportMessage(): message not in use!");
+        return;
+    }
+    _usedBuckets -= numBuckets;
+    _requestedBytes -= transportMessage.getBufferLength();
+    _messagePool.destroy(&transportMessage);
+}
+
+void BuddyTransportMessageProvider::dump()
+{
+    Statistics const statistics = getStatistics();
+    Logger::info(
+        TRANSPORT,
+        "BuddyTransportMessageProvider: messages %d (max %d), bytes %d (max %d) of %d",
+        statistics.usedMessages,
+        statistics.maxUsedMessages,
+        statistics.usedBytes,
+        statistics.maxUsedBytes,
+        _memory.size());
+    Logger::info(
+        TRANSPORT,
+        "BuddyTransportMessageProvider: unused %d, largest free %d, failed requests %d",
+        statistics.unusedBytes,
+        statistics.largestFreeBytes,
+        statistics.failedRequests);
+}
+
+bool BuddyTransportMessageProvider::isOwnMessage(TransportMessage const& transportMessage) const
+{
+    return _messagePool.is_in_pool(&transportMessage);
+}
+
+BuddyTransportMessageProvider::Statistics BuddyTransportMessageProvider::getStatistics() const
+{
+    ::async::LockType const lock;
+    Statistics statistics;
+    statistics.usedMessages     = _messagePool.size();
+    statistics.maxUsedMessages  = _maxUsedMessages;
+    statistics.usedBytes        = _usedBuckets * _bucketSize;
+    statistics.maxUsedBytes     = _maxUsedBuckets * _bucketSize;
+    statistics.unusedBytes      = statistics.usedBytes - _requestedBytes;
+    statistics.largestFreeBytes = _memoryManager.largestFreeChunk() * _bucketSize;
+    statistics.failedRequests   = _failedRequests;
+    return statistics;
+}
+
+} // namespace transport
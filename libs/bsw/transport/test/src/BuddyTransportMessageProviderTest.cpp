@@ -0,0 +1,161 @@
+// Copyright 2025 Accenture.
+
+#include "transport/BuddyTransportMessageProvider.h"
+
+#include <gmock/gmock.h>
+
+using namespace ::transport;
+using namespace ::testing;
+
+namespace
+{
+size_t const MEMORY_SIZE  = 1000U;
+size_t const BUCKET_SIZE  = 64U;
+size_t const NUM_MESSAGES = 4U;
+
+using ErrorCode = ITransportMessageProvider::ErrorCode;
+
+class BuddyTransportMessageProviderTest : public Test
+{
+public:
+    ErrorCode getMessage(uint16_t const size, TransportMessage*& pMessage)
+    {
+        return _provider.getTransportMessage(0U, 0x10U, 0x20U, size, {}, pMessage);
+    }
+
+protected:
+    declare::BuddyTransportMessageProvider<MEMORY_SIZE, BUCKET_SIZE, NUM_MESSAGES> _provider;
+};
+
+TEST_F(BuddyTransportMessageProviderTest, memoryIsRoundedToPowerOfTwoBuckets)
+{
+    EXPECT_EQ(1024U, (declare::BuddyTransportMessageProvider<MEMORY_SIZE, BUCKET_SIZE, 1U>::
+                          BUFFER_MEMORY_SIZE));
+    EXPECT_EQ(1024U, _provider.getMaxMessageSize());
+    BuddyTransportMessageProvider::Statistics const statistics = _provider.getStatistics();
+    EXPECT_EQ(0U, statistics.usedMessages);
+    EXPECT_EQ(0U, statistics.usedBytes);
+    EXPECT_EQ(1024U, statistics.largestFreeBytes);
+}
+
+TEST_F(BuddyTransportMessageProviderTest, messageHasRequestedSize)
+{
+    TransportMessage* pMessage = nullptr;
+    ASSERT_EQ(ErrorCode::TPMSG_OK, getMessage(20U, pMessage));
+    ASSERT_NE(nullptr, pMessage);
+    EXPECT_TRUE(_provider.isOwnMessage(*pMessage));
+    EXPECT_EQ(20U, pMessage->getBufferLength());
+    EXPECT_EQ(20U, pMessage->getMaxPayloadLength());
+    EXPECT_EQ(0U, pMessage->getPayloadLength());
+
+    TransportMessage* pLargeMessage = nullptr;
+    ASSERT_EQ(ErrorCode::TPMSG_OK, getMessage(300U, pLargeMessage));
+    ASSERT_NE(nullptr, pLargeMessage);
+    EXPECT_EQ(300U, pLargeMessage->getBufferLength());
+    // buffers must not overlap
+    EXPECT_TRUE(
+        (pLargeMessage->getBuffer() >= (pMessage->getBuffer() + 20U))
+        || ((pLargeMessage->getBuffer() + 300U) <= pMessage->getBuffer()));
+
+    _provider.releaseTransportMessage(*pMessage);
+    _provider.releaseTransportMessage(*pLargeMessage);
+    EXPECT_EQ(0U, _provider.getStatistics().usedMessages);
+    EXPECT_EQ(1024U, _provider.getStatistics().largestFreeBytes);
+}
+
+TEST_F(BuddyTransportMessageProviderTest, messageHasAtLeastMinimumBufferSize)
+{
+    declare::BuddyTransportMessageProvider<MEMORY_SIZE, BUCKET_SIZE, NUM_MESSAGES, 200U> provider;
+    TransportMessage* pMessage = nullptr;
+    ASSERT_EQ(
+        ErrorCode::TPMSG_OK, provider.getTransportMessage(0U, 0x10U, 0x20U, 3U, {}, pMessage));
+    ASSERT_NE(nullptr, pMessage);
+    EXPECT_EQ(200U, pMessage->getBufferLength());
+    EXPECT_EQ(256U, provider.getStatistics().usedBytes);
+
+    TransportMessage* pLargeMessage = nullptr;
+    ASSERT_EQ(
+        ErrorCode::TPMSG_OK,
+        provider.getTransportMessage(0U, 0x10U, 0x20U, 300U, {}, pLargeMessage));
+    EXPECT_EQ(300U, pLargeMessage->getBufferLength());
+
+    provider.releaseTransportMessage(*pMessage);
+    provider.releaseTransportMessage(*pLargeMessage);
+    EXPECT_EQ(0U, provider.getStatistics().usedBytes);
+    EXPECT_EQ(0U, provider.getStatistics().unusedBytes);
+}
+
+TEST_F(BuddyTransportMessageProviderTest, tooLargeAndUnavailableMessages)
+{
+    TransportMessage* pMessage = nullptr;
+    EXPECT_EQ(ErrorCode::TPMSG_SIZE_TOO_LARGE, getMessage(1025U, pMessage));
+    EXPECT_EQ(nullptr, pMessage);
+
+    TransportMessage* pFullMessage = nullptr;
+    ASSERT_EQ(ErrorCode::TPMSG_OK, getMessage(1024U, pFullMessage));
+    EXPECT_EQ(ErrorCode::TPMSG_NO_MSG_AVAILABLE, getMessage(1U, pMessage));
+    EXPECT_EQ(nullptr, pMessage);
+    _provider.releaseTransportMessage(*pFullMessage);
+
+    TransportMessage* messages[NUM_MESSAGES] = {};
+    for (TransportMessage*& pSmallMessage : messages)
+    {
+        ASSERT_EQ(ErrorCode::TPMSG_OK, getMessage(1U, pSmallMessage));
+    }
+    EXPECT_EQ(ErrorCode::TPMSG_NO_MSG_AVAILABLE, getMessage(1U, pMessage));
+    EXPECT_EQ(2U, _provider.getStatistics().failedRequests);
+    for (TransportMessage* pSmallMessage : messages)
+    {
+        _provider.releaseTransportMessage(*pSmallMessage);
+    }
+    ASSERT_EQ(ErrorCode::TPMSG_OK, getMessage(1U, pMessage));
+    _provider.releaseTransportMessage(*pMessage);
+}
+
+TEST_F(BuddyTransportMessageProviderTest, foreignMessagesAreIgnored)
+{
+    uint8_t buffer[8] = {};
+    TransportMessage foreignMessage(buffer, sizeof(buffer));
+    EXPECT_FALSE(_provider.isOwnMessage(foreignMessage));
+    _provider.releaseTransportMessage(foreignMessage);
+
+    TransportMessage* pMessage = nullptr;
+    ASSERT_EQ(ErrorCode::TPMSG_OK, getMessage(8U, pMessage));
+    _provider.releaseTransportMessage(*pMessage);
+    EXPECT_EQ(0U, _provider.getStatistics().usedMessages);
+}
+
+TEST_F(BuddyTransportMessageProviderTest, statistics)
+{
+    TransportMessage* pFirst  = nullptr;
+    TransportMessage* pSecond = nullptr;
+    TransportMessage* pThird  = nullptr;
+    ASSERT_EQ(ErrorCode::TPMSG_OK, getMessage(100U, pFirst));
+    ASSERT_EQ(ErrorCode::TPMSG_OK, getMessage(10U, pSecond));
+    ASSERT_EQ(ErrorCode::TPMSG_OK, getMessage(0U, pThird));
+
+    BuddyTransportMessageProvider::Statistics statistics = _provider.getStatistics();
+    EXPECT_EQ(3U, statistics.usedMessages);
+    EXPECT_EQ(3U, statistics.maxUsedMessages);
+    EXPECT_EQ(256U, statistics.usedBytes);
+    EXPECT_EQ(256U, statistics.maxUsedBytes);
+    EXPECT_EQ(146U, statistics.unusedBytes);
+    EXPECT_EQ(512U, statistics.largestFreeBytes);
+    EXPECT_EQ(0U, statistics.failedRequests);
+
+    _provider.releaseTransportMessage(*pFirst);
+    _provider.releaseTransportMessage(*pThird);
+    statistics = _provider.getStatistics();
+    EXPECT_EQ(1U, statistics.usedMessages);
+    EXPECT_EQ(3U, statistics.maxUsedMessages);
+    EXPECT_EQ(64U, statistics.usedBytes);
+    EXPECT_EQ(256U, statistics.maxUsedBytes);
+    EXPECT_EQ(54U, statistics.unusedBytes);
+    EXPECT_EQ(512U, statistics.largestFreeBytes);
+    _provider.dump();
+
+    _provider.releaseTransportMessage(*pSecond);
+    EXPECT_EQ(0U, _provider.getStatistics().usedBytes);
+}
+
+} // namespace
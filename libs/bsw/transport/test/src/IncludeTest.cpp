@@ -11,6 +11,7 @@
 
 // IWYU pragma: begin_keep
 #include "transport/AbstractTransportLayer.h"
+#include "transport/BuddyTransportMessageProvider.h"
 #include "transport/ITransportMessageListener.h"
 #include "transport/ITransportMessageProcessedListener.h"
 #include "transport/ITransportMessageProvider.h"
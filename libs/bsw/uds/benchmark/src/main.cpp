@@ -0,0 +1,158 @@
+// Copyright 2025 Accenture.
+
+#include <benchmark/benchmark.h>
+#include <uds/base/DiagJobIndex.h>
+#include <uds/base/Service.h>
+#include <uds/connection/IncomingDiagConnection.h>
+#include <uds/jobs/DataIdentifierJob.h>
+#include <uds/session/ApplicationDefaultSession.h>
+#include <uds/session/IDiagSessionManager.h>
+
+#include <etl/array.h>
+#include <etl/span.h>
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+using ::uds::AbstractDiagJob;
+using ::uds::DiagReturnCode;
+
+class BenchmarkSessionManager : public ::uds::IDiagSessionManager
+{
+public:
+    ::uds::DiagSession const& getActiveSession() const override
+    {
+        return ::uds::DiagSession::APPLICATION_DEFAULT_SESSION();
+    }
+
+    void startSessionTimeout() override {}
+
+    void stopSessionTimeout() override {}
+
+    bool isSessionTimeoutActive() override { return false; }
+
+    void resetToDefaultSession() override {}
+
+    DiagReturnCode::Type acceptedJob(
+        ::uds::IncomingDiagConnection&, AbstractDiagJob const&, uint8_t const[], uint16_t) override
+    {
+        return DiagReturnCode::OK;
+    }
+
+    void responseSent(
+        ::uds::IncomingDiagConnection&, DiagReturnCode::Type, uint8_t const[], uint16_t) override
+    {}
+
+    void addDiagSessionListener(::uds::IDiagSessionChangedListener&) override {}
+
+    void removeDiagSessionListener(::uds::IDiagSessionChangedListener&) override {}
+};
+
+class BenchmarkDataIdentifierJob : public ::uds::DataIdentifierJob
+{
+public:
+    explicit BenchmarkDataIdentifierJob(uint8_t const implementedRequest[])
+    : ::uds::DataIdentifierJob(implementedRequest)
+    {}
+
+protected:
+    DiagReturnCode::Type
+    process(::uds::IncomingDiagConnection&, uint8_t const[], uint16_t) override
+    {
+        return DiagReturnCode::OK;
+    }
+};
+
+struct Linear
+{
+    static bool const INDEXED = false;
+};
+
+struct Indexed
+{
+    static bool const INDEXED = true;
+};
+
+/**
+ * ReadDataByIdentifier service with a given number of DataIdentifierJobs as children.
+ */
+class ReadDataByIdentifierTree
+{
+public:
+    ReadDataByIdentifierTree(size_t const jobCount, bool const indexed)
+    : _service(0x22U, ::uds::DiagSession::ALL_SESSIONS())
+    , _requests(jobCount)
+    , _entries(jobCount)
+    , _index(::etl::span<::uds::DiagJobIndex::Entry>(_entries.data(), _entries.size()))
+    {
+        AbstractDiagJob::setDefaultDiagSessionManager(_sessionManager);
+        if (indexed)
+        {
+            _service.setChildIndex(_index);
+        }
+        for (size_t i = 0U; i < jobCount; ++i)
+        {
+            _requests[i]
+                = {0x22U, static_cast<uint8_t>(0xF1U - (i >> 8U)), static_cast<uint8_t>(i)};
+            _jobs.emplace_back(new BenchmarkDataIdentifierJob(_requests[i].data()));
+            (void)_service.addAbstractDiagJob(*_jobs.back());
+        }
+    }
+
+    DiagReturnCode::Type dispatch(::etl::array<uint8_t, 3U> const& request)
+    {
+        return _service.execute(_connection, request.data(), static_cast<uint16_t>(request.size()));
+    }
+
+    ::etl::array<uint8_t, 3U> const& getRequest(size_t const idx) const { return _requests[idx]; }
+
+private:
+    BenchmarkSessionManager _sessionManager;
+    ::uds::IncomingDiagConnection _connection{::async::CONTEXT_INVALID};
+    ::uds::Service _service;
+    std::vector<::etl::array<uint8_t, 3U>> _requests;
+    std::vector<std::unique_ptr<BenchmarkDataIdentifierJob>> _jobs;
+    std::vector<::uds::DiagJobIndex::Entry> _entries;
+    ::uds::DiagJobIndex _index;
+};
+} // namespace
+
+/**
+ * Benchmarks the dispatch of a request to the last of state.range(0) DataIdentifierJobs, which
+ * is the worst case for searching the children linearly.
+ */
+template<class T>
+void BM_dispatch_last(benchmark::State& state)
+{
+    size_t const jobCount = static_cast<size_t>(state.range(0));
+    ReadDataByIdentifierTree tree(jobCount, T::INDEXED);
+    auto const& request = tree.getRequest(jobCount - 1U);
+
+    while (state.KeepRunning())
+    {
+        benchmark::DoNotOptimize(tree.dispatch(request));
+    }
+}
+
+/**
+ * Benchmarks the dispatch of a request that no DataIdentifierJob is responsible for, i.e. the
+ * request is answered with the default return code of the service.
+ */
+template<class T>
+void BM_dispatch_unknown(benchmark::State& state)
+{
+    ReadDataByIdentifierTree tree(static_cast<size_t>(state.range(0)), T::INDEXED);
+    ::etl::array<uint8_t, 3U> const request = {0x22U, 0x00U, 0x00U};
+
+    while (state.KeepRunning())
+    {
+        benchmark::DoNotOptimize(tree.dispatch(request));
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_dispatch_last, Linear)->RangeMultiplier(4)->Range(4, 1024);
+BENCHMARK_TEMPLATE(BM_dispatch_last, Indexed)->RangeMultiplier(4)->Range(4, 1024);
+BENCHMARK_TEMPLATE(BM_dispatch_unknown, Linear)->RangeMultiplier(4)->Range(4, 1024);
+BENCHMARK_TEMPLATE(BM_dispatch_unknown, Indexed)->RangeMultiplier(4)->Range(4, 1024);
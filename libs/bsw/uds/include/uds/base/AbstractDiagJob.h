@@ -27,6 +27,7 @@ class IDiagSessionManager;
 class DiagSubSession;
 class Service;
 class DiagJobRoot;
+class DiagJobIndex;
 
 /**
  * Common base class for diagnosis jobs
@@ -106,6 +107,9 @@ public:
     , fRequestPayloadLength(VARIABLE_REQUEST_LENGTH)
     , fDefaultDiagReturnCode(DiagReturnCode::ISO_GENERAL_REJECT)
     , fSuppressPositiveResponseBitEnabled(false)
+    , fpChildIndex(nullptr)
+    , fIsIndexed(false)
+    , fHasUnindexedChildren(false)
     {
         if (requestLength > 0U)
         {
@@ -149,6 +153,9 @@ public:
     , fRequestPayloadLength(requestPayloadLength)
     , fDefaultDiagReturnCode(DiagReturnCode::ISO_GENERAL_REJECT)
     , fSuppressPositiveResponseBitEnabled(false)
+    , fpChildIndex(nullptr)
+    , fIsIndexed(false)
+    , fHasUnindexedChildren(false)
     {
         if (requestLength > 0U)
         {
@@ -205,6 +212,15 @@ public:
      */
     void removeAbstractDiagJob(AbstractDiagJob& job);
 
+    /**
+     * Sets an index that is used to look up the child responsible for a
+     * request instead of asking all children one after the other. Children
+     * that have already been added are inserted into the index.
+     * \param   index   DiagJobIndex to use for the children of this job
+     * \see DiagJobIndex
+     */
+    void setChildIndex(DiagJobIndex& index);
+
     /**
      * Callback that gets invoked when a response on a IncomingDiagConnection
      * has been sent
@@ -261,6 +277,9 @@ protected:
     , fRequestPayloadLength(pJob->fRequestPayloadLength)
     , fDefaultDiagReturnCode(DiagReturnCode::ISO_GENERAL_REJECT)
     , fSuppressPositiveResponseBitEnabled(false)
+    , fpChildIndex(nullptr)
+    , fIsIndexed(false)
+    , fHasUnindexedChildren(false)
     {}
 
     /**
@@ -394,6 +413,7 @@ private:
     friend class Service;
     friend class ServiceWithAuthentication;
     friend class DiagJobRoot;
+    friend class DiagJobIndex;
     friend class ::http::html::UdsController;
 
     /** Mask with suppress positive response bit set */
@@ -411,6 +431,11 @@ private:
     void checkSuppressPositiveResponseBit(
         IncomingDiagConnection& connection, uint8_t const request[]) const;
 
+    /**
+     * Updates fHasUnindexedChildren after children have been removed
+     */
+    void updateUnindexedChildren();
+
     /** Array containing the request implemented by this job */
     uint8_t const* const fpImplementedRequest;
     /** Pointer to first child. A child has fpImplementedRequest as its prefix */
@@ -432,6 +457,12 @@ private:
     DiagReturnCode::Type fDefaultDiagReturnCode;
     /** Indication if positive response bit handling is enabled */
     bool fSuppressPositiveResponseBitEnabled;
+    /** Optional index of the children, nullptr if children are searched linearly */
+    DiagJobIndex* fpChildIndex;
+    /** Indication if this job is part of the DiagJobIndex of its parent */
+    bool fIsIndexed;
+    /** Indication if fpChildIndex doesn't contain all children */
+    bool fHasUnindexedChildren;
 };
 
 /**
@@ -0,0 +1,119 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <etl/array.h>
+#include <etl/span.h>
+
+#include <platform/estdint.h>
+
+namespace uds
+{
+class AbstractDiagJob;
+
+/**
+ * Sorted index of the child jobs of an AbstractDiagJob
+ *
+ *
+ *
+ * \section Design
+ * Without an index, AbstractDiagJob::process() asks one child after the
+ * other to execute a request until a child doesn't return NOT_RESPONSIBLE.
+ * A job with an index (see AbstractDiagJob::setChildIndex()) looks up the
+ * child whose identifier starts the request by binary search and asks it
+ * first. Children that are not indexed are asked afterwards in the order
+ * they have been added.
+ *
+ * The identifier of a child is the part of its implemented request that
+ * follows the prefix, e.g. the two DID bytes of a DataIdentifierJob. The
+ * index takes its key length from the first child, which must be 1 to
+ * MAX_KEY_LENGTH bytes. Children with identifiers of another length or
+ * that exceed the capacity of the index are not indexed.
+ *
+ * \note
+ * An indexed child must return NOT_RESPONSIBLE for every request that
+ * doesn't start with its identifier, as DataIdentifierJob, Service and
+ * Subfunction do.
+ */
+class DiagJobIndex
+{
+public:
+    static uint8_t const MAX_KEY_LENGTH = 4U;
+
+    struct Entry
+    {
+        uint32_t key;
+        AbstractDiagJob* job;
+    };
+
+    explicit DiagJobIndex(::etl::span<Entry> entries);
+
+    /**
+     * Adds a job to the index.
+     * \param   job AbstractDiagJob to add
+     * \return
+     *          - true: job has been indexed
+     *          - false: job has a different key length or the index is full
+     */
+    bool add(AbstractDiagJob& job);
+
+    /**
+     * Removes a job from the index.
+     * \param   job AbstractDiagJob to remove
+     * \return
+     *          - true: job has been removed
+     *          - false: job is not part of the index
+     */
+    bool remove(AbstractDiagJob& job);
+
+    /**
+     * Removes all jobs from the index.
+     */
+    void clear();
+
+    /**
+     * Looks up the job whose identifier starts a given request.
+     * \param   request Array containing the request without prefix
+     * \param   requestLength Length of request
+     * \return
+     *          - nullptr: No job of the index matches the request
+     *          - else: Pointer to the matching job
+     */
+    AbstractDiagJob* find(uint8_t const request[], uint16_t requestLength) const;
+
+    size_t getSize() const;
+
+    uint8_t getKeyLength() const;
+
+private:
+    static uint32_t getKey(uint8_t const data[], uint8_t length);
+
+    size_t lowerBound(uint32_t key) const;
+
+    ::etl::span<Entry> fEntries;
+    size_t fSize;
+    uint8_t fKeyLength;
+};
+
+namespace declare
+{
+/**
+ * DiagJobIndex with storage for a specified number of jobs.
+ * \tparam N Maximum number of jobs that can be indexed
+ */
+template<size_t N>
+class DiagJobIndex : public ::uds::DiagJobIndex
+{
+public:
+    DiagJobIndex() : ::uds::DiagJobIndex(fEntries), fEntries() {}
+
+private:
+    ::etl::array<Entry, N> fEntries;
+};
+} // namespace declare
+
+inline size_t DiagJobIndex::getSize() const { return fSize; }
+
+inline uint8_t DiagJobIndex::getKeyLength() const { return fKeyLength; }
+
+} // namespace uds
@@ -0,0 +1,195 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "uds/DiagReturnCode.h"
+#include "uds/services/download/IFlashDownloadListener.h"
+#include "uds/session/IDiagSessionChangedListener.h"
+
+#include <async/Async.h>
+#include <async/util/Call.h>
+#include <bsp/flash/IFlashDriver.h>
+#include <util/crc/Crc32.h>
+
+#include <etl/array.h>
+#include <etl/span.h>
+
+#include <platform/estdint.h>
+
+namespace uds
+{
+/**
+ * Programs the data of a download (RequestDownload, TransferData, RequestTransferExit) into
+ * flash memory.
+ *
+ * \section Design
+ * The data of a TransferData request is copied into one of two buffers and acknowledged right
+ * away. The buffer is programmed within the flash context while the next block is received into
+ * the other buffer. Blocks that need to be erased are erased right before they are written to,
+ * and after a block has been written the following flash block is erased ahead, so that erasing
+ * overlaps with the reception of the next block as well. A TransferData request that arrives
+ * while both buffers are in use is answered with ISO_RESPONSE_PENDING, and the service is
+ * notified by IFlashDownloadListener as soon as a buffer is free again.
+ *
+ * A CRC32 (Ethernet) is calculated over all received data and returned by
+ * requestTransferExit() after all blocks have been programmed.
+ *
+ * Registered at the IDiagSessionManager, an active download is aborted on every change of the
+ * diagnostic session. This includes the session timeout, which also covers a tester that has
+ * disconnected in the middle of a download.
+ *
+ * All functions except the programming itself have to be called from within the diagnosis
+ * context.
+ */
+class FlashDownload : public IDiagSessionChangedListener
+{
+public:
+    /**
+     * Constructor
+     * \param flashDriver Flash driver to erase and program the memory with
+     * \param diagContext Context of the diagnosis
+     * \param flashContext Context to erase and program the memory within
+     * \param buffer Memory for the two buffers, each taking half of it
+     * \param memoryStart Start address of the memory that may be downloaded to
+     * \param memorySize Size of the memory that may be downloaded to
+     */
+    FlashDownload(
+        ::flash::IFlashDriver& flashDriver,
+        ::async::ContextType diagContext,
+        ::async::ContextType flashContext,
+        ::etl::span<uint8_t> buffer,
+        uint32_t memoryStart,
+        uint32_t memorySize);
+
+    /**
+     * Starts a download.
+     * \param address Start address of the download, must be the start of a flash block
+     * \param size Number of bytes to download
+     * \return
+     *          - OK: download has been started
+     *          - ISO_CONDITIONS_NOT_CORRECT: another download is active
+     *          - ISO_REQUEST_OUT_OF_RANGE: memory area is invalid or address is not aligned to
+     *            a flash block
+     */
+    DiagReturnCode::Type requestDownload(uint32_t address, uint32_t size);
+
+    /**
+     * Accepts a block of data.
+     * \param blockSequenceCounter Block sequence counter of the TransferData request
+     * \param data Data of the block
+     * \param length Number of bytes of the block
+     * \return
+     *          - OK: block has been accepted or is a repetition of the last accepted block
+     *          - ISO_RESPONSE_PENDING: no buffer is free, repeat after downloadProgressed()
+     *          - else: negative response code
+     */
+    DiagReturnCode::Type
+    transferData(uint8_t blockSequenceCounter, uint8_t const data[], uint16_t length);
+
+    /**
+     * Finishes the download.
+     * \param crc Returns the CRC32 of all downloaded data
+     * \return
+     *          - OK: all data has been programmed
+     *          - ISO_RESPONSE_PENDING: programming is ongoing, repeat after downloadProgressed()
+     *          - else: negative response code
+     */
+    DiagReturnCode::Type requestTransferExit(uint32_t& crc);
+
+    /**
+     * Registers a listener that is notified once when the next block has been programmed.
+     * \return false if another listener is already waiting
+     */
+    bool waitForProgress(IFlashDownloadListener& listener);
+
+    /**
+     * Aborts an active download. Data that has already been accepted may still be programmed.
+     */
+    void abort();
+
+    /**
+     * Aborts an active download.
+     * \see IDiagSessionChangedListener::diagSessionChanged()
+     */
+    void diagSessionChanged(DiagSession const& session) override;
+
+    void diagSessionResponseSent(uint8_t responseCode) override;
+
+    bool isActive() const;
+
+    /**
+     * Returns the maximum number of data bytes of a single TransferData request.
+     */
+    uint16_t getBufferSize() const;
+
+private:
+    struct Buffer
+    {
+        uint8_t* data;
+        uint32_t address;
+        uint16_t length;
+    };
+
+    void startProgramming();
+    void program();
+    void programmed();
+    ::flash::IFlashDriver::FlashOperationStatus eraseUpTo(uint32_t end);
+
+    ::flash::IFlashDriver& fFlashDriver;
+    ::async::ContextType fDiagContext;
+    ::async::ContextType fFlashContext;
+    ::async::Function fProgram;
+    ::async::Function fProgrammed;
+    ::etl::array<Buffer, 2U> fBuffers;
+    uint16_t fBufferSize;
+    uint32_t fMemoryStart;
+    uint32_t fMemorySize;
+    ::util::crc::Crc32::Ethernet fCrc;
+    IFlashDownloadListener* fpListener;
+    // state of the diagnosis context
+    uint32_t fStart;
+    uint32_t fAddress;
+    uint32_t fEnd;
+    uint8_t fBlockSequenceCounter;
+    uint8_t fFillIdx;
+    uint8_t fProgramIdx;
+    uint8_t fUsedBuffers;
+    bool fActive;
+    bool fProgramming;
+    bool fFailed;
+    // state of the flash context
+    uint32_t fErasedEnd;
+    ::flash::IFlashDriver::FlashOperationStatus fResult;
+};
+
+namespace declare
+{
+/**
+ * FlashDownload with two buffers for TransferData blocks of a specified size.
+ * \tparam N Maximum number of data bytes of a single TransferData request
+ */
+template<uint16_t N>
+class FlashDownload : public ::uds::FlashDownload
+{
+public:
+    FlashDownload(
+        ::flash::IFlashDriver& flashDriver,
+        ::async::ContextType const diagContext,
+        ::async::ContextType const flashContext,
+        uint32_t const memoryStart,
+        uint32_t const memorySize)
+    : ::uds::FlashDownload(
+        flashDriver, diagContext, flashContext, fBuffer, memoryStart, memorySize)
+    , fBuffer()
+    {}
+
+private:
+    ::etl::array<uint8_t, 2U * N> fBuffer;
+};
+} // namespace declare
+
+inline bool FlashDownload::isActive() const { return fActive; }
+
+inline uint16_t FlashDownload::getBufferSize() const { return fBufferSize; }
+
+} // namespace uds
@@ -0,0 +1,23 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+namespace uds
+{
+/**
+ * Interface for a diagnostic service that waits for FlashDownload to make progress.
+ */
+class IFlashDownloadListener
+{
+public:
+    /**
+     * Called from within the diagnosis context when a block has been programmed, i.e. a
+     * buffer of FlashDownload has become free again.
+     */
+    virtual void downloadProgressed() = 0;
+
+protected:
+    IFlashDownloadListener& operator=(IFlashDownloadListener const&) = default;
+};
+
+} // namespace uds
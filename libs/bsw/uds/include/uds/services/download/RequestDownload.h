@@ -0,0 +1,41 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "uds/base/Service.h"
+#include "uds/services/download/FlashDownload.h"
+#include "uds/session/DiagSession.h"
+
+namespace uds
+{
+/**
+ * UDS service RequestDownload (0x34).
+ *
+ * Supports unencrypted and uncompressed data (dataFormatIdentifier 0x00) and memory addresses
+ * and sizes of one to four bytes. The positive response contains the maximum length of a
+ * TransferData request, which is given by the buffers of the FlashDownload.
+ */
+class RequestDownload : public Service
+{
+public:
+    explicit RequestDownload(
+        FlashDownload& download,
+        DiagSession::DiagSessionMask sessionMask
+        = DiagSession::APPLICATION_EXTENDED_SESSION_MASK());
+
+private:
+    static uint8_t const MIN_REQUEST_LENGTH          = 4U;
+    static uint8_t const MAX_PARAMETER_LENGTH        = 4U;
+    static uint8_t const DATA_FORMAT_IDENTIFIER      = 0x00U;
+    static uint8_t const LENGTH_FORMAT_IDENTIFIER    = 0x20U;
+    static uint8_t const TRANSFER_DATA_HEADER_LENGTH = 2U;
+
+    DiagReturnCode::Type process(
+        IncomingDiagConnection& connection,
+        uint8_t const request[],
+        uint16_t requestLength) override;
+
+    FlashDownload& fDownload;
+};
+
+} // namespace uds
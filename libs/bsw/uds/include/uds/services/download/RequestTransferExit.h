@@ -0,0 +1,42 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "uds/base/Service.h"
+#include "uds/services/download/FlashDownload.h"
+#include "uds/services/download/IFlashDownloadListener.h"
+#include "uds/session/DiagSession.h"
+
+namespace uds
+{
+/**
+ * UDS service RequestTransferExit (0x37) for a download started by RequestDownload.
+ *
+ * The positive response is sent after all data has been programmed. Its
+ * transferResponseParameterRecord is the CRC32 (Ethernet) of the downloaded data.
+ */
+class RequestTransferExit
+: public Service
+, public IFlashDownloadListener
+{
+public:
+    explicit RequestTransferExit(
+        FlashDownload& download,
+        DiagSession::DiagSessionMask sessionMask
+        = DiagSession::APPLICATION_EXTENDED_SESSION_MASK());
+
+    void downloadProgressed() override;
+
+private:
+    DiagReturnCode::Type process(
+        IncomingDiagConnection& connection,
+        uint8_t const request[],
+        uint16_t requestLength) override;
+
+    DiagReturnCode::Type exit(IncomingDiagConnection& connection);
+
+    FlashDownload& fDownload;
+    IncomingDiagConnection* fpPendingConnection;
+};
+
+} // namespace uds
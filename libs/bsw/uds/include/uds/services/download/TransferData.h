@@ -0,0 +1,47 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "uds/base/Service.h"
+#include "uds/services/download/FlashDownload.h"
+#include "uds/services/download/IFlashDownloadListener.h"
+#include "uds/session/DiagSession.h"
+
+namespace uds
+{
+/**
+ * UDS service TransferData (0x36) for a download started by RequestDownload.
+ *
+ * A request that arrives while FlashDownload has no free buffer is kept until a buffer has been
+ * programmed. The connection sends ResponsePending meanwhile.
+ */
+class TransferData
+: public Service
+, public IFlashDownloadListener
+{
+public:
+    explicit TransferData(
+        FlashDownload& download,
+        DiagSession::DiagSessionMask sessionMask
+        = DiagSession::APPLICATION_EXTENDED_SESSION_MASK());
+
+    void downloadProgressed() override;
+
+private:
+    static uint8_t const MIN_REQUEST_LENGTH = 2U;
+
+    DiagReturnCode::Type process(
+        IncomingDiagConnection& connection,
+        uint8_t const request[],
+        uint16_t requestLength) override;
+
+    DiagReturnCode::Type transfer(
+        IncomingDiagConnection& connection, uint8_t const request[], uint16_t requestLength);
+
+    FlashDownload& fDownload;
+    IncomingDiagConnection* fpPendingConnection;
+    uint8_t const* fpPendingRequest;
+    uint16_t fPendingRequestLength;
+};
+
+} // namespace uds
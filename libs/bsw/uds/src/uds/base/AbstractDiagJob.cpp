@@ -5,6 +5,7 @@
 #include "uds/UdsLogger.h"
 #include "uds/authentication/DefaultDiagAuthenticator.h"
 #include "uds/authentication/IDiagAuthenticator.h"
+#include "uds/base/DiagJobIndex.h"
 #include "uds/base/DiagJobRoot.h"
 #include "uds/connection/IncomingDiagConnection.h"
 #include "uds/session/IDiagSessionManager.h"
@@ -187,6 +188,10 @@ AbstractDiagJob::ErrorCode AbstractDiagJob::addAbstractDiagJob(AbstractDiagJob&
         }
         job.fpNextJob    = nullptr;
         job.fpFirstChild = nullptr;
+        if ((fpChildIndex != nullptr) && (!fpChildIndex->add(job)))
+        {
+            fHasUnindexedChildren = true;
+        }
 
         Logger::debug(UDS, "Add diag job successfully 0x%X", job.getRequestId());
 
@@ -215,9 +220,14 @@ void AbstractDiagJob::removeAbstractDiagJob(AbstractDiagJob& job)
     { // we cannot remove us from ourself
         return;
     }
+    if (fpChildIndex != nullptr)
+    {
+        (void)fpChildIndex->remove(job);
+    }
     if (&job == fpFirstChild)
     { // we remove our first child
         fpFirstChild = job.getNextJob();
+        updateUnindexedChildren();
 
         Logger::debug(UDS, "Remove diag job successfully 0x%X", job.getRequestId());
         return;
@@ -226,6 +236,7 @@ void AbstractDiagJob::removeAbstractDiagJob(AbstractDiagJob& job)
     if (fpFirstChild != nullptr)
     {
         fpFirstChild->removeAbstractDiagJob(job);
+        updateUnindexedChildren();
     }
 
     if (getNextJob() == &job)
@@ -240,6 +251,34 @@ void AbstractDiagJob::removeAbstractDiagJob(AbstractDiagJob& job)
     }
 }
 
+void AbstractDiagJob::setChildIndex(DiagJobIndex& index)
+{
+    if (fpChildIndex != nullptr)
+    {
+        fpChildIndex->clear();
+    }
+    index.clear();
+    fpChildIndex                 = &index;
+    AbstractDiagJob* pCurrentJob = fpFirstChild;
+    while (pCurrentJob != nullptr)
+    {
+        (void)index.add(*pCurrentJob);
+        pCurrentJob = pCurrentJob->fpNextJob;
+    }
+    updateUnindexedChildren();
+}
+
+void AbstractDiagJob::updateUnindexedChildren()
+{
+    fHasUnindexedChildren        = false;
+    AbstractDiagJob* pCurrentJob = fpFirstChild;
+    while ((pCurrentJob != nullptr) && (!fHasUnindexedChildren))
+    {
+        fHasUnindexedChildren = !pCurrentJob->fIsIndexed;
+        pCurrentJob           = pCurrentJob->fpNextJob;
+    }
+}
+
 IDiagSessionManager& AbstractDiagJob::getDiagSessionManager()
 {
     ETL_ASSERT(sfpSessionManager != nullptr, ETL_ERROR_GENERIC("session manager must not be null"));
@@ -300,10 +339,28 @@ DiagReturnCode::Type AbstractDiagJob::process(
 {
     DiagReturnCode::Type result  = DiagReturnCode::NOT_RESPONSIBLE;
     AbstractDiagJob* pCurrentJob = fpFirstChild;
+    // requests shorter than the keys of the index are passed to all children
+    bool const useIndex = (fpChildIndex != nullptr) && (fpChildIndex->getSize() > 0U)
+                          && (requestLength >= fpChildIndex->getKeyLength());
 
+    if (useIndex)
+    {
+        AbstractDiagJob* const pIndexedJob = fpChildIndex->find(request, requestLength);
+        if (pIndexedJob != nullptr)
+        {
+            result = pIndexedJob->execute(connection, request, requestLength);
+        }
+        if (!fHasUnindexedChildren)
+        {
+            pCurrentJob = nullptr;
+        }
+    }
     while ((result == DiagReturnCode::NOT_RESPONSIBLE) && (pCurrentJob != nullptr))
     {
-        result      = pCurrentJob->execute(connection, request, requestLength);
+        if ((!useIndex) || (!pCurrentJob->fIsIndexed))
+        {
+            result = pCurrentJob->execute(connection, request, requestLength);
+        }
         pCurrentJob = pCurrentJob->fpNextJob;
     }
     if (result == DiagReturnCode::NOT_RESPONSIBLE)
@@ -0,0 +1,125 @@
+// Copyright 2025 Accenture.
+
+#include "uds/base/DiagJobIndex.h"
+
+#include "uds/base/AbstractDiagJob.h"
+
+namespace uds
+{
+DiagJobIndex::DiagJobIndex(::etl::span<Entry> const entries)
+: fEntries(entries), fSize(0U), fKeyLength(0U)
+{}
+
+bool DiagJobIndex::add(AbstractDiagJob& job)
+{
+    if ((job.fpImplementedRequest == nullptr) || (job.fIsIndexed)
+        || (job.fRequestLength <= job.fPrefixLength))
+    {
+        return false;
+    }
+    uint8_t const keyLength = static_cast<uint8_t>(job.fRequestLength - job.fPrefixLength);
+    if (fSize == 0U)
+    {
+        if (keyLength > MAX_KEY_LENGTH)
+        {
+            return false;
+        }
+        fKeyLength = keyLength;
+    }
+    if ((keyLength != fKeyLength) || (fSize >= fEntries.size()))
+    {
+        return false;
+    }
+    uint32_t const key = getKey(job.fpImplementedRequest + job.fPrefixLength, fKeyLength);
+    size_t const idx   = lowerBound(key);
+    if ((idx < fSize) && (fEntries[idx].key == key))
+    {
+        return false;
+    }
+    for (size_t i = fSize; i > idx; --i)
+    {
+        fEntries[i] = fEntries[i - 1U];
+    }
+    fEntries[idx].key = key;
+    fEntries[idx].job = &job;
+    ++fSize;
+    job.fIsIndexed = true;
+    return true;
+}
+
+bool DiagJobIndex::remove(AbstractDiagJob& job)
+{
+    if ((!job.fIsIndexed) || (fSize == 0U)
+        || (static_cast<uint8_t>(job.fRequestLength - job.fPrefixLength) != fKeyLength))
+    {
+        return false;
+    }
+    size_t const idx = lowerBound(getKey(job.fpImplementedRequest + job.fPrefixLength, fKeyLength));
+    if ((idx >= fSize) || (fEntries[idx].job != &job))
+    {
+        return false;
+    }
+    for (size_t i = idx + 1U; i < fSize; ++i)
+    {
+        fEntries[i - 1U] = fEntries[i];
+    }
+    --fSize;
+    job.fIsIndexed = false;
+    return true;
+}
+
+void DiagJobIndex::clear()
+{
+    for (size_t i = 0U; i < fSize; ++i)
+    {
+        fEntries[i].job->fIsIndexed = false;
+    }
+    fSize      = 0U;
+    fKeyLength = 0U;
+}
+
+AbstractDiagJob* DiagJobIndex::find(uint8_t const request[], uint16_t const requestLength) const
+{
+    if ((fSize == 0U) || (requestLength < fKeyLength))
+    {
+        return nullptr;
+    }
+    uint32_t const key = getKey(request, fKeyLength);
+    size_t const idx   = lowerBound(key);
+    if ((idx < fSize) && (fEntries[idx].key == key))
+    {
+        return fEntries[idx].job;
+    }
+    return nullptr;
+}
+
+uint32_t DiagJobIndex::getKey(uint8_t const data[], uint8_t const length)
+{
+    uint32_t key = 0U;
+    for (uint8_t i = 0U; i < length; ++i)
+    {
+        key = (key << 8U) | static_cast<uint32_t>(data[i]);
+    }
+    return key;
+}
+
+size_t DiagJobIndex::lowerBound(uint32_t const key) const
+{
+    size_t first = 0U;
+    size_t last  = fSize;
+    while (first < last)
+    {
+        size_t const middle = first + ((last - first) / 2U);
+        if (fEntries[middle].key < key)
+        {
+            first = middle + 1U;
+        }
+        else
+        {
+            last = middle;
+        }
+    }
+    return first;
+}
+
+} // namespace uds
@@ -0,0 +1,254 @@
+// Copyright 2025 Accenture.
+
+#include "uds/services/download/FlashDownload.h"
+
+#include "uds/UdsLogger.h"
+
+#include <etl/algorithm.h>
+
+namespace uds
+{
+using ::flash::IFlashDriver;
+using ::util::logger::Logger;
+using ::util::logger::UDS;
+
+FlashDownload::FlashDownload(
+    IFlashDriver& flashDriver,
+    ::async::ContextType const diagContext,
+    ::async::ContextType const flashContext,
+    ::etl::span<uint8_t> const buffer,
+    uint32_t const memoryStart,
+    uint32_t const memorySize)
+: fFlashDriver(flashDriver)
+, fDiagContext(diagContext)
+, fFlashContext(flashContext)
+, fProgram(::async::Function::CallType::create<FlashDownload, &FlashDownload::program>(*this))
+, fProgrammed(
+      ::async::Function::CallType::create<FlashDownload, &FlashDownload::programmed>(*this))
+, fBuffers()
+, fBufferSize(static_cast<uint16_t>(::etl::min<size_t>(buffer.size() / 2U, 0xFFFFU)))
+, fMemoryStart(memoryStart)
+, fMemorySize(memorySize)
+, fCrc()
+, fpListener(nullptr)
+, fStart(0U)
+, fAddress(0U)
+, fEnd(0U)
+, fBlockSequenceCounter(0U)
+, fFillIdx(0U)
+, fProgramIdx(0U)
+, fUsedBuffers(0U)
+, fActive(false)
+, fProgramming(false)
+, fFailed(false)
+, fErasedEnd(0U)
+, fResult(IFlashDriver::FLASH_OP_SUCCESSFUL)
+{
+    fBuffers[0U].data = buffer.data();
+    fBuffers[1U].data = buffer.data() + fBufferSize;
+}
+
+DiagReturnCode::Type FlashDownload::requestDownload(uint32_t const address, uint32_t const size)
+{
+    if (fActive && (!fFailed))
+    {
+        return DiagReturnCode::ISO_CONDITIONS_NOT_CORRECT;
+    }
+    if (fProgramming)
+    {
+        return DiagReturnCode::ISO_BUSY_REPEAT_REQUEST;
+    }
+    uint32_t blockSize = 0U;
+    if ((size == 0U) || (address < fMemoryStart) || ((address - fMemoryStart) > fMemorySize)
+        || (size > (fMemorySize - (address - fMemoryStart)))
+        || (fFlashDriver.getBlockSize(address, blockSize) != IFlashDriver::FLASH_OP_SUCCESSFUL)
+        || (blockSize == 0U) || ((address % blockSize) != 0U))
+    {
+        return DiagReturnCode::ISO_REQUEST_OUT_OF_RANGE;
+    }
+    fStart                = address;
+    fAddress              = address;
+    fEnd                  = address + size;
+    fErasedEnd            = address;
+    fBlockSequenceCounter = 0U;
+    fFillIdx              = 0U;
+    fProgramIdx           = 0U;
+    fUsedBuffers          = 0U;
+    fFailed               = false;
+    fActive               = true;
+    fCrc.init();
+    return DiagReturnCode::OK;
+}
+
+DiagReturnCode::Type FlashDownload::transferData(
+    uint8_t const blockSequenceCounter, uint8_t const data[], uint16_t const length)
+{
+    if (!fActive)
+    {
+        return DiagReturnCode::ISO_REQUEST_SEQUENCE_ERROR;
+    }
+    if (fFailed)
+    {
+        return DiagReturnCode::ISO_GENERAL_PROGRAMMING_FAILURE;
+    }
+    if ((fAddress != fStart) && (blockSequenceCounter == fBlockSequenceCounter))
+    {
+        // repetition of the last block, which has already been accepted
+        return DiagReturnCode::OK;
+    }
+    if (blockSequenceCounter != static_cast<uint8_t>(fBlockSequenceCounter + 1U))
+    {
+        return DiagReturnCode::ISO_WRONG_BLOCK_SEQUENCE_COUNTER;
+    }
+    if ((length == 0U) || (length > fBufferSize))
+    {
+        return DiagReturnCode::ISO_INVALID_FORMAT;
+    }
+    if (length > (fEnd - fAddress))
+    {
+        return DiagReturnCode::ISO_TRANSFER_DATA_SUSPENDED;
+    }
+    if (fUsedBuffers == fBuffers.size())
+    {
+        return DiagReturnCode::ISO_RESPONSE_PENDING;
+    }
+    Buffer& buffer = fBuffers[fFillIdx];
+    (void)::etl::copy(data, data + length, buffer.data);
+    buffer.address = fAddress;
+    buffer.length  = length;
+    (void)fCrc.update(data, length);
+    fAddress += length;
+    fBlockSequenceCounter = blockSequenceCounter;
+    fFillIdx ^= 1U;
+    ++fUsedBuffers;
+    startProgramming();
+    return DiagReturnCode::OK;
+}
+
+DiagReturnCode::Type FlashDownload::requestTransferExit(uint32_t& crc)
+{
+    if (!fActive)
+    {
+        return DiagReturnCode::ISO_REQUEST_SEQUENCE_ERROR;
+    }
+    if (fFailed)
+    {
+        fActive = false;
+        return DiagReturnCode::ISO_GENERAL_PROGRAMMING_FAILURE;
+    }
+    if (fAddress != fEnd)
+    {
+        return DiagReturnCode::ISO_REQUEST_SEQUENCE_ERROR;
+    }
+    if (fUsedBuffers > 0U)
+    {
+        return DiagReturnCode::ISO_RESPONSE_PENDING;
+    }
+    fActive = false;
+    crc     = fCrc.digest();
+    Logger::info(UDS, "FlashDownload: 0x%x bytes programmed at 0x%x", fEnd - fStart, fStart);
+    return DiagReturnCode::OK;
+}
+
+bool FlashDownload::waitForProgress(IFlashDownloadListener& listener)
+{
+    if ((fpListener != nullptr) && (fpListener != &listener))
+    {
+        return false;
+    }
+    fpListener = &listener;
+    return true;
+}
+
+void FlashDownload::abort()
+{
+    if (fActive)
+    {
+        Logger::warn(UDS, "FlashDownload: download at 0x%x aborted", fStart);
+    }
+    fActive = false;
+}
+
+void FlashDownload::diagSessionChanged(DiagSession const& /* session */) { abort(); }
+
+void FlashDownload::diagSessionResponseSent(uint8_t const /* responseCode */) {}
+
+void FlashDownload::startProgramming()
+{
+    if ((!fProgramming) && (fUsedBuffers > 0U))
+    {
+        fProgramming = true;
+        ::async::execute(fFlashContext, fProgram);
+    }
+}
+
+void FlashDownload::program()
+{
+    Buffer const& buffer = fBuffers[fProgramIdx];
+    uint32_t const end   = buffer.address + buffer.length;
+    fResult              = eraseUpTo(end);
+    if (fResult == IFlashDriver::FLASH_OP_SUCCESSFUL)
+    {
+        fResult = fFlashDriver.write(buffer.address, buffer.data, buffer.length);
+    }
+    if (fResult == IFlashDriver::FLASH_OP_SUCCESSFUL)
+    {
+        if (end == fEnd)
+        {
+            fResult = fFlashDriver.flush();
+        }
+        else
+        {
+            // A failure is reported when the next block is programmed.
+            (void)eraseUpTo(end + ::etl::min<uint32_t>(fBufferSize, fEnd - end));
+        }
+    }
+    ::async::execute(fDiagContext, fProgrammed);
+}
+
+void FlashDownload::programmed()
+{
+    if (fResult != IFlashDriver::FLASH_OP_SUCCESSFUL)
+    {
+        Logger::error(
+            UDS, "FlashDownload: programming failed at 0x%x", fBuffers[fProgramIdx].address);
+        fFailed = true;
+    }
+    fProgramming = false;
+    fProgramIdx ^= 1U;
+    --fUsedBuffers;
+    if (fActive && (!fFailed))
+    {
+        startProgramming();
+    }
+    else
+    {
+        // discard data that has not been programmed yet
+        fUsedBuffers = 0U;
+        fFillIdx     = fProgramIdx;
+    }
+    IFlashDownloadListener* const listener = fpListener;
+    fpListener                             = nullptr;
+    if (listener != nullptr)
+    {
+        listener->downloadProgressed();
+    }
+}
+
+IFlashDriver::FlashOperationStatus FlashDownload::eraseUpTo(uint32_t const end)
+{
+    while (fErasedEnd < end)
+    {
+        uint32_t blockSize = 0U;
+        if ((fFlashDriver.getBlockSize(fErasedEnd, blockSize) != IFlashDriver::FLASH_OP_SUCCESSFUL)
+            || (blockSize == 0U)
+            || (fFlashDriver.erase(fErasedEnd, blockSize) != IFlashDriver::FLASH_OP_SUCCESSFUL))
+        {
+            return IFlashDriver::FLASH_OP_FAILED;
+        }
+        fErasedEnd += blockSize;
+    }
+    return IFlashDriver::FLASH_OP_SUCCESSFUL;
+}
+
+} // namespace uds
@@ -0,0 +1,65 @@
+// Copyright 2025 Accenture.
+
+#include "uds/services/download/RequestDownload.h"
+
+#include "uds/connection/IncomingDiagConnection.h"
+
+namespace uds
+{
+RequestDownload::RequestDownload(
+    FlashDownload& download, DiagSession::DiagSessionMask const sessionMask)
+: Service(ServiceId::REQUEST_DOWNLOAD, sessionMask), fDownload(download)
+{
+    setDefaultDiagReturnCode(DiagReturnCode::ISO_REQUEST_OUT_OF_RANGE);
+}
+
+DiagReturnCode::Type RequestDownload::process(
+    IncomingDiagConnection& connection, uint8_t const* const request, uint16_t const requestLength)
+{
+    if (requestLength < MIN_REQUEST_LENGTH)
+    {
+        return DiagReturnCode::ISO_INVALID_FORMAT;
+    }
+    if (request[0] != DATA_FORMAT_IDENTIFIER)
+    {
+        return DiagReturnCode::ISO_REQUEST_OUT_OF_RANGE;
+    }
+    uint8_t const addressLength = request[1] & 0x0FU;
+    uint8_t const sizeLength    = static_cast<uint8_t>(request[1] >> 4U);
+    if ((addressLength == 0U) || (addressLength > MAX_PARAMETER_LENGTH) || (sizeLength == 0U)
+        || (sizeLength > MAX_PARAMETER_LENGTH))
+    {
+        return DiagReturnCode::ISO_REQUEST_OUT_OF_RANGE;
+    }
+    if (requestLength != (2U + addressLength + sizeLength))
+    {
+        return DiagReturnCode::ISO_INVALID_FORMAT;
+    }
+    uint32_t address = 0U;
+    uint32_t size    = 0U;
+    for (uint8_t i = 0U; i < addressLength; ++i)
+    {
+        address = (address << 8U) | static_cast<uint32_t>(request[2U + i]);
+    }
+    for (uint8_t i = 0U; i < sizeLength; ++i)
+    {
+        size = (size << 8U) | static_cast<uint32_t>(request[2U + addressLength + i]);
+    }
+    DiagReturnCode::Type const result = fDownload.requestDownload(address, size);
+    if (result != DiagReturnCode::OK)
+    {
+        return result;
+    }
+    PositiveResponse& response = connection.releaseRequestGetResponse();
+    if ((!response.appendUint8(LENGTH_FORMAT_IDENTIFIER))
+        || (!response.appendUint16(
+            static_cast<uint16_t>(fDownload.getBufferSize() + TRANSFER_DATA_HEADER_LENGTH))))
+    {
+        fDownload.abort();
+        return DiagReturnCode::ISO_RESPONSE_TOO_LONG;
+    }
+    (void)connection.sendPositiveResponseInternal(response.getLength(), *this);
+    return DiagReturnCode::OK;
+}
+
+} // namespace uds
@@ -0,0 +1,66 @@
+// Copyright 2025 Accenture.
+
+#include "uds/services/download/RequestTransferExit.h"
+
+#include "uds/connection/IncomingDiagConnection.h"
+
+namespace uds
+{
+RequestTransferExit::RequestTransferExit(
+    FlashDownload& download, DiagSession::DiagSessionMask const sessionMask)
+: Service(ServiceId::REQUEST_TRANSFER_EXIT, sessionMask)
+, fDownload(download)
+, fpPendingConnection(nullptr)
+{}
+
+void RequestTransferExit::downloadProgressed()
+{
+    IncomingDiagConnection* const connection = fpPendingConnection;
+    fpPendingConnection                      = nullptr;
+    if ((connection == nullptr) || (!connection->isOpen))
+    {
+        return;
+    }
+    DiagReturnCode::Type const result = exit(*connection);
+    if (result != DiagReturnCode::OK)
+    {
+        (void)connection->sendNegativeResponse(result, *this);
+        connection->terminate();
+    }
+}
+
+DiagReturnCode::Type RequestTransferExit::process(
+    IncomingDiagConnection& connection,
+    uint8_t const* const /* request */,
+    uint16_t const /* requestLength */)
+{
+    return exit(connection);
+}
+
+DiagReturnCode::Type RequestTransferExit::exit(IncomingDiagConnection& connection)
+{
+    uint32_t crc                      = 0U;
+    DiagReturnCode::Type const result = fDownload.requestTransferExit(crc);
+    if (result == DiagReturnCode::ISO_RESPONSE_PENDING)
+    {
+        if (!fDownload.waitForProgress(*this))
+        {
+            return DiagReturnCode::ISO_BUSY_REPEAT_REQUEST;
+        }
+        fpPendingConnection = &connection;
+        return DiagReturnCode::OK;
+    }
+    if (result != DiagReturnCode::OK)
+    {
+        return result;
+    }
+    PositiveResponse& response = connection.releaseRequestGetResponse();
+    if (!response.appendUint32(crc))
+    {
+        return DiagReturnCode::ISO_RESPONSE_TOO_LONG;
+    }
+    (void)connection.sendPositiveResponseInternal(response.getLength(), *this);
+    return DiagReturnCode::OK;
+}
+
+} // namespace uds
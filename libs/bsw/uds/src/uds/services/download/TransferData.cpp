@@ -0,0 +1,71 @@
+// Copyright 2025 Accenture.
+
+#include "uds/services/download/TransferData.h"
+
+#include "uds/connection/IncomingDiagConnection.h"
+
+namespace uds
+{
+TransferData::TransferData(FlashDownload& download, DiagSession::DiagSessionMask const sessionMask)
+: Service(ServiceId::TRANSFER_DATA, sessionMask)
+, fDownload(download)
+, fpPendingConnection(nullptr)
+, fpPendingRequest(nullptr)
+, fPendingRequestLength(0U)
+{}
+
+void TransferData::downloadProgressed()
+{
+    IncomingDiagConnection* const connection = fpPendingConnection;
+    fpPendingConnection                      = nullptr;
+    if ((connection == nullptr) || (!connection->isOpen))
+    {
+        return;
+    }
+    DiagReturnCode::Type const result
+        = transfer(*connection, fpPendingRequest, fPendingRequestLength);
+    if (result != DiagReturnCode::OK)
+    {
+        (void)connection->sendNegativeResponse(result, *this);
+        connection->terminate();
+    }
+}
+
+DiagReturnCode::Type TransferData::process(
+    IncomingDiagConnection& connection, uint8_t const* const request, uint16_t const requestLength)
+{
+    if (requestLength < MIN_REQUEST_LENGTH)
+    {
+        return DiagReturnCode::ISO_INVALID_FORMAT;
+    }
+    return transfer(connection, request, requestLength);
+}
+
+DiagReturnCode::Type TransferData::transfer(
+    IncomingDiagConnection& connection, uint8_t const* const request, uint16_t const requestLength)
+{
+    uint8_t const blockSequenceCounter = request[0];
+    DiagReturnCode::Type const result  = fDownload.transferData(
+        blockSequenceCounter, &request[1], static_cast<uint16_t>(requestLength - 1U));
+    if (result == DiagReturnCode::ISO_RESPONSE_PENDING)
+    {
+        if (!fDownload.waitForProgress(*this))
+        {
+            return DiagReturnCode::ISO_BUSY_REPEAT_REQUEST;
+        }
+        fpPendingConnection   = &connection;
+        fpPendingRequest      = request;
+        fPendingRequestLength = requestLength;
+        return DiagReturnCode::OK;
+    }
+    if (result != DiagReturnCode::OK)
+    {
+        return result;
+    }
+    PositiveResponse& response = connection.releaseRequestGetResponse();
+    (void)response.appendUint8(blockSequenceCounter);
+    (void)connection.sendPositiveResponseInternal(response.getLength(), *this);
+    return DiagReturnCode::OK;
+}
+
+} // namespace uds
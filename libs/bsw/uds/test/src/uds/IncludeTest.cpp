@@ -36,6 +36,11 @@
 #include "uds/services/communicationcontrol/CommunicationControl.h"
 #include "uds/services/communicationcontrol/ICommunicationStateManager.h"
 #include "uds/services/controldtcsetting/ControlDTCSetting.h"
+#include "uds/services/download/FlashDownload.h"
+#include "uds/services/download/IFlashDownloadListener.h"
+#include "uds/services/download/RequestDownload.h"
+#include "uds/services/download/RequestTransferExit.h"
+#include "uds/services/download/TransferData.h"
 #include "uds/services/ecureset/ECUReset.h"
 #include "uds/services/ecureset/EnableRapidPowerShutdown.h"
 #include "uds/services/ecureset/HardReset.h"
@@ -4,6 +4,7 @@
  * Contains a UDS integration test.
  */
 #include "common/busid/BusId.h"
+#include "transport/BuddyTransportMessageProvider.h"
 #include "transport/AbstractTransportLayerMock.h"
 #include "transport/TransportConfiguration.h"
 #include "transport/TransportMessage.h"
@@ -247,6 +248,68 @@ TEST_F(UdsIntegration, positive_response)
     CONTEXT_EXECUTE;
 }
 
+/**
+ * \desc
+ * The response is built in the buffer of the request. A request taken from a
+ * BuddyTransportMessageProvider with the minimum buffer size of the TransportRouterSimple must
+ * have room for a response that is longer than the request.
+ */
+TEST_F(UdsIntegration, positive_response_larger_than_request_from_buddy_provider)
+{
+    static uint16_t const DIAG_PAYLOAD_SIZE = transport::TransportConfiguration::DIAG_PAYLOAD_SIZE;
+    transport::declare::BuddyTransportMessageProvider<DIAG_PAYLOAD_SIZE, 64U, 1U, DIAG_PAYLOAD_SIZE>
+        provider;
+    uint8_t const request[]    = {0x22, 0x01, 0x01};
+    uint8_t expectedResponse[] = {0x62, 0x01, 0x01, 0x01, 0x02, 0x03};
+    TransportMessageWithBuffer pResponse(0x10, 0xF1, expectedResponse);
+
+    transport::TransportMessage* pRequest = nullptr;
+    ASSERT_EQ(
+        transport::ITransportMessageProvider::ErrorCode::TPMSG_OK,
+        provider.getTransportMessage(0U, SOURCE_ID, TARGET_ID, sizeof(request), {}, pRequest));
+    pRequest->append(request, sizeof(request));
+    pRequest->setSourceAddress(SOURCE_ID);
+    pRequest->setTargetAddress(TARGET_ID);
+    pRequest->setPayloadLength(sizeof(request));
+
+    transport::ITransportMessageProcessedListener* pProcessedListener = nullptr;
+    transport::TransportMessage* pMessage                             = nullptr;
+
+    _udsDispatcher.send(*pRequest, &_messageProcessedListener);
+
+    EXPECT_CALL(_sessionManager, getActiveSession())
+        .WillRepeatedly(ReturnRef(DiagSession::APPLICATION_DEFAULT_SESSION()));
+    EXPECT_CALL(_sessionManager, acceptedJob(_, Ref(_rdbi), NotNull(), 2))
+        .WillOnce(Return(uds::DiagReturnCode::OK));
+    EXPECT_CALL(_sessionManager, acceptedJob(_, Ref(_myRdbi), NotNull(), 0))
+        .WillOnce(Return(uds::DiagReturnCode::OK));
+    EXPECT_CALL(_sessionManager, responseSent(_, uds::DiagReturnCode::OK, NotNull(), 3))
+        .With(Args<2, 3>(ElementsAre(0x01, 0x02, 0x03)));
+    EXPECT_CALL(_messageListener, messageReceived(Eq(0u), Eq(ByRef(*pResponse)), NotNull()))
+        .WillOnce(DoAll(
+            WithArg<1>(SaveRef<0>(&pMessage)),
+            SaveArg<2>(&pProcessedListener),
+            Return(transport::ITransportMessageListener::ReceiveResult::RECEIVED_NO_ERROR)));
+
+    _udsDispatcher.processQueue();
+    CONTEXT_EXECUTE;
+
+    EXPECT_CALL(
+        _messageProcessedListener,
+        transportMessageProcessed(
+            Ref(*pRequest),
+            transport::ITransportMessageProcessedListener::ProcessingResult::PROCESSED_NO_ERROR));
+    EXPECT_CALL(_messageProvider, releaseTransportMessage(SameAddress(pMessage)));
+
+    ASSERT_NE(pMessage, nullptr);
+    EXPECT_EQ(pRequest->getBuffer(), pMessage->getBuffer());
+    pProcessedListener->transportMessageProcessed(
+        *pMessage,
+        transport::ITransportMessageProcessedListener::ProcessingResult::PROCESSED_NO_ERROR);
+    CONTEXT_EXECUTE;
+    provider.releaseTransportMessage(*pRequest);
+}
+
 /**
  * \desc
  * A RDBI not found must result in negative response ROOR
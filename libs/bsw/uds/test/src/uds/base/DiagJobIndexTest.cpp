@@ -0,0 +1,311 @@
+// Copyright 2025 Accenture.
+
+#include "uds/base/DiagJobIndex.h"
+
+#include "uds/base/AbstractDiagJob.h"
+#include "uds/connection/IncomingDiagConnection.h"
+#include "uds/session/ApplicationDefaultSession.h"
+#include "uds/session/DiagSessionManagerMock.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+using namespace ::uds;
+using namespace ::testing;
+
+/**
+ * Job that is responsible for all requests starting with its identifier, like DataIdentifierJob.
+ */
+class IdentifierJob : public AbstractDiagJob
+{
+public:
+    IdentifierJob(
+        uint8_t const implementedRequest[],
+        uint8_t const requestLength,
+        uint8_t const prefixLength,
+        DiagSessionMask const sessionMask = DiagSession::ALL_SESSIONS())
+    : AbstractDiagJob(implementedRequest, requestLength, prefixLength, sessionMask)
+    , fIdentifierLength(requestLength - prefixLength)
+    , fVerifyCount(0U)
+    , fProcessCount(0U)
+    {}
+
+    DiagReturnCode::Type verify(uint8_t const request[], uint16_t const requestLength) override
+    {
+        ++fVerifyCount;
+        uint8_t const* const identifier
+            = getImplementedRequest() + (getRequestLength() - fIdentifierLength);
+        if ((requestLength < fIdentifierLength)
+            || (!compare(request, identifier, fIdentifierLength)))
+        {
+            return DiagReturnCode::NOT_RESPONSIBLE;
+        }
+        return DiagReturnCode::OK;
+    }
+
+    DiagReturnCode::Type
+    process(IncomingDiagConnection&, uint8_t const[], uint16_t const) override
+    {
+        ++fProcessCount;
+        return DiagReturnCode::OK;
+    }
+
+    uint16_t fIdentifierLength;
+    uint32_t fVerifyCount;
+    uint32_t fProcessCount;
+};
+
+/**
+ * Job that is responsible for every request.
+ */
+class CatchAllJob : public IdentifierJob
+{
+public:
+    CatchAllJob(uint8_t const implementedRequest[], uint8_t const requestLength)
+    : IdentifierJob(implementedRequest, requestLength, requestLength - 1U)
+    {}
+
+    DiagReturnCode::Type verify(uint8_t const[], uint16_t const) override
+    {
+        ++fVerifyCount;
+        return DiagReturnCode::OK;
+    }
+};
+
+class ParentJob : public IdentifierJob
+{
+public:
+    using IdentifierJob::IdentifierJob;
+
+    DiagReturnCode::Type
+    process(IncomingDiagConnection& connection, uint8_t const request[], uint16_t const length)
+        override
+    {
+        return AbstractDiagJob::process(connection, request, length);
+    }
+
+    using AbstractDiagJob::setDefaultDiagReturnCode;
+};
+
+struct DiagJobIndexTest : public Test
+{
+    DiagJobIndexTest()
+    {
+        ON_CALL(fSessionManager, getActiveSession())
+            .WillByDefault(ReturnRef(DiagSession::APPLICATION_DEFAULT_SESSION()));
+        AbstractDiagJob::setDefaultDiagSessionManager(fSessionManager);
+        fParent.setDefaultDiagReturnCode(DiagReturnCode::ISO_REQUEST_OUT_OF_RANGE);
+    }
+
+    DiagReturnCode::Type process(uint8_t const request[], uint16_t const length)
+    {
+        return fParent.process(fConnection, request, length);
+    }
+
+    static uint8_t const PARENT_REQUEST[];
+    static uint8_t const CHILD_1_REQUEST[];
+    static uint8_t const CHILD_2_REQUEST[];
+    static uint8_t const CHILD_3_REQUEST[];
+    static uint8_t const LONG_CHILD_REQUEST[];
+
+    NiceMock<DiagSessionManagerMock> fSessionManager;
+    IncomingDiagConnection fConnection{::async::CONTEXT_INVALID};
+    ParentJob fParent{PARENT_REQUEST, 1U, 0U};
+    IdentifierJob fChild1{CHILD_1_REQUEST, 3U, 1U};
+    IdentifierJob fChild2{CHILD_2_REQUEST, 3U, 1U};
+    IdentifierJob fChild3{CHILD_3_REQUEST, 3U, 1U};
+    IdentifierJob fLongChild{LONG_CHILD_REQUEST, 4U, 1U};
+    declare::DiagJobIndex<2U> fIndex;
+};
+
+uint8_t const DiagJobIndexTest::PARENT_REQUEST[]     = {0x22U};
+uint8_t const DiagJobIndexTest::CHILD_1_REQUEST[]    = {0x22U, 0xF1U, 0x90U};
+uint8_t const DiagJobIndexTest::CHILD_2_REQUEST[]    = {0x22U, 0x01U, 0x00U};
+uint8_t const DiagJobIndexTest::CHILD_3_REQUEST[]    = {0x22U, 0x80U, 0x00U};
+uint8_t const DiagJobIndexTest::LONG_CHILD_REQUEST[] = {0x22U, 0x01U, 0x00U, 0x01U};
+
+/**
+ * \desc
+ * Jobs are kept sorted by their identifier and are found by the beginning of a request.
+ */
+TEST_F(DiagJobIndexTest, findReturnsJobWithMatchingIdentifier)
+{
+    EXPECT_TRUE(fIndex.add(fChild1));
+    EXPECT_TRUE(fIndex.add(fChild2));
+    EXPECT_EQ(2U, fIndex.getSize());
+    EXPECT_EQ(2U, fIndex.getKeyLength());
+
+    uint8_t const request1[] = {0xF1U, 0x90U, 0x12U};
+    uint8_t const request2[] = {0x01U, 0x00U};
+    uint8_t const request3[] = {0x01U, 0x01U};
+    EXPECT_EQ(&fChild1, fIndex.find(request1, sizeof(request1)));
+    EXPECT_EQ(&fChild2, fIndex.find(request2, sizeof(request2)));
+    EXPECT_EQ(nullptr, fIndex.find(request3, sizeof(request3)));
+    EXPECT_EQ(nullptr, fIndex.find(request2, 1U));
+}
+
+/**
+ * \desc
+ * Jobs with identifiers of another length than the first job, duplicate identifiers and jobs
+ * exceeding the capacity are not indexed.
+ */
+TEST_F(DiagJobIndexTest, addRejectsNonMatchingJobs)
+{
+    IdentifierJob duplicate(CHILD_1_REQUEST, 3U, 1U);
+
+    EXPECT_TRUE(fIndex.add(fChild1));
+    EXPECT_FALSE(fIndex.add(fChild1));
+    EXPECT_FALSE(fIndex.add(duplicate));
+    EXPECT_FALSE(fIndex.add(fLongChild));
+    EXPECT_TRUE(fIndex.add(fChild2));
+    EXPECT_FALSE(fIndex.add(fChild3));
+    EXPECT_EQ(2U, fIndex.getSize());
+
+    EXPECT_TRUE(fIndex.remove(fChild1));
+    EXPECT_FALSE(fIndex.remove(fChild1));
+    EXPECT_TRUE(fIndex.add(fChild3));
+    fIndex.clear();
+    EXPECT_EQ(0U, fIndex.getSize());
+    EXPECT_TRUE(fIndex.add(fLongChild));
+    EXPECT_EQ(3U, fIndex.getKeyLength());
+}
+
+/**
+ * \desc
+ * With an index only the responsible child is executed.
+ */
+TEST_F(DiagJobIndexTest, processExecutesIndexedChildOnly)
+{
+    fParent.setChildIndex(fIndex);
+    EXPECT_EQ(AbstractDiagJob::JOB_ADDED, fParent.addAbstractDiagJob(fChild1));
+    EXPECT_EQ(AbstractDiagJob::JOB_ADDED, fParent.addAbstractDiagJob(fChild2));
+    EXPECT_EQ(2U, fIndex.getSize());
+
+    uint8_t const request[] = {0x01U, 0x00U};
+    EXPECT_EQ(DiagReturnCode::OK, process(request, sizeof(request)));
+    EXPECT_EQ(0U, fChild1.fVerifyCount);
+    EXPECT_EQ(1U, fChild2.fVerifyCount);
+    EXPECT_EQ(1U, fChild2.fProcessCount);
+}
+
+/**
+ * \desc
+ * Children added before the index is set are indexed, requests without responsible child return
+ * the default return code.
+ */
+TEST_F(DiagJobIndexTest, processReturnsDefaultReturnCodeIfNoChildIsResponsible)
+{
+    EXPECT_EQ(AbstractDiagJob::JOB_ADDED, fParent.addAbstractDiagJob(fChild1));
+    EXPECT_EQ(AbstractDiagJob::JOB_ADDED, fParent.addAbstractDiagJob(fChild2));
+    fParent.setChildIndex(fIndex);
+    EXPECT_EQ(2U, fIndex.getSize());
+
+    uint8_t const request[] = {0x01U, 0x01U};
+    EXPECT_EQ(DiagReturnCode::ISO_REQUEST_OUT_OF_RANGE, process(request, sizeof(request)));
+    EXPECT_EQ(0U, fChild1.fVerifyCount);
+    EXPECT_EQ(0U, fChild2.fVerifyCount);
+}
+
+/**
+ * \desc
+ * Children that don't fit into the index are asked one after the other after the indexed child.
+ */
+TEST_F(DiagJobIndexTest, processAsksChildrenNotInIndex)
+{
+    fParent.setChildIndex(fIndex);
+    EXPECT_EQ(AbstractDiagJob::JOB_ADDED, fParent.addAbstractDiagJob(fChild1));
+    EXPECT_EQ(AbstractDiagJob::JOB_ADDED, fParent.addAbstractDiagJob(fLongChild));
+    EXPECT_EQ(AbstractDiagJob::JOB_ADDED, fParent.addAbstractDiagJob(fChild2));
+    EXPECT_EQ(AbstractDiagJob::JOB_ADDED, fParent.addAbstractDiagJob(fChild3));
+    EXPECT_EQ(2U, fIndex.getSize());
+
+    uint8_t const request1[] = {0x80U, 0x00U};
+    EXPECT_EQ(DiagReturnCode::OK, process(request1, sizeof(request1)));
+    EXPECT_EQ(1U, fLongChild.fVerifyCount);
+    EXPECT_EQ(1U, fChild3.fProcessCount);
+    EXPECT_EQ(0U, fChild1.fVerifyCount);
+    EXPECT_EQ(0U, fChild2.fVerifyCount);
+
+    // requests shorter than the identifiers are passed to all children
+    uint8_t const request2[] = {0x80U};
+    EXPECT_EQ(DiagReturnCode::ISO_REQUEST_OUT_OF_RANGE, process(request2, sizeof(request2)));
+    EXPECT_EQ(1U, fChild1.fVerifyCount);
+    EXPECT_EQ(1U, fChild2.fVerifyCount);
+}
+
+/**
+ * \desc
+ * An indexed child is asked before children that are not indexed.
+ */
+TEST_F(DiagJobIndexTest, processAsksIndexedChildFirst)
+{
+    uint8_t const catchAllRequest[] = {0x22U, 0x00U};
+    CatchAllJob catchAll(catchAllRequest, sizeof(catchAllRequest));
+
+    fParent.setChildIndex(fIndex);
+    EXPECT_EQ(AbstractDiagJob::JOB_ADDED, fParent.addAbstractDiagJob(fChild1));
+    EXPECT_EQ(AbstractDiagJob::JOB_ADDED, fParent.addAbstractDiagJob(catchAll));
+    EXPECT_EQ(AbstractDiagJob::JOB_ADDED, fParent.addAbstractDiagJob(fChild2));
+    EXPECT_EQ(2U, fIndex.getSize());
+
+    uint8_t const request1[] = {0x01U, 0x00U};
+    EXPECT_EQ(DiagReturnCode::OK, process(request1, sizeof(request1)));
+    EXPECT_EQ(1U, fChild2.fProcessCount);
+    EXPECT_EQ(0U, catchAll.fVerifyCount);
+
+    uint8_t const request2[] = {0x01U, 0x01U};
+    EXPECT_EQ(DiagReturnCode::OK, process(request2, sizeof(request2)));
+    EXPECT_EQ(1U, catchAll.fProcessCount);
+    EXPECT_EQ(0U, fChild1.fVerifyCount);
+}
+
+/**
+ * \desc
+ * Removing a child from the tree removes it from the index of its parent.
+ */
+TEST_F(DiagJobIndexTest, removeAbstractDiagJobRemovesChildFromIndex)
+{
+    fParent.setChildIndex(fIndex);
+    EXPECT_EQ(AbstractDiagJob::JOB_ADDED, fParent.addAbstractDiagJob(fChild1));
+    EXPECT_EQ(AbstractDiagJob::JOB_ADDED, fParent.addAbstractDiagJob(fChild2));
+
+    fParent.removeAbstractDiagJob(fChild2);
+    EXPECT_EQ(1U, fIndex.getSize());
+
+    uint8_t const request[] = {0x01U, 0x00U};
+    EXPECT_EQ(DiagReturnCode::ISO_REQUEST_OUT_OF_RANGE, process(request, sizeof(request)));
+    EXPECT_EQ(0U, fChild2.fVerifyCount);
+
+    fParent.removeAbstractDiagJob(fChild1);
+    EXPECT_EQ(0U, fIndex.getSize());
+    EXPECT_EQ(AbstractDiagJob::JOB_ADDED, fParent.addAbstractDiagJob(fChild2));
+    EXPECT_EQ(DiagReturnCode::OK, process(request, sizeof(request)));
+    EXPECT_EQ(1U, fChild2.fProcessCount);
+}
+
+/**
+ * \desc
+ * Replacing the index of a job moves all children to the new index.
+ */
+TEST_F(DiagJobIndexTest, setChildIndexReplacesIndex)
+{
+    declare::DiagJobIndex<4U> index;
+
+    fParent.setChildIndex(fIndex);
+    EXPECT_EQ(AbstractDiagJob::JOB_ADDED, fParent.addAbstractDiagJob(fChild1));
+    EXPECT_EQ(AbstractDiagJob::JOB_ADDED, fParent.addAbstractDiagJob(fChild2));
+    EXPECT_EQ(AbstractDiagJob::JOB_ADDED, fParent.addAbstractDiagJob(fChild3));
+
+    fParent.setChildIndex(index);
+    EXPECT_EQ(0U, fIndex.getSize());
+    EXPECT_EQ(3U, index.getSize());
+
+    uint8_t const request[] = {0x80U, 0x00U};
+    EXPECT_EQ(DiagReturnCode::OK, process(request, sizeof(request)));
+    EXPECT_EQ(1U, fChild3.fVerifyCount);
+    EXPECT_EQ(0U, fChild1.fVerifyCount);
+    EXPECT_EQ(0U, fChild2.fVerifyCount);
+}
+
+} // anonymous namespace
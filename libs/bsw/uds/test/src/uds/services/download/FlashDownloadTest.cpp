@@ -0,0 +1,289 @@
+// Copyright 2025 Accenture.
+
+#include "uds/services/download/FlashDownload.h"
+
+#include "uds/session/ApplicationDefaultSession.h"
+
+#include <async/AsyncMock.h>
+#include <async/TestContext.h>
+#include <bsp/flash/FlashDriverMock.h>
+#include <util/crc/Crc32.h>
+
+#include <etl/array.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+using namespace ::uds;
+using namespace ::testing;
+using ::flash::FlashDriverMock;
+using ::flash::IFlashDriver;
+
+class FlashDownloadListenerMock : public IFlashDownloadListener
+{
+public:
+    MOCK_METHOD(void, downloadProgressed, (), (override));
+};
+
+class FlashDownloadTest : public Test
+{
+public:
+    static uint16_t const BUFFER_SIZE  = 16U;
+    static uint32_t const BLOCK_SIZE   = 32U;
+    static uint32_t const MEMORY_START = 0x1000U;
+    static uint32_t const MEMORY_SIZE  = 0x100U;
+
+    FlashDownloadTest()
+    : fDiagContext(1U)
+    , fFlashContext(2U)
+    , fDownload(fFlashDriver, fDiagContext, fFlashContext, MEMORY_START, MEMORY_SIZE)
+    {
+        fDiagContext.handleExecute();
+        fFlashContext.handleExecute();
+        for (size_t i = 0U; i < fData.size(); ++i)
+        {
+            fData[i] = static_cast<uint8_t>(i * 7U);
+        }
+        ON_CALL(fFlashDriver, getBlockSize(_, _))
+            .WillByDefault(Invoke(
+                [](uint32_t const address, uint32_t& blockSize)
+                {
+                    if ((address % BLOCK_SIZE) == 0U)
+                    {
+                        blockSize = BLOCK_SIZE;
+                        return IFlashDriver::FLASH_OP_SUCCESSFUL;
+                    }
+                    blockSize = 0U;
+                    return IFlashDriver::FLASH_OP_FAILED;
+                }));
+        ON_CALL(fFlashDriver, erase(_, _))
+            .WillByDefault(Return(IFlashDriver::FLASH_OP_SUCCESSFUL));
+        ON_CALL(fFlashDriver, write(_, _, _))
+            .WillByDefault(Return(IFlashDriver::FLASH_OP_SUCCESSFUL));
+        ON_CALL(fFlashDriver, flush()).WillByDefault(Return(IFlashDriver::FLASH_OP_SUCCESSFUL));
+    }
+
+    void programAll()
+    {
+        fFlashContext.execute();
+        fDiagContext.execute();
+    }
+
+protected:
+    ::async::AsyncMock fAsyncMock;
+    ::async::TestContext fDiagContext;
+    ::async::TestContext fFlashContext;
+    NiceMock<FlashDriverMock> fFlashDriver;
+    StrictMock<FlashDownloadListenerMock> fListener;
+    declare::FlashDownload<BUFFER_SIZE> fDownload;
+    ::etl::array<uint8_t, 64U> fData;
+};
+
+uint16_t const FlashDownloadTest::BUFFER_SIZE;
+uint32_t const FlashDownloadTest::BLOCK_SIZE;
+uint32_t const FlashDownloadTest::MEMORY_START;
+uint32_t const FlashDownloadTest::MEMORY_SIZE;
+
+TEST_F(FlashDownloadTest, requestDownloadChecksMemoryArea)
+{
+    EXPECT_EQ(16U, fDownload.getBufferSize());
+    EXPECT_EQ(DiagReturnCode::ISO_REQUEST_OUT_OF_RANGE, fDownload.requestDownload(0x0F00U, 32U));
+    EXPECT_EQ(
+        DiagReturnCode::ISO_REQUEST_OUT_OF_RANGE, fDownload.requestDownload(MEMORY_START, 0U));
+    EXPECT_EQ(
+        DiagReturnCode::ISO_REQUEST_OUT_OF_RANGE,
+        fDownload.requestDownload(MEMORY_START, MEMORY_SIZE + 1U));
+    EXPECT_EQ(
+        DiagReturnCode::ISO_REQUEST_OUT_OF_RANGE,
+        fDownload.requestDownload(MEMORY_START + 0x200U, 1U));
+    // not the start of a flash block
+    EXPECT_EQ(
+        DiagReturnCode::ISO_REQUEST_OUT_OF_RANGE, fDownload.requestDownload(MEMORY_START + 4U, 8U));
+    EXPECT_FALSE(fDownload.isActive());
+
+    EXPECT_EQ(DiagReturnCode::OK, fDownload.requestDownload(MEMORY_START, MEMORY_SIZE));
+    EXPECT_TRUE(fDownload.isActive());
+    EXPECT_EQ(
+        DiagReturnCode::ISO_CONDITIONS_NOT_CORRECT,
+        fDownload.requestDownload(MEMORY_START, MEMORY_SIZE));
+
+    fDownload.abort();
+    EXPECT_FALSE(fDownload.isActive());
+    EXPECT_EQ(DiagReturnCode::OK, fDownload.requestDownload(MEMORY_START, MEMORY_SIZE));
+}
+
+TEST_F(FlashDownloadTest, requestDownloadRequiresBlockAlignedAddress)
+{
+    // a driver that doesn't check the alignment itself
+    ON_CALL(fFlashDriver, getBlockSize(_, _))
+        .WillByDefault(
+            DoAll(SetArgReferee<1>(BLOCK_SIZE), Return(IFlashDriver::FLASH_OP_SUCCESSFUL)));
+    EXPECT_EQ(
+        DiagReturnCode::ISO_REQUEST_OUT_OF_RANGE,
+        fDownload.requestDownload(MEMORY_START + 4U, BUFFER_SIZE));
+    EXPECT_FALSE(fDownload.isActive());
+    EXPECT_EQ(
+        DiagReturnCode::OK, fDownload.requestDownload(MEMORY_START + BLOCK_SIZE, BUFFER_SIZE));
+}
+
+TEST_F(FlashDownloadTest, sessionChangeAbortsDownload)
+{
+    ASSERT_EQ(DiagReturnCode::OK, fDownload.requestDownload(MEMORY_START, 2U * BUFFER_SIZE));
+    ASSERT_EQ(DiagReturnCode::OK, fDownload.transferData(1U, fData.data(), BUFFER_SIZE));
+
+    // e.g. session timeout after the tester has disconnected
+    fDownload.diagSessionChanged(DiagSession::APPLICATION_DEFAULT_SESSION());
+    EXPECT_FALSE(fDownload.isActive());
+    EXPECT_EQ(
+        DiagReturnCode::ISO_REQUEST_SEQUENCE_ERROR,
+        fDownload.transferData(2U, fData.data(), BUFFER_SIZE));
+    programAll();
+
+    // a new download can be started right away
+    EXPECT_EQ(DiagReturnCode::OK, fDownload.requestDownload(MEMORY_START, BUFFER_SIZE));
+    EXPECT_EQ(DiagReturnCode::OK, fDownload.transferData(1U, fData.data(), BUFFER_SIZE));
+    programAll();
+    uint32_t crc = 0U;
+    EXPECT_EQ(DiagReturnCode::OK, fDownload.requestTransferExit(crc));
+}
+
+TEST_F(FlashDownloadTest, transferDataAndExitRequireActiveDownload)
+{
+    uint32_t crc = 0U;
+    EXPECT_EQ(
+        DiagReturnCode::ISO_REQUEST_SEQUENCE_ERROR, fDownload.transferData(1U, fData.data(), 8U));
+    EXPECT_EQ(DiagReturnCode::ISO_REQUEST_SEQUENCE_ERROR, fDownload.requestTransferExit(crc));
+}
+
+TEST_F(FlashDownloadTest, downloadIsErasedAheadProgrammedAndFlushed)
+{
+    ::util::crc::Crc32::Ethernet expectedCrc;
+    (void)expectedCrc.update(fData.data(), 40U);
+
+    ASSERT_EQ(DiagReturnCode::OK, fDownload.requestDownload(MEMORY_START, 40U));
+    {
+        InSequence seq;
+        EXPECT_CALL(fFlashDriver, erase(0x1000U, BLOCK_SIZE));
+        EXPECT_CALL(fFlashDriver, write(0x1000U, NotNull(), 16U));
+        EXPECT_CALL(fFlashDriver, write(0x1010U, NotNull(), 16U));
+        // the block following the received data is erased ahead
+        EXPECT_CALL(fFlashDriver, erase(0x1020U, BLOCK_SIZE));
+        EXPECT_CALL(fFlashDriver, write(0x1020U, NotNull(), 8U));
+        EXPECT_CALL(fFlashDriver, flush());
+    }
+
+    EXPECT_EQ(DiagReturnCode::OK, fDownload.transferData(1U, &fData[0U], 16U));
+    // the second buffer is filled while the first one is programmed
+    EXPECT_EQ(DiagReturnCode::OK, fDownload.transferData(2U, &fData[16U], 16U));
+    programAll();
+    EXPECT_EQ(DiagReturnCode::OK, fDownload.transferData(3U, &fData[32U], 8U));
+    programAll();
+    programAll();
+
+    uint32_t crc = 0U;
+    EXPECT_EQ(DiagReturnCode::OK, fDownload.requestTransferExit(crc));
+    EXPECT_EQ(expectedCrc.digest(), crc);
+    EXPECT_FALSE(fDownload.isActive());
+}
+
+TEST_F(FlashDownloadTest, transferDataIsPendingWhileBothBuffersAreInUse)
+{
+    ASSERT_EQ(DiagReturnCode::OK, fDownload.requestDownload(MEMORY_START, 64U));
+    EXPECT_EQ(DiagReturnCode::OK, fDownload.transferData(1U, &fData[0U], 16U));
+    EXPECT_EQ(DiagReturnCode::OK, fDownload.transferData(2U, &fData[16U], 16U));
+    EXPECT_EQ(DiagReturnCode::ISO_RESPONSE_PENDING, fDownload.transferData(3U, &fData[32U], 16U));
+    EXPECT_TRUE(fDownload.waitForProgress(fListener));
+    StrictMock<FlashDownloadListenerMock> otherListener;
+    EXPECT_FALSE(fDownload.waitForProgress(otherListener));
+
+    fFlashContext.execute();
+    EXPECT_CALL(fListener, downloadProgressed())
+        .WillOnce(Invoke(
+            [this]()
+            {
+                EXPECT_EQ(
+                    DiagReturnCode::OK, fDownload.transferData(3U, &fData[32U], 16U));
+            }));
+    fDiagContext.execute();
+    Mock::VerifyAndClearExpectations(&fListener);
+
+    // the second and third block are programmed one after the other
+    EXPECT_CALL(fFlashDriver, write(0x1010U, NotNull(), 16U));
+    EXPECT_CALL(fFlashDriver, write(0x1020U, NotNull(), 16U));
+    programAll();
+    programAll();
+}
+
+TEST_F(FlashDownloadTest, blockSequenceCounterIsChecked)
+{
+    ASSERT_EQ(DiagReturnCode::OK, fDownload.requestDownload(MEMORY_START, 64U));
+    EXPECT_EQ(
+        DiagReturnCode::ISO_WRONG_BLOCK_SEQUENCE_COUNTER,
+        fDownload.transferData(0U, &fData[0U], 16U));
+    EXPECT_EQ(DiagReturnCode::OK, fDownload.transferData(1U, &fData[0U], 16U));
+
+    // a repeated block is acknowledged but not programmed again
+    EXPECT_CALL(fFlashDriver, write(_, _, _)).Times(1);
+    EXPECT_EQ(DiagReturnCode::OK, fDownload.transferData(1U, &fData[0U], 16U));
+    EXPECT_EQ(
+        DiagReturnCode::ISO_WRONG_BLOCK_SEQUENCE_COUNTER,
+        fDownload.transferData(3U, &fData[16U], 16U));
+    programAll();
+}
+
+TEST_F(FlashDownloadTest, blockLengthIsChecked)
+{
+    ASSERT_EQ(DiagReturnCode::OK, fDownload.requestDownload(MEMORY_START, 20U));
+    EXPECT_EQ(
+        DiagReturnCode::ISO_INVALID_FORMAT,
+        fDownload.transferData(1U, &fData[0U], BUFFER_SIZE + 1U));
+    EXPECT_EQ(DiagReturnCode::OK, fDownload.transferData(1U, &fData[0U], 16U));
+    EXPECT_EQ(
+        DiagReturnCode::ISO_TRANSFER_DATA_SUSPENDED, fDownload.transferData(2U, &fData[16U], 8U));
+
+    uint32_t crc = 0U;
+    // not all data has been transferred
+    EXPECT_EQ(DiagReturnCode::ISO_REQUEST_SEQUENCE_ERROR, fDownload.requestTransferExit(crc));
+}
+
+TEST_F(FlashDownloadTest, requestTransferExitIsPendingUntilAllDataIsProgrammed)
+{
+    ASSERT_EQ(DiagReturnCode::OK, fDownload.requestDownload(MEMORY_START, 16U));
+    EXPECT_EQ(DiagReturnCode::OK, fDownload.transferData(1U, &fData[0U], 16U));
+
+    uint32_t crc = 0U;
+    EXPECT_EQ(DiagReturnCode::ISO_RESPONSE_PENDING, fDownload.requestTransferExit(crc));
+    EXPECT_TRUE(fDownload.waitForProgress(fListener));
+
+    EXPECT_CALL(fFlashDriver, flush());
+    EXPECT_CALL(fListener, downloadProgressed());
+    programAll();
+
+    EXPECT_EQ(DiagReturnCode::OK, fDownload.requestTransferExit(crc));
+}
+
+TEST_F(FlashDownloadTest, programmingFailureIsReported)
+{
+    ASSERT_EQ(DiagReturnCode::OK, fDownload.requestDownload(MEMORY_START, 64U));
+    EXPECT_CALL(fFlashDriver, write(0x1000U, NotNull(), 16U))
+        .WillOnce(Return(IFlashDriver::FLASH_OP_FAILED));
+    EXPECT_EQ(DiagReturnCode::OK, fDownload.transferData(1U, &fData[0U], 16U));
+    EXPECT_EQ(DiagReturnCode::OK, fDownload.transferData(2U, &fData[16U], 16U));
+    // the second block is discarded
+    EXPECT_CALL(fFlashDriver, write(0x1010U, _, _)).Times(0);
+    programAll();
+    programAll();
+
+    EXPECT_EQ(
+        DiagReturnCode::ISO_GENERAL_PROGRAMMING_FAILURE,
+        fDownload.transferData(3U, &fData[32U], 16U));
+    uint32_t crc = 0U;
+    EXPECT_EQ(DiagReturnCode::ISO_GENERAL_PROGRAMMING_FAILURE, fDownload.requestTransferExit(crc));
+    EXPECT_FALSE(fDownload.isActive());
+
+    // a new download can be started
+    EXPECT_EQ(DiagReturnCode::OK, fDownload.requestDownload(MEMORY_START, 64U));
+}
+
+} // namespace
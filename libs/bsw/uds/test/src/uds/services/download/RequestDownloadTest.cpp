@@ -0,0 +1,106 @@
+// Copyright 2025 Accenture.
+
+#include "uds/services/download/RequestDownload.h"
+
+#include "uds/connection/IncomingDiagConnectionMock.h"
+#include "uds/session/ApplicationDefaultSession.h"
+#include "uds/session/DiagSessionManagerMock.h"
+
+#include <async/AsyncMock.h>
+#include <bsp/flash/FlashDriverMock.h>
+#include <transport/TransportMessageWithBuffer.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+using namespace ::uds;
+using namespace ::testing;
+using namespace ::transport::test;
+using ::flash::FlashDriverMock;
+using ::flash::IFlashDriver;
+
+class RequestDownloadTest : public Test
+{
+public:
+    RequestDownloadTest()
+    : fDownload(fFlashDriver, 1U, 2U, 0x1000U, 0x1000U)
+    , fRequestDownload(fDownload, DiagSession::ALL_SESSIONS())
+    , fIncomingDiagConnection(::async::CONTEXT_INVALID)
+    {}
+
+    void SetUp() override
+    {
+        fRequestDownload.setDefaultDiagSessionManager(fSessionManager);
+        EXPECT_CALL(fSessionManager, getActiveSession())
+            .WillRepeatedly(ReturnRef(DiagSession::APPLICATION_DEFAULT_SESSION()));
+        EXPECT_CALL(fSessionManager, acceptedJob(_, _, _, _))
+            .WillRepeatedly(Return(DiagReturnCode::OK));
+        ON_CALL(fFlashDriver, getBlockSize(0x1000U, _))
+            .WillByDefault(
+                DoAll(SetArgReferee<1>(0x100U), Return(IFlashDriver::FLASH_OP_SUCCESSFUL)));
+        ON_CALL(fFlashDriver, getBlockSize(0x1004U, _))
+            .WillByDefault(DoAll(SetArgReferee<1>(0U), Return(IFlashDriver::FLASH_OP_FAILED)));
+    }
+
+    template<size_t N>
+    DiagReturnCode::Type execute(uint8_t const (&request)[N])
+    {
+        fRequest.reset(new TransportMessageWithBuffer(0xF1U, 0x10U, request, 16U));
+        fIncomingDiagConnection.requestMessage = fRequest->get();
+        return fRequestDownload.execute(fIncomingDiagConnection, request, N);
+    }
+
+protected:
+    ::async::AsyncMock fAsyncMock;
+    NiceMock<FlashDriverMock> fFlashDriver;
+    declare::FlashDownload<0x100U> fDownload;
+    RequestDownload fRequestDownload;
+    StrictMock<IncomingDiagConnectionMock> fIncomingDiagConnection;
+    StrictMock<DiagSessionManagerMock> fSessionManager;
+    std::unique_ptr<TransportMessageWithBuffer> fRequest;
+};
+
+TEST_F(RequestDownloadTest, positiveResponseContainsMaxNumberOfBlockLength)
+{
+    uint8_t const request[] = {0x34U, 0x00U, 0x24U, 0x00U, 0x00U, 0x10U, 0x00U, 0x00U, 0x20U};
+    EXPECT_EQ(DiagReturnCode::OK, execute(request));
+    EXPECT_TRUE(fDownload.isActive());
+
+    uint8_t const* const response = fRequest->get()->getPayload();
+    EXPECT_EQ(0x20U, response[1]);
+    EXPECT_EQ(0x01U, response[2]);
+    EXPECT_EQ(0x02U, response[3]);
+}
+
+TEST_F(RequestDownloadTest, requestWithInvalidLengthIsRejected)
+{
+    uint8_t const tooShort[] = {0x34U, 0x00U, 0x11U};
+    EXPECT_EQ(DiagReturnCode::ISO_INVALID_FORMAT, execute(tooShort));
+    uint8_t const sizeMissing[] = {0x34U, 0x00U, 0x12U, 0x10U, 0x00U};
+    EXPECT_EQ(DiagReturnCode::ISO_INVALID_FORMAT, execute(sizeMissing));
+    EXPECT_FALSE(fDownload.isActive());
+}
+
+TEST_F(RequestDownloadTest, unsupportedFormatIsRejected)
+{
+    uint8_t const compressed[] = {0x34U, 0x10U, 0x11U, 0x10U, 0x20U};
+    EXPECT_EQ(DiagReturnCode::ISO_REQUEST_OUT_OF_RANGE, execute(compressed));
+    uint8_t const noAddress[] = {0x34U, 0x00U, 0x10U, 0x10U, 0x20U};
+    EXPECT_EQ(DiagReturnCode::ISO_REQUEST_OUT_OF_RANGE, execute(noAddress));
+    uint8_t const addressTooLong[]
+        = {0x34U, 0x00U, 0x15U, 0x00U, 0x00U, 0x00U, 0x10U, 0x00U, 0x20U};
+    EXPECT_EQ(DiagReturnCode::ISO_REQUEST_OUT_OF_RANGE, execute(addressTooLong));
+    EXPECT_FALSE(fDownload.isActive());
+}
+
+TEST_F(RequestDownloadTest, invalidMemoryAreaIsRejected)
+{
+    uint8_t const notBlockStart[] = {0x34U, 0x00U, 0x12U, 0x10U, 0x04U, 0x20U};
+    EXPECT_EQ(DiagReturnCode::ISO_REQUEST_OUT_OF_RANGE, execute(notBlockStart));
+    uint8_t const tooLarge[] = {0x34U, 0x00U, 0x22U, 0x10U, 0x00U, 0x10U, 0x01U};
+    EXPECT_EQ(DiagReturnCode::ISO_REQUEST_OUT_OF_RANGE, execute(tooLarge));
+    EXPECT_FALSE(fDownload.isActive());
+}
+
+} // namespace
@@ -0,0 +1,121 @@
+// Copyright 2025 Accenture.
+
+#include "uds/services/download/RequestTransferExit.h"
+
+#include "uds/connection/IncomingDiagConnectionMock.h"
+#include "uds/session/ApplicationDefaultSession.h"
+#include "uds/session/DiagSessionManagerMock.h"
+
+#include <async/AsyncMock.h>
+#include <async/TestContext.h>
+#include <bsp/flash/FlashDriverMock.h>
+#include <transport/TransportMessageWithBuffer.h>
+#include <util/crc/Crc32.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+using namespace ::uds;
+using namespace ::testing;
+using namespace ::transport::test;
+using ::flash::FlashDriverMock;
+using ::flash::IFlashDriver;
+
+class RequestTransferExitTest : public Test
+{
+public:
+    RequestTransferExitTest()
+    : fDiagContext(1U)
+    , fFlashContext(2U)
+    , fDownload(fFlashDriver, fDiagContext, fFlashContext, 0x1000U, 0x1000U)
+    , fRequestTransferExit(fDownload, DiagSession::ALL_SESSIONS())
+    , fIncomingDiagConnection(::async::CONTEXT_INVALID)
+    , fRequest(0xF1U, 0x10U, REQUEST, 8U)
+    {}
+
+    void SetUp() override
+    {
+        fDiagContext.handleExecute();
+        fFlashContext.handleExecute();
+        fRequestTransferExit.setDefaultDiagSessionManager(fSessionManager);
+        EXPECT_CALL(fSessionManager, getActiveSession())
+            .WillRepeatedly(ReturnRef(DiagSession::APPLICATION_DEFAULT_SESSION()));
+        EXPECT_CALL(fSessionManager, acceptedJob(_, _, _, _))
+            .WillRepeatedly(Return(DiagReturnCode::OK));
+        ON_CALL(fFlashDriver, getBlockSize(_, _))
+            .WillByDefault(
+                DoAll(SetArgReferee<1>(0x100U), Return(IFlashDriver::FLASH_OP_SUCCESSFUL)));
+        fIncomingDiagConnection.isOpen         = true;
+        fIncomingDiagConnection.requestMessage = fRequest.get();
+    }
+
+    DiagReturnCode::Type execute()
+    {
+        return fRequestTransferExit.execute(fIncomingDiagConnection, REQUEST, sizeof(REQUEST));
+    }
+
+    uint32_t getResponseCrc()
+    {
+        uint8_t const* const payload = fRequest.get()->getPayload();
+        return (static_cast<uint32_t>(payload[1]) << 24U)
+               | (static_cast<uint32_t>(payload[2]) << 16U)
+               | (static_cast<uint32_t>(payload[3]) << 8U) | static_cast<uint32_t>(payload[4]);
+    }
+
+protected:
+    static uint8_t const REQUEST[1U];
+
+    ::async::AsyncMock fAsyncMock;
+    ::async::TestContext fDiagContext;
+    ::async::TestContext fFlashContext;
+    NiceMock<FlashDriverMock> fFlashDriver;
+    declare::FlashDownload<4U> fDownload;
+    RequestTransferExit fRequestTransferExit;
+    StrictMock<IncomingDiagConnectionMock> fIncomingDiagConnection;
+    StrictMock<DiagSessionManagerMock> fSessionManager;
+    TransportMessageWithBuffer fRequest;
+};
+
+uint8_t const RequestTransferExitTest::REQUEST[] = {0x37U};
+
+TEST_F(RequestTransferExitTest, requestWithoutDownloadIsRejected)
+{
+    EXPECT_EQ(DiagReturnCode::ISO_REQUEST_SEQUENCE_ERROR, execute());
+}
+
+TEST_F(RequestTransferExitTest, positiveResponseContainsCrcAfterProgramming)
+{
+    uint8_t const data[] = {0x11U, 0x22U, 0x33U, 0x44U};
+    ::util::crc::Crc32::Ethernet crc;
+    (void)crc.update(data, sizeof(data));
+
+    ASSERT_EQ(DiagReturnCode::OK, fDownload.requestDownload(0x1000U, sizeof(data)));
+    ASSERT_EQ(DiagReturnCode::OK, fDownload.transferData(1U, data, sizeof(data)));
+
+    EXPECT_EQ(DiagReturnCode::OK, execute());
+    EXPECT_TRUE(fDownload.isActive());
+
+    EXPECT_CALL(fFlashDriver, flush());
+    fFlashContext.execute();
+    fDiagContext.execute();
+    EXPECT_FALSE(fDownload.isActive());
+    EXPECT_EQ(crc.digest(), getResponseCrc());
+}
+
+TEST_F(RequestTransferExitTest, negativeResponseIfCrcDoesNotFitIntoResponse)
+{
+    uint8_t const data[] = {0x11U, 0x22U, 0x33U, 0x44U};
+    ASSERT_EQ(DiagReturnCode::OK, fDownload.requestDownload(0x1000U, sizeof(data)));
+    ASSERT_EQ(DiagReturnCode::OK, fDownload.transferData(1U, data, sizeof(data)));
+    fFlashContext.execute();
+    fDiagContext.execute();
+
+    // service identifier and three bytes only
+    TransportMessageWithBuffer request(0xF1U, 0x10U, REQUEST, 4U);
+    fIncomingDiagConnection.requestMessage = request.get();
+    EXPECT_EQ(DiagReturnCode::ISO_RESPONSE_TOO_LONG, execute());
+    EXPECT_FALSE(fDownload.isActive());
+}
+
+} // namespace
@@ -0,0 +1,133 @@
+// Copyright 2025 Accenture.
+
+#include "uds/services/download/TransferData.h"
+
+#include "uds/connection/IncomingDiagConnectionMock.h"
+#include "uds/session/ApplicationDefaultSession.h"
+#include "uds/session/DiagSessionManagerMock.h"
+
+#include <async/AsyncMock.h>
+#include <async/TestContext.h>
+#include <bsp/flash/FlashDriverMock.h>
+#include <transport/TransportMessageWithBuffer.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+using namespace ::uds;
+using namespace ::testing;
+using namespace ::transport::test;
+using ::flash::FlashDriverMock;
+using ::flash::IFlashDriver;
+
+class TransferDataTest : public Test
+{
+public:
+    TransferDataTest()
+    : fDiagContext(1U)
+    , fFlashContext(2U)
+    , fDownload(fFlashDriver, fDiagContext, fFlashContext, 0x1000U, 0x1000U)
+    , fTransferData(fDownload, DiagSession::ALL_SESSIONS())
+    , fIncomingDiagConnection(::async::CONTEXT_INVALID)
+    {}
+
+    void SetUp() override
+    {
+        fDiagContext.handleExecute();
+        fFlashContext.handleExecute();
+        fTransferData.setDefaultDiagSessionManager(fSessionManager);
+        EXPECT_CALL(fSessionManager, getActiveSession())
+            .WillRepeatedly(ReturnRef(DiagSession::APPLICATION_DEFAULT_SESSION()));
+        EXPECT_CALL(fSessionManager, acceptedJob(_, _, _, _))
+            .WillRepeatedly(Return(DiagReturnCode::OK));
+        ON_CALL(fFlashDriver, getBlockSize(_, _))
+            .WillByDefault(
+                DoAll(SetArgReferee<1>(0x100U), Return(IFlashDriver::FLASH_OP_SUCCESSFUL)));
+        fIncomingDiagConnection.isOpen = true;
+    }
+
+    template<size_t N>
+    DiagReturnCode::Type execute(uint8_t const (&request)[N])
+    {
+        fRequest.reset(new TransportMessageWithBuffer(0xF1U, 0x10U, request, 16U));
+        fIncomingDiagConnection.requestMessage = fRequest->get();
+        return fTransferData.execute(fIncomingDiagConnection, fRequest->get()->getPayload(), N);
+    }
+
+protected:
+    ::async::AsyncMock fAsyncMock;
+    ::async::TestContext fDiagContext;
+    ::async::TestContext fFlashContext;
+    NiceMock<FlashDriverMock> fFlashDriver;
+    declare::FlashDownload<4U> fDownload;
+    TransferData fTransferData;
+    StrictMock<IncomingDiagConnectionMock> fIncomingDiagConnection;
+    StrictMock<DiagSessionManagerMock> fSessionManager;
+    std::unique_ptr<TransportMessageWithBuffer> fRequest;
+};
+
+TEST_F(TransferDataTest, positiveResponseContainsBlockSequenceCounter)
+{
+    ASSERT_EQ(DiagReturnCode::OK, fDownload.requestDownload(0x1000U, 8U));
+    uint8_t const request[] = {0x36U, 0x01U, 0x11U, 0x22U, 0x33U, 0x44U};
+    EXPECT_EQ(DiagReturnCode::OK, execute(request));
+    EXPECT_EQ(0x01U, fRequest->get()->getPayload()[1]);
+
+    EXPECT_CALL(fFlashDriver, write(0x1000U, NotNull(), 4U));
+    fFlashContext.execute();
+}
+
+TEST_F(TransferDataTest, requestWithoutDataIsRejected)
+{
+    ASSERT_EQ(DiagReturnCode::OK, fDownload.requestDownload(0x1000U, 8U));
+    uint8_t const request[] = {0x36U, 0x01U};
+    EXPECT_EQ(DiagReturnCode::ISO_INVALID_FORMAT, execute(request));
+}
+
+TEST_F(TransferDataTest, requestWithoutDownloadIsRejected)
+{
+    uint8_t const request[] = {0x36U, 0x01U, 0x11U};
+    EXPECT_EQ(DiagReturnCode::ISO_REQUEST_SEQUENCE_ERROR, execute(request));
+}
+
+TEST_F(TransferDataTest, responseIsSentWhenBufferBecomesFree)
+{
+    ASSERT_EQ(DiagReturnCode::OK, fDownload.requestDownload(0x1000U, 12U));
+    uint8_t const data[] = {0x11U, 0x22U, 0x33U, 0x44U};
+    ASSERT_EQ(DiagReturnCode::OK, fDownload.transferData(1U, data, sizeof(data)));
+    ASSERT_EQ(DiagReturnCode::OK, fDownload.transferData(2U, data, sizeof(data)));
+
+    // the request is kept until a buffer has been programmed
+    uint8_t const request[] = {0x36U, 0x03U, 0x55U, 0x66U, 0x77U, 0x88U};
+    EXPECT_EQ(DiagReturnCode::OK, execute(request));
+
+    EXPECT_CALL(fFlashDriver, write(0x1000U, NotNull(), 4U));
+    EXPECT_CALL(fFlashDriver, write(0x1004U, NotNull(), 4U));
+    EXPECT_CALL(fFlashDriver, write(0x1008U, Pointee(0x55U), 4U));
+    fFlashContext.execute();
+    fDiagContext.execute();
+    fFlashContext.execute();
+    fDiagContext.execute();
+    fFlashContext.execute();
+    EXPECT_EQ(0x03U, fRequest->get()->getPayload()[1]);
+}
+
+TEST_F(TransferDataTest, negativeResponseIsSentIfProgrammingFailed)
+{
+    ASSERT_EQ(DiagReturnCode::OK, fDownload.requestDownload(0x1000U, 12U));
+    uint8_t const data[] = {0x11U, 0x22U, 0x33U, 0x44U};
+    ASSERT_EQ(DiagReturnCode::OK, fDownload.transferData(1U, data, sizeof(data)));
+    ASSERT_EQ(DiagReturnCode::OK, fDownload.transferData(2U, data, sizeof(data)));
+
+    uint8_t const request[] = {0x36U, 0x03U, 0x11U, 0x22U, 0x33U, 0x44U};
+    EXPECT_EQ(DiagReturnCode::OK, execute(request));
+
+    EXPECT_CALL(fFlashDriver, write(0x1000U, NotNull(), 4U))
+        .WillOnce(Return(IFlashDriver::FLASH_OP_FAILED));
+    EXPECT_CALL(fIncomingDiagConnection, terminate());
+    fFlashContext.execute();
+    fDiagContext.execute();
+}
+
+} // namespace
@@ -0,0 +1,68 @@
+// Copyright 2025 Accenture.
+
+#include <benchmark/benchmark.h>
+#include <util/crc/Crc.h>
+
+#include <vector>
+
+namespace
+{
+using ::util::crc::FoldingEngine;
+using ::util::crc::SlicingEngine;
+using ::util::crc::TableEngine;
+
+template<class Engine>
+using Crc16Ccitt = ::util::crc::CrcRegister<uint16_t, 0x1021U, 0xFFFFU, false, false, 0U, Engine>;
+
+template<class Engine>
+using Crc32Ethernet = ::util::crc::
+    CrcRegister<uint32_t, 0x4C11DB7U, 0xFFFFFFFFU, true, true, 0xFFFFFFFFU, Engine>;
+
+template<class Engine>
+using Crc32Bzip2 = ::util::crc::
+    CrcRegister<uint32_t, 0x4C11DB7U, 0xFFFFFFFFU, false, false, 0xFFFFFFFFU, Engine>;
+
+std::vector<uint8_t> createData(size_t const size)
+{
+    std::vector<uint8_t> data(size);
+    uint32_t value = 0x12345678U;
+    for (uint8_t& byte : data)
+    {
+        value = (value * 1103515245U) + 12345U;
+        byte  = static_cast<uint8_t>(value >> 16U);
+    }
+    return data;
+}
+} // namespace
+
+/**
+ * Calculates the CRC over range(0) bytes, the throughput is reported in bytes per second.
+ */
+template<class Register>
+void BM_crc(benchmark::State& state)
+{
+    std::vector<uint8_t> const data = createData(static_cast<size_t>(state.range(0)));
+    Register crc;
+    while (state.KeepRunning())
+    {
+        crc.init();
+        crc.update(data.data(), data.size());
+        benchmark::DoNotOptimize(crc.digest());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_crc, Crc16Ccitt<TableEngine>)->Range(64, 65536);
+BENCHMARK_TEMPLATE(BM_crc, Crc16Ccitt<SlicingEngine<4U>>)->Range(64, 65536);
+BENCHMARK_TEMPLATE(BM_crc, Crc16Ccitt<SlicingEngine<8U>>)->Range(64, 65536);
+BENCHMARK_TEMPLATE(BM_crc, Crc16Ccitt<FoldingEngine>)->Range(64, 65536);
+
+BENCHMARK_TEMPLATE(BM_crc, Crc32Ethernet<TableEngine>)->Range(64, 65536);
+BENCHMARK_TEMPLATE(BM_crc, Crc32Ethernet<SlicingEngine<4U>>)->Range(64, 65536);
+BENCHMARK_TEMPLATE(BM_crc, Crc32Ethernet<SlicingEngine<8U>>)->Range(64, 65536);
+BENCHMARK_TEMPLATE(BM_crc, Crc32Ethernet<FoldingEngine>)->Range(64, 65536);
+
+BENCHMARK_TEMPLATE(BM_crc, Crc32Bzip2<TableEngine>)->Range(64, 65536);
+BENCHMARK_TEMPLATE(BM_crc, Crc32Bzip2<SlicingEngine<4U>>)->Range(64, 65536);
+BENCHMARK_TEMPLATE(BM_crc, Crc32Bzip2<SlicingEngine<8U>>)->Range(64, 65536);
+BENCHMARK_TEMPLATE(BM_crc, Crc32Bzip2<FoldingEngine>)->Range(64, 65536);
@@ -2,8 +2,10 @@
 
 #pragma once
 
+#include "util/crc/FoldingCrc.h"
 #include "util/crc/LookupTable.h"
 #include "util/crc/Reflect.h"
+#include "util/crc/SlicingCrc.h"
 #include "util/crc/Xor.h"
 
 #include <etl/error_handler.h>
@@ -15,6 +17,28 @@ namespace util
 {
 namespace crc
 {
+/**
+ * Processes one byte per iteration with a single lookup table of 256 entries (default).
+ */
+struct TableEngine
+{};
+
+/**
+ * Processes Slices (4 or 8) bytes per iteration with Slices lookup tables.
+ * \see SlicingCrcCalculator
+ */
+template<size_t Slices>
+struct SlicingEngine
+{};
+
+/**
+ * Folds blocks of 16 bytes with carry-less multiplication on x86 CPUs that support it and uses
+ * the SlicingEngine with 8 slices otherwise.
+ * \see FoldingCrcCalculator
+ */
+struct FoldingEngine
+{};
+
 template<
     class DigestType,
     bool ReflectInput   = false,
@@ -50,7 +74,8 @@ template<
     DigestType Polynom,
     bool ReflectInput   = false,
     bool ReflectOutput  = false,
-    DigestType FinalXor = 0>
+    DigestType FinalXor = 0,
+    class Engine        = TableEngine>
 struct CrcCalculator : public CrcCalculatorBase<DigestType, ReflectInput, ReflectOutput, FinalXor>
 {
     using CrcCalculatorBase_t
@@ -64,18 +89,68 @@ struct CrcCalculator : public CrcCalculatorBase<DigestType, ReflectInput, Reflec
     }
 };
 
+/**
+ * The reflected algorithm is used for reflected input, therefore the register value is reflected
+ * before and after the calculation.
+ */
+template<
+    class DigestType,
+    DigestType Polynom,
+    bool ReflectInput,
+    bool ReflectOutput,
+    DigestType FinalXor,
+    size_t Slices>
+struct CrcCalculator<
+    DigestType,
+    Polynom,
+    ReflectInput,
+    ReflectOutput,
+    FinalXor,
+    SlicingEngine<Slices>>
+: public CrcCalculatorBase<DigestType, ReflectInput, ReflectOutput, FinalXor>
+{
+    static DigestType update(
+        uint8_t const* const data, size_t const length, DigestType const initValue = DigestType())
+    {
+        ETL_ASSERT(data != nullptr || length == 0, ETL_ERROR_GENERIC("data must not be null"));
+        return Reflect<ReflectInput>::apply(
+            SlicingCrcCalculator<DigestType, Polynom, ReflectInput, Slices>::update(
+                data, length, Reflect<ReflectInput>::apply(initValue)));
+    }
+};
+
+template<
+    class DigestType,
+    DigestType Polynom,
+    bool ReflectInput,
+    bool ReflectOutput,
+    DigestType FinalXor>
+struct CrcCalculator<DigestType, Polynom, ReflectInput, ReflectOutput, FinalXor, FoldingEngine>
+: public CrcCalculatorBase<DigestType, ReflectInput, ReflectOutput, FinalXor>
+{
+    static DigestType update(
+        uint8_t const* const data, size_t const length, DigestType const initValue = DigestType())
+    {
+        ETL_ASSERT(data != nullptr || length == 0, ETL_ERROR_GENERIC("data must not be null"));
+        return Reflect<ReflectInput>::apply(
+            FoldingCrcCalculator<DigestType, Polynom, ReflectInput>::update(
+                data, length, Reflect<ReflectInput>::apply(initValue)));
+    }
+};
+
 template<
     class DigestType,
     DigestType Polynom,
     DigestType InitValue = 0,
     bool ReflectInput    = false,
     bool ReflectOutput   = false,
-    DigestType FinalXor  = 0>
+    DigestType FinalXor  = 0,
+    class Engine         = TableEngine>
 class CrcRegister
 {
 public:
     using CrcCalculator_t
-        = CrcCalculator<DigestType, Polynom, ReflectInput, ReflectOutput, FinalXor>;
+        = CrcCalculator<DigestType, Polynom, ReflectInput, ReflectOutput, FinalXor, Engine>;
 
     inline CrcRegister() : _register(InitValue) {}
 
@@ -0,0 +1,227 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "util/crc/SlicingCrc.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define UTIL_CRC_HAS_CARRYLESS_MULTIPLY 1
+#include <immintrin.h>
+#endif
+
+namespace util
+{
+namespace crc
+{
+/**
+ * Returns true if the CPU supports the instructions used by FoldingCrcCalculator.
+ */
+bool isCarrylessMultiplySupported();
+
+namespace internal
+{
+/**
+ * Returns x^exponent modulo the generator polynomial of the given width.
+ */
+constexpr uint32_t getPowerModulo(size_t const exponent, uint32_t const polynom, size_t const width)
+{
+    uint64_t remainder = 1U;
+    for (size_t idx = 0U; idx < exponent; ++idx)
+    {
+        remainder <<= 1U;
+        if ((remainder >> width) != 0U)
+        {
+            remainder ^= (static_cast<uint64_t>(1U) << width) | polynom;
+        }
+    }
+    return static_cast<uint32_t>(remainder);
+}
+
+constexpr uint64_t reflectBits64(uint64_t value)
+{
+    uint64_t result = 0U;
+    for (size_t bit = 0U; bit < 64U; ++bit)
+    {
+        result = (result << 1U) | (value & 1U);
+        value >>= 1U;
+    }
+    return result;
+}
+
+/**
+ * Returns the multiplier for folding a 64 bit half of a block over exponent bits. In the reflected
+ * representation the product of two 64 bit values is one bit short of 128 bits, which is
+ * compensated by using x^(exponent - 1).
+ */
+constexpr uint64_t getFoldConstant(
+    size_t const exponent, uint32_t const polynom, size_t const width, bool const reflected)
+{
+    return reflected ? reflectBits64(getPowerModulo(exponent - 1U, polynom, width))
+                     : getPowerModulo(exponent, polynom, width);
+}
+
+/**
+ * Multipliers for folding the high and the low order half of a block over Distance bits.
+ */
+template<class DigestType, DigestType Polynom, bool Reflected, size_t Distance>
+struct FoldConstants
+{
+    static constexpr size_t WIDTH = sizeof(DigestType) * 8U;
+
+    static constexpr uint64_t HIGH = getFoldConstant(Distance + 64U, Polynom, WIDTH, Reflected);
+    static constexpr uint64_t LOW  = getFoldConstant(Distance, Polynom, WIDTH, Reflected);
+};
+} // namespace internal
+
+/**
+ * Calculates a CRC by folding blocks of 16 bytes with carry-less multiplication (PCLMULQDQ).
+ *
+ * Four blocks are folded in parallel, the result is reduced to a single block and folded with the
+ * remaining blocks. The final block and all bytes that do not fill a block are processed with
+ * SlicingCrcCalculator, which is also used for short input and if the CPU or the compiler don't
+ * support carry-less multiplication. The generator polynomial may be of any width up to 32 bits.
+ *
+ * The remainder is passed in the bit order of the algorithm, i.e. reflected if Reflected is true.
+ */
+template<class DigestType, DigestType Polynom, bool Reflected>
+struct FoldingCrcCalculator
+{
+    using SlicingCrcCalculator_t = SlicingCrcCalculator<DigestType, Polynom, Reflected, 8U>;
+
+    static DigestType update(uint8_t const* data, size_t length, DigestType remainder);
+
+private:
+    static constexpr size_t BLOCK_SIZE     = 16U;
+    static constexpr size_t PARALLEL_COUNT = 4U;
+
+#ifdef UTIL_CRC_HAS_CARRYLESS_MULTIPLY
+    template<size_t Distance>
+    static __m128i getConstants();
+
+    __attribute__((target("pclmul,ssse3"))) static DigestType
+    fold(uint8_t const* data, size_t length, DigestType remainder);
+
+    __attribute__((target("pclmul,ssse3"))) static __m128i
+    foldBlock(__m128i block, __m128i constants);
+
+    __attribute__((target("pclmul,ssse3"))) static __m128i loadBlock(uint8_t const* data);
+
+    __attribute__((target("pclmul,ssse3"))) static void storeBlock(uint8_t* data, __m128i block);
+#endif
+};
+
+template<class DigestType, DigestType Polynom, bool Reflected>
+DigestType FoldingCrcCalculator<DigestType, Polynom, Reflected>::update(
+    uint8_t const* data, size_t length, DigestType remainder)
+{
+#ifdef UTIL_CRC_HAS_CARRYLESS_MULTIPLY
+    if ((length >= (BLOCK_SIZE * PARALLEL_COUNT)) && isCarrylessMultiplySupported())
+    {
+        size_t const foldLength = length - (length % BLOCK_SIZE);
+        remainder               = fold(data, foldLength, remainder);
+        data += foldLength;
+        length -= foldLength;
+    }
+#endif
+    return SlicingCrcCalculator_t::update(data, length, remainder);
+}
+
+#ifdef UTIL_CRC_HAS_CARRYLESS_MULTIPLY
+template<class DigestType, DigestType Polynom, bool Reflected>
+template<size_t Distance>
+inline __m128i FoldingCrcCalculator<DigestType, Polynom, Reflected>::getConstants()
+{
+    using Constants = internal::FoldConstants<DigestType, Polynom, Reflected, Distance>;
+    // the reflected representation holds the high order half of a block in the lower 64 bits
+    int64_t const high = static_cast<int64_t>(Constants::HIGH);
+    int64_t const low  = static_cast<int64_t>(Constants::LOW);
+    return Reflected ? _mm_set_epi64x(low, high) : _mm_set_epi64x(high, low);
+}
+
+template<class DigestType, DigestType Polynom, bool Reflected>
+DigestType FoldingCrcCalculator<DigestType, Polynom, Reflected>::fold(
+    uint8_t const* data, size_t length, DigestType const remainder)
+{
+    constexpr size_t WIDTH = sizeof(DigestType) * 8U;
+
+    __m128i const initial
+        = Reflected
+              ? _mm_cvtsi32_si128(static_cast<int32_t>(remainder))
+              : _mm_set_epi32(
+                  static_cast<int32_t>(static_cast<uint32_t>(remainder) << (32U - WIDTH)), 0, 0, 0);
+
+    __m128i blocks[PARALLEL_COUNT];
+    for (size_t idx = 0U; idx < PARALLEL_COUNT; ++idx)
+    {
+        blocks[idx] = loadBlock(data + (idx * BLOCK_SIZE));
+    }
+    blocks[0] = _mm_xor_si128(blocks[0], initial);
+    data += BLOCK_SIZE * PARALLEL_COUNT;
+    length -= BLOCK_SIZE * PARALLEL_COUNT;
+
+    __m128i const parallelConstants = getConstants<BLOCK_SIZE * PARALLEL_COUNT * 8U>();
+    for (; length >= (BLOCK_SIZE * PARALLEL_COUNT); length -= BLOCK_SIZE * PARALLEL_COUNT)
+    {
+        for (size_t idx = 0U; idx < PARALLEL_COUNT; ++idx)
+        {
+            blocks[idx] = _mm_xor_si128(
+                foldBlock(blocks[idx], parallelConstants), loadBlock(data + (idx * BLOCK_SIZE)));
+        }
+        data += BLOCK_SIZE * PARALLEL_COUNT;
+    }
+
+    __m128i const constants = getConstants<BLOCK_SIZE * 8U>();
+    __m128i block           = _mm_xor_si128(
+        foldBlock(blocks[0], getConstants<BLOCK_SIZE * 3U * 8U>()),
+        foldBlock(blocks[1], getConstants<BLOCK_SIZE * 2U * 8U>()));
+    block = _mm_xor_si128(block, foldBlock(blocks[2], constants));
+    block = _mm_xor_si128(block, blocks[3]);
+    for (; length >= BLOCK_SIZE; length -= BLOCK_SIZE)
+    {
+        block = _mm_xor_si128(foldBlock(block, constants), loadBlock(data));
+        data += BLOCK_SIZE;
+    }
+
+    uint8_t lastBlock[BLOCK_SIZE];
+    storeBlock(lastBlock, block);
+    return SlicingCrcCalculator_t::update(lastBlock, BLOCK_SIZE, 0U);
+}
+
+template<class DigestType, DigestType Polynom, bool Reflected>
+inline __m128i FoldingCrcCalculator<DigestType, Polynom, Reflected>::foldBlock(
+    __m128i const block, __m128i const constants)
+{
+    return _mm_xor_si128(
+        _mm_clmulepi64_si128(block, constants, 0x00), _mm_clmulepi64_si128(block, constants, 0x11));
+}
+
+template<class DigestType, DigestType Polynom, bool Reflected>
+inline __m128i
+FoldingCrcCalculator<DigestType, Polynom, Reflected>::loadBlock(uint8_t const* const data)
+{
+    __m128i const block = _mm_loadu_si128(reinterpret_cast<__m128i const*>(data));
+    // without reflection the first byte holds the highest order coefficients
+    return Reflected
+               ? block
+               : _mm_shuffle_epi8(
+                   block, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+}
+
+template<class DigestType, DigestType Polynom, bool Reflected>
+inline void
+FoldingCrcCalculator<DigestType, Polynom, Reflected>::storeBlock(uint8_t* const data, __m128i block)
+{
+    if (!Reflected)
+    {
+        block = _mm_shuffle_epi8(
+            block, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(data), block);
+}
+#endif
+
+} // namespace crc
+} // namespace util
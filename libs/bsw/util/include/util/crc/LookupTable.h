@@ -2,13 +2,97 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+
 namespace util
 {
 namespace crc
 {
-// FIXME: add a static assert for the non specialized variant
-//        so the error message shows that the crc table is missing!
+/**
+ * Storage for Slices lookup tables of 256 entries each.
+ */
+template<class T, size_t Slices>
+struct LookupTables
+{
+    T values[Slices][256];
+};
+
+namespace internal
+{
+constexpr uint32_t reflectBits(uint32_t value, size_t const width)
+{
+    uint32_t result = 0U;
+    for (size_t bit = 0U; bit < width; ++bit)
+    {
+        result = (result << 1U) | (value & 1U);
+        value >>= 1U;
+    }
+    return result;
+}
+
+template<class T, size_t Slices>
+constexpr LookupTables<T, Slices> generateLookupTables(uint32_t const polynom, bool const reflected)
+{
+    constexpr size_t WIDTH = sizeof(T) * 8U;
+    uint32_t const mask    = static_cast<uint32_t>((static_cast<uint64_t>(1U) << WIDTH) - 1U);
+    uint32_t const topBit  = static_cast<uint32_t>(1U) << (WIDTH - 1U);
+    uint32_t const reflectedPolynom = reflectBits(polynom, WIDTH);
 
+    LookupTables<T, Slices> tables{};
+    for (uint32_t index = 0U; index < 256U; ++index)
+    {
+        uint32_t entry = reflected ? index : (index << (WIDTH - 8U));
+        for (size_t bit = 0U; bit < 8U; ++bit)
+        {
+            if (reflected)
+            {
+                entry = ((entry & 1U) != 0U) ? ((entry >> 1U) ^ reflectedPolynom) : (entry >> 1U);
+            }
+            else
+            {
+                entry = ((entry & topBit) != 0U) ? (((entry << 1U) ^ polynom) & mask)
+                                                 : ((entry << 1U) & mask);
+            }
+        }
+        tables.values[0][index] = static_cast<T>(entry);
+    }
+    for (size_t slice = 1U; slice < Slices; ++slice)
+    {
+        for (size_t index = 0U; index < 256U; ++index)
+        {
+            uint32_t const previous = tables.values[slice - 1U][index];
+            uint32_t const entry
+                = reflected ? ((previous >> 8U) ^ tables.values[0][previous & 0xFFU])
+                            : (((previous << 8U) & mask)
+                               ^ tables.values[0][(previous >> (WIDTH - 8U)) & 0xFFU]);
+            tables.values[slice][index] = static_cast<T>(entry);
+        }
+    }
+    return tables;
+}
+} // namespace internal
+
+/**
+ * Lookup tables for the generator polynomial Polynom, which are generated at compile time.
+ *
+ * Table k holds the remainder of each byte value followed by k zero bytes. With Slices tables,
+ * Slices bytes of input can be processed with independent lookups (slicing-by-N). If Reflected is
+ * true, the tables are generated for the reflected (LSB first) algorithm.
+ */
+template<class T, T Polynom, bool Reflected = false, size_t Slices = 1U>
+struct SlicingTable
+{
+    static constexpr LookupTables<T, Slices> TABLES
+        = internal::generateLookupTables<T, Slices>(Polynom, Reflected);
+};
+
+template<class T, T Polynom, bool Reflected, size_t Slices>
+constexpr LookupTables<T, Slices> SlicingTable<T, Polynom, Reflected, Slices>::TABLES;
+
+/**
+ * Lookup table for the byte-wise (MSB first) calculation with the generator polynomial Polynom.
+ */
 template<class T, T Polynom>
 struct LookupTable
 {
@@ -16,5 +100,11 @@ struct LookupTable
     static TableRef getTable();
 };
 
+template<class T, T Polynom>
+inline typename LookupTable<T, Polynom>::TableRef LookupTable<T, Polynom>::getTable()
+{
+    return SlicingTable<T, Polynom>::TABLES.values[0];
+}
+
 } // namespace crc
 } // namespace util
@@ -0,0 +1,73 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "util/crc/LookupTable.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace util
+{
+namespace crc
+{
+/**
+ * Calculates a CRC with the slicing-by-N algorithm, processing Slices bytes per iteration with
+ * Slices lookup tables. Remaining bytes are processed one at a time with the first table.
+ *
+ * The remainder is passed in the bit order of the algorithm, i.e. reflected if Reflected is true.
+ */
+template<class DigestType, DigestType Polynom, bool Reflected, size_t Slices>
+struct SlicingCrcCalculator
+{
+    static_assert(
+        Slices >= sizeof(DigestType), "At least one slice per byte of the CRC is required");
+
+    static DigestType update(uint8_t const* data, size_t length, DigestType remainder);
+
+private:
+    static constexpr size_t WIDTH = sizeof(DigestType) * 8U;
+
+    static uint8_t getRemainderByte(uint32_t remainder, size_t index);
+};
+
+template<class DigestType, DigestType Polynom, bool Reflected, size_t Slices>
+DigestType SlicingCrcCalculator<DigestType, Polynom, Reflected, Slices>::update(
+    uint8_t const* data, size_t length, DigestType const remainder)
+{
+    auto const& tables = SlicingTable<DigestType, Polynom, Reflected, Slices>::TABLES.values;
+    uint32_t reg       = remainder;
+    for (; length >= Slices; length -= Slices)
+    {
+        uint32_t next = 0U;
+        for (size_t idx = 0U; idx < Slices; ++idx)
+        {
+            uint8_t value = data[idx];
+            if (idx < sizeof(DigestType))
+            {
+                value ^= getRemainderByte(reg, idx);
+            }
+            next ^= tables[Slices - 1U - idx][value];
+        }
+        reg = next;
+        data += Slices;
+    }
+    for (; length > 0U; --length)
+    {
+        uint8_t const value = *data ^ getRemainderByte(reg, 0U);
+        reg = (Reflected ? (reg >> 8U) : (reg << 8U)) ^ tables[0][value];
+        ++data;
+    }
+    return static_cast<DigestType>(reg);
+}
+
+template<class DigestType, DigestType Polynom, bool Reflected, size_t Slices>
+inline uint8_t SlicingCrcCalculator<DigestType, Polynom, Reflected, Slices>::getRemainderByte(
+    uint32_t const remainder, size_t const index)
+{
+    return static_cast<uint8_t>(
+        Reflected ? (remainder >> (index * 8U)) : (remainder >> (WIDTH - 8U - (index * 8U))));
+}
+
+} // namespace crc
+} // namespace util
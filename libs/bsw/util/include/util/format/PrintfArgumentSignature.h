@@ -0,0 +1,327 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "util/format/IPrintfArgumentReader.h"
+#include "util/format/Printf.h"
+
+#include <etl/span.h>
+#include <etl/type_traits.h>
+
+#include <platform/estdint.h>
+
+#include <cstddef>
+#include <cstring>
+
+namespace util
+{
+namespace format
+{
+/**
+ * Compact description of the datatypes of a list of printf arguments.
+ *
+ * The datatypes are packed into a single 32 bit value with 4 bits per argument, so the signature
+ * of a call can be determined at compile time and stored with the raw argument values instead of
+ * a datatype per argument. Arguments are stored with the datatypes they are promoted to when
+ * passed as variadic arguments: 32 or 64 bit integers, pointers and strings.
+ *
+ * \see PrintfArgumentWriter
+ * \see PrintfArgumentSignatureReader
+ */
+class PrintfArgumentSignature
+{
+public:
+    /// Maximum number of arguments that can be described.
+    static constexpr size_t MAX_ARGUMENTS = 8U;
+
+    constexpr explicit PrintfArgumentSignature(uint32_t const value = EMPTY) : _value(value) {}
+
+    /**
+     * Returns the signature of the arguments Args.
+     */
+    template<class... Args>
+    static constexpr PrintfArgumentSignature create();
+
+    /**
+     * Returns the packed value, e.g. to store it.
+     */
+    constexpr uint32_t getValue() const { return _value; }
+
+    /**
+     * Returns the number of arguments.
+     */
+    size_t getCount() const;
+
+    /**
+     * Returns the datatype of the argument at \p index or ParamDatatype::COUNT if \p index exceeds
+     * the number of arguments.
+     */
+    ParamDatatype getDatatype(size_t index) const;
+
+    /**
+     * Returns the number of bytes needed to store the raw values of all arguments.
+     */
+    size_t getArgumentsSize() const;
+
+    /**
+     * Returns the number of bytes needed to store the raw value of an argument of \p datatype.
+     */
+    static constexpr size_t getStorageSize(ParamDatatype datatype);
+
+private:
+    static constexpr uint32_t EMPTY         = 0xFFFFFFFFU;
+    static constexpr uint32_t DATATYPE_BITS = 4U;
+    static constexpr uint32_t DATATYPE_MASK = 0x0FU;
+
+    template<class... Args>
+    struct Packer;
+
+    uint32_t _value;
+};
+
+/**
+ * Maps the type T of a printf argument to the datatype it is stored with. Integral and enum types
+ * are stored as 32 or 64 bit integers of the same signedness, character pointers as strings and
+ * all other pointers as VOIDPTR. Other types (e.g. floating point values) are not supported.
+ */
+template<class T, class Enable = void>
+struct PrintfArgumentTraits;
+
+template<class T>
+struct PrintfArgumentTraits<T, typename ::etl::enable_if<::etl::is_integral<T>::value>::type>
+{
+    static constexpr ParamDatatype DATATYPE
+        = (sizeof(T) > sizeof(uint32_t))
+              ? (::etl::is_signed<T>::value ? ParamDatatype::SINT64 : ParamDatatype::UINT64)
+              : (::etl::is_signed<T>::value ? ParamDatatype::SINT32 : ParamDatatype::UINT32);
+};
+
+template<class T>
+struct PrintfArgumentTraits<T, typename ::etl::enable_if<::etl::is_enum<T>::value>::type>
+: PrintfArgumentTraits<typename ::etl::underlying_type<T>::type>
+{};
+
+template<class T>
+struct PrintfArgumentTraits<T*>
+{
+    static constexpr ParamDatatype DATATYPE = ParamDatatype::VOIDPTR;
+};
+
+template<>
+struct PrintfArgumentTraits<char*>
+{
+    static constexpr ParamDatatype DATATYPE = ParamDatatype::CHARPTR;
+};
+
+template<>
+struct PrintfArgumentTraits<char const*>
+{
+    static constexpr ParamDatatype DATATYPE = ParamDatatype::CHARPTR;
+};
+
+template<>
+struct PrintfArgumentTraits<::util::string::PlainSizedString const*>
+{
+    static constexpr ParamDatatype DATATYPE = ParamDatatype::SIZEDCHARPTR;
+};
+
+template<>
+struct PrintfArgumentTraits<std::nullptr_t>
+{
+    static constexpr ParamDatatype DATATYPE = ParamDatatype::VOIDPTR;
+};
+
+/**
+ * Maps the datatype of a printf argument to the type its raw value is stored as.
+ */
+template<ParamDatatype Datatype>
+struct PrintfArgumentStorage
+{
+    using Type = void const*;
+};
+
+template<>
+struct PrintfArgumentStorage<ParamDatatype::SINT32>
+{
+    using Type = int32_t;
+};
+
+template<>
+struct PrintfArgumentStorage<ParamDatatype::UINT32>
+{
+    using Type = uint32_t;
+};
+
+template<>
+struct PrintfArgumentStorage<ParamDatatype::SINT64>
+{
+    using Type = int64_t;
+};
+
+template<>
+struct PrintfArgumentStorage<ParamDatatype::UINT64>
+{
+    using Type = uint64_t;
+};
+
+/**
+ * Writes the raw values of printf arguments in the layout given by their PrintfArgumentSignature.
+ */
+class PrintfArgumentWriter
+{
+public:
+    /**
+     * Writes \p args to \p buffer, which needs to have a size of at least
+     * PrintfArgumentSignature::create<Args...>().getArgumentsSize() bytes.
+     */
+    template<class... Args>
+    static void write(uint8_t* buffer, Args const&... args);
+
+    /**
+     * Returns the number of bytes needed to store arguments of types Args.
+     */
+    template<class... Args>
+    static constexpr size_t getSize();
+
+private:
+    template<class T>
+    static uint8_t* writeArgument(uint8_t* buffer, T const& arg);
+
+    template<class T>
+    static uint8_t* writeValue(uint8_t* buffer, T value);
+};
+
+/**
+ * Reads printf arguments that have been written by PrintfArgumentWriter. Integer arguments are
+ * converted to the datatype requested by the formatter.
+ */
+class PrintfArgumentSignatureReader : public IPrintfArgumentReader
+{
+public:
+    PrintfArgumentSignatureReader(
+        PrintfArgumentSignature signature, ::etl::span<uint8_t const> const& arguments);
+
+    ParamVariant const* readArgument(ParamDatatype datatype) override;
+
+    /**
+     * Reads a raw value of \p storedDatatype from \p source into \p variant as \p datatype.
+     */
+    static void readValue(
+        ParamDatatype storedDatatype,
+        uint8_t const* source,
+        ParamDatatype datatype,
+        ParamVariant& variant);
+
+private:
+    PrintfArgumentSignature _signature;
+    ::etl::span<uint8_t const> _arguments;
+    size_t _index;
+    size_t _offset;
+    ParamVariant _variant;
+};
+
+template<class... Args>
+struct PrintfArgumentSignature::Packer
+{
+    static constexpr uint32_t VALUE = EMPTY;
+};
+
+template<class Arg, class... Args>
+struct PrintfArgumentSignature::Packer<Arg, Args...>
+{
+    static constexpr uint32_t VALUE
+        = (Packer<Args...>::VALUE << DATATYPE_BITS)
+          | static_cast<uint32_t>(
+              PrintfArgumentTraits<typename ::etl::decay<Arg>::type>::DATATYPE);
+};
+
+template<class... Args>
+constexpr PrintfArgumentSignature PrintfArgumentSignature::create()
+{
+    static_assert(sizeof...(Args) <= MAX_ARGUMENTS, "Too many printf arguments");
+    return PrintfArgumentSignature(Packer<Args...>::VALUE);
+}
+
+inline size_t PrintfArgumentSignature::getCount() const
+{
+    size_t count = 0U;
+    while ((count < MAX_ARGUMENTS) && (getDatatype(count) != ParamDatatype::COUNT))
+    {
+        ++count;
+    }
+    return count;
+}
+
+inline ParamDatatype PrintfArgumentSignature::getDatatype(size_t const index) const
+{
+    if (index >= MAX_ARGUMENTS)
+    {
+        return ParamDatatype::COUNT;
+    }
+    uint32_t const datatype = (_value >> (index * DATATYPE_BITS)) & DATATYPE_MASK;
+    return (datatype < static_cast<uint32_t>(ParamDatatype::COUNT))
+               ? static_cast<ParamDatatype>(datatype)
+               : ParamDatatype::COUNT;
+}
+
+inline size_t PrintfArgumentSignature::getArgumentsSize() const
+{
+    size_t size = 0U;
+    for (size_t i = 0U; i < MAX_ARGUMENTS; ++i)
+    {
+        size += getStorageSize(getDatatype(i));
+    }
+    return size;
+}
+
+constexpr size_t PrintfArgumentSignature::getStorageSize(ParamDatatype const datatype)
+{
+    return ((datatype == ParamDatatype::UINT32) || (datatype == ParamDatatype::SINT32))
+               ? sizeof(uint32_t)
+           : ((datatype == ParamDatatype::UINT64) || (datatype == ParamDatatype::SINT64))
+               ? sizeof(uint64_t)
+           : ((datatype == ParamDatatype::VOIDPTR) || (datatype == ParamDatatype::CHARPTR)
+              || (datatype == ParamDatatype::SIZEDCHARPTR))
+               ? sizeof(void const*)
+               : 0U;
+}
+
+template<class... Args>
+inline void PrintfArgumentWriter::write(uint8_t* buffer, Args const&... args)
+{
+    uint8_t* const unused[] = {buffer, (buffer = writeArgument(buffer, args))...};
+    (void)unused;
+}
+
+template<class... Args>
+constexpr size_t PrintfArgumentWriter::getSize()
+{
+    size_t const sizes[] = {
+        0U,
+        sizeof(typename PrintfArgumentStorage<
+               PrintfArgumentTraits<typename ::etl::decay<Args>::type>::DATATYPE>::Type)...};
+    size_t size = 0U;
+    for (size_t const argumentSize : sizes)
+    {
+        size += argumentSize;
+    }
+    return size;
+}
+
+template<class T>
+inline uint8_t* PrintfArgumentWriter::writeArgument(uint8_t* const buffer, T const& arg)
+{
+    using StorageType = typename PrintfArgumentStorage<
+        PrintfArgumentTraits<typename ::etl::decay<T>::type>::DATATYPE>::Type;
+    return writeValue(buffer, static_cast<StorageType>(arg));
+}
+
+template<class T>
+inline uint8_t* PrintfArgumentWriter::writeValue(uint8_t* const buffer, T const value)
+{
+    (void)::memcpy(buffer, &value, sizeof(value));
+    return buffer + sizeof(value);
+}
+
+} // namespace format
+} // namespace util
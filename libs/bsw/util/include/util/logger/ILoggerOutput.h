@@ -2,9 +2,12 @@
 
 #pragma once
 
+#include "util/format/PrintfArgumentSignature.h"
 #include "util/logger/ComponentInfo.h"
 #include "util/logger/LevelInfo.h"
 
+#include <etl/span.h>
+
 #include <cstdarg>
 
 namespace util
@@ -36,8 +39,54 @@ public:
         ComponentInfo const& componentInfo, LevelInfo const& levelInfo, char const* str, va_list ap)
         = 0;
 
+    /**
+     * Called for each filtered log message emitted by TypedLogger.
+     * The default implementation formats the message with formatTypedOutput() into a buffer of
+     * TYPED_MESSAGE_SIZE characters on the stack. Longer messages are truncated and end with
+     * "...". Outputs that print longer messages override it and call formatTypedOutput() with a
+     * buffer of their size. Outputs that store messages may override it to store the raw
+     * arguments instead and defer the formatting.
+     * \param componentInfo reference to component info holding a human readable name of the
+     * component
+     * \param levelInfo reference to the level info holding a human readable text for the severity
+     * of the message
+     * \param str Printf-like format string
+     * \param signature datatypes of the arguments
+     * \param arguments raw argument values as written by PrintfArgumentWriter
+     */
+    virtual void logTypedOutput(
+        ComponentInfo const& componentInfo,
+        LevelInfo const& levelInfo,
+        char const* str,
+        ::util::format::PrintfArgumentSignature signature,
+        ::etl::span<uint8_t const> const& arguments);
+
+    /// Size of the buffer, including the terminating zero, that the default implementation of
+    /// logTypedOutput() formats a message into.
+    static constexpr size_t TYPED_MESSAGE_SIZE = 128U;
+
 protected:
     ILoggerOutput() = default;
+
+    /**
+     * Formats a message emitted by TypedLogger into a buffer and passes it to logOutput().
+     * \param componentInfo reference to component info holding a human readable name of the
+     * component
+     * \param levelInfo reference to the level info holding a human readable text for the severity
+     * of the message
+     * \param str Printf-like format string
+     * \param signature datatypes of the arguments
+     * \param arguments raw argument values as written by PrintfArgumentWriter
+     * \param buffer buffer for the formatted message including the terminating zero, a message
+     * that doesn't fit is truncated and ends with "..."
+     */
+    void formatTypedOutput(
+        ComponentInfo const& componentInfo,
+        LevelInfo const& levelInfo,
+        char const* str,
+        ::util::format::PrintfArgumentSignature signature,
+        ::etl::span<uint8_t const> const& arguments,
+        ::etl::span<char> buffer);
 };
 
 } // namespace logger
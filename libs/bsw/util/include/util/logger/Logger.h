@@ -37,13 +37,17 @@
 
 #ifndef LOGGER_NO_LEGACY_API
 
+#include "util/format/PrintfArgumentSignature.h"
 #include "util/logger/IComponentMapping.h"
 
+#include <etl/span.h>
+
 namespace util
 {
 namespace logger
 {
 class ILoggerOutput;
+class TypedLogger;
 
 /**
  * This class is a simple facade that allows the separation of emitting log messages from
@@ -151,7 +155,15 @@ public:
     static void critical(uint8_t componentIndex, char const* str, ...);
 
 private:
+    friend class TypedLogger;
+
     static void doLog(uint8_t componentIndex, Level level, char const* str, va_list ap);
+    static void doLog(
+        uint8_t componentIndex,
+        Level level,
+        char const* str,
+        ::util::format::PrintfArgumentSignature signature,
+        ::etl::span<uint8_t const> const& arguments);
 
     static IComponentMapping* _componentMapping;
     static ILoggerOutput* _output;
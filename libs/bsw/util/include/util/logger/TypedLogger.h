@@ -0,0 +1,150 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "util/logger/Logger.h"
+
+#ifndef LOGGER_NO_LEGACY_API
+
+namespace util
+{
+namespace logger
+{
+/**
+ * Logging front end with the same interface as Logger, but with variadic templates instead of
+ * C variadic arguments.
+ *
+ * The datatypes of the arguments are determined at compile time and passed to the output as a
+ * PrintfArgumentSignature together with the raw argument values. No va_list needs to be walked
+ * and outputs that store messages (e.g. logger::BufferedLoggerOutput) can copy the arguments as
+ * a single block and defer the formatting until the message is printed. Supported arguments are
+ * integers, enums, strings, PlainSizedString pointers and other pointers, at most
+ * PrintfArgumentSignature::MAX_ARGUMENTS per message.
+ *
+ * Logger has to be initialized to enable logging with this class.
+ */
+class TypedLogger
+{
+public:
+    /**
+     * Emit a log message for a given component and severity.
+     * \param componentIndex index of the logger component
+     * \param level severity of message
+     * \param str printf-format string for message
+     * \param args printf arguments depending on format string
+     */
+    template<class... Args>
+    static void log(uint8_t componentIndex, Level level, char const* str, Args const&... args);
+
+    /**
+     * Emit a log message of severity LEVEL_INFO for a given component.
+     * \see log()
+     */
+    template<class... Args>
+    static void info(uint8_t componentIndex, char const* str, Args const&... args);
+
+    /**
+     * Emit a log message of severity LEVEL_DEBUG for a given component.
+     * \see log()
+     */
+    template<class... Args>
+    static void debug(uint8_t componentIndex, char const* str, Args const&... args);
+
+    /**
+     * Emit a log message of severity LEVEL_WARN for a given component.
+     * \see log()
+     */
+    template<class... Args>
+    static void warn(uint8_t componentIndex, char const* str, Args const&... args);
+
+    /**
+     * Emit a log message of severity LEVEL_ERROR for a given component.
+     * \see log()
+     */
+    template<class... Args>
+    static void error(uint8_t componentIndex, char const* str, Args const&... args);
+
+    /**
+     * Emit a log message of severity LEVEL_CRITICAL for a given component.
+     * \see log()
+     */
+    template<class... Args>
+    static void critical(uint8_t componentIndex, char const* str, Args const&... args);
+
+private:
+    template<class... Args>
+    static void doLog(uint8_t componentIndex, Level level, char const* str, Args const&... args);
+};
+
+template<class... Args>
+inline void TypedLogger::log(
+    uint8_t const componentIndex, Level const level, char const* const str, Args const&... args)
+{
+#ifndef DISABLE_LOGGING
+    if (Logger::isEnabled(componentIndex, level))
+    {
+        doLog(componentIndex, level, str, args...);
+    }
+#else
+    (void)componentIndex;
+    (void)level;
+    (void)str;
+#endif
+}
+
+template<class... Args>
+inline void
+TypedLogger::info(uint8_t const componentIndex, char const* const str, Args const&... args)
+{
+    log(componentIndex, LEVEL_INFO, str, args...);
+}
+
+template<class... Args>
+inline void
+TypedLogger::debug(uint8_t const componentIndex, char const* const str, Args const&... args)
+{
+    log(componentIndex, LEVEL_DEBUG, str, args...);
+}
+
+template<class... Args>
+inline void
+TypedLogger::warn(uint8_t const componentIndex, char const* const str, Args const&... args)
+{
+    log(componentIndex, LEVEL_WARN, str, args...);
+}
+
+template<class... Args>
+inline void
+TypedLogger::error(uint8_t const componentIndex, char const* const str, Args const&... args)
+{
+    log(componentIndex, LEVEL_ERROR, str, args...);
+}
+
+template<class... Args>
+inline void
+TypedLogger::critical(uint8_t const componentIndex, char const* const str, Args const&... args)
+{
+    log(componentIndex, LEVEL_CRITICAL, str, args...);
+}
+
+template<class... Args>
+void TypedLogger::doLog(
+    uint8_t const componentIndex, Level const level, char const* const str, Args const&... args)
+{
+    static constexpr size_t ARGUMENTS_SIZE
+        = ::util::format::PrintfArgumentWriter::getSize<Args...>();
+    // one additional byte avoids an empty array for messages without arguments
+    uint8_t arguments[ARGUMENTS_SIZE + 1U];
+    ::util::format::PrintfArgumentWriter::write(&arguments[0], args...);
+    Logger::doLog(
+        componentIndex,
+        level,
+        str,
+        ::util::format::PrintfArgumentSignature::create<Args...>(),
+        ::etl::span<uint8_t const>(&arguments[0], ARGUMENTS_SIZE));
+}
+
+} // namespace logger
+} // namespace util
+
+#endif // LOGGER_NO_LEGACY_API
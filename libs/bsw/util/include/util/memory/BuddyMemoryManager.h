@@ -186,6 +186,12 @@ public:
 
     bool isEmpty() const;
 
+    /**
+     * Returns the size of the largest chunk that can currently be acquired.
+     * \return Number of buckets of the largest free chunk. Zero if the memory is full.
+     */
+    size_t largestFreeChunk() const;
+
     /**
      * Acquires a given number of buckets.
      * \return
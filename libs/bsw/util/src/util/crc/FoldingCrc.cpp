@@ -0,0 +1,24 @@
+// Copyright 2025 Accenture.
+
+#include "util/crc/FoldingCrc.h"
+
+namespace util
+{
+namespace crc
+{
+bool isCarrylessMultiplySupported()
+{
+#ifdef UTIL_CRC_HAS_CARRYLESS_MULTIPLY
+    static bool const supported = []()
+    {
+        __builtin_cpu_init();
+        return (__builtin_cpu_supports("pclmul") != 0) && (__builtin_cpu_supports("ssse3") != 0);
+    }();
+    return supported;
+#else
+    return false;
+#endif
+}
+
+} // namespace crc
+} // namespace util
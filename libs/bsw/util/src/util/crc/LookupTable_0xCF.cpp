@@ -1,43 +0,0 @@
-// Copyright 2024 Accenture.
-
-#include "util/crc/LookupTable.h"
-
-#include <cstdint>
-
-namespace util
-{
-namespace crc
-{
-uint8_t const table_0xCF[256] = {
-    0x00U, 0xCFU, 0x51U, 0x9EU, 0xA2U, 0x6DU, 0xF3U, 0x3CU, 0x8BU, 0x44U, 0xDAU, 0x15U, 0x29U,
-    0xE6U, 0x78U, 0xB7U, 0xD9U, 0x16U, 0x88U, 0x47U, 0x7BU, 0xB4U, 0x2AU, 0xE5U, 0x52U, 0x9DU,
-    0x03U, 0xCCU, 0xF0U, 0x3FU, 0xA1U, 0x6EU, 0x7DU, 0xB2U, 0x2CU, 0xE3U, 0xDFU, 0x10U, 0x8EU,
-    0x41U, 0xF6U, 0x39U, 0xA7U, 0x68U, 0x54U, 0x9BU, 0x05U, 0xCAU, 0xA4U, 0x6BU, 0xF5U, 0x3AU,
-    0x06U, 0xC9U, 0x57U, 0x98U, 0x2FU, 0xE0U, 0x7EU, 0xB1U, 0x8DU, 0x42U, 0xDCU, 0x13U, 0xFAU,
-    0x35U, 0xABU, 0x64U, 0x58U, 0x97U, 0x09U, 0xC6U, 0x71U, 0xBEU, 0x20U, 0xEFU, 0xD3U, 0x1CU,
-    0x82U, 0x4DU, 0x23U, 0xECU, 0x72U, 0xBDU, 0x81U, 0x4EU, 0xD0U, 0x1FU, 0xA8U, 0x67U, 0xF9U,
-    0x36U, 0x0AU, 0xC5U, 0x5BU, 0x94U, 0x87U, 0x48U, 0xD6U, 0x19U, 0x25U, 0xEAU, 0x74U, 0xBBU,
-    0x0CU, 0xC3U, 0x5DU, 0x92U, 0xAEU, 0x61U, 0xFFU, 0x30U, 0x5EU, 0x91U, 0x0FU, 0xC0U, 0xFCU,
-    0x33U, 0xADU, 0x62U, 0xD5U, 0x1AU, 0x84U, 0x4BU, 0x77U, 0xB8U, 0x26U, 0xE9U, 0x3BU, 0xF4U,
-    0x6AU, 0xA5U, 0x99U, 0x56U, 0xC8U, 0x07U, 0xB0U, 0x7FU, 0xE1U, 0x2EU, 0x12U, 0xDDU, 0x43U,
-    0x8CU, 0xE2U, 0x2DU, 0xB3U, 0x7CU, 0x40U, 0x8FU, 0x11U, 0xDEU, 0x69U, 0xA6U, 0x38U, 0xF7U,
-    0xCBU, 0x04U, 0x9AU, 0x55U, 0x46U, 0x89U, 0x17U, 0xD8U, 0xE4U, 0x2BU, 0xB5U, 0x7AU, 0xCDU,
-    0x02U, 0x9CU, 0x53U, 0x6FU, 0xA0U, 0x3EU, 0xF1U, 0x9FU, 0x50U, 0xCEU, 0x01U, 0x3DU, 0xF2U,
-    0x6CU, 0xA3U, 0x14U, 0xDBU, 0x45U, 0x8AU, 0xB6U, 0x79U, 0xE7U, 0x28U, 0xC1U, 0x0EU, 0x90U,
-    0x5FU, 0x63U, 0xACU, 0x32U, 0xFDU, 0x4AU, 0x85U, 0x1BU, 0xD4U, 0xE8U, 0x27U, 0xB9U, 0x76U,
-    0x18U, 0xD7U, 0x49U, 0x86U, 0xBAU, 0x75U, 0xEBU, 0x24U, 0x93U, 0x5CU, 0xC2U, 0x0DU, 0x31U,
-    0xFEU, 0x60U, 0xAFU, 0xBCU, 0x73U, 0xEDU, 0x22U, 0x1EU, 0xD1U, 0x4FU, 0x80U, 0x37U, 0xF8U,
-    0x66U, 0xA9U, 0x95U, 0x5AU, 0xC4U, 0x0BU, 0x65U, 0xAAU, 0x34U, 0xFBU, 0xC7U, 0x08U, 0x96U,
-    0x59U, 0xEEU, 0x21U, 0xBFU, 0x70U, 0x4CU, 0x83U, 0x1DU, 0xD2U,
-};
-
-template<class T, T Polynom>
-typename LookupTable<T, Polynom>::TableRef LookupTable<T, Polynom>::getTable()
-{
-    return table_0xCF;
-}
-
-template struct LookupTable<uint8_t, 0xCF>;
-
-} // namespace crc
-} // namespace util
@@ -0,0 +1,98 @@
+// Copyright 2025 Accenture.
+
+#include "util/format/PrintfArgumentSignature.h"
+
+namespace util
+{
+namespace format
+{
+PrintfArgumentSignatureReader::PrintfArgumentSignatureReader(
+    PrintfArgumentSignature const signature, ::etl::span<uint8_t const> const& arguments)
+: IPrintfArgumentReader(), _signature(signature), _arguments(arguments), _index(0U), _offset(0U)
+{
+    _variant._uint64Value = 0U;
+}
+
+ParamVariant const* PrintfArgumentSignatureReader::readArgument(ParamDatatype const datatype)
+{
+    ParamDatatype const storedDatatype = _signature.getDatatype(_index);
+    size_t const size = PrintfArgumentSignature::getStorageSize(storedDatatype);
+    if ((size == 0U) || ((_offset + size) > _arguments.size()))
+    {
+        return nullptr;
+    }
+    readValue(storedDatatype, &_arguments[_offset], datatype, _variant);
+    _offset += size;
+    ++_index;
+    return &_variant;
+}
+
+void PrintfArgumentSignatureReader::readValue(
+    ParamDatatype const storedDatatype,
+    uint8_t const* const source,
+    ParamDatatype const datatype,
+    ParamVariant& variant)
+{
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-union-access): intentional tagged-by-ParamDatatype
+    // union access
+    uint64_t value = 0U;
+    switch (storedDatatype)
+    {
+        case ParamDatatype::SINT32:
+        {
+            int32_t sint32Value = 0;
+            (void)::memcpy(&sint32Value, source, sizeof(sint32Value));
+            value = static_cast<uint64_t>(static_cast<int64_t>(sint32Value));
+            break;
+        }
+        case ParamDatatype::UINT32:
+        {
+            uint32_t uint32Value = 0U;
+            (void)::memcpy(&uint32Value, source, sizeof(uint32Value));
+            value = uint32Value;
+            break;
+        }
+        case ParamDatatype::SINT64:
+        case ParamDatatype::UINT64:
+        {
+            (void)::memcpy(&value, source, sizeof(value));
+            break;
+        }
+        default:
+        {
+            (void)::memcpy(&variant._voidPtrValue, source, sizeof(variant._voidPtrValue));
+            return;
+        }
+    }
+
+    switch (datatype)
+    {
+        case ParamDatatype::UINT8:
+        case ParamDatatype::SINT8:
+        {
+            variant._uint8Value = static_cast<uint8_t>(value);
+            break;
+        }
+        case ParamDatatype::UINT16:
+        case ParamDatatype::SINT16:
+        {
+            variant._uint16Value = static_cast<uint16_t>(value);
+            break;
+        }
+        case ParamDatatype::UINT32:
+        case ParamDatatype::SINT32:
+        {
+            variant._uint32Value = static_cast<uint32_t>(value);
+            break;
+        }
+        default:
+        {
+            variant._uint64Value = value;
+            break;
+        }
+    }
+    // NOLINTEND(cppcoreguidelines-pro-type-union-access)
+}
+
+} // namespace format
+} // namespace util
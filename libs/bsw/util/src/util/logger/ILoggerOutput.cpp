@@ -0,0 +1,58 @@
+// Copyright 2025 Accenture.
+
+#include "util/logger/ILoggerOutput.h"
+
+#ifndef LOGGER_NO_LEGACY_API
+
+#include "util/format/PrintfFormatter.h"
+#include "util/stream/StringBufferOutputStream.h"
+
+namespace util
+{
+namespace logger
+{
+namespace
+{
+void forwardOutput(
+    ILoggerOutput& output,
+    ComponentInfo const& componentInfo,
+    LevelInfo const& levelInfo,
+    char const* const str,
+    ...)
+{
+    va_list ap;
+    va_start(ap, str);
+    output.logOutput(componentInfo, levelInfo, str, ap);
+    va_end(ap);
+}
+} // namespace
+
+void ILoggerOutput::logTypedOutput(
+    ComponentInfo const& componentInfo,
+    LevelInfo const& levelInfo,
+    char const* const str,
+    ::util::format::PrintfArgumentSignature const signature,
+    ::etl::span<uint8_t const> const& arguments)
+{
+    char buffer[TYPED_MESSAGE_SIZE];
+    formatTypedOutput(componentInfo, levelInfo, str, signature, arguments, buffer);
+}
+
+void ILoggerOutput::formatTypedOutput(
+    ComponentInfo const& componentInfo,
+    LevelInfo const& levelInfo,
+    char const* const str,
+    ::util::format::PrintfArgumentSignature const signature,
+    ::etl::span<uint8_t const> const& arguments,
+    ::etl::span<char> const buffer)
+{
+    ::util::stream::StringBufferOutputStream stream(buffer, nullptr, "...");
+    ::util::format::PrintfArgumentSignatureReader reader(signature, arguments);
+    ::util::format::PrintfFormatter(stream).format(str, reader);
+    forwardOutput(*this, componentInfo, levelInfo, "%s", stream.getString());
+}
+
+} // namespace logger
+} // namespace util
+
+#endif // LOGGER_NO_LEGACY_API
@@ -36,6 +36,18 @@ void Logger::doLog(
     _output->logOutput(componentInfo, levelInfo, str, ap);
 }
 
+void Logger::doLog(
+    uint8_t const componentIndex,
+    Level const level,
+    char const* const str,
+    ::util::format::PrintfArgumentSignature const signature,
+    ::etl::span<uint8_t const> const& arguments)
+{
+    ComponentInfo const componentInfo = _componentMapping->getComponentInfo(componentIndex);
+    LevelInfo const levelInfo         = _componentMapping->getLevelInfo(level);
+    _output->logTypedOutput(componentInfo, levelInfo, str, signature, arguments);
+}
+
 Level Logger::getLevel(uint8_t const componentIndex)
 {
     return (_componentMapping != nullptr) ? _componentMapping->getLevel(componentIndex)
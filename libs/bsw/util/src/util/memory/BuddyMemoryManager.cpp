@@ -276,5 +276,23 @@ bool BuddyMemoryManager::isEmpty() const
     }
     return true;
 }
+
+size_t BuddyMemoryManager::largestFreeChunk() const
+{
+    for (size_t level = 0U; level < _nodeTreeDepth; ++level)
+    {
+        size_t const numberOfNodesInLevel = static_cast<size_t>(1U) << level;
+        size_t const startPositionOfLevel = numberOfNodesInLevel - 1U;
+        for (size_t i = startPositionOfLevel; i < (startPositionOfLevel + numberOfNodesInLevel);
+             ++i)
+        {
+            if (isNodeFree(i))
+            {
+                return levelToBucketNum(level);
+            }
+        }
+    }
+    return 0U;
+}
 } // namespace memory
 } // namespace util
@@ -0,0 +1,166 @@
+// Copyright 2025 Accenture.
+
+#include "util/crc/Crc.h"
+
+#include "fixtures/crc/CrcTestFixture.h"
+
+#include <gmock/gmock.h>
+
+namespace
+{
+using ::test::fixtures::CrcTestFixture;
+using namespace ::util::crc;
+using namespace ::testing;
+
+template<
+    class DigestType,
+    DigestType Polynom,
+    DigestType InitValue,
+    bool ReflectInput,
+    bool ReflectOutput,
+    DigestType FinalXor>
+struct CrcConfig
+{
+    template<class Engine>
+    using Register
+        = CrcRegister<DigestType, Polynom, InitValue, ReflectInput, ReflectOutput, FinalXor, Engine>;
+};
+
+using Crc8Ccitt     = CrcConfig<uint8_t, 0x07U, 0x00U, false, false, 0x00U>;
+using Crc8Rohc      = CrcConfig<uint8_t, 0x07U, 0xFFU, true, true, 0x00U>;
+using Crc16Ccitt    = CrcConfig<uint16_t, 0x1021U, 0xFFFFU, false, false, 0x0000U>;
+using Crc16Arc      = CrcConfig<uint16_t, 0x8005U, 0x0000U, true, true, 0x0000U>;
+using Crc32Ethernet = CrcConfig<uint32_t, 0x4C11DB7U, 0xFFFFFFFFU, true, true, 0xFFFFFFFFU>;
+using Crc32Bzip2    = CrcConfig<uint32_t, 0x4C11DB7U, 0xFFFFFFFFU, false, false, 0xFFFFFFFFU>;
+using Crc32Mixed    = CrcConfig<uint32_t, 0xF4ACFB13U, 0x12345678U, true, false, 0x00000000U>;
+
+class CrcEngineTest : public CrcTestFixture
+{
+public:
+    CrcEngineTest()
+    {
+        uint32_t value = 0x12345678U;
+        for (uint8_t& byte : _data)
+        {
+            value = (value * 1103515245U) + 12345U;
+            byte  = static_cast<uint8_t>(value >> 16U);
+        }
+    }
+
+    /**
+     * Compares the CRC of each engine with the one of the TableEngine for all lengths and offsets
+     * of the data and with the data split into two updates.
+     */
+    template<class Config>
+    void expectEqualToTableEngine()
+    {
+        expectEqualToTableEngine<Config, SlicingEngine<4U>>();
+        expectEqualToTableEngine<Config, SlicingEngine<8U>>();
+        expectEqualToTableEngine<Config, FoldingEngine>();
+    }
+
+    template<class Config, class Engine>
+    void expectEqualToTableEngine()
+    {
+        typename Config::template Register<TableEngine> expected;
+        typename Config::template Register<Engine> crc;
+        for (size_t offset = 0U; offset < 4U; ++offset)
+        {
+            for (size_t length = 0U; length <= (sizeof(_data) - offset); ++length)
+            {
+                expected.init();
+                expected.update(_data + offset, length);
+                crc.init();
+                crc.update(_data + offset, length);
+                ASSERT_EQ(expected.digest(), crc.digest()) << offset << ", " << length;
+            }
+        }
+        expected.init();
+        expected.update(_data, sizeof(_data));
+        for (size_t split = 0U; split <= sizeof(_data); ++split)
+        {
+            crc.init();
+            crc.update(_data, split);
+            crc.update(_data + split, sizeof(_data) - split);
+            ASSERT_EQ(expected.digest(), crc.digest()) << split;
+        }
+    }
+
+    uint8_t _data[300];
+};
+
+TEST_F(CrcEngineTest, check_values)
+{
+    Crc32Ethernet::Register<SlicingEngine<4U>> slicing4;
+    slicing4.init();
+    slicing4.update(_multiple_bytes, sizeof(_multiple_bytes));
+    EXPECT_EQ(0xCBF43926U, slicing4.digest());
+
+    Crc32Ethernet::Register<SlicingEngine<8U>> slicing8;
+    slicing8.init();
+    slicing8.update(_multiple_bytes, sizeof(_multiple_bytes));
+    EXPECT_EQ(0xCBF43926U, slicing8.digest());
+
+    Crc16Ccitt::Register<SlicingEngine<8U>> crc16;
+    crc16.init();
+    crc16.update(_multiple_bytes, sizeof(_multiple_bytes));
+    EXPECT_EQ(0x29B1U, crc16.digest());
+
+    Crc8Rohc::Register<SlicingEngine<4U>> crc8;
+    crc8.init();
+    crc8.update(_multiple_bytes, sizeof(_multiple_bytes));
+    EXPECT_EQ(0xD0U, crc8.digest());
+}
+
+TEST_F(CrcEngineTest, folding_check_values)
+{
+    // 123456789 repeated to exceed the minimum length for folding
+    uint8_t data[90];
+    for (size_t idx = 0U; idx < sizeof(data); ++idx)
+    {
+        data[idx] = _multiple_bytes[idx % sizeof(_multiple_bytes)];
+    }
+
+    Crc32Ethernet::Register<FoldingEngine> crc32;
+    crc32.init();
+    crc32.update(data, sizeof(data));
+    EXPECT_EQ(0xDF68476AU, crc32.digest());
+
+    Crc32Bzip2::Register<FoldingEngine> bzip2;
+    bzip2.init();
+    bzip2.update(data, sizeof(data));
+    EXPECT_EQ(0xDFDE3E43U, bzip2.digest());
+}
+
+TEST_F(CrcEngineTest, crc8_engines_equal_table_engine)
+{
+    expectEqualToTableEngine<Crc8Ccitt>();
+    expectEqualToTableEngine<Crc8Rohc>();
+}
+
+TEST_F(CrcEngineTest, crc16_engines_equal_table_engine)
+{
+    expectEqualToTableEngine<Crc16Ccitt>();
+    expectEqualToTableEngine<Crc16Arc>();
+}
+
+TEST_F(CrcEngineTest, crc32_engines_equal_table_engine)
+{
+    expectEqualToTableEngine<Crc32Ethernet>();
+    expectEqualToTableEngine<Crc32Bzip2>();
+    expectEqualToTableEngine<Crc32Mixed>();
+}
+
+TEST(SlicingTable, first_table_equals_lookup_table)
+{
+    auto const& tables = SlicingTable<uint16_t, 0x1021U, false, 8U>::TABLES.values;
+    LookupTable<uint16_t, 0x1021U>::TableRef table = LookupTable<uint16_t, 0x1021U>::getTable();
+    for (size_t idx = 0U; idx < 256U; ++idx)
+    {
+        EXPECT_EQ(table[idx], tables[0][idx]);
+    }
+    // reflected table of the Ethernet CRC-32 (0xEDB88320)
+    EXPECT_EQ(0x77073096U, (SlicingTable<uint32_t, 0x4C11DB7U, true, 8U>::TABLES.values[0][1]));
+}
+
+} // namespace
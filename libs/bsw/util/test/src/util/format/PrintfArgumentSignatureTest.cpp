@@ -0,0 +1,116 @@
+// Copyright 2025 Accenture.
+
+#include "util/format/PrintfArgumentSignature.h"
+
+#include <gtest/gtest.h>
+
+using namespace ::util::format;
+
+namespace
+{
+enum class TestEnum : uint8_t
+{
+    VALUE = 7U
+};
+
+TEST(PrintfArgumentSignatureTest, testEmptySignature)
+{
+    constexpr PrintfArgumentSignature cut = PrintfArgumentSignature::create<>();
+    EXPECT_EQ(0xFFFFFFFFU, cut.getValue());
+    EXPECT_EQ(0U, cut.getCount());
+    EXPECT_EQ(ParamDatatype::COUNT, cut.getDatatype(0U));
+    EXPECT_EQ(0U, cut.getArgumentsSize());
+    EXPECT_EQ(0U, PrintfArgumentWriter::getSize<>());
+}
+
+TEST(PrintfArgumentSignatureTest, testDatatypes)
+{
+    PrintfArgumentSignature const cut = PrintfArgumentSignature::create<
+        int8_t,
+        uint16_t,
+        int32_t,
+        uint64_t,
+        TestEnum,
+        char const*,
+        ::util::string::PlainSizedString const*,
+        int32_t*>();
+    EXPECT_EQ(8U, cut.getCount());
+    EXPECT_EQ(ParamDatatype::SINT32, cut.getDatatype(0U));
+    EXPECT_EQ(ParamDatatype::UINT32, cut.getDatatype(1U));
+    EXPECT_EQ(ParamDatatype::SINT32, cut.getDatatype(2U));
+    EXPECT_EQ(ParamDatatype::UINT64, cut.getDatatype(3U));
+    EXPECT_EQ(ParamDatatype::UINT32, cut.getDatatype(4U));
+    EXPECT_EQ(ParamDatatype::CHARPTR, cut.getDatatype(5U));
+    EXPECT_EQ(ParamDatatype::SIZEDCHARPTR, cut.getDatatype(6U));
+    EXPECT_EQ(ParamDatatype::VOIDPTR, cut.getDatatype(7U));
+    EXPECT_EQ(ParamDatatype::COUNT, cut.getDatatype(8U));
+    EXPECT_EQ(
+        4U * sizeof(uint32_t) + sizeof(uint64_t) + 3U * sizeof(void*), cut.getArgumentsSize());
+    EXPECT_EQ(
+        cut.getArgumentsSize(),
+        (PrintfArgumentWriter::getSize<
+            int8_t,
+            uint16_t,
+            int32_t,
+            uint64_t,
+            TestEnum,
+            char const*,
+            ::util::string::PlainSizedString const*,
+            int32_t*>()));
+}
+
+TEST(PrintfArgumentSignatureTest, testWriteAndRead)
+{
+    char const* const text = "text";
+    int32_t value          = 0;
+    uint8_t buffer
+        [PrintfArgumentWriter::getSize<int16_t, uint32_t, int64_t, char const*, int32_t*>()];
+    PrintfArgumentWriter::write(buffer, static_cast<int16_t>(-3), 4U, -5LL, text, &value);
+
+    PrintfArgumentSignatureReader cut(
+        PrintfArgumentSignature::create<int16_t, uint32_t, int64_t, char const*, int32_t*>(),
+        buffer);
+    ParamVariant const* variant = cut.readArgument(ParamDatatype::SINT16);
+    ASSERT_NE(nullptr, variant);
+    EXPECT_EQ(-3, variant->_sint16Value);
+    variant = cut.readArgument(ParamDatatype::UINT32);
+    ASSERT_NE(nullptr, variant);
+    EXPECT_EQ(4U, variant->_uint32Value);
+    variant = cut.readArgument(ParamDatatype::SINT64);
+    ASSERT_NE(nullptr, variant);
+    EXPECT_EQ(-5, variant->_sint64Value);
+    variant = cut.readArgument(ParamDatatype::CHARPTR);
+    ASSERT_NE(nullptr, variant);
+    EXPECT_EQ(text, variant->_charPtrValue);
+    variant = cut.readArgument(ParamDatatype::SINT32PTR);
+    ASSERT_NE(nullptr, variant);
+    EXPECT_EQ(&value, variant->_sint32PtrValue);
+    EXPECT_EQ(nullptr, cut.readArgument(ParamDatatype::SINT32));
+}
+
+TEST(PrintfArgumentSignatureTest, testReadConvertsToRequestedDatatype)
+{
+    uint8_t buffer[PrintfArgumentWriter::getSize<int32_t, int32_t>()];
+    PrintfArgumentWriter::write(buffer, -1, -2);
+
+    PrintfArgumentSignatureReader cut(PrintfArgumentSignature::create<int32_t, int32_t>(), buffer);
+    ParamVariant const* variant = cut.readArgument(ParamDatatype::UINT8);
+    ASSERT_NE(nullptr, variant);
+    EXPECT_EQ(0xFFU, variant->_uint8Value);
+    variant = cut.readArgument(ParamDatatype::SINT64);
+    ASSERT_NE(nullptr, variant);
+    EXPECT_EQ(-2, variant->_sint64Value);
+}
+
+TEST(PrintfArgumentSignatureTest, testReadBeyondArguments)
+{
+    uint8_t buffer[PrintfArgumentWriter::getSize<uint64_t>()];
+    PrintfArgumentWriter::write(buffer, 1ULL);
+
+    PrintfArgumentSignatureReader cut(
+        PrintfArgumentSignature::create<uint64_t>(),
+        ::etl::span<uint8_t const>(buffer).first(sizeof(buffer) - 1U));
+    EXPECT_EQ(nullptr, cut.readArgument(ParamDatatype::UINT64));
+}
+
+} // anonymous namespace
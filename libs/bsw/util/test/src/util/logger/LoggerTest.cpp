@@ -3,6 +3,7 @@
 #include "util/logger/Logger.h"
 
 #include "util/logger/ILoggerOutput.h"
+#include "util/logger/TypedLogger.h"
 
 #include <gtest/gtest.h>
 
@@ -67,6 +68,23 @@ struct LoggerTest
         _logStr = buffer;
     }
 
+    void logTypedOutput(
+        ComponentInfo const& componentInfo,
+        LevelInfo const& levelInfo,
+        char const* str,
+        PrintfArgumentSignature signature,
+        ::etl::span<uint8_t const> const& arguments) override
+    {
+        if (_typedBuffer.empty())
+        {
+            ILoggerOutput::logTypedOutput(componentInfo, levelInfo, str, signature, arguments);
+        }
+        else
+        {
+            formatTypedOutput(componentInfo, levelInfo, str, signature, arguments, _typedBuffer);
+        }
+    }
+
     bool checkAndResetLog(
         uint8_t componentIndex,
         Level level,
@@ -95,6 +113,7 @@ struct LoggerTest
     std::string _logStr;
     LevelInfo _outLevelInfo;
     ComponentInfo _outComponentInfo;
+    ::etl::span<char> _typedBuffer;
 };
 } // anonymous namespace
 
@@ -182,3 +201,68 @@ TEST_F(LoggerTest, testUninitializedUsage)
     callLog(6, LEVEL_DEBUG, "abc", 1, 2, 3);
     ASSERT_EQ(LEVEL_NONE, Logger::getLevel(0));
 }
+
+TEST_F(LoggerTest, testTypedLogging)
+{
+    Logger::init(*this, *this);
+
+    ComponentInfo::PlainInfo constComponentInfo
+        = {{"abc", {Color::DEFAULT_COLOR, 0U, Color::DEFAULT_COLOR}}};
+    ComponentInfo componentInfo(12, &constComponentInfo);
+
+    _enabled       = true;
+    _componentInfo = componentInfo;
+    _levelInfo     = LevelInfo(LevelInfo::getDefaultTable() + LEVEL_DEBUG);
+
+    TypedLogger::log(1, LEVEL_INFO, "abc: %d %s", 12, "log");
+    ASSERT_TRUE(checkAndResetLog(1, LEVEL_INFO, 12, LEVEL_DEBUG, "abc: 12 log"));
+
+    TypedLogger::debug(2, "abc: %u %s", 13U, "debug");
+    ASSERT_TRUE(checkAndResetLog(2, LEVEL_DEBUG, 12, LEVEL_DEBUG, "abc: 13 debug"));
+
+    TypedLogger::info(3, "abc: %d %lld", -14, -1400000000000LL);
+    ASSERT_TRUE(checkAndResetLog(3, LEVEL_INFO, 12, LEVEL_DEBUG, "abc: -14 -1400000000000"));
+
+    TypedLogger::warn(4, "abc: %x %hu", 0xABCDU, static_cast<uint8_t>(200U));
+    ASSERT_TRUE(checkAndResetLog(4, LEVEL_WARN, 12, LEVEL_DEBUG, "abc: abcd 200"));
+
+    TypedLogger::error(5, "abc: %*d|", 4, 15);
+    ASSERT_TRUE(checkAndResetLog(5, LEVEL_ERROR, 12, LEVEL_DEBUG, "abc:   15|"));
+
+    TypedLogger::critical(6, "abc");
+    ASSERT_TRUE(checkAndResetLog(6, LEVEL_CRITICAL, 12, LEVEL_DEBUG, "abc"));
+
+    _enabled = false;
+    TypedLogger::info(7, "abc: %d", 17);
+    ASSERT_EQ(7, _componentIndex);
+    ASSERT_TRUE(_logStr.empty());
+}
+
+TEST_F(LoggerTest, testTypedLoggingTruncatesToBufferOfOutput)
+{
+    Logger::init(*this, *this);
+
+    _enabled   = true;
+    _levelInfo = LevelInfo(LevelInfo::getDefaultTable() + LEVEL_DEBUG);
+    std::string const text(200U, 'x');
+
+    TypedLogger::info(1, "%s", text.c_str());
+    ASSERT_EQ(ILoggerOutput::TYPED_MESSAGE_SIZE - 1U, _logStr.size());
+    ASSERT_EQ(text.substr(0U, ILoggerOutput::TYPED_MESSAGE_SIZE - 4U) + "...", _logStr);
+
+    char buffer[256];
+    _typedBuffer = buffer;
+    TypedLogger::info(1, "%s", text.c_str());
+    ASSERT_EQ(text, _logStr);
+}
+
+TEST_F(LoggerTest, testTypedUninitializedUsage)
+{
+    TypedLogger::log(0, LEVEL_DEBUG, "abc", 1, 2, 3);
+    TypedLogger::info(1, "abc", 1, 2, 3);
+    TypedLogger::debug(2, "abc", 1, 2, 3);
+    TypedLogger::warn(3, "abc", 1, 2, 3);
+    TypedLogger::error(4, "abc", 1, 2, 3);
+    TypedLogger::critical(5, "abc", 1, 2, 3);
+    ASSERT_TRUE(_logStr.empty());
+}
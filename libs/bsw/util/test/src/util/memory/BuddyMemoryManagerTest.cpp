@@ -169,6 +169,24 @@ TEST_F(BuddyMemoryManagerTest, AllocateOutOfOrder)
     EXPECT_TRUE(_memoryManager.isEmpty());
 }
 
+TEST_F(BuddyMemoryManagerTest, LargestFreeChunk)
+{
+    EXPECT_EQ(8U, _memoryManager.largestFreeChunk());
+    EXPECT_EQ(Bucket(0U, 1U), _memoryManager.acquireMemory(1U));
+    EXPECT_EQ(4U, _memoryManager.largestFreeChunk());
+    EXPECT_EQ(Bucket(4U, 4U), _memoryManager.acquireMemory(4U));
+    EXPECT_EQ(2U, _memoryManager.largestFreeChunk());
+    EXPECT_EQ(Bucket(2U, 2U), _memoryManager.acquireMemory(2U));
+    EXPECT_EQ(1U, _memoryManager.largestFreeChunk());
+    EXPECT_EQ(Bucket(1U, 1U), _memoryManager.acquireMemory(1U));
+    EXPECT_EQ(0U, _memoryManager.largestFreeChunk());
+
+    EXPECT_EQ(4U, _memoryManager.releaseMemoryExtended(4U));
+    EXPECT_EQ(4U, _memoryManager.largestFreeChunk());
+    EXPECT_EQ(1U, _memoryManager.releaseMemoryExtended(0U));
+    EXPECT_EQ(4U, _memoryManager.largestFreeChunk());
+}
+
 TEST_F(BuddyMemoryManagerTest, ReleaseMemoryOutsideManager)
 {
     EXPECT_EQ(Bucket(0U, 8U), _memoryManager.acquireMemory(8U));
@@ -0,0 +1,58 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "bsp/FlashConfiguration.h"
+#include "bsp/flash/IFlashDriver.h"
+
+#include <etl/span.h>
+
+#include <string>
+
+namespace flash
+{
+/**
+ * IFlashDriver that emulates NOR flash memory with a file.
+ */
+class FlashDriver : public IFlashDriver
+{
+public:
+    static constexpr uint32_t FLASH_SIZE  = 4U * 1024U * 1024U; // 4MB
+    static constexpr uint32_t SECTOR_SIZE = 64U * 1024U;        // 64KB
+
+    FlashDriver();
+    ~FlashDriver();
+
+    FlashDriver(FlashDriver const&)            = delete;
+    FlashDriver& operator=(FlashDriver const&) = delete;
+    FlashDriver(FlashDriver&&)                 = delete;
+    FlashDriver& operator=(FlashDriver&&)      = delete;
+
+    FlashOperationStatus write(uint32_t destination, uint8_t const* source, uint32_t size) override;
+
+    FlashOperationStatus erase(uint32_t address, uint32_t size) override;
+
+    FlashOperationStatus flush() override;
+
+    FlashOperationStatus getBlockSize(uint32_t blockStartAddress, uint32_t& blockSize) override;
+
+    FlashOperationStatus read(uint32_t address, uint8_t* buffer, uint32_t size);
+
+    /**
+     * Returns a read-only mapping of the file, which behaves like memory mapped flash memory,
+     * or an empty span if the file couldn't be mapped.
+     */
+    ::etl::span<uint8_t const> getMemory() const;
+
+private:
+    static constexpr uint32_t CHUNK_SIZE = 4096U;
+
+    static bool isInRange(uint32_t address, uint32_t size);
+
+    std::string const flashFilePath = FLASH_FILEPATH;
+    int flashFd;
+    uint8_t const* flashMemory;
+    // not on the stack, the flash context may run on a small one
+    uint8_t chunk[CHUNK_SIZE];
+};
+} // namespace flash
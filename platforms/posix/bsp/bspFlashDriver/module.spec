@@ -0,0 +1 @@
+oss: true
\ No newline at end of file
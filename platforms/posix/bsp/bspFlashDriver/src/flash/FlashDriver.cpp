@@ -0,0 +1,160 @@
+// Copyright 2025 Accenture.
+
+#include "flash/FlashDriver.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace flash
+{
+constexpr uint32_t FlashDriver::FLASH_SIZE;
+constexpr uint32_t FlashDriver::SECTOR_SIZE;
+constexpr uint32_t FlashDriver::CHUNK_SIZE;
+
+FlashDriver::FlashDriver() : flashFd(-1), flashMemory(nullptr), chunk()
+{
+    flashFd = open(flashFilePath.c_str(), O_RDWR | O_CREAT, 0666);
+
+    struct stat fileStat;
+    if ((flashFd != -1) && (fstat(flashFd, &fileStat) == 0)
+        && (fileStat.st_size != static_cast<off_t>(FLASH_SIZE)))
+    {
+        // New or resized file: start with erased flash memory
+        if ((ftruncate(flashFd, 0) != 0) || (erase(0U, FLASH_SIZE) != FLASH_OP_SUCCESSFUL))
+        {
+            printf("Failed to initialize flash file\r\n");
+        }
+    }
+    if (flashFd != -1)
+    {
+        // writes through the file descriptor are visible in the shared mapping right away
+        void* const mapping = mmap(nullptr, FLASH_SIZE, PROT_READ, MAP_SHARED, flashFd, 0);
+        if (mapping != MAP_FAILED)
+        {
+            flashMemory = static_cast<uint8_t const*>(mapping);
+        }
+        else
+        {
+            printf("Failed to map flash file\r\n");
+        }
+    }
+}
+
+IFlashDriver::FlashOperationStatus
+FlashDriver::write(uint32_t const destination, uint8_t const* const source, uint32_t const size)
+{
+    if ((flashFd == -1) || (source == nullptr) || (!isInRange(destination, size)))
+    {
+        return FLASH_OP_FAILED;
+    }
+    uint32_t offset = 0U;
+    while (offset < size)
+    {
+        uint32_t const length  = ((size - offset) < CHUNK_SIZE) ? (size - offset) : CHUNK_SIZE;
+        off_t const position   = static_cast<off_t>(destination + offset);
+        ssize_t const expected = static_cast<ssize_t>(length);
+        if (pread(flashFd, chunk, length, position) != expected)
+        {
+            return FLASH_OP_FAILED;
+        }
+        // programming can only clear bits
+        for (uint32_t i = 0U; i < length; ++i)
+        {
+            chunk[i] &= source[offset + i];
+        }
+        if (pwrite(flashFd, chunk, length, position) != expected)
+        {
+            return FLASH_OP_FAILED;
+        }
+        offset += length;
+    }
+    return FLASH_OP_SUCCESSFUL;
+}
+
+IFlashDriver::FlashOperationStatus FlashDriver::erase(uint32_t const address, uint32_t const size)
+{
+    if ((flashFd == -1) || (!isInRange(address, size)) || ((address % SECTOR_SIZE) != 0U)
+        || ((size % SECTOR_SIZE) != 0U))
+    {
+        return FLASH_OP_FAILED;
+    }
+    memset(chunk, 0xFF, CHUNK_SIZE);
+    for (uint32_t offset = 0U; offset < size; offset += CHUNK_SIZE)
+    {
+        if (pwrite(flashFd, chunk, CHUNK_SIZE, static_cast<off_t>(address + offset))
+            != static_cast<ssize_t>(CHUNK_SIZE))
+        {
+            return FLASH_OP_FAILED;
+        }
+    }
+    return FLASH_OP_SUCCESSFUL;
+}
+
+IFlashDriver::FlashOperationStatus FlashDriver::flush()
+{
+    if ((flashFd == -1) || (fsync(flashFd) != 0))
+    {
+        return FLASH_OP_FAILED;
+    }
+    return FLASH_OP_SUCCESSFUL;
+}
+
+IFlashDriver::FlashOperationStatus
+FlashDriver::getBlockSize(uint32_t const blockStartAddress, uint32_t& blockSize)
+{
+    if ((blockStartAddress >= FLASH_SIZE) || ((blockStartAddress % SECTOR_SIZE) != 0U))
+    {
+        blockSize = 0U;
+        return FLASH_OP_FAILED;
+    }
+    blockSize = SECTOR_SIZE;
+    return FLASH_OP_SUCCESSFUL;
+}
+
+IFlashDriver::FlashOperationStatus
+FlashDriver::read(uint32_t const address, uint8_t* const buffer, uint32_t const size)
+{
+    if ((flashFd == -1) || (buffer == nullptr) || (!isInRange(address, size))
+        || (pread(flashFd, buffer, size, static_cast<off_t>(address))
+            != static_cast<ssize_t>(size)))
+    {
+        return FLASH_OP_FAILED;
+    }
+    return FLASH_OP_SUCCESSFUL;
+}
+
+::etl::span<uint8_t const> FlashDriver::getMemory() const
+{
+    if (flashMemory == nullptr)
+    {
+        return {};
+    }
+    return ::etl::span<uint8_t const>(flashMemory, FLASH_SIZE);
+}
+
+bool FlashDriver::isInRange(uint32_t const address, uint32_t const size)
+{
+    return (address < FLASH_SIZE) && (size <= (FLASH_SIZE - address));
+}
+
+FlashDriver::~FlashDriver()
+{
+    if (flashMemory != nullptr)
+    {
+        munmap(const_cast<uint8_t*>(flashMemory), FLASH_SIZE);
+        flashMemory = nullptr;
+    }
+    if (-1 != flashFd)
+    {
+        fsync(flashFd);
+        close(flashFd);
+        flashFd = -1;
+    }
+}
+
+} // namespace flash
@@ -0,0 +1,113 @@
+// Copyright 2025 Accenture.
+
+#include "flash/FlashDriver.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+namespace
+{
+
+using namespace ::testing;
+using ::flash::FlashDriver;
+using ::flash::IFlashDriver;
+
+class FlashDriverTest : public ::testing::Test
+{
+protected:
+    FlashDriver _cut;
+};
+
+TEST_F(FlashDriverTest, testGetBlockSize)
+{
+    uint32_t blockSize = 0U;
+    EXPECT_EQ(IFlashDriver::FLASH_OP_SUCCESSFUL, _cut.getBlockSize(0U, blockSize));
+    EXPECT_EQ(FlashDriver::SECTOR_SIZE, blockSize);
+    EXPECT_EQ(
+        IFlashDriver::FLASH_OP_SUCCESSFUL,
+        _cut.getBlockSize(FlashDriver::FLASH_SIZE - FlashDriver::SECTOR_SIZE, blockSize));
+    EXPECT_EQ(FlashDriver::SECTOR_SIZE, blockSize);
+
+    EXPECT_EQ(IFlashDriver::FLASH_OP_FAILED, _cut.getBlockSize(0x100U, blockSize));
+    EXPECT_EQ(0U, blockSize);
+    EXPECT_EQ(IFlashDriver::FLASH_OP_FAILED, _cut.getBlockSize(FlashDriver::FLASH_SIZE, blockSize));
+}
+
+TEST_F(FlashDriverTest, testEraseWriteRead)
+{
+    uint32_t const address = FlashDriver::SECTOR_SIZE;
+    EXPECT_EQ(IFlashDriver::FLASH_OP_SUCCESSFUL, _cut.erase(address, FlashDriver::SECTOR_SIZE));
+
+    uint8_t readData[8] = {0};
+    EXPECT_EQ(IFlashDriver::FLASH_OP_SUCCESSFUL, _cut.read(address, readData, sizeof(readData)));
+    for (uint8_t const value : readData)
+    {
+        EXPECT_EQ(0xFFU, value);
+    }
+
+    uint8_t const dataToWrite[] = {0x01, 0x02, 0x03, 0x04, 0x05};
+    EXPECT_EQ(
+        IFlashDriver::FLASH_OP_SUCCESSFUL,
+        _cut.write(address + 1U, dataToWrite, sizeof(dataToWrite)));
+    EXPECT_EQ(IFlashDriver::FLASH_OP_SUCCESSFUL, _cut.flush());
+    EXPECT_EQ(IFlashDriver::FLASH_OP_SUCCESSFUL, _cut.read(address, readData, sizeof(readData)));
+    uint8_t const expected[] = {0xFF, 0x01, 0x02, 0x03, 0x04, 0x05, 0xFF, 0xFF};
+    EXPECT_EQ(0, memcmp(expected, readData, sizeof(expected)));
+}
+
+TEST_F(FlashDriverTest, testMemoryReflectsEraseAndWrite)
+{
+    ::etl::span<uint8_t const> const memory = _cut.getMemory();
+    ASSERT_EQ(FlashDriver::FLASH_SIZE, memory.size());
+
+    uint32_t const address = 2U * FlashDriver::SECTOR_SIZE;
+    EXPECT_EQ(IFlashDriver::FLASH_OP_SUCCESSFUL, _cut.erase(address, FlashDriver::SECTOR_SIZE));
+    EXPECT_EQ(0xFFU, memory[address]);
+    uint8_t const dataToWrite[] = {0x12, 0x34};
+    EXPECT_EQ(
+        IFlashDriver::FLASH_OP_SUCCESSFUL, _cut.write(address, dataToWrite, sizeof(dataToWrite)));
+    EXPECT_EQ(0x12U, memory[address]);
+    EXPECT_EQ(0x34U, memory[address + 1U]);
+    EXPECT_EQ(0xFFU, memory[address + 2U]);
+}
+
+TEST_F(FlashDriverTest, testWriteOnlyClearsBits)
+{
+    uint32_t const address = 2U * FlashDriver::SECTOR_SIZE;
+    EXPECT_EQ(IFlashDriver::FLASH_OP_SUCCESSFUL, _cut.erase(address, FlashDriver::SECTOR_SIZE));
+
+    uint8_t const first[]  = {0xF0};
+    uint8_t const second[] = {0x3C};
+    EXPECT_EQ(IFlashDriver::FLASH_OP_SUCCESSFUL, _cut.write(address, first, 1U));
+    EXPECT_EQ(IFlashDriver::FLASH_OP_SUCCESSFUL, _cut.write(address, second, 1U));
+
+    uint8_t readData[1] = {0};
+    EXPECT_EQ(IFlashDriver::FLASH_OP_SUCCESSFUL, _cut.read(address, readData, 1U));
+    EXPECT_EQ(0x30U, readData[0]);
+}
+
+TEST_F(FlashDriverTest, testEraseRequiresSectorAlignment)
+{
+    EXPECT_EQ(IFlashDriver::FLASH_OP_FAILED, _cut.erase(0x100U, FlashDriver::SECTOR_SIZE));
+    EXPECT_EQ(IFlashDriver::FLASH_OP_FAILED, _cut.erase(0U, 0x100U));
+    uint32_t const lastSector = FlashDriver::FLASH_SIZE - FlashDriver::SECTOR_SIZE;
+    EXPECT_EQ(
+        IFlashDriver::FLASH_OP_FAILED, _cut.erase(lastSector, 2U * FlashDriver::SECTOR_SIZE));
+}
+
+TEST_F(FlashDriverTest, testAccessBeyondSizeError)
+{
+    uint8_t data[4]        = {0};
+    uint32_t const address = FlashDriver::FLASH_SIZE - 2U;
+    EXPECT_EQ(IFlashDriver::FLASH_OP_FAILED, _cut.write(address, data, sizeof(data)));
+    EXPECT_EQ(IFlashDriver::FLASH_OP_FAILED, _cut.read(address, data, sizeof(data)));
+}
+
+TEST_F(FlashDriverTest, testNullpointerBuffer)
+{
+    EXPECT_EQ(IFlashDriver::FLASH_OP_FAILED, _cut.write(0U, nullptr, 4U));
+    EXPECT_EQ(IFlashDriver::FLASH_OP_FAILED, _cut.read(0U, nullptr, 4U));
+}
+
+} // namespace
@@ -0,0 +1,25 @@
+// Copyright 2025 Accenture.
+
+#include "interrupts/suspendResumeAllInterrupts.h"
+
+#include <async/CriticalSection.h>
+
+void main_thread_setup(void)
+{ /* Do nothing */
+}
+
+OldIntEnabledStatusValueType getOldIntEnabledStatusValueAndSuspendAllInterrupts(void)
+{
+    // There are no interrupts to suspend. Entering the critical section of the async locks makes
+    // the caller mutually exclusive with all other threads doing the same.
+    ::async::internal::CriticalSection::enter();
+    return static_cast<OldIntEnabledStatusValueType>(1);
+}
+
+void resumeAllInterrupts(OldIntEnabledStatusValueType const oldIntEnabledStatusValue)
+{
+    if (oldIntEnabledStatusValue != 0)
+    {
+        ::async::internal::CriticalSection::leave();
+    }
+}
@@ -0,0 +1,47 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <bsp/timer/IOneShotTimer.h>
+
+#include <thread>
+
+namespace bsp
+{
+/**
+ * IOneShotTimer based on a Linux timerfd. A thread waits for the timer and calls the listener,
+ * so the listener must not call into an RTOS simulation that doesn't know this thread. It is
+ * meant for the pthread adapter and for measuring wakeup latencies on the host.
+ */
+class OneShotTimer : public IOneShotTimer
+{
+public:
+    OneShotTimer();
+    ~OneShotTimer();
+
+    OneShotTimer(OneShotTimer const&)            = delete;
+    OneShotTimer& operator=(OneShotTimer const&) = delete;
+
+    /**
+     * Creates the timer and starts the thread calling the listener.
+     * \return true if the timer has been created
+     */
+    bool open();
+
+    /// Stops the thread and releases the timer.
+    void close();
+
+    void setListener(IOneShotTimerListener& listener) override;
+    void start(uint32_t timeUs) override;
+    void stop() override;
+
+private:
+    void run();
+
+    ::std::thread _thread;
+    IOneShotTimerListener* _listener;
+    int _timerFd;
+    int _stopFd;
+};
+
+} // namespace bsp
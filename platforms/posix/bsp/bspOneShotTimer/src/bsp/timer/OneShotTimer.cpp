@@ -0,0 +1,102 @@
+// Copyright 2025 Accenture.
+
+#include "bsp/timer/OneShotTimer.h"
+
+#include <bsp/timer/SystemTimer.h>
+
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+namespace bsp
+{
+OneShotTimer::OneShotTimer() : _thread(), _listener(nullptr), _timerFd(-1), _stopFd(-1) {}
+
+OneShotTimer::~OneShotTimer() { close(); }
+
+bool OneShotTimer::open()
+{
+    if (_timerFd >= 0)
+    {
+        return true;
+    }
+    _timerFd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+    _stopFd  = eventfd(0U, EFD_CLOEXEC);
+    if ((_timerFd < 0) || (_stopFd < 0))
+    {
+        close();
+        return false;
+    }
+    _thread = ::std::thread(&OneShotTimer::run, this);
+    return true;
+}
+
+void OneShotTimer::close()
+{
+    if (_thread.joinable())
+    {
+        uint64_t const value = 1U;
+        (void)::write(_stopFd, &value, sizeof(value));
+        _thread.join();
+    }
+    if (_timerFd >= 0)
+    {
+        (void)::close(_timerFd);
+        _timerFd = -1;
+    }
+    if (_stopFd >= 0)
+    {
+        (void)::close(_stopFd);
+        _stopFd = -1;
+    }
+}
+
+void OneShotTimer::setListener(IOneShotTimerListener& listener) { _listener = &listener; }
+
+void OneShotTimer::start(uint32_t const timeUs)
+{
+    int32_t const delayUs = static_cast<int32_t>(timeUs - getSystemTimeUs32Bit());
+    itimerspec spec       = {};
+    if (delayUs > 0)
+    {
+        spec.it_value.tv_sec  = static_cast<time_t>(delayUs / 1000000);
+        spec.it_value.tv_nsec = static_cast<long>(delayUs % 1000000) * 1000L;
+    }
+    else
+    {
+        // a zero value would disarm the timer
+        spec.it_value.tv_nsec = 1L;
+    }
+    (void)timerfd_settime(_timerFd, 0, &spec, nullptr);
+}
+
+void OneShotTimer::stop()
+{
+    itimerspec const spec = {};
+    (void)timerfd_settime(_timerFd, 0, &spec, nullptr);
+}
+
+void OneShotTimer::run()
+{
+    pollfd fds[2] = {{_timerFd, POLLIN, 0}, {_stopFd, POLLIN, 0}};
+    while (true)
+    {
+        if (::poll(fds, 2U, -1) < 0)
+        {
+            continue;
+        }
+        if ((fds[1].revents & POLLIN) != 0)
+        {
+            return;
+        }
+        uint64_t expirations = 0U;
+        if ((::read(_timerFd, &expirations, sizeof(expirations)) == sizeof(expirations))
+            && (_listener != nullptr))
+        {
+            _listener->expired();
+        }
+    }
+}
+
+} // namespace bsp
@@ -0,0 +1,160 @@
+// Copyright 2025 Accenture.
+
+#include "bsp/timer/OneShotTimer.h"
+
+#include <async/HighResolutionWakeup.h>
+#include <bsp/timer/SystemTimer.h>
+#include <etl/algorithm.h>
+#include <etl/vector.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+
+namespace
+{
+using namespace ::testing;
+
+::std::mutex lockMutex;
+
+struct TestLock
+{
+    TestLock() { lockMutex.lock(); }
+
+    ~TestLock() { lockMutex.unlock(); }
+};
+
+size_t const SAMPLE_COUNT = 50U;
+// half of the RTOS tick of a millisecond
+int32_t const MAX_MEDIAN_LATENESS_US = 500;
+
+class OneShotTimerTest
+: public Test
+, public ::bsp::IOneShotTimerListener
+{
+public:
+    void SetUp() override { ASSERT_TRUE(_timer.open()); }
+
+    void TearDown() override { _timer.close(); }
+
+    void expired() override { record(0U); }
+
+    void record(::async::ContextType const context)
+    {
+        uint32_t const nowUs = getSystemTimeUs32Bit();
+        ::std::lock_guard<::std::mutex> const lock(_mutex);
+        _context   = context;
+        _timeUs    = nowUs;
+        _isExpired = true;
+        _condition.notify_one();
+    }
+
+    bool waitExpired(uint32_t const timeoutMs)
+    {
+        ::std::unique_lock<::std::mutex> lock(_mutex);
+        bool const result = _condition.wait_for(
+            lock, ::std::chrono::milliseconds(timeoutMs), [this] { return _isExpired; });
+        _isExpired = false;
+        return result;
+    }
+
+protected:
+    ::bsp::OneShotTimer _timer;
+    ::std::mutex _mutex;
+    ::std::condition_variable _condition;
+    ::async::ContextType _context = ::async::CONTEXT_INVALID;
+    uint32_t _timeUs              = 0U;
+    bool _isExpired               = false;
+};
+
+/**
+ * \desc
+ * The timer calls the listener once after the programmed time.
+ */
+TEST_F(OneShotTimerTest, testExpiresOnceAtProgrammedTime)
+{
+    _timer.setListener(*this);
+    uint32_t const timeUs = getSystemTimeUs32Bit() + 1000U;
+    _timer.start(timeUs);
+    ASSERT_TRUE(waitExpired(100U));
+    EXPECT_GE(static_cast<int32_t>(_timeUs - timeUs), 0);
+    EXPECT_FALSE(waitExpired(10U));
+}
+
+/**
+ * \desc
+ * A time that has already passed expires immediately.
+ */
+TEST_F(OneShotTimerTest, testPassedTimeExpiresImmediately)
+{
+    _timer.setListener(*this);
+    _timer.start(getSystemTimeUs32Bit() - 100U);
+    EXPECT_TRUE(waitExpired(100U));
+}
+
+/**
+ * \desc
+ * Starting the timer again replaces the programmed time, stopping it cancels the expiry.
+ */
+TEST_F(OneShotTimerTest, testStartReplacesAndStopCancelsExpiry)
+{
+    _timer.setListener(*this);
+    _timer.start(getSystemTimeUs32Bit() + 1000000U);
+    uint32_t const timeUs = getSystemTimeUs32Bit() + 1000U;
+    _timer.start(timeUs);
+    ASSERT_TRUE(waitExpired(100U));
+    EXPECT_LT(_timeUs - timeUs, 500000U);
+
+    _timer.start(getSystemTimeUs32Bit() + 20000U);
+    _timer.stop();
+    EXPECT_FALSE(waitExpired(50U));
+}
+
+/**
+ * \desc
+ * Measures the lateness of wakeups of a HighResolutionWakeup driven by the timer. No context is
+ * woken up early and the median lateness stays below half an RTOS tick of a millisecond. Each
+ * wakeup is requested right after the previous one, so a wakeup falling back to the tick would
+ * happen at the next tick after the delay, which is at least 500us late for all delays measured.
+ * The test is timing-sensitive and runs serially.
+ */
+TEST_F(OneShotTimerTest, testHighResolutionWakeupLatency)
+{
+    ::async::declare::HighResolutionWakeup<2U, TestLock> wakeup(
+        _timer,
+        ::async::HighResolutionWakeup<TestLock>::WakeupFunctionType::
+            create<OneShotTimerTest, &OneShotTimerTest::record>(*this));
+
+    for (uint32_t const delayUs : {100U, 250U, 500U, 1500U})
+    {
+        ::etl::vector<int32_t, SAMPLE_COUNT> latenciesUs;
+        for (size_t idx = 0U; idx < SAMPLE_COUNT; ++idx)
+        {
+            uint32_t const timeUs = getSystemTimeUs32Bit() + delayUs;
+            wakeup.setWakeup(1U, timeUs);
+            ASSERT_TRUE(waitExpired(100U));
+            EXPECT_EQ(1U, _context);
+            latenciesUs.push_back(static_cast<int32_t>(_timeUs - timeUs));
+        }
+        ::etl::sort(latenciesUs.begin(), latenciesUs.end());
+        int64_t sumUs = 0;
+        for (int32_t const latencyUs : latenciesUs)
+        {
+            sumUs += latencyUs;
+        }
+        int32_t const medianUs = latenciesUs[SAMPLE_COUNT / 2U];
+        (void)printf(
+            "delay %4uus: lateness median %dus, mean %dus, max %dus\n",
+            static_cast<unsigned>(delayUs),
+            static_cast<int>(medianUs),
+            static_cast<int>(sumUs / static_cast<int64_t>(SAMPLE_COUNT)),
+            static_cast<int>(latenciesUs.back()));
+        EXPECT_GE(latenciesUs.front(), 0);
+        EXPECT_LT(medianUs, MAX_MEDIAN_LATENESS_US);
+    }
+}
+
+} // namespace
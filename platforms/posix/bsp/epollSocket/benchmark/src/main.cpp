@@ -0,0 +1,188 @@
+// Copyright 2025 Accenture.
+
+#include <benchmark/benchmark.h>
+#include <epollSocket/EpollLoop.h>
+#include <epollSocket/tcp/EpollServerSocket.h>
+#include <epollSocket/tcp/EpollSocket.h>
+#include <epollSocket/udp/EpollDatagramSocket.h>
+#include <tcp/util/TcpIperf2Server.h>
+#include <udp/DatagramPacket.h>
+#include <udp/IDataListener.h>
+#include <udp/util/UdpIperf2Server.h>
+
+/**
+ * Throughput and latency benchmarks of the epoll sockets with the iperf2 servers of cpp2ethernet
+ * on the loopback interface.
+ *
+ * The same servers are run by the reference application on top of lwip and the TAP driver, so
+ * the results can be compared with an iperf2 client against the TAP interface:
+ *
+ *   iperf -c 192.168.0.201 -p 5001 -l 1024
+ *   iperf -c 192.168.0.201 -p 5001 -u -l 1024
+ */
+
+namespace
+{
+uint16_t const TCP_PORT       = 5001U;
+uint16_t const UDP_PORT       = 5002U;
+uint16_t const UDP_REPLY_PORT = 5003U;
+
+::ip::IPAddress const LOCALHOST = ::ip::make_ip4(127U, 0U, 0U, 1U);
+
+int const POLL_TIMEOUT_MS = 10;
+
+uint8_t payload[::udp::EpollDatagramSocket::MAX_DATAGRAM_LENGTH] = {};
+
+void setSequenceNumber(int32_t const sequenceNo)
+{
+    uint32_t const value = static_cast<uint32_t>(sequenceNo);
+    payload[0]           = static_cast<uint8_t>(value >> 24U);
+    payload[1]           = static_cast<uint8_t>(value >> 16U);
+    payload[2]           = static_cast<uint8_t>(value >> 8U);
+    payload[3]           = static_cast<uint8_t>(value);
+}
+
+class ConnectResult
+{
+public:
+    ConnectResult() : _result(::tcp::AbstractSocket::ErrorCode::SOCKET_ERR_NOT_OPEN) {}
+
+    void connected(::tcp::AbstractSocket::ErrorCode const result) { _result = result; }
+
+    bool isConnected() const { return _result == ::tcp::AbstractSocket::ErrorCode::SOCKET_ERR_OK; }
+
+private:
+    ::tcp::AbstractSocket::ErrorCode _result;
+};
+
+class ReplyListener : public ::udp::IDataListener
+{
+public:
+    ReplyListener() : _replyCount(0U) {}
+
+    void dataReceived(
+        ::udp::AbstractDatagramSocket& socket,
+        ::ip::IPAddress /* sourceAddress */,
+        uint16_t /* sourcePort */,
+        ::ip::IPAddress /* destinationAddress */,
+        uint16_t length) override
+    {
+        (void)socket.read(nullptr, length);
+        ++_replyCount;
+    }
+
+    uint32_t getReplyCount() const { return _replyCount; }
+
+private:
+    uint32_t _replyCount;
+};
+
+/**
+ * Sends state.range(0) bytes per send() from an EpollSocket to a TcpIperf2Server and waits until
+ * the data has been accepted by the kernel.
+ */
+void BM_tcpThroughput(benchmark::State& state)
+{
+    ::ethernet::EpollLoop loop;
+    ::tcp::EpollSocket serverConnection(loop);
+    ::tcp::TcpIperf2Server server(serverConnection);
+    ::tcp::EpollServerSocket serverSocket(loop, TCP_PORT, server);
+    ::tcp::EpollSocket client(loop);
+    ConnectResult connectResult;
+    (void)serverSocket.accept();
+    (void)client.connect(
+        LOCALHOST,
+        TCP_PORT,
+        ::tcp::AbstractSocket::ConnectedDelegate::create<ConnectResult, &ConnectResult::connected>(
+            connectResult));
+    while (!(connectResult.isConnected() && serverConnection.isEstablished()))
+    {
+        (void)loop.poll(POLL_TIMEOUT_MS);
+    }
+
+    ::etl::span<uint8_t const> const data(&payload[0], static_cast<size_t>(state.range(0)));
+    int64_t sentBytes = 0;
+    while (state.KeepRunning())
+    {
+        while (client.send(data) != ::tcp::AbstractSocket::ErrorCode::SOCKET_ERR_OK)
+        {
+            (void)loop.poll(POLL_TIMEOUT_MS);
+        }
+        sentBytes += static_cast<int64_t>(data.size());
+        (void)loop.poll(0);
+    }
+    state.SetBytesProcessed(sentBytes);
+
+    (void)client.close();
+    serverSocket.close();
+}
+
+/**
+ * Sends datagrams of state.range(0) bytes with increasing iperf2 sequence numbers to an
+ * UdpIperf2Server.
+ */
+void BM_udpThroughput(benchmark::State& state)
+{
+    ::ethernet::EpollLoop loop;
+    ::udp::EpollDatagramSocket serverSocket(loop);
+    ::udp::UdpIperf2Server server(LOCALHOST, UDP_PORT, serverSocket);
+    ::udp::EpollDatagramSocket client(loop);
+    (void)server.start();
+    (void)client.connect(LOCALHOST, UDP_PORT, nullptr);
+
+    ::etl::span<uint8_t const> const data(&payload[0], static_cast<size_t>(state.range(0)));
+    int32_t sequenceNo = 0;
+    int64_t sentBytes  = 0;
+    while (state.KeepRunning())
+    {
+        ++sequenceNo;
+        setSequenceNumber(sequenceNo);
+        if (client.send(data) == ::udp::AbstractDatagramSocket::ErrorCode::UDP_SOCKET_OK)
+        {
+            sentBytes += static_cast<int64_t>(data.size());
+        }
+        (void)loop.poll(0);
+    }
+    state.SetBytesProcessed(sentBytes);
+
+    client.close();
+    server.stop();
+}
+
+/**
+ * Measures the round trip of a final iperf2 datagram, which is answered by the UdpIperf2Server
+ * with a server report.
+ */
+void BM_udpRoundTrip(benchmark::State& state)
+{
+    ::ethernet::EpollLoop loop;
+    ::udp::EpollDatagramSocket serverSocket(loop);
+    ::udp::UdpIperf2Server server(LOCALHOST, UDP_PORT, serverSocket);
+    ::udp::EpollDatagramSocket client(loop);
+    ReplyListener replyListener;
+    (void)server.start();
+    client.setDataListener(&replyListener);
+    (void)client.bind(&LOCALHOST, UDP_REPLY_PORT);
+
+    setSequenceNumber(-1);
+    ::udp::DatagramPacket const packet(
+        &payload[0], static_cast<uint16_t>(state.range(0)), LOCALHOST, UDP_PORT);
+    uint32_t expectedReplyCount = 0U;
+    while (state.KeepRunning())
+    {
+        ++expectedReplyCount;
+        (void)client.send(packet);
+        while (replyListener.getReplyCount() < expectedReplyCount)
+        {
+            (void)loop.poll(POLL_TIMEOUT_MS);
+        }
+    }
+
+    client.close();
+    server.stop();
+}
+} // namespace
+
+BENCHMARK(BM_tcpThroughput)->RangeMultiplier(4)->Range(64, 1024);
+BENCHMARK(BM_udpThroughput)->RangeMultiplier(4)->Range(64, 1024);
+BENCHMARK(BM_udpRoundTrip)->Arg(64);
@@ -0,0 +1,103 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <async/Types.h>
+
+#include <platform/estdint.h>
+
+#include <sys/epoll.h>
+
+namespace ethernet
+{
+/**
+ * Single epoll instance dispatching the readiness events of non-blocking Linux sockets to their
+ * handlers. The loop is meant to be executed periodically in the context of the ethernet task, so
+ * that all socket callbacks are called in this context.
+ *
+ * All methods have to be called in the same context the loop is executed in.
+ */
+class EpollLoop : public ::async::RunnableType
+{
+public:
+    /**
+     * Interface for objects owning file descriptors registered at the loop.
+     */
+    class IEventHandler
+    {
+    public:
+        IEventHandler(IEventHandler const&)            = delete;
+        IEventHandler& operator=(IEventHandler const&) = delete;
+
+        /**
+         * Called for each file descriptor registered with this handler that is ready.
+         * \param events epoll event mask (EPOLLIN, EPOLLOUT, ...)
+         */
+        virtual void handleEvents(uint32_t events) = 0;
+
+    protected:
+        IEventHandler() = default;
+    };
+
+    /// Maximum number of events dispatched by a single call to poll().
+    static constexpr size_t MAX_EVENT_COUNT = 32U;
+
+    EpollLoop();
+    ~EpollLoop();
+
+    EpollLoop(EpollLoop const&)            = delete;
+    EpollLoop& operator=(EpollLoop const&) = delete;
+
+    /**
+     * Creates the epoll instance. Called implicitly when the first file descriptor is added.
+     * \return true if the epoll instance is available
+     */
+    bool open();
+
+    /**
+     * Closes the epoll instance. The registered file descriptors are not closed.
+     */
+    void close();
+
+    bool isOpen() const { return _epollFd >= 0; }
+
+    /**
+     * Registers a file descriptor.
+     * \param fd file descriptor to watch
+     * \param events epoll event mask to watch for
+     * \param handler handler to call if the file descriptor is ready
+     * \return true if the file descriptor has been added
+     */
+    bool add(int fd, uint32_t events, IEventHandler& handler);
+
+    /**
+     * Changes the event mask of a registered file descriptor.
+     */
+    bool modify(int fd, uint32_t events, IEventHandler& handler);
+
+    /**
+     * Unregisters a file descriptor. Events of the handler that have already been fetched but
+     * not yet dispatched are dropped, so it is safe to call this from within an event handler.
+     */
+    void remove(int fd, IEventHandler& handler);
+
+    /**
+     * Waits for ready file descriptors and calls their handlers.
+     * \param timeoutMs maximum time to wait, 0 to return immediately
+     * \return number of dispatched events
+     */
+    size_t poll(int timeoutMs);
+
+    /**
+     * Dispatches the pending events without waiting.
+     */
+    void execute() override;
+
+private:
+    epoll_event _events[MAX_EVENT_COUNT];
+    size_t _dispatchIndex;
+    size_t _dispatchCount;
+    int _epollFd;
+};
+
+} // namespace ethernet
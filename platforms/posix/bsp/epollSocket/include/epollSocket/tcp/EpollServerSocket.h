@@ -0,0 +1,80 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "epollSocket/EpollLoop.h"
+
+#include <ip/IPAddress.h>
+#include <tcp/socket/AbstractServerSocket.h>
+
+#include <platform/estdint.h>
+
+#include <sys/socket.h>
+
+namespace tcp
+{
+/**
+ * Implementation of AbstractServerSocket on top of a non-blocking Linux TCP socket.
+ *
+ * Incoming connections are accepted in the context the EpollLoop is executed in and handed over
+ * to the EpollSocket provided by the ISocketProvidingConnectionListener. A connection is closed
+ * immediately if no socket is provided.
+ *
+ * \see AbstractServerSocket
+ */
+class EpollServerSocket
+: public AbstractServerSocket
+, private ::ethernet::EpollLoop::IEventHandler
+{
+public:
+    /// Maximum number of pending connections that have not been accepted yet.
+    static constexpr int LISTEN_BACKLOG = 4;
+
+    explicit EpollServerSocket(::ethernet::EpollLoop& loop);
+
+    /**
+     * constructor
+     * \param loop    loop the listening socket is registered at
+     * \param port    the port to open
+     * \param providingListener   ISocketProvidingConnectionListener attached
+     *          to this EpollServerSocket
+     */
+    EpollServerSocket(
+        ::ethernet::EpollLoop& loop,
+        uint16_t port,
+        ISocketProvidingConnectionListener& providingListener);
+
+    virtual ~EpollServerSocket();
+
+    EpollServerSocket(EpollServerSocket const&)            = delete;
+    EpollServerSocket& operator=(EpollServerSocket const&) = delete;
+
+    /**
+     * \see AbstractServerSocket::accept()
+     */
+    bool accept() override;
+
+    /**
+     * \see AbstractServerSocket::bind()
+     */
+    bool bind(ip::IPAddress const& localIpAddress, uint16_t port) override;
+
+    /**
+     * \see AbstractServerSocket::close()
+     */
+    void close() override;
+
+    bool isClosed() const override;
+
+private:
+    void handleEvents(uint32_t events) override;
+
+    void acceptConnection(int fd, sockaddr_storage const& remoteAddr);
+
+    ::ethernet::EpollLoop& _loop;
+    int _fd;
+    bool _isBound;
+    bool _isListening;
+};
+
+} // namespace tcp
@@ -0,0 +1,134 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "epollSocket/EpollLoop.h"
+
+#include <etl/span.h>
+#include <ip/IPEndpoint.h>
+#include <tcp/IDataListener.h>
+#include <tcp/IDataSendNotificationListener.h>
+#include <tcp/socket/AbstractSocket.h>
+
+#include <platform/estdint.h>
+
+namespace tcp
+{
+/**
+ * Socket implementation on top of a non-blocking Linux TCP socket.
+ *
+ * The socket registers its file descriptor at an EpollLoop and calls the IDataListener and
+ * IDataSendNotificationListener callbacks from the context the loop is executed in:
+ * - dataReceived() is called with the number of unread bytes whenever new data has arrived.
+ * - dataSent() is called with DATA_QUEUED for bytes taken over by the kernel and with DATA_SENT
+ *   for bytes acknowledged by the peer.
+ * - connectionClosed() is called if the peer closes or resets the connection.
+ *
+ * \see AbstractSocket
+ */
+class EpollSocket
+: public AbstractSocket
+, private ::ethernet::EpollLoop::IEventHandler
+{
+public:
+    explicit EpollSocket(::ethernet::EpollLoop& loop);
+
+    virtual ~EpollSocket();
+
+    EpollSocket(EpollSocket const&)            = delete;
+    EpollSocket& operator=(EpollSocket const&) = delete;
+
+    /**
+     * Takes over an established connection, e.g. an accepted one.
+     * \param fd non-blocking file descriptor of the connection
+     */
+    void open(int fd);
+
+    // AbstractSocket
+    ErrorCode
+    connect(ip::IPAddress const& ipAddr, uint16_t port, ConnectedDelegate delegate) override;
+
+    ErrorCode close() override;
+
+    void abort() override;
+
+    ErrorCode flush() override;
+
+    uint8_t read(uint8_t& byte) override;
+
+    size_t read(uint8_t* buffer, size_t n) override;
+
+    void discardData() override;
+
+    ErrorCode send(::etl::span<uint8_t const> const& data) override;
+
+    size_t available() override;
+
+    bool isClosed() const override;
+
+    bool isEstablished() const override;
+
+    ErrorCode bind(ip::IPAddress const& ipAddr, uint16_t port) override;
+
+    ip::IPAddress getRemoteIPAddress() const override;
+
+    ip::IPAddress getLocalIPAddress() const override;
+
+    uint16_t getRemotePort() const override;
+
+    uint16_t getLocalPort() const override;
+
+    void disableNagleAlgorithm() override;
+
+    void enableKeepAlive(uint32_t idle, uint32_t interval, uint32_t probes) override;
+
+    void disableKeepAlive() override;
+
+private:
+    enum class State : uint8_t
+    {
+        CLOSED,
+        CONNECTING,
+        ESTABLISHED
+    };
+
+    static constexpr uint32_t KEEPALIVE_IDLE_DEFAULT     = 7200000U;
+    static constexpr uint32_t KEEPALIVE_INTERVAL_DEFAULT = 75000U;
+    static constexpr uint32_t KEEPALIVE_PROBES_DEFAULT   = 9U;
+
+    void handleEvents(uint32_t events) override;
+
+    void connectCallback();
+
+    void receiveCallback(uint32_t events);
+
+    void errorCallback(IDataListener::ErrorCode error);
+
+    void sendPendingData();
+
+    void notifyAcknowledgedData();
+
+    void notifyDataSent(size_t length, IDataSendNotificationListener::SendResult result);
+
+    void updateEvents();
+
+    void setKeepAlive();
+
+    void resetSocket();
+
+    ::ethernet::EpollLoop& _loop;
+    ::ip::IPEndpoint _bindEndpoint;
+    ::etl::span<uint8_t const> _pendingData;
+    ConnectedDelegate _delegate;
+    size_t _notifiedLength;
+    size_t _unacknowledgedLength;
+    uint32_t _events;
+    uint32_t _keepAliveIdle;
+    uint32_t _keepAliveInterval;
+    uint32_t _keepAliveProbes;
+    int _fd;
+    State _state;
+    bool _keepAliveEnabled;
+};
+
+} // namespace tcp
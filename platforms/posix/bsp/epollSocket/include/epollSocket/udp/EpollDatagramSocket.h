@@ -0,0 +1,137 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include "epollSocket/EpollLoop.h"
+
+#include <etl/span.h>
+#include <etl/vector.h>
+#include <ip/IPAddress.h>
+#include <udp/socket/AbstractDatagramSocket.h>
+
+#include <platform/estdint.h>
+
+namespace udp
+{
+/**
+ * Implementation of AbstractDatagramSocket on top of non-blocking Linux UDP sockets.
+ *
+ * Datagrams are received in the context the EpollLoop is executed in. Each datagram is passed to
+ * IDataListener::dataReceived() separately and can be read from within the callback, the unread
+ * rest is dropped afterwards. Datagrams longer than MAX_DATAGRAM_LENGTH are dropped.
+ *
+ * \see AbstractDatagramSocket
+ */
+class EpollDatagramSocket
+: public AbstractDatagramSocket
+, private ::ethernet::EpollLoop::IEventHandler
+{
+public:
+    /// Maximum length of a received datagram, i.e. the ethernet MTU.
+    static constexpr size_t MAX_DATAGRAM_LENGTH = 1500U;
+
+    /// Maximum number of datagrams received per socket and loop execution.
+    static constexpr size_t MAX_DATAGRAMS_PER_EVENT = 16U;
+
+    explicit EpollDatagramSocket(::ethernet::EpollLoop& loop);
+
+    virtual ~EpollDatagramSocket();
+
+    /**
+     * \see AbstractDatagramSocket::bind();
+     */
+    ErrorCode bind(ip::IPAddress const* pIpAddress, uint16_t port) override;
+
+    /**
+     * \see AbstractDatagramSocket::join();
+     */
+    ErrorCode join(ip::IPAddress const& groupAddr) override;
+
+    /**
+     * \see AbstractDatagramSocket::isBound();
+     */
+    bool isBound() const override;
+
+    /**
+     * \see AbstractDatagramSocket::close();
+     */
+    void close() override;
+
+    /**
+     * \see AbstractDatagramSocket::isClosed();
+     */
+    bool isClosed() const override;
+
+    /**
+     * \see AbstractDatagramSocket::connect();
+     */
+    ErrorCode
+    connect(ip::IPAddress const& address, uint16_t port, ip::IPAddress* pLocalAddress) override;
+
+    /**
+     * \see AbstractDatagramSocket::disconnect();
+     */
+    void disconnect() override;
+
+    /**
+     * \see AbstractDatagramSocket::isConnected();
+     */
+    bool isConnected() const override;
+
+    /**
+     * \see AbstractDatagramSocket::read();
+     */
+    size_t read(uint8_t* buffer, size_t n) override;
+
+    /**
+     * \see AbstractDatagramSocket::send();
+     */
+    ErrorCode send(::etl::span<uint8_t const> const& data) override;
+
+    /**
+     * \see AbstractDatagramSocket::send();
+     */
+    ErrorCode send(DatagramPacket const& packet) override;
+
+    /**
+     * \see AbstractDatagramSocket::getIPAddress();
+     */
+    ip::IPAddress const* getIPAddress() const override;
+
+    /**
+     * \see AbstractDatagramSocket::getLocalIPAddress();
+     */
+    ip::IPAddress const* getLocalIPAddress() const override;
+
+    /**
+     * \see AbstractDatagramSocket::getPort();
+     */
+    uint16_t getPort() const override;
+
+    /**
+     * \see AbstractDatagramSocket::getLocalPort();
+     */
+    uint16_t getLocalPort() const override;
+
+private:
+    static uint8_t const NUM_MULTICAST_GROUPS = 3U;
+
+    void handleEvents(uint32_t events) override;
+
+    void receiveDatagrams(int fd);
+
+    bool isAlreadyJoined(ip::IPAddress const& groupAddr) const;
+
+    ::ethernet::EpollLoop& _loop;
+    ::etl::vector<ip::IPAddress, NUM_MULTICAST_GROUPS> _multicastGroups;
+    ip::IPAddress _remoteAddress;
+    ip::IPAddress _localAddress;
+    size_t _rxLength;
+    size_t _rxOffset;
+    int _rxFd;
+    int _txFd;
+    uint16_t _remotePort;
+    uint8_t _rxBuffer[MAX_DATAGRAM_LENGTH];
+};
+
+} // namespace udp
@@ -0,0 +1,33 @@
+// Copyright 2025 Accenture.
+
+#pragma once
+
+#include <ip/IPAddress.h>
+#include <ip/IPEndpoint.h>
+
+#include <platform/estdint.h>
+
+#include <sys/socket.h>
+
+namespace epollutils
+{
+/**
+ * Fills a socket address from an IP address and a port. An unspecified address is converted to
+ * the IPv4 wildcard address.
+ * \return length of the filled socket address, 0 if the address family is not supported
+ */
+socklen_t toSockAddr(::ip::IPAddress const& ipAddr, uint16_t port, sockaddr_storage& sockAddr);
+
+/**
+ * Returns the address family of the socket to be used for an IP address.
+ */
+int addressFamilyOf(::ip::IPAddress const& ipAddr);
+
+::ip::IPEndpoint fromSockAddr(sockaddr_storage const& sockAddr);
+
+/**
+ * Returns the local (or remote if \p remote is set) endpoint of a socket.
+ */
+::ip::IPEndpoint getEndpoint(int fd, bool remote);
+
+} // namespace epollutils
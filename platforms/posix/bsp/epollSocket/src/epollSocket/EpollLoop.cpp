@@ -0,0 +1,119 @@
+// Copyright 2025 Accenture.
+
+#include "epollSocket/EpollLoop.h"
+
+#include <ethernet/EthernetLogger.h>
+
+#include <cerrno>
+#include <unistd.h>
+
+namespace ethernet
+{
+namespace logger = ::util::logger;
+
+// needed if ODR-used
+constexpr size_t EpollLoop::MAX_EVENT_COUNT;
+
+EpollLoop::EpollLoop() : _events(), _dispatchIndex(0U), _dispatchCount(0U), _epollFd(-1) {}
+
+EpollLoop::~EpollLoop() { close(); }
+
+bool EpollLoop::open()
+{
+    if (_epollFd < 0)
+    {
+        _epollFd = ::epoll_create1(EPOLL_CLOEXEC);
+        if (_epollFd < 0)
+        {
+            logger::Logger::error(
+                logger::ETHERNET, "EpollLoop::open(): epoll_create1() failed (errno %d)", errno);
+            return false;
+        }
+    }
+    return true;
+}
+
+void EpollLoop::close()
+{
+    if (_epollFd >= 0)
+    {
+        (void)::close(_epollFd);
+        _epollFd       = -1;
+        _dispatchIndex = 0U;
+        _dispatchCount = 0U;
+    }
+}
+
+bool EpollLoop::add(int const fd, uint32_t const events, IEventHandler& handler)
+{
+    if (!open())
+    {
+        return false;
+    }
+    epoll_event event{};
+    event.events   = events;
+    event.data.ptr = &handler;
+    if (::epoll_ctl(_epollFd, EPOLL_CTL_ADD, fd, &event) != 0)
+    {
+        logger::Logger::error(
+            logger::ETHERNET, "EpollLoop::add(%d): epoll_ctl() failed (errno %d)", fd, errno);
+        return false;
+    }
+    return true;
+}
+
+bool EpollLoop::modify(int const fd, uint32_t const events, IEventHandler& handler)
+{
+    epoll_event event{};
+    event.events   = events;
+    event.data.ptr = &handler;
+    return (_epollFd >= 0) && (::epoll_ctl(_epollFd, EPOLL_CTL_MOD, fd, &event) == 0);
+}
+
+void EpollLoop::remove(int const fd, IEventHandler& handler)
+{
+    if (_epollFd >= 0)
+    {
+        (void)::epoll_ctl(_epollFd, EPOLL_CTL_DEL, fd, nullptr);
+    }
+    for (size_t i = _dispatchIndex; i < _dispatchCount; ++i)
+    {
+        if (_events[i].data.ptr == &handler)
+        {
+            _events[i].data.ptr = nullptr;
+        }
+    }
+}
+
+size_t EpollLoop::poll(int const timeoutMs)
+{
+    if (_epollFd < 0)
+    {
+        return 0U;
+    }
+    int const count
+        = ::epoll_wait(_epollFd, &_events[0], static_cast<int>(MAX_EVENT_COUNT), timeoutMs);
+    if (count <= 0)
+    {
+        return 0U;
+    }
+    _dispatchCount    = static_cast<size_t>(count);
+    size_t dispatched = 0U;
+    for (_dispatchIndex = 0U; _dispatchIndex < _dispatchCount; ++_dispatchIndex)
+    {
+        IEventHandler* const handler
+            = static_cast<IEventHandler*>(_events[_dispatchIndex].data.ptr);
+        if (handler != nullptr)
+        {
+            handler->handleEvents(_events[_dispatchIndex].events);
+            ++dispatched;
+        }
+    }
+    _dispatchIndex = 0U;
+    _dispatchCount = 0U;
+    return dispatched;
+}
+
+void EpollLoop::execute() { (void)poll(0); }
+
+} // namespace ethernet
@@ -0,0 +1,175 @@
+// Copyright 2025 Accenture.
+
+#include "epollSocket/tcp/EpollServerSocket.h"
+
+#include "epollSocket/tcp/EpollSocket.h"
+#include "epollSocket/utils/SocketAddress.h"
+
+#include <ip/IPAddress.h>
+#include <tcp/TcpLogger.h>
+#include <tcp/socket/ISocketProvidingConnectionListener.h>
+
+#include <etl/error_handler.h>
+
+#include <cerrno>
+#include <unistd.h>
+
+using ip::IPAddress;
+
+namespace tcp
+{
+namespace logger = ::util::logger;
+
+// needed if ODR-used
+constexpr int EpollServerSocket::LISTEN_BACKLOG;
+
+EpollServerSocket::EpollServerSocket(::ethernet::EpollLoop& loop)
+: AbstractServerSocket()
+, IEventHandler()
+, _loop(loop)
+, _fd(-1)
+, _isBound(false)
+, _isListening(false)
+{}
+
+EpollServerSocket::EpollServerSocket(
+    ::ethernet::EpollLoop& loop,
+    uint16_t const port,
+    ISocketProvidingConnectionListener& providingListener)
+: AbstractServerSocket(port, providingListener)
+, IEventHandler()
+, _loop(loop)
+, _fd(-1)
+, _isBound(false)
+, _isListening(false)
+{}
+
+EpollServerSocket::~EpollServerSocket() { close(); }
+
+bool EpollServerSocket::accept()
+{
+    if ((_port == 0) || (_socketProvidingConnectionListener == nullptr) || _isListening)
+    {
+        return false;
+    }
+
+    if ((!_isBound) && (!bind(IPAddress(), _port)))
+    {
+        return false;
+    }
+    if (::listen(_fd, LISTEN_BACKLOG) != 0)
+    {
+        logger::Logger::error(logger::TCP, "EpollServerSocket::accept(): listen() failed");
+        close();
+        return false;
+    }
+    if (!_loop.add(_fd, EPOLLIN, *this))
+    {
+        close();
+        return false;
+    }
+    _isListening = true;
+    logger::Logger::info(logger::TCP, "Socket prepared at port %d", _port);
+    return true;
+}
+
+bool EpollServerSocket::bind(IPAddress const& localIpAddress, uint16_t const port)
+{
+    _port = port;
+    if ((_port == 0) || (_socketProvidingConnectionListener == nullptr) || _isListening)
+    {
+        return false;
+    }
+    if (_fd < 0)
+    {
+        _fd = ::socket(
+            epollutils::addressFamilyOf(localIpAddress),
+            SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC,
+            0);
+        if (_fd < 0)
+        {
+            logger::Logger::error(logger::TCP, "EpollServerSocket::bind(): socket() failed");
+            return false;
+        }
+    }
+    int const reuseAddress = 1;
+    (void)::setsockopt(_fd, SOL_SOCKET, SO_REUSEADDR, &reuseAddress, sizeof(reuseAddress));
+
+    sockaddr_storage localAddr{};
+    socklen_t const length = epollutils::toSockAddr(localIpAddress, _port, localAddr);
+    if ((length == 0U) || (::bind(_fd, reinterpret_cast<sockaddr*>(&localAddr), length) != 0))
+    {
+        logger::Logger::error(logger::TCP, "EpollServerSocket::bind(): bind() failed");
+        // Do not close the socket here - bind can be retried in accept function
+        return false;
+    }
+    _isBound = true;
+    return true;
+}
+
+void EpollServerSocket::close()
+{
+    if (_fd >= 0)
+    {
+        logger::Logger::info(logger::TCP, "Socket at port %d closed", _port);
+        _loop.remove(_fd, *this);
+        (void)::close(_fd);
+        _fd = -1;
+    }
+    _isBound     = false;
+    _isListening = false;
+}
+
+bool EpollServerSocket::isClosed() const { return (_fd < 0); }
+
+void EpollServerSocket::handleEvents(uint32_t const /* events */)
+{
+    // accept all pending connections, the callbacks may close this socket
+    while (_isListening)
+    {
+        sockaddr_storage remoteAddr{};
+        socklen_t length = sizeof(remoteAddr);
+        int const fd     = ::accept4(
+            _fd, reinterpret_cast<sockaddr*>(&remoteAddr), &length, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0)
+        {
+            if ((errno != EAGAIN) && (errno != EWOULDBLOCK))
+            {
+                logger::Logger::error(
+                    logger::TCP, "EpollServerSocket: accept4() failed with errno: %d", errno);
+            }
+            break;
+        }
+        acceptConnection(fd, remoteAddr);
+    }
+}
+
+void EpollServerSocket::acceptConnection(int const fd, sockaddr_storage const& remoteAddr)
+{
+    ETL_ASSERT(
+        _socketProvidingConnectionListener != nullptr,
+        ETL_ERROR_GENERIC("listener must not be null"));
+
+    ::ip::IPEndpoint const remote = epollutils::fromSockAddr(remoteAddr);
+
+    EpollSocket* const pSocket = static_cast<EpollSocket*>(
+        _socketProvidingConnectionListener->getSocket(remote.getAddress(), remote.getPort()));
+    if ((pSocket == nullptr) || (!pSocket->isClosed()))
+    {
+        logger::Logger::debug(
+            logger::TCP,
+            "EpollServerSocket::acceptConnection(): SocketProvidingConnectionListener provided no "
+            "socket");
+        (void)::close(fd);
+        return;
+    }
+    logger::Logger::debug(logger::TCP, "EpollServerSocket: accepted connection at port %d", _port);
+
+    pSocket->open(fd);
+    if (!pSocket->isClosed())
+    {
+        _socketProvidingConnectionListener->connectionAccepted(*pSocket);
+    }
+}
+
+} /*namespace tcp*/
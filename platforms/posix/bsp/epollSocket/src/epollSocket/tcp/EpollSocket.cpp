@@ -0,0 +1,597 @@
+// Copyright 2025 Accenture.
+
+#include "epollSocket/tcp/EpollSocket.h"
+
+#include "epollSocket/utils/SocketAddress.h"
+
+#include <etl/algorithm.h>
+#include <ip/to_str.h>
+#include <tcp/IDataListener.h>
+#include <tcp/IDataSendNotificationListener.h>
+#include <tcp/TcpLogger.h>
+
+#include <linux/sockios.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+
+#include <cerrno>
+#include <unistd.h>
+
+namespace tcp
+{
+namespace logger = ::util::logger;
+
+using ::ip::IPAddress;
+using ::ip::IPEndpoint;
+
+namespace
+{
+uint32_t const RECEIVE_EVENTS = EPOLLIN | EPOLLRDHUP;
+
+size_t getReceiveQueueLength(int const fd)
+{
+    int length = 0;
+    return (::ioctl(fd, FIONREAD, &length) == 0) ? static_cast<size_t>(length) : 0U;
+}
+
+int setOption(int const fd, int const level, int const option, int const value)
+{
+    return ::setsockopt(fd, level, option, &value, sizeof(value));
+}
+} // namespace
+
+// needed if ODR-used
+constexpr uint32_t EpollSocket::KEEPALIVE_IDLE_DEFAULT;
+constexpr uint32_t EpollSocket::KEEPALIVE_INTERVAL_DEFAULT;
+constexpr uint32_t EpollSocket::KEEPALIVE_PROBES_DEFAULT;
+
+EpollSocket::EpollSocket(::ethernet::EpollLoop& loop)
+: AbstractSocket()
+, IEventHandler()
+, _loop(loop)
+, _bindEndpoint()
+, _pendingData()
+, _delegate()
+, _notifiedLength(0U)
+, _unacknowledgedLength(0U)
+, _events(0U)
+, _keepAliveIdle(KEEPALIVE_IDLE_DEFAULT)
+, _keepAliveInterval(KEEPALIVE_INTERVAL_DEFAULT)
+, _keepAliveProbes(KEEPALIVE_PROBES_DEFAULT)
+, _fd(-1)
+, _state(State::CLOSED)
+, _keepAliveEnabled(false)
+{}
+
+EpollSocket::~EpollSocket() { resetSocket(); }
+
+void EpollSocket::open(int const fd)
+{
+    if (!isClosed())
+    {
+        logger::Logger::error(logger::TCP, "EpollSocket::open() called in illegal state != CLOSED");
+        return;
+    }
+
+    _fd                   = fd;
+    _state                = State::ESTABLISHED;
+    _pendingData          = {};
+    _notifiedLength       = 0U;
+    _unacknowledgedLength = 0U;
+    _events               = RECEIVE_EVENTS;
+    setKeepAlive();
+    if (!_loop.add(_fd, _events, *this))
+    {
+        resetSocket();
+    }
+}
+
+AbstractSocket::ErrorCode
+EpollSocket::connect(IPAddress const& ipAddr, uint16_t const port, ConnectedDelegate delegate)
+{
+    if (_fd >= 0)
+    {
+        return AbstractSocket::ErrorCode::SOCKET_ERR_NOT_OK;
+    }
+
+    sockaddr_storage remoteAddr{};
+    if (ip::isUnspecified(ipAddr) || (epollutils::toSockAddr(ipAddr, port, remoteAddr) == 0U))
+    {
+        logger::Logger::error(
+            logger::TCP, "EpollSocket::connect(): IP address is neither IPv4 nor IPv6!");
+        return AbstractSocket::ErrorCode::SOCKET_ERR_NOT_OK;
+    }
+
+    _fd = ::socket(
+        epollutils::addressFamilyOf(ipAddr), SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (_fd < 0)
+    {
+        logger::Logger::error(logger::TCP, "EpollSocket::connect(): socket() failed");
+        return AbstractSocket::ErrorCode::SOCKET_ERR_NOT_OK;
+    }
+
+    _state                = State::CONNECTING;
+    _delegate             = delegate;
+    _pendingData          = {};
+    _notifiedLength       = 0U;
+    _unacknowledgedLength = 0U;
+    _events               = RECEIVE_EVENTS | EPOLLOUT;
+    setKeepAlive();
+    if (_bindEndpoint.isSet())
+    {
+        sockaddr_storage localAddr{};
+        socklen_t const length = epollutils::toSockAddr(
+            _bindEndpoint.getAddress(), _bindEndpoint.getPort(), localAddr);
+        if (::bind(_fd, reinterpret_cast<sockaddr*>(&localAddr), length) != 0)
+        {
+            logger::Logger::error(
+                logger::TCP, "EpollSocket::connect(): bind() failed with errno: %d", errno);
+            resetSocket();
+            return AbstractSocket::ErrorCode::SOCKET_ERR_NOT_OK;
+        }
+    }
+    socklen_t const remoteLength = (remoteAddr.ss_family == AF_INET) ? sizeof(sockaddr_in)
+                                                                     : sizeof(sockaddr_in6);
+    if ((::connect(_fd, reinterpret_cast<sockaddr*>(&remoteAddr), remoteLength) != 0)
+        && (errno != EINPROGRESS))
+    {
+        logger::Logger::error(logger::TCP, "EpollSocket::connect(): connect() failed");
+        resetSocket();
+        return AbstractSocket::ErrorCode::SOCKET_ERR_NOT_OK;
+    }
+    // the result of the connection attempt is reported by the first EPOLLOUT event
+    if (!_loop.add(_fd, _events, *this))
+    {
+        resetSocket();
+        return AbstractSocket::ErrorCode::SOCKET_ERR_NOT_OK;
+    }
+
+    char ipAddrBuffer[ip::MAX_IP_STRING_LENGTH];
+    logger::Logger::info(
+        logger::TCP, "Socket connecting to %s:%d", ip::to_str(ipAddr, ipAddrBuffer).data(), port);
+
+    return AbstractSocket::ErrorCode::SOCKET_ERR_OK;
+}
+
+void EpollSocket::handleEvents(uint32_t const events)
+{
+    if (_fd < 0)
+    {
+        return;
+    }
+
+    if (_state == State::CONNECTING)
+    {
+        if ((events & (EPOLLOUT | EPOLLERR | EPOLLHUP)) != 0U)
+        {
+            connectCallback();
+        }
+        return;
+    }
+
+    if ((events & EPOLLERR) != 0U)
+    {
+        int error        = 0;
+        socklen_t length = sizeof(error);
+        (void)::getsockopt(_fd, SOL_SOCKET, SO_ERROR, &error, &length);
+        switch (error)
+        {
+            case ECONNRESET:
+            case EPIPE:
+                logger::Logger::debug(logger::TCP, "EpollSocket: connection reset");
+                errorCallback(IDataListener::ErrorCode::ERR_CONNECTION_RESET);
+                break;
+            case ETIMEDOUT:
+                logger::Logger::debug(logger::TCP, "EpollSocket: connection timed out");
+                errorCallback(IDataListener::ErrorCode::ERR_CONNECTION_TIMED_OUT);
+                break;
+            default:
+                logger::Logger::warn(logger::TCP, "EpollSocket::handleEvents(error %d)", error);
+                errorCallback(IDataListener::ErrorCode::ERR_UNKNOWN);
+                break;
+        }
+        return;
+    }
+
+    if ((events & EPOLLOUT) != 0U)
+    {
+        sendPendingData();
+        notifyAcknowledgedData();
+        updateEvents();
+    }
+
+    if ((_fd >= 0) && ((events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP)) != 0U))
+    {
+        receiveCallback(events);
+    }
+}
+
+void EpollSocket::connectCallback()
+{
+    int error        = 0;
+    socklen_t length = sizeof(error);
+    if ((::getsockopt(_fd, SOL_SOCKET, SO_ERROR, &error, &length) != 0) || (error != 0))
+    {
+        logger::Logger::debug(logger::TCP, "EpollSocket::connectCallback(%d)", error);
+        resetSocket();
+        _delegate(AbstractSocket::ErrorCode::SOCKET_ERR_NOT_OK);
+        return;
+    }
+
+    _state = State::ESTABLISHED;
+    updateEvents();
+    _delegate(AbstractSocket::ErrorCode::SOCKET_ERR_OK);
+}
+
+void EpollSocket::receiveCallback(uint32_t const events)
+{
+    size_t const readLen = getReceiveQueueLength(_fd);
+    if (readLen == 0U)
+    {
+        // readable without data means that the peer has closed the connection
+        logger::Logger::info(
+            logger::TCP,
+            "EpollSocket: connection at port %d closed (events 0x%x)",
+            getLocalPort(),
+            events);
+        resetSocket();
+        if (_dataListener != nullptr)
+        {
+            _dataListener->connectionClosed(IDataListener::ErrorCode::ERR_CONNECTION_CLOSED);
+        }
+        else
+        {
+            logger::Logger::warn(logger::TCP, "No connectionClosed listener registered!");
+        }
+        return;
+    }
+
+    // the socket is level triggered, only report data that has not been reported before
+    if (readLen > _notifiedLength)
+    {
+        _notifiedLength = readLen;
+        if (_dataListener != nullptr)
+        {
+            _dataListener->dataReceived(
+                static_cast<uint16_t>(::etl::min<size_t>(readLen, UINT16_MAX)));
+        }
+        else
+        {
+            logger::Logger::error(logger::TCP, "EpollSocket::receiveCallback(): no datalistener!");
+            (void)read(nullptr, readLen);
+        }
+    }
+}
+
+void EpollSocket::errorCallback(IDataListener::ErrorCode const error)
+{
+    resetSocket();
+    if (_dataListener != nullptr)
+    {
+        _dataListener->connectionClosed(error);
+    }
+}
+
+AbstractSocket::ErrorCode EpollSocket::send(::etl::span<uint8_t const> const& data)
+{
+    if (!isEstablished())
+    {
+        logger::Logger::warn(
+            logger::TCP, "EpollSocket::send() called on closed or closing socket!");
+        return AbstractSocket::ErrorCode::SOCKET_ERR_NOT_OPEN;
+    }
+
+    if ((_pendingData.size() != 0U) || (data.size() == 0U))
+    {
+        return AbstractSocket::ErrorCode::SOCKET_FLUSH;
+    }
+
+    ssize_t const sent = ::send(_fd, data.data(), data.size(), MSG_NOSIGNAL);
+    if (sent <= 0)
+    {
+        if ((errno != EAGAIN) && (errno != EWOULDBLOCK))
+        {
+            logger::Logger::error(logger::TCP, "EpollSocket::send() failed with errno: %d", errno);
+        }
+        // wait for send ack before retry
+        return AbstractSocket::ErrorCode::SOCKET_ERR_NOT_OK;
+    }
+
+    size_t const sentLength = static_cast<size_t>(sent);
+    _unacknowledgedLength += sentLength;
+    if (sentLength < data.size())
+    {
+        // the rest is sent as soon as the kernel signals free buffer space
+        _pendingData = data;
+        _pendingData.advance(sentLength);
+    }
+    updateEvents();
+    bool const sendAll = (_pendingData.size() == 0U);
+    notifyDataSent(sentLength, IDataSendNotificationListener::SendResult::DATA_QUEUED);
+    return sendAll ? AbstractSocket::ErrorCode::SOCKET_ERR_OK
+                   : AbstractSocket::ErrorCode::SOCKET_ERR_NO_MORE_BUFFER;
+}
+
+void EpollSocket::sendPendingData()
+{
+    if (_pendingData.size() == 0U)
+    {
+        return;
+    }
+
+    ssize_t const sent = ::send(_fd, _pendingData.data(), _pendingData.size(), MSG_NOSIGNAL);
+    if (sent > 0)
+    {
+        size_t const sentLength = static_cast<size_t>(sent);
+        _pendingData.advance(sentLength);
+        _unacknowledgedLength += sentLength;
+        notifyDataSent(sentLength, IDataSendNotificationListener::SendResult::DATA_QUEUED);
+    }
+}
+
+void EpollSocket::notifyAcknowledgedData()
+{
+    if ((_fd < 0) || (_unacknowledgedLength == 0U))
+    {
+        return;
+    }
+
+    // the send queue holds both the unsent and the sent but unacknowledged bytes
+    int queued = 0;
+    if (::ioctl(_fd, SIOCOUTQ, &queued) != 0)
+    {
+        return;
+    }
+    size_t const queuedLength = static_cast<size_t>(queued);
+    if (queuedLength < _unacknowledgedLength)
+    {
+        size_t const acknowledgedLength = _unacknowledgedLength - queuedLength;
+        _unacknowledgedLength           = queuedLength;
+        notifyDataSent(acknowledgedLength, IDataSendNotificationListener::SendResult::DATA_SENT);
+    }
+}
+
+void EpollSocket::notifyDataSent(
+    size_t length, IDataSendNotificationListener::SendResult const result)
+{
+    while ((_sendNotificationListener != nullptr) && (length > 0U))
+    {
+        size_t const chunk = ::etl::min<size_t>(length, UINT16_MAX);
+        _sendNotificationListener->dataSent(static_cast<uint16_t>(chunk), result);
+        length -= chunk;
+    }
+}
+
+void EpollSocket::updateEvents()
+{
+    if (_fd < 0)
+    {
+        return;
+    }
+
+    uint32_t events = RECEIVE_EVENTS;
+    if ((_state == State::CONNECTING) || (_pendingData.size() != 0U)
+        || (_unacknowledgedLength != 0U))
+    {
+        events |= EPOLLOUT;
+    }
+    if ((events != _events) && _loop.modify(_fd, events, *this))
+    {
+        _events = events;
+    }
+}
+
+size_t EpollSocket::available()
+{
+    if (!isEstablished())
+    {
+        return 0U;
+    }
+    int bufferSize   = 0;
+    socklen_t length = sizeof(bufferSize);
+    int queued       = 0;
+    if ((::getsockopt(_fd, SOL_SOCKET, SO_SNDBUF, &bufferSize, &length) != 0)
+        || (::ioctl(_fd, SIOCOUTQ, &queued) != 0) || (queued >= bufferSize))
+    {
+        return 0U;
+    }
+    return static_cast<size_t>(bufferSize - queued);
+}
+
+bool EpollSocket::isClosed() const { return _fd < 0; }
+
+bool EpollSocket::isEstablished() const { return _state == State::ESTABLISHED; }
+
+AbstractSocket::ErrorCode EpollSocket::close()
+{
+    if (_fd < 0)
+    {
+        return AbstractSocket::ErrorCode::SOCKET_ERR_OK;
+    }
+
+    // From this point pending data is sent by the kernel
+    discardData();
+    resetSocket();
+    return AbstractSocket::ErrorCode::SOCKET_ERR_OK;
+}
+
+void EpollSocket::abort()
+{
+    if (_fd >= 0)
+    {
+        // closing with zero linger time resets the connection
+        linger const lingerOption{1, 0};
+        (void)::setsockopt(_fd, SOL_SOCKET, SO_LINGER, &lingerOption, sizeof(lingerOption));
+        discardData();
+        resetSocket();
+    }
+}
+
+AbstractSocket::ErrorCode EpollSocket::flush()
+{
+    if (!isEstablished())
+    {
+        return AbstractSocket::ErrorCode::SOCKET_ERR_NOT_OPEN;
+    }
+
+    int noDelay      = 0;
+    socklen_t length = sizeof(noDelay);
+    (void)::getsockopt(_fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, &length);
+    // setting TCP_NODELAY pushes out the data held back by the Nagle algorithm
+    if (setOption(_fd, IPPROTO_TCP, TCP_NODELAY, 1) != 0)
+    {
+        return AbstractSocket::ErrorCode::SOCKET_ERR_NOT_OK;
+    }
+    if (noDelay == 0)
+    {
+        (void)setOption(_fd, IPPROTO_TCP, TCP_NODELAY, 0);
+    }
+    return AbstractSocket::ErrorCode::SOCKET_ERR_OK;
+}
+
+uint8_t EpollSocket::read(uint8_t& byte)
+{
+    uint8_t value[1];
+    if (1U == read(&value[0], 1U))
+    {
+        byte = value[0];
+        return 1U;
+    }
+
+    return 0U;
+}
+
+size_t EpollSocket::read(uint8_t* const buffer, size_t const n)
+{
+    if ((_fd < 0) || (n == 0U) || (getReceiveQueueLength(_fd) < n))
+    {
+        return 0U;
+    }
+
+    // MSG_TRUNC discards the data of a TCP socket without copying it
+    ssize_t const result
+        = (buffer != nullptr) ? ::recv(_fd, buffer, n, 0) : ::recv(_fd, nullptr, n, MSG_TRUNC);
+    if (result <= 0)
+    {
+        return 0U;
+    }
+    size_t const readLength = static_cast<size_t>(result);
+    _notifiedLength         = (_notifiedLength > readLength) ? (_notifiedLength - readLength) : 0U;
+    return readLength;
+}
+
+void EpollSocket::discardData()
+{
+    if (_fd >= 0)
+    {
+        size_t const readLen = getReceiveQueueLength(_fd);
+        if (readLen > 0U)
+        {
+            (void)::recv(_fd, nullptr, readLen, MSG_TRUNC);
+        }
+        _notifiedLength = 0U;
+    }
+}
+
+IPAddress EpollSocket::getRemoteIPAddress() const
+{
+    return epollutils::getEndpoint(_fd, true).getAddress();
+}
+
+IPAddress EpollSocket::getLocalIPAddress() const
+{
+    return epollutils::getEndpoint(_fd, false).getAddress();
+}
+
+uint16_t EpollSocket::getRemotePort() const
+{
+    return (_fd >= 0) ? epollutils::getEndpoint(_fd, true).getPort() : 0U;
+}
+
+uint16_t EpollSocket::getLocalPort() const
+{
+    return (_fd >= 0) ? epollutils::getEndpoint(_fd, false).getPort() : 0U;
+}
+
+AbstractSocket::ErrorCode EpollSocket::bind(IPAddress const& ipAddr, uint16_t const port)
+{
+    if (_fd < 0)
+    {
+        _bindEndpoint = IPEndpoint(ipAddr, port);
+        return AbstractSocket::ErrorCode::SOCKET_ERR_OK;
+    }
+    return AbstractSocket::ErrorCode::SOCKET_ERR_NOT_OK;
+}
+
+void EpollSocket::disableNagleAlgorithm()
+{
+    if (_fd >= 0)
+    {
+        (void)setOption(_fd, IPPROTO_TCP, TCP_NODELAY, 1);
+    }
+}
+
+void EpollSocket::enableKeepAlive(
+    uint32_t const idle, uint32_t const interval, uint32_t const probes)
+{
+    _keepAliveEnabled  = true;
+    _keepAliveIdle     = idle;
+    _keepAliveInterval = interval;
+    _keepAliveProbes   = probes;
+
+    setKeepAlive();
+}
+
+void EpollSocket::disableKeepAlive()
+{
+    _keepAliveEnabled  = false;
+    _keepAliveIdle     = KEEPALIVE_IDLE_DEFAULT;
+    _keepAliveInterval = KEEPALIVE_INTERVAL_DEFAULT;
+    _keepAliveProbes   = KEEPALIVE_PROBES_DEFAULT;
+
+    setKeepAlive();
+}
+
+void EpollSocket::setKeepAlive()
+{
+    if (_fd < 0)
+    {
+        return;
+    }
+
+    (void)setOption(_fd, SOL_SOCKET, SO_KEEPALIVE, _keepAliveEnabled ? 1 : 0);
+    if (_keepAliveEnabled)
+    {
+        // the kernel expects seconds, the interface passes milliseconds
+        (void)setOption(
+            _fd,
+            IPPROTO_TCP,
+            TCP_KEEPIDLE,
+            static_cast<int>(::etl::max(_keepAliveIdle / 1000U, 1U)));
+        (void)setOption(
+            _fd,
+            IPPROTO_TCP,
+            TCP_KEEPINTVL,
+            static_cast<int>(::etl::max(_keepAliveInterval / 1000U, 1U)));
+        (void)setOption(_fd, IPPROTO_TCP, TCP_KEEPCNT, static_cast<int>(_keepAliveProbes));
+    }
+}
+
+void EpollSocket::resetSocket()
+{
+    if (_fd >= 0)
+    {
+        _loop.remove(_fd, *this);
+        (void)::close(_fd);
+        _fd = -1;
+    }
+    _state                = State::CLOSED;
+    _pendingData          = {};
+    _notifiedLength       = 0U;
+    _unacknowledgedLength = 0U;
+    _events               = 0U;
+}
+
+} // namespace tcp
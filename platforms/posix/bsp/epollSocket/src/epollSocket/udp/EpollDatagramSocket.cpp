@@ -0,0 +1,447 @@
+// Copyright 2025 Accenture.
+
+#include "epollSocket/udp/EpollDatagramSocket.h"
+
+#include "epollSocket/utils/SocketAddress.h"
+
+#include <etl/algorithm.h>
+#include <ip/to_str.h>
+#include <udp/DatagramPacket.h>
+#include <udp/IDataListener.h>
+#include <udp/UdpLogger.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include <cerrno>
+#include <cstring>
+#include <unistd.h>
+
+namespace udp
+{
+namespace logger = ::util::logger;
+using ::ip::IPAddress;
+
+namespace
+{
+int openSocket(int const family)
+{
+    int const fd = ::socket(family, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd >= 0)
+    {
+        int const enable = 1;
+        (void)::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+        // the destination address of received datagrams is passed to the data listener
+        if (family == AF_INET)
+        {
+            (void)::setsockopt(fd, IPPROTO_IP, IP_PKTINFO, &enable, sizeof(enable));
+        }
+        else
+        {
+            (void)::setsockopt(fd, IPPROTO_IPV6, IPV6_RECVPKTINFO, &enable, sizeof(enable));
+        }
+    }
+    return fd;
+}
+
+int getSocketFamily(int const fd)
+{
+    sockaddr_storage sockAddr{};
+    socklen_t length = sizeof(sockAddr);
+    return (::getsockname(fd, reinterpret_cast<sockaddr*>(&sockAddr), &length) == 0)
+               ? sockAddr.ss_family
+               : AF_UNSPEC;
+}
+
+IPAddress getDestinationAddress(msghdr& message, IPAddress const& localAddress)
+{
+    for (cmsghdr* cmsg = CMSG_FIRSTHDR(&message); cmsg != nullptr;
+         cmsg          = CMSG_NXTHDR(&message, cmsg))
+    {
+        if ((cmsg->cmsg_level == IPPROTO_IP) && (cmsg->cmsg_type == IP_PKTINFO))
+        {
+            in_pktinfo info{};
+            (void)memcpy(&info, CMSG_DATA(cmsg), sizeof(info));
+            return ::ip::make_ip4(ntohl(info.ipi_addr.s_addr));
+        }
+#ifndef OPENBSW_NO_IPV6
+        if ((cmsg->cmsg_level == IPPROTO_IPV6) && (cmsg->cmsg_type == IPV6_PKTINFO))
+        {
+            in6_pktinfo info{};
+            (void)memcpy(&info, CMSG_DATA(cmsg), sizeof(info));
+            return ::ip::make_ip6(::etl::span<uint8_t const>(
+                &info.ipi6_addr.s6_addr[0], IPAddress::IP6LENGTH));
+        }
+#endif
+    }
+    return localAddress;
+}
+} // namespace
+
+// needed if ODR-used
+constexpr size_t EpollDatagramSocket::MAX_DATAGRAM_LENGTH;
+constexpr size_t EpollDatagramSocket::MAX_DATAGRAMS_PER_EVENT;
+
+EpollDatagramSocket::EpollDatagramSocket(::ethernet::EpollLoop& loop)
+: AbstractDatagramSocket()
+, IEventHandler()
+, _loop(loop)
+, _multicastGroups()
+, _remoteAddress()
+, _localAddress()
+, _rxLength(0U)
+, _rxOffset(0U)
+, _rxFd(-1)
+, _txFd(-1)
+, _remotePort(AbstractDatagramSocket::INVALID_PORT)
+, _rxBuffer()
+{}
+
+EpollDatagramSocket::~EpollDatagramSocket()
+{
+    close();
+    disconnect();
+}
+
+bool EpollDatagramSocket::isBound() const { return (_rxFd >= 0); }
+
+bool EpollDatagramSocket::isConnected() const { return (_txFd >= 0); }
+
+bool EpollDatagramSocket::isClosed() const { return (!(isBound() && isConnected())); }
+
+AbstractDatagramSocket::ErrorCode
+EpollDatagramSocket::bind(ip::IPAddress const* pIpAddress, uint16_t port)
+{
+    if (_dataListener == nullptr)
+    {
+        return AbstractDatagramSocket::ErrorCode::UDP_SOCKET_NO_DATA_LISTENER;
+    }
+
+    close();
+
+    IPAddress const localAddress = (pIpAddress != nullptr) ? *pIpAddress : IPAddress();
+    _rxFd                        = openSocket(epollutils::addressFamilyOf(localAddress));
+    if (_rxFd < 0)
+    {
+        logger::Logger::error(logger::UDP, " EpollDatagramSocket::bind(): socket() failed!");
+        return AbstractDatagramSocket::ErrorCode::UDP_SOCKET_NOT_OK;
+    }
+    sockaddr_storage localAddr{};
+    socklen_t const length = epollutils::toSockAddr(localAddress, port, localAddr);
+    if ((length == 0U) || (::bind(_rxFd, reinterpret_cast<sockaddr*>(&localAddr), length) != 0))
+    {
+        logger::Logger::error(
+            logger::UDP, " EpollDatagramSocket::bind(): bind failed with errno %d!", errno);
+        close();
+        return AbstractDatagramSocket::ErrorCode::UDP_SOCKET_NOT_OK;
+    }
+    if (!_loop.add(_rxFd, EPOLLIN, *this))
+    {
+        close();
+        return AbstractDatagramSocket::ErrorCode::UDP_SOCKET_NOT_OK;
+    }
+    logger::Logger::info(logger::UDP, "DatagramSocket bound to UDP port %d", getLocalPort());
+    return AbstractDatagramSocket::ErrorCode::UDP_SOCKET_OK;
+}
+
+AbstractDatagramSocket::ErrorCode EpollDatagramSocket::join(ip::IPAddress const& groupAddr)
+{
+    if ((!isBound()) || isAlreadyJoined(groupAddr) || _multicastGroups.full())
+    {
+        return AbstractDatagramSocket::ErrorCode::UDP_SOCKET_OK;
+    }
+
+    int status = -1;
+    if (ip::isIp4Address(groupAddr))
+    {
+        ::ip::IPEndpoint const local = epollutils::getEndpoint(_rxFd, false);
+        ip_mreqn request{};
+        request.imr_multiaddr.s_addr = htonl(::ip::ip4_to_u32(groupAddr));
+        request.imr_address.s_addr   = htonl(::ip::ip4_to_u32(local.getAddress()));
+        status = ::setsockopt(_rxFd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &request, sizeof(request));
+    }
+#ifndef OPENBSW_NO_IPV6
+    else if (ip::isIp6Address(groupAddr))
+    {
+        ipv6_mreq request{};
+        (void)memcpy(
+            &request.ipv6mr_multiaddr, ::ip::ip6_bytes(groupAddr).data(), IPAddress::IP6LENGTH);
+        status = ::setsockopt(_rxFd, IPPROTO_IPV6, IPV6_JOIN_GROUP, &request, sizeof(request));
+    }
+#endif
+    else
+    {
+        // unspecified group address
+    }
+    if (status != 0)
+    {
+        logger::Logger::error(
+            logger::UDP, " EpollDatagramSocket::join(): setsockopt failed with errno %d!", errno);
+        return AbstractDatagramSocket::ErrorCode::UDP_SOCKET_NOT_OK;
+    }
+
+    logger::Logger::info(logger::UDP, "DatagramSocket joined the group");
+    _multicastGroups.push_back(groupAddr);
+    return AbstractDatagramSocket::ErrorCode::UDP_SOCKET_OK;
+}
+
+bool EpollDatagramSocket::isAlreadyJoined(ip::IPAddress const& groupAddr) const
+{
+    return ::etl::find(_multicastGroups.begin(), _multicastGroups.end(), groupAddr)
+           != _multicastGroups.end();
+}
+
+void EpollDatagramSocket::handleEvents(uint32_t const /* events */)
+{
+    // a connected socket shares the local port, the datagrams may arrive at both sockets
+    if (_rxFd >= 0)
+    {
+        receiveDatagrams(_rxFd);
+    }
+    if (_txFd >= 0)
+    {
+        receiveDatagrams(_txFd);
+    }
+}
+
+void EpollDatagramSocket::receiveDatagrams(int const fd)
+{
+    IPAddress const localAddress = epollutils::getEndpoint(fd, false).getAddress();
+    for (size_t count = 0U; count < MAX_DATAGRAMS_PER_EVENT; ++count)
+    {
+        sockaddr_storage sourceAddr{};
+        iovec iov{&_rxBuffer[0], sizeof(_rxBuffer)};
+        uint8_t control[CMSG_SPACE(sizeof(in6_pktinfo))];
+        msghdr message{};
+        message.msg_name       = &sourceAddr;
+        message.msg_namelen    = sizeof(sourceAddr);
+        message.msg_iov        = &iov;
+        message.msg_iovlen     = 1U;
+        message.msg_control    = &control[0];
+        message.msg_controllen = sizeof(control);
+
+        ssize_t const length = ::recvmsg(fd, &message, 0);
+        if (length < 0)
+        {
+            break;
+        }
+        if ((message.msg_flags & MSG_TRUNC) != 0)
+        {
+            logger::Logger::error(logger::UDP, "EpollDatagramSocket: dropped oversized datagram");
+            continue;
+        }
+
+        ::ip::IPEndpoint const source = epollutils::fromSockAddr(sourceAddr);
+        _rxLength                     = static_cast<size_t>(length);
+        _rxOffset                     = 0U;
+        if (_dataListener != nullptr)
+        {
+            _dataListener->dataReceived(
+                *this,
+                source.getAddress(),
+                source.getPort(),
+                getDestinationAddress(message, localAddress),
+                static_cast<uint16_t>(_rxLength));
+        }
+        // the unread rest of the datagram is dropped
+        _rxLength = 0U;
+        _rxOffset = 0U;
+        if ((fd != _rxFd) && (fd != _txFd))
+        {
+            // the socket has been closed by the listener
+            break;
+        }
+    }
+}
+
+size_t EpollDatagramSocket::read(uint8_t* const buffer, size_t n)
+{
+    n = ::etl::min(n, _rxLength - _rxOffset);
+    if ((buffer != nullptr) && (n > 0U))
+    {
+        (void)memcpy(buffer, &_rxBuffer[_rxOffset], n);
+    }
+    _rxOffset += n;
+    return n;
+}
+
+AbstractDatagramSocket::ErrorCode EpollDatagramSocket::connect(
+    ip::IPAddress const& address, uint16_t const port, ip::IPAddress* const pLocalAddress)
+{
+    if (_txFd >= 0)
+    {
+        logger::Logger::warn(
+            logger::UDP, "EpollDatagramSocket::connect() called although already connected");
+        return AbstractDatagramSocket::ErrorCode::UDP_SOCKET_NOT_OK;
+    }
+    sockaddr_storage remoteAddr{};
+    if (ip::isUnspecified(address) || (epollutils::toSockAddr(address, port, remoteAddr) == 0U))
+    {
+        logger::Logger::error(
+            logger::UDP, "EpollDatagramSocket::connect(): IP address is neither IPv4 nor IPv6!");
+        return AbstractDatagramSocket::ErrorCode::UDP_SOCKET_NOT_OK;
+    }
+
+    _txFd = openSocket(epollutils::addressFamilyOf(address));
+    if (_txFd < 0)
+    {
+        logger::Logger::error(logger::UDP, "EpollDatagramSocket::connect(): socket() failed!");
+        return AbstractDatagramSocket::ErrorCode::UDP_SOCKET_NOT_OK;
+    }
+    if ((pLocalAddress != nullptr) || isBound())
+    {
+        // send from the local port of the bound socket
+        ::ip::IPEndpoint const local = epollutils::getEndpoint(_rxFd, false);
+        IPAddress const localAddress
+            = (pLocalAddress != nullptr) ? *pLocalAddress : local.getAddress();
+        uint16_t const localPort = isBound() ? local.getPort() : 0U;
+        sockaddr_storage localAddr{};
+        socklen_t const length = epollutils::toSockAddr(localAddress, localPort, localAddr);
+        if ((length == 0U) || (::bind(_txFd, reinterpret_cast<sockaddr*>(&localAddr), length) != 0))
+        {
+            logger::Logger::error(
+                logger::UDP,
+                " EpollDatagramSocket::connect(): bind failed with errno %d!",
+                errno);
+            disconnect();
+            return AbstractDatagramSocket::ErrorCode::UDP_SOCKET_NOT_OK;
+        }
+    }
+    socklen_t const remoteLength = (remoteAddr.ss_family == AF_INET) ? sizeof(sockaddr_in)
+                                                                     : sizeof(sockaddr_in6);
+    if (::connect(_txFd, reinterpret_cast<sockaddr*>(&remoteAddr), remoteLength) != 0)
+    {
+        logger::Logger::error(
+            logger::UDP,
+            " EpollDatagramSocket::connect(): connect failed with errno %d!",
+            errno);
+        disconnect();
+        return AbstractDatagramSocket::ErrorCode::UDP_SOCKET_NOT_OK;
+    }
+    if (isBound() && (!_loop.add(_txFd, EPOLLIN, *this)))
+    {
+        disconnect();
+        return AbstractDatagramSocket::ErrorCode::UDP_SOCKET_NOT_OK;
+    }
+    _remoteAddress = address;
+    _remotePort    = port;
+    _localAddress  = epollutils::getEndpoint(_txFd, false).getAddress();
+
+    char ipAddrBuffer[ip::MAX_IP_STRING_LENGTH];
+    logger::Logger::info(
+        logger::UDP,
+        "DatagramSocket connecting to %s:%d",
+        ip::to_str(address, ipAddrBuffer).data(),
+        port);
+    return AbstractDatagramSocket::ErrorCode::UDP_SOCKET_OK;
+}
+
+void EpollDatagramSocket::disconnect()
+{
+    if (_txFd >= 0)
+    {
+        char ipAddrBuffer[ip::MAX_IP_STRING_LENGTH];
+        logger::Logger::info(
+            logger::UDP,
+            "DatagramSocket to %s:%d disconnected",
+            ip::to_str(_remoteAddress, ipAddrBuffer).data(),
+            getPort());
+
+        _loop.remove(_txFd, *this);
+        (void)::close(_txFd);
+        _txFd = -1;
+    }
+    _remotePort = AbstractDatagramSocket::INVALID_PORT;
+}
+
+AbstractDatagramSocket::ErrorCode EpollDatagramSocket::send(::etl::span<uint8_t const> const& data)
+{
+    if (_txFd < 0)
+    {
+        return AbstractDatagramSocket::ErrorCode::UDP_SOCKET_NOT_OK;
+    }
+    if (::send(_txFd, data.data(), data.size(), 0) < 0)
+    {
+        logger::Logger::error(
+            logger::UDP, "EpollDatagramSocket::send() failed (errno:%d)!", errno);
+        return AbstractDatagramSocket::ErrorCode::UDP_SOCKET_NOT_OK;
+    }
+    return AbstractDatagramSocket::ErrorCode::UDP_SOCKET_OK;
+}
+
+AbstractDatagramSocket::ErrorCode EpollDatagramSocket::send(DatagramPacket const& packet)
+{
+    sockaddr_storage destination{};
+    socklen_t const length
+        = epollutils::toSockAddr(packet.getAddress(), packet.getPort(), destination);
+    if (length == 0U)
+    {
+        return AbstractDatagramSocket::ErrorCode::UDP_SOCKET_NOT_OK;
+    }
+
+    // send from the bound socket if the address family matches, else from a temporary one
+    bool const useBoundSocket = isBound() && (getSocketFamily(_rxFd) == destination.ss_family);
+    int const fd = useBoundSocket ? _rxFd : openSocket(destination.ss_family);
+    if (fd < 0)
+    {
+        logger::Logger::error(logger::UDP, " EpollDatagramSocket::send(): socket() failed!");
+        return AbstractDatagramSocket::ErrorCode::UDP_SOCKET_NOT_OK;
+    }
+    ssize_t const sent = ::sendto(
+        fd,
+        packet.getData(),
+        packet.getLength(),
+        0,
+        reinterpret_cast<sockaddr*>(&destination),
+        length);
+    if (!useBoundSocket)
+    {
+        (void)::close(fd);
+    }
+    if (sent < 0)
+    {
+        logger::Logger::error(
+            logger::UDP, "EpollDatagramSocket::send() failed (errno:%d)!", errno);
+        return AbstractDatagramSocket::ErrorCode::UDP_SOCKET_NOT_OK;
+    }
+    return AbstractDatagramSocket::ErrorCode::UDP_SOCKET_OK;
+}
+
+void EpollDatagramSocket::close()
+{
+    if (_rxFd >= 0)
+    {
+        logger::Logger::info(logger::UDP, "DatagramSocket @ port %d closed", getLocalPort());
+        _loop.remove(_rxFd, *this);
+        (void)::close(_rxFd);
+        _rxFd = -1;
+    }
+    _multicastGroups.clear();
+}
+
+uint16_t EpollDatagramSocket::getLocalPort() const
+{
+    if (_rxFd >= 0)
+    {
+        return epollutils::getEndpoint(_rxFd, false).getPort();
+    }
+    return AbstractDatagramSocket::INVALID_PORT;
+}
+
+ip::IPAddress const* EpollDatagramSocket::getLocalIPAddress() const
+{
+    return (_txFd >= 0) ? &_localAddress : nullptr;
+}
+
+uint16_t EpollDatagramSocket::getPort() const
+{
+    return (_txFd >= 0) ? _remotePort : static_cast<uint16_t>(AbstractDatagramSocket::INVALID_PORT);
+}
+
+ip::IPAddress const* EpollDatagramSocket::getIPAddress() const
+{
+    return (_txFd >= 0) ? &_remoteAddress : nullptr;
+}
+
+} // namespace udp
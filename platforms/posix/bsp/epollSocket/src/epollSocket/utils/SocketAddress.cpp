@@ -0,0 +1,78 @@
+// Copyright 2025 Accenture.
+
+#include "epollSocket/utils/SocketAddress.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+
+#include <cstring>
+
+namespace epollutils
+{
+socklen_t
+toSockAddr(::ip::IPAddress const& ipAddr, uint16_t const port, sockaddr_storage& sockAddr)
+{
+    (void)memset(&sockAddr, 0, sizeof(sockAddr));
+    if (::ip::isUnspecified(ipAddr) || ::ip::isIp4Address(ipAddr))
+    {
+        sockaddr_in& addr = reinterpret_cast<sockaddr_in&>(sockAddr);
+        addr.sin_family   = AF_INET;
+        addr.sin_port     = htons(port);
+        addr.sin_addr.s_addr
+            = ::ip::isUnspecified(ipAddr) ? htonl(INADDR_ANY) : htonl(::ip::ip4_to_u32(ipAddr));
+        return sizeof(sockaddr_in);
+    }
+#ifndef OPENBSW_NO_IPV6
+    sockaddr_in6& addr = reinterpret_cast<sockaddr_in6&>(sockAddr);
+    addr.sin6_family   = AF_INET6;
+    addr.sin6_port     = htons(port);
+    (void)memcpy(&addr.sin6_addr, ::ip::ip6_bytes(ipAddr).data(), ::ip::IPAddress::IP6LENGTH);
+    return sizeof(sockaddr_in6);
+#else
+    return 0U;
+#endif
+}
+
+int addressFamilyOf(::ip::IPAddress const& ipAddr)
+{
+    return (::ip::isUnspecified(ipAddr) || ::ip::isIp4Address(ipAddr)) ? AF_INET : AF_INET6;
+}
+
+::ip::IPEndpoint fromSockAddr(sockaddr_storage const& sockAddr)
+{
+    if (sockAddr.ss_family == AF_INET)
+    {
+        sockaddr_in const& addr = reinterpret_cast<sockaddr_in const&>(sockAddr);
+        return ::ip::IPEndpoint(::ip::make_ip4(ntohl(addr.sin_addr.s_addr)), ntohs(addr.sin_port));
+    }
+#ifndef OPENBSW_NO_IPV6
+    if (sockAddr.ss_family == AF_INET6)
+    {
+        sockaddr_in6 const& addr = reinterpret_cast<sockaddr_in6 const&>(sockAddr);
+        return ::ip::IPEndpoint(
+            ::ip::make_ip6(::etl::span<uint8_t const>(
+                &addr.sin6_addr.s6_addr[0], ::ip::IPAddress::IP6LENGTH)),
+            ntohs(addr.sin6_port));
+    }
+#endif
+    return ::ip::IPEndpoint();
+}
+
+::ip::IPEndpoint getEndpoint(int const fd, bool const remote)
+{
+    if (fd < 0)
+    {
+        return ::ip::IPEndpoint();
+    }
+    sockaddr_storage sockAddr{};
+    socklen_t length = sizeof(sockAddr);
+    int const result = remote ? ::getpeername(fd, reinterpret_cast<sockaddr*>(&sockAddr), &length)
+                              : ::getsockname(fd, reinterpret_cast<sockaddr*>(&sockAddr), &length);
+    if (result != 0)
+    {
+        return ::ip::IPEndpoint();
+    }
+    return fromSockAddr(sockAddr);
+}
+
+} // namespace epollutils
@@ -0,0 +1,106 @@
+// Copyright 2025 Accenture.
+
+#include "epollSocket/EpollLoop.h"
+
+#include <gmock/gmock.h>
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace
+{
+using namespace ::ethernet;
+using namespace ::testing;
+
+struct EventHandlerMock : public EpollLoop::IEventHandler
+{
+    MOCK_METHOD(void, handleEvents, (uint32_t));
+};
+
+class EpollLoopTest : public Test
+{
+public:
+    EpollLoopTest()
+    : _fd1(::eventfd(0U, EFD_NONBLOCK | EFD_CLOEXEC))
+    , _fd2(::eventfd(0U, EFD_NONBLOCK | EFD_CLOEXEC))
+    {}
+
+    ~EpollLoopTest() override
+    {
+        (void)::close(_fd1);
+        (void)::close(_fd2);
+    }
+
+    static void signal(int const fd)
+    {
+        uint64_t const value = 1U;
+        ASSERT_EQ(static_cast<ssize_t>(sizeof(value)), ::write(fd, &value, sizeof(value)));
+    }
+
+protected:
+    EpollLoop _cut;
+    StrictMock<EventHandlerMock> _handler1;
+    StrictMock<EventHandlerMock> _handler2;
+    int _fd1;
+    int _fd2;
+};
+
+/**
+ * \desc
+ * Verifies that ready file descriptors are dispatched to their handlers and that nothing is
+ * dispatched before a file descriptor has been added or after the loop has been closed.
+ */
+TEST_F(EpollLoopTest, testDispatchEvents)
+{
+    EXPECT_FALSE(_cut.isOpen());
+    EXPECT_EQ(0U, _cut.poll(0));
+
+    EXPECT_TRUE(_cut.add(_fd1, EPOLLIN, _handler1));
+    EXPECT_TRUE(_cut.isOpen());
+    EXPECT_TRUE(_cut.add(_fd2, EPOLLIN, _handler2));
+    EXPECT_FALSE(_cut.add(_fd2, EPOLLIN, _handler2));
+    EXPECT_EQ(0U, _cut.poll(0));
+
+    signal(_fd2);
+    EXPECT_CALL(_handler2, handleEvents(EPOLLIN));
+    EXPECT_EQ(1U, _cut.poll(0));
+    Mock::VerifyAndClearExpectations(&_handler2);
+
+    // level triggered until the event is consumed
+    EXPECT_TRUE(_cut.modify(_fd2, EPOLLIN | EPOLLOUT, _handler2));
+    EXPECT_CALL(_handler2, handleEvents(EPOLLIN | EPOLLOUT));
+    _cut.execute();
+    Mock::VerifyAndClearExpectations(&_handler2);
+
+    _cut.remove(_fd2, _handler2);
+    EXPECT_EQ(0U, _cut.poll(0));
+
+    _cut.close();
+    EXPECT_FALSE(_cut.isOpen());
+    signal(_fd1);
+    EXPECT_EQ(0U, _cut.poll(0));
+}
+
+/**
+ * \desc
+ * Verifies that events that have already been fetched are not dispatched to a handler that has
+ * been removed by another handler of the same poll.
+ */
+TEST_F(EpollLoopTest, testRemoveWhileDispatching)
+{
+    EXPECT_TRUE(_cut.add(_fd1, EPOLLIN, _handler1));
+    EXPECT_TRUE(_cut.add(_fd2, EPOLLIN, _handler2));
+    signal(_fd1);
+    signal(_fd2);
+
+    // whichever handler comes first removes the other one
+    EXPECT_CALL(_handler1, handleEvents(EPOLLIN))
+        .Times(AtMost(1))
+        .WillOnce(Invoke([this](uint32_t) { _cut.remove(_fd2, _handler2); }));
+    EXPECT_CALL(_handler2, handleEvents(EPOLLIN))
+        .Times(AtMost(1))
+        .WillOnce(Invoke([this](uint32_t) { _cut.remove(_fd1, _handler1); }));
+    EXPECT_EQ(1U, _cut.poll(0));
+}
+
+} // namespace
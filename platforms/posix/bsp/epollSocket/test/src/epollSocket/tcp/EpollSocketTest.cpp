@@ -0,0 +1,263 @@
+// Copyright 2025 Accenture.
+
+#include "epollSocket/tcp/EpollSocket.h"
+
+#include "epollSocket/EpollLoop.h"
+#include "epollSocket/tcp/EpollServerSocket.h"
+
+#include <tcp/DataListenerMock.h>
+#include <tcp/DataSendNotificationListenerMock.h>
+#include <tcp/socket/SocketProvidingConnectionListenerMock.h>
+
+#include <gmock/gmock.h>
+
+namespace
+{
+using namespace ::tcp;
+using namespace ::testing;
+
+uint16_t const TEST_PORT = 48513U;
+
+class EpollSocketTest : public Test
+{
+public:
+    EpollSocketTest()
+    : _loop()
+    , _serverSocket(_loop, TEST_PORT, _connectionListener)
+    , _serverConnection(_loop)
+    , _client(_loop)
+    , _connectResult(AbstractSocket::ErrorCode::SOCKET_ERR_NOT_OPEN)
+    {}
+
+    void connected(AbstractSocket::ErrorCode const result) { _connectResult = result; }
+
+    AbstractSocket::ConnectedDelegate getConnectedDelegate()
+    {
+        return AbstractSocket::ConnectedDelegate::
+            create<EpollSocketTest, &EpollSocketTest::connected>(*this);
+    }
+
+    template<class Predicate>
+    bool pollUntil(Predicate const& predicate)
+    {
+        for (size_t i = 0U; (i < 200U) && (!predicate()); ++i)
+        {
+            (void)_loop.poll(10);
+        }
+        return predicate();
+    }
+
+    void establishConnection()
+    {
+        ASSERT_TRUE(_serverSocket.accept());
+        EXPECT_CALL(_connectionListener, getSocket(_, _)).WillOnce(Return(&_serverConnection));
+        EXPECT_CALL(_connectionListener, connectionAccepted(Ref(_serverConnection)))
+            .WillOnce(Invoke([this](AbstractSocket& socket)
+                             { socket.setDataListener(&_serverDataListener); }));
+        _client.setDataListener(&_clientDataListener);
+        ASSERT_EQ(
+            AbstractSocket::ErrorCode::SOCKET_ERR_OK,
+            _client.connect(::ip::make_ip4(127U, 0U, 0U, 1U), TEST_PORT, getConnectedDelegate()));
+        EXPECT_FALSE(_client.isEstablished());
+        ASSERT_TRUE(pollUntil(
+            [this]
+            {
+                return (_connectResult == AbstractSocket::ErrorCode::SOCKET_ERR_OK)
+                       && _serverConnection.isEstablished();
+            }));
+        Mock::VerifyAndClearExpectations(&_connectionListener);
+    }
+
+protected:
+    ::ethernet::EpollLoop _loop;
+    StrictMock<SocketProvidingConnectionListenerMock> _connectionListener;
+    StrictMock<DataListenerMock> _serverDataListener;
+    StrictMock<DataListenerMock> _clientDataListener;
+    StrictMock<DataSendNotificationListenerMock> _sendNotificationListener;
+    EpollServerSocket _serverSocket;
+    EpollSocket _serverConnection;
+    EpollSocket _client;
+    AbstractSocket::ErrorCode _connectResult;
+};
+
+/**
+ * \desc
+ * Verifies the behaviour of a socket that is not connected.
+ */
+TEST_F(EpollSocketTest, testClosedSocket)
+{
+    uint8_t const data[] = {1U, 2U};
+    uint8_t byte         = 0U;
+    EXPECT_TRUE(_client.isClosed());
+    EXPECT_FALSE(_client.isEstablished());
+    EXPECT_EQ(AbstractSocket::ErrorCode::SOCKET_ERR_NOT_OPEN, _client.send(data));
+    EXPECT_EQ(AbstractSocket::ErrorCode::SOCKET_ERR_NOT_OPEN, _client.flush());
+    EXPECT_EQ(AbstractSocket::ErrorCode::SOCKET_ERR_OK, _client.close());
+    EXPECT_EQ(0U, _client.available());
+    EXPECT_EQ(0U, _client.read(byte));
+    EXPECT_EQ(0U, _client.getLocalPort());
+    EXPECT_EQ(0U, _client.getRemotePort());
+    EXPECT_EQ(AbstractSocket::ErrorCode::SOCKET_ERR_OK, _client.bind(::ip::make_ip4(0U), 0U));
+    EXPECT_EQ(
+        AbstractSocket::ErrorCode::SOCKET_ERR_NOT_OK,
+        _client.connect(::ip::IPAddress(), TEST_PORT, getConnectedDelegate()));
+    _client.abort();
+    _client.disableNagleAlgorithm();
+    _client.enableKeepAlive(1000U, 1000U, 3U);
+    _client.disableKeepAlive();
+    EXPECT_TRUE(_client.isClosed());
+}
+
+/**
+ * \desc
+ * Verifies that a server socket can only be put into listening state once and needs a port and
+ * a connection listener.
+ */
+TEST_F(EpollSocketTest, testServerSocketAcceptAndClose)
+{
+    EpollServerSocket unconfigured(_loop);
+    EXPECT_FALSE(unconfigured.accept());
+    EXPECT_FALSE(unconfigured.bind(::ip::make_ip4(0U), TEST_PORT));
+    EXPECT_TRUE(unconfigured.isClosed());
+
+    EXPECT_TRUE(_serverSocket.isClosed());
+    EXPECT_TRUE(_serverSocket.accept());
+    EXPECT_FALSE(_serverSocket.isClosed());
+    EXPECT_FALSE(_serverSocket.accept());
+    _serverSocket.close();
+    EXPECT_TRUE(_serverSocket.isClosed());
+    EXPECT_TRUE(_serverSocket.bind(::ip::make_ip4(127U, 0U, 0U, 1U), TEST_PORT));
+    EXPECT_TRUE(_serverSocket.accept());
+}
+
+/**
+ * \desc
+ * Verifies that data is passed in both directions with the same callbacks as with the lwip
+ * sockets: received data is reported once with the number of unread bytes and sent data is
+ * reported as queued and as acknowledged.
+ */
+TEST_F(EpollSocketTest, testSendAndReceive)
+{
+    establishConnection();
+    EXPECT_EQ(TEST_PORT, _client.getRemotePort());
+    EXPECT_EQ(::ip::make_ip4(127U, 0U, 0U, 1U), _client.getRemoteIPAddress());
+    EXPECT_EQ(TEST_PORT, _serverConnection.getLocalPort());
+    EXPECT_EQ(_client.getLocalPort(), _serverConnection.getRemotePort());
+    EXPECT_EQ(_client.getLocalIPAddress(), _serverConnection.getRemoteIPAddress());
+    EXPECT_GT(_client.available(), 0U);
+
+    uint8_t const data[] = {1U, 2U, 3U, 4U, 5U};
+    _client.setSendNotificationListener(&_sendNotificationListener);
+    {
+        InSequence sequence;
+        EXPECT_CALL(
+            _sendNotificationListener,
+            dataSent(5U, IDataSendNotificationListener::SendResult::DATA_QUEUED));
+        EXPECT_CALL(
+            _sendNotificationListener,
+            dataSent(5U, IDataSendNotificationListener::SendResult::DATA_SENT));
+    }
+    bool received = false;
+    EXPECT_CALL(_serverDataListener, dataReceived(5U)).WillOnce(Assign(&received, true));
+    EXPECT_EQ(AbstractSocket::ErrorCode::SOCKET_ERR_OK, _client.send(data));
+    EXPECT_EQ(AbstractSocket::ErrorCode::SOCKET_ERR_OK, _client.flush());
+    EXPECT_TRUE(pollUntil([&received] { return received; }));
+    // unread data is not reported again
+    (void)_loop.poll(10);
+    Mock::VerifyAndClearExpectations(&_sendNotificationListener);
+    Mock::VerifyAndClearExpectations(&_serverDataListener);
+
+    uint8_t buffer[8] = {};
+    uint8_t byte      = 0U;
+    EXPECT_EQ(0U, _serverConnection.read(buffer, 6U));
+    EXPECT_EQ(1U, _serverConnection.read(byte));
+    EXPECT_EQ(1U, byte);
+    EXPECT_EQ(2U, _serverConnection.read(buffer, 2U));
+    EXPECT_THAT(buffer, ElementsAre(2U, 3U, 0U, 0U, 0U, 0U, 0U, 0U));
+
+    // new data is reported with the total number of unread bytes
+    received = false;
+    EXPECT_CALL(_clientDataListener, dataReceived(3U)).WillOnce(Assign(&received, true));
+    EXPECT_EQ(
+        AbstractSocket::ErrorCode::SOCKET_ERR_OK,
+        _serverConnection.send(::etl::span<uint8_t const>(data).first(3U)));
+    EXPECT_TRUE(pollUntil([&received] { return received; }));
+    Mock::VerifyAndClearExpectations(&_clientDataListener);
+
+    received = false;
+    EXPECT_CALL(_clientDataListener, dataReceived(5U)).WillOnce(Assign(&received, true));
+    EXPECT_EQ(
+        AbstractSocket::ErrorCode::SOCKET_ERR_OK,
+        _serverConnection.send(::etl::span<uint8_t const>(data).first(2U)));
+    EXPECT_TRUE(pollUntil([&received] { return received; }));
+    Mock::VerifyAndClearExpectations(&_clientDataListener);
+    EXPECT_EQ(3U, _client.read(nullptr, 3U));
+    _client.discardData();
+    EXPECT_EQ(0U, _client.read(buffer, 1U));
+}
+
+/**
+ * \desc
+ * Verifies that closing a connection is reported to the peer, which closes its socket.
+ */
+TEST_F(EpollSocketTest, testCloseIsReportedToPeer)
+{
+    establishConnection();
+    bool closed = false;
+    EXPECT_CALL(
+        _serverDataListener, connectionClosed(IDataListener::ErrorCode::ERR_CONNECTION_CLOSED))
+        .WillOnce(Assign(&closed, true));
+    EXPECT_EQ(AbstractSocket::ErrorCode::SOCKET_ERR_OK, _client.close());
+    EXPECT_TRUE(_client.isClosed());
+    EXPECT_TRUE(pollUntil([&closed] { return closed; }));
+    EXPECT_TRUE(_serverConnection.isClosed());
+}
+
+/**
+ * \desc
+ * Verifies that aborting a connection is reported to the peer as reset.
+ */
+TEST_F(EpollSocketTest, testAbortIsReportedAsReset)
+{
+    establishConnection();
+    bool closed = false;
+    EXPECT_CALL(
+        _serverDataListener, connectionClosed(IDataListener::ErrorCode::ERR_CONNECTION_RESET))
+        .WillOnce(Assign(&closed, true));
+    _client.abort();
+    EXPECT_TRUE(_client.isClosed());
+    EXPECT_TRUE(pollUntil([&closed] { return closed; }));
+    EXPECT_TRUE(_serverConnection.isClosed());
+}
+
+/**
+ * \desc
+ * Verifies that a connection is closed if the connection listener provides no socket and that
+ * a failed connection attempt is reported to the connect delegate.
+ */
+TEST_F(EpollSocketTest, testRejectedAndRefusedConnections)
+{
+    ASSERT_TRUE(_serverSocket.accept());
+    bool closed = false;
+    EXPECT_CALL(_connectionListener, getSocket(_, _)).WillOnce(Return(nullptr));
+    EXPECT_CALL(
+        _clientDataListener, connectionClosed(IDataListener::ErrorCode::ERR_CONNECTION_CLOSED))
+        .WillOnce(Assign(&closed, true));
+    _client.setDataListener(&_clientDataListener);
+    ASSERT_EQ(
+        AbstractSocket::ErrorCode::SOCKET_ERR_OK,
+        _client.connect(::ip::make_ip4(127U, 0U, 0U, 1U), TEST_PORT, getConnectedDelegate()));
+    EXPECT_TRUE(pollUntil([&closed] { return closed; }));
+    EXPECT_EQ(AbstractSocket::ErrorCode::SOCKET_ERR_OK, _connectResult);
+
+    _serverSocket.close();
+    _connectResult = AbstractSocket::ErrorCode::SOCKET_ERR_NOT_OPEN;
+    ASSERT_EQ(
+        AbstractSocket::ErrorCode::SOCKET_ERR_OK,
+        _client.connect(::ip::make_ip4(127U, 0U, 0U, 1U), TEST_PORT, getConnectedDelegate()));
+    EXPECT_TRUE(pollUntil(
+        [this] { return _connectResult == AbstractSocket::ErrorCode::SOCKET_ERR_NOT_OK; }));
+    EXPECT_TRUE(_client.isClosed());
+}
+
+} // namespace
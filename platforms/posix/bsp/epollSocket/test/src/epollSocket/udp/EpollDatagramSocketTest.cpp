@@ -0,0 +1,176 @@
+// Copyright 2025 Accenture.
+
+#include "epollSocket/udp/EpollDatagramSocket.h"
+
+#include "epollSocket/EpollLoop.h"
+
+#include <udp/DataListenerMock.h>
+#include <udp/DatagramPacket.h>
+
+#include <gmock/gmock.h>
+
+namespace
+{
+using namespace ::udp;
+using namespace ::testing;
+
+uint16_t const RX_PORT = 48514U;
+uint16_t const TX_PORT = 48515U;
+
+::ip::IPAddress const LOCALHOST = ::ip::make_ip4(127U, 0U, 0U, 1U);
+
+class EpollDatagramSocketTest : public Test
+{
+public:
+    EpollDatagramSocketTest() : _loop(), _receiver(_loop), _sender(_loop) {}
+
+    template<class Predicate>
+    bool pollUntil(Predicate const& predicate)
+    {
+        for (size_t i = 0U; (i < 200U) && (!predicate()); ++i)
+        {
+            (void)_loop.poll(10);
+        }
+        return predicate();
+    }
+
+protected:
+    ::ethernet::EpollLoop _loop;
+    StrictMock<DataListenerMock> _receiverListener;
+    StrictMock<DataListenerMock> _senderListener;
+    EpollDatagramSocket _receiver;
+    EpollDatagramSocket _sender;
+};
+
+/**
+ * \desc
+ * Verifies the behaviour of a socket that is neither bound nor connected.
+ */
+TEST_F(EpollDatagramSocketTest, testUnboundSocket)
+{
+    uint8_t const data[] = {1U, 2U};
+    EXPECT_TRUE(_receiver.isClosed());
+    EXPECT_FALSE(_receiver.isBound());
+    EXPECT_FALSE(_receiver.isConnected());
+    EXPECT_EQ(
+        AbstractDatagramSocket::ErrorCode::UDP_SOCKET_NO_DATA_LISTENER,
+        _receiver.bind(&LOCALHOST, RX_PORT));
+    EXPECT_EQ(AbstractDatagramSocket::ErrorCode::UDP_SOCKET_NOT_OK, _receiver.send(data));
+    EXPECT_EQ(AbstractDatagramSocket::INVALID_PORT, _receiver.getLocalPort());
+    EXPECT_EQ(AbstractDatagramSocket::INVALID_PORT, _receiver.getPort());
+    EXPECT_EQ(nullptr, _receiver.getIPAddress());
+    EXPECT_EQ(nullptr, _receiver.getLocalIPAddress());
+    EXPECT_EQ(0U, _receiver.read(nullptr, 1U));
+    EXPECT_EQ(
+        AbstractDatagramSocket::ErrorCode::UDP_SOCKET_NOT_OK,
+        _receiver.connect(::ip::IPAddress(), RX_PORT, nullptr));
+}
+
+/**
+ * \desc
+ * Verifies that datagrams sent from a connected socket are passed to the data listener of a bound
+ * socket with source and destination address, and that the datagram can be read in parts.
+ */
+TEST_F(EpollDatagramSocketTest, testSendToBoundSocket)
+{
+    _receiver.setDataListener(&_receiverListener);
+    ASSERT_EQ(
+        AbstractDatagramSocket::ErrorCode::UDP_SOCKET_OK, _receiver.bind(&LOCALHOST, RX_PORT));
+    EXPECT_TRUE(_receiver.isBound());
+    EXPECT_EQ(RX_PORT, _receiver.getLocalPort());
+
+    _sender.setDataListener(&_senderListener);
+    ASSERT_EQ(AbstractDatagramSocket::ErrorCode::UDP_SOCKET_OK, _sender.bind(&LOCALHOST, TX_PORT));
+    ASSERT_EQ(
+        AbstractDatagramSocket::ErrorCode::UDP_SOCKET_OK,
+        _sender.connect(LOCALHOST, RX_PORT, nullptr));
+    EXPECT_FALSE(_sender.isClosed());
+    EXPECT_EQ(
+        AbstractDatagramSocket::ErrorCode::UDP_SOCKET_NOT_OK,
+        _sender.connect(LOCALHOST, RX_PORT, nullptr));
+    EXPECT_EQ(RX_PORT, _sender.getPort());
+    ASSERT_NE(nullptr, _sender.getIPAddress());
+    EXPECT_EQ(LOCALHOST, *_sender.getIPAddress());
+    ASSERT_NE(nullptr, _sender.getLocalIPAddress());
+    EXPECT_EQ(LOCALHOST, *_sender.getLocalIPAddress());
+
+    uint8_t const data[] = {1U, 2U, 3U, 4U, 5U};
+    uint8_t buffer[8]    = {};
+    size_t receivedCount = 0U;
+    EXPECT_CALL(
+        _receiverListener, dataReceived(Ref(_receiver), LOCALHOST, TX_PORT, LOCALHOST, 5U))
+        .WillOnce(Invoke(
+            [&](AbstractDatagramSocket&, ::ip::IPAddress, uint16_t, ::ip::IPAddress, uint16_t)
+            {
+                EXPECT_EQ(2U, _receiver.read(&buffer[0], 2U));
+                EXPECT_EQ(1U, _receiver.read(nullptr, 1U));
+                EXPECT_EQ(2U, _receiver.read(&buffer[2], 8U));
+                ++receivedCount;
+            }))
+        .WillOnce(Invoke(
+            [&](AbstractDatagramSocket&, ::ip::IPAddress, uint16_t, ::ip::IPAddress, uint16_t)
+            { ++receivedCount; }));
+    EXPECT_EQ(AbstractDatagramSocket::ErrorCode::UDP_SOCKET_OK, _sender.send(data));
+    EXPECT_EQ(AbstractDatagramSocket::ErrorCode::UDP_SOCKET_OK, _sender.send(data));
+    EXPECT_TRUE(pollUntil([&receivedCount] { return receivedCount == 2U; }));
+    EXPECT_THAT(buffer, ElementsAre(1U, 2U, 4U, 5U, 0U, 0U, 0U, 0U));
+    // the unread datagram has been dropped
+    EXPECT_EQ(0U, _receiver.read(&buffer[0], 1U));
+
+    _sender.disconnect();
+    EXPECT_FALSE(_sender.isConnected());
+    EXPECT_EQ(AbstractDatagramSocket::ErrorCode::UDP_SOCKET_NOT_OK, _sender.send(data));
+}
+
+/**
+ * \desc
+ * Verifies that datagram packets are sent from the local port of a bound socket, and from an
+ * arbitrary port otherwise.
+ */
+TEST_F(EpollDatagramSocketTest, testSendDatagramPacket)
+{
+    _receiver.setDataListener(&_receiverListener);
+    ASSERT_EQ(AbstractDatagramSocket::ErrorCode::UDP_SOCKET_OK, _receiver.bind(nullptr, RX_PORT));
+
+    uint8_t const data[] = {1U, 2U, 3U};
+    bool received        = false;
+    EXPECT_CALL(_receiverListener, dataReceived(Ref(_receiver), LOCALHOST, Ne(TX_PORT), _, 3U))
+        .WillOnce(Assign(&received, true));
+    EXPECT_EQ(
+        AbstractDatagramSocket::ErrorCode::UDP_SOCKET_OK,
+        _sender.send(DatagramPacket(data, sizeof(data), LOCALHOST, RX_PORT)));
+    EXPECT_TRUE(pollUntil([&received] { return received; }));
+    Mock::VerifyAndClearExpectations(&_receiverListener);
+
+    _sender.setDataListener(&_senderListener);
+    ASSERT_EQ(AbstractDatagramSocket::ErrorCode::UDP_SOCKET_OK, _sender.bind(nullptr, TX_PORT));
+    received = false;
+    EXPECT_CALL(_receiverListener, dataReceived(Ref(_receiver), LOCALHOST, TX_PORT, LOCALHOST, 3U))
+        .WillOnce(Assign(&received, true));
+    EXPECT_EQ(
+        AbstractDatagramSocket::ErrorCode::UDP_SOCKET_OK,
+        _sender.send(DatagramPacket(data, sizeof(data), LOCALHOST, RX_PORT)));
+    EXPECT_TRUE(pollUntil([&received] { return received; }));
+
+    _receiver.close();
+    EXPECT_FALSE(_receiver.isBound());
+}
+
+/**
+ * \desc
+ * Verifies that multicast groups are joined once and only by a bound socket.
+ */
+TEST_F(EpollDatagramSocketTest, testJoin)
+{
+    ::ip::IPAddress const group = ::ip::make_ip4(239U, 192U, 0U, 1U);
+    EXPECT_EQ(AbstractDatagramSocket::ErrorCode::UDP_SOCKET_OK, _receiver.join(group));
+    _receiver.setDataListener(&_receiverListener);
+    ASSERT_EQ(
+        AbstractDatagramSocket::ErrorCode::UDP_SOCKET_OK, _receiver.bind(&LOCALHOST, RX_PORT));
+    EXPECT_EQ(AbstractDatagramSocket::ErrorCode::UDP_SOCKET_OK, _receiver.join(group));
+    EXPECT_EQ(AbstractDatagramSocket::ErrorCode::UDP_SOCKET_OK, _receiver.join(group));
+    _receiver.close();
+    EXPECT_EQ(AbstractDatagramSocket::ErrorCode::UDP_SOCKET_OK, _receiver.join(group));
+}
+
+} // namespace
@@ -0,0 +1,91 @@
+// Copyright 2024 Accenture.
+
+#include <benchmark/benchmark.h>
+#include <can/SocketCanTransceiver.h>
+#include <can/canframes/CANFrame.h>
+#include <can/filter/IntervalFilter.h>
+#include <can/framemgmt/ICANFrameListener.h>
+
+/**
+ * Throughput benchmarks of SocketCanTransceiver with and without batched I/O.
+ *
+ * The benchmarks need a virtual CAN interface:
+ *
+ *   sudo ip link add dev vcan0 type vcan
+ *   sudo ip link set up vcan0
+ */
+
+namespace
+{
+uint32_t const FRAMES_PER_ITERATION = 16U;
+
+class CountingListener : public ::can::ICANFrameListener
+{
+public:
+    CountingListener() : _filter(0U, 0x7FFU), _receivedCount(0U) {}
+
+    void frameReceived(::can::CANFrame const& /* canFrame */) override { ++_receivedCount; }
+
+    ::can::IFilter& getFilter() override { return _filter; }
+
+    uint32_t getReceivedCount() const { return _receivedCount; }
+
+private:
+    ::can::IntervalFilter _filter;
+    uint32_t _receivedCount;
+};
+
+/**
+ * Sends state.range(0) frames per run() through one transceiver and receives them with a second
+ * one on the same interface.
+ */
+void runThroughput(benchmark::State& state, bool const batchedIo)
+{
+    ::can::SocketCanTransceiver::DeviceConfig const config{"vcan0", 0U, batchedIo};
+    ::can::SocketCanTransceiver sender(config);
+    ::can::SocketCanTransceiver receiver(config);
+    CountingListener listener;
+    receiver.addCANFrameListener(listener);
+    (void)sender.init();
+    (void)sender.open();
+    (void)receiver.init();
+    (void)receiver.open();
+
+    int const framesPerRun = static_cast<int>(state.range(0));
+    uint8_t const payload[8] = {0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U};
+    ::can::CANFrame frame(0x123U, payload, sizeof(payload));
+    uint32_t sentCount = 0U;
+    while (state.KeepRunning())
+    {
+        for (uint32_t i = 0U; i < FRAMES_PER_ITERATION; i += static_cast<uint32_t>(framesPerRun))
+        {
+            for (int j = 0; j < framesPerRun; ++j)
+            {
+                if (sender.write(frame) == ::can::ICanTransceiver::ErrorCode::CAN_ERR_OK)
+                {
+                    ++sentCount;
+                }
+            }
+            sender.run(framesPerRun, 0);
+            receiver.run(0, framesPerRun);
+        }
+    }
+    // collect frames still pending in the socket
+    receiver.run(0, static_cast<int>(FRAMES_PER_ITERATION));
+
+    state.counters["sent"]     = sentCount;
+    state.counters["received"] = listener.getReceivedCount();
+    state.SetItemsProcessed(static_cast<int64_t>(listener.getReceivedCount()));
+
+    receiver.removeCANFrameListener(listener);
+    (void)receiver.close();
+    (void)sender.close();
+}
+} // namespace
+
+void BM_throughput_single(benchmark::State& state) { runThroughput(state, false); }
+
+void BM_throughput_batched(benchmark::State& state) { runThroughput(state, true); }
+
+BENCHMARK(BM_throughput_single)->RangeMultiplier(2)->Range(1, 16);
+BENCHMARK(BM_throughput_batched)->RangeMultiplier(2)->Range(1, 16);
@@ -0,0 +1,69 @@
+// Copyright 2024 Accenture.
+
+#pragma once
+
+#include <can/filter/BitFieldFilter.h>
+#include <can/filter/IMerger.h>
+#include <linux/can.h>
+
+#include <etl/span.h>
+#include <etl/vector.h>
+
+#include <platform/estdint.h>
+
+namespace can
+{
+
+/**
+ * Computes the SocketCAN kernel filters (CAN_RAW_FILTER) for a set of listener filters.
+ *
+ * The filters are merged into a bit field of the base identifiers and a sorted list of extended
+ * identifier intervals. Consecutive identifiers are coalesced into ranges, which are then split
+ * into aligned id/mask pairs. If more pairs are needed than the filter buffer can hold, the
+ * ranges separated by the smallest gaps are joined. The kernel filter may therefore accept more
+ * identifiers than requested, but never less. The exact filtering is still done in
+ * AbstractCANTransceiver::notifyListeners().
+ */
+class SocketCanFilter final : public IMerger
+{
+public:
+    /// Maximum number of distinct extended identifier intervals, further ones are joined.
+    static constexpr size_t MAX_EXTENDED_RANGES = 16U;
+
+    SocketCanFilter();
+
+    SocketCanFilter(SocketCanFilter const&)            = delete;
+    SocketCanFilter& operator=(SocketCanFilter const&) = delete;
+
+    void mergeWithBitField(BitFieldFilter const& filter) override;
+    void mergeWithStaticBitField(AbstractStaticBitFieldFilter const& filter) override;
+    void mergeWithInterval(IntervalFilter const& filter) override;
+
+    /**
+     * Writes the kernel filters for all merged filters.
+     * \param filters buffer to write the id/mask pairs to
+     * \return number of pairs written, 0 if no frame shall be received at all
+     */
+    size_t getFilters(::etl::span<can_filter> filters) const;
+
+private:
+    struct Range
+    {
+        uint32_t from;
+        uint32_t to;
+    };
+
+    void addExtendedRange(uint32_t from, uint32_t to);
+
+    template<class F>
+    void forEachBaseRange(uint32_t maxGap, F&& function) const;
+    template<class F>
+    void forEachExtendedRange(uint32_t maxGap, F&& function) const;
+
+    size_t countFilters(uint32_t maxGap) const;
+
+    BitFieldFilter _baseIds;
+    ::etl::vector<Range, MAX_EXTENDED_RANGES> _extendedRanges;
+};
+
+} // namespace can
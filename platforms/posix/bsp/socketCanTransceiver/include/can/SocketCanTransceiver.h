@@ -17,6 +17,15 @@ namespace can
  * run in the same task context. The deviation from this can result in unobvious UBs.
  * The transceiver state change detection is currently not implemented,
  * the corresponding callback is never called.
+ *
+ * If DeviceConfig::batchedIo is set, run() passes all queued frames to the kernel with a single
+ * sendmmsg() call and fetches the received frames with a single recvmmsg() call instead of
+ * making one write()/read() system call per frame. Frames the kernel doesn't accept are kept and
+ * sent again on the next run, in either mode.
+ *
+ * The filters of the registered CANFrameListeners are installed as kernel filters
+ * (CAN_RAW_FILTER) on the socket, so that frames nobody listens to don't wake up the task.
+ * They are refreshed whenever a listener is added or removed.
  */
 class SocketCanTransceiver final : public AbstractCANTransceiver
 {
@@ -29,8 +38,9 @@ public:
      */
     struct DeviceConfig
     {
-        char const* name; /// SocketCAN interface name
-        uint8_t busId;    /// currently not used
+        char const* name;       /// SocketCAN interface name
+        uint8_t busId;          /// currently not used
+        bool batchedIo = false; /// send and receive frames in batches
     };
 
     explicit SocketCanTransceiver(DeviceConfig const& config);
@@ -62,6 +72,10 @@ public:
 private:
     static constexpr size_t TX_NUM_ELEMENTS       = 16U;
     static constexpr size_t TX_ELEMENT_SIZE_BYTES = sizeof(CANFrame) + sizeof(void*);
+    static constexpr size_t MAX_BATCH_SIZE        = 32U;
+    static constexpr size_t MAX_FILTER_COUNT      = 64U;
+    /// Size of the ancillary data buffer, holds the SCM_TIMESTAMPNS receive timestamp.
+    static constexpr size_t CONTROL_BUFFER_SIZE   = 64U;
 
     using ElementSizeType = uint16_t;
     static constexpr size_t TX_QUEUE_SIZE_BYTES
@@ -73,14 +87,30 @@ private:
 
     ICanTransceiver::ErrorCode writeImpl(CANFrame const& frame, ICANFrameSentListener* listener);
 
+    void listenersChanged() final;
+
     // these functions are making system calls and shall be signal-masked
     void guardedOpen();
     void guardedClose();
+    void guardedSetFilter(int fd);
     void guardedRun(int maxSentPerRun, int maxReceivedPerRun);
+    void guardedSend(int maxSentPerRun);
+    void guardedReceive(int maxReceivedPerRun);
+    void guardedSendBatched(int maxSentPerRun);
+    void guardedReceiveBatched(int maxReceivedPerRun);
+
+    bool peekTxFrame(CANFrame& canFrame, ICANFrameSentListener*& listener);
+    void frameSent(CANFrame const& canFrame, ICANFrameSentListener* listener);
+    void frameDropped(CANFrame const& canFrame, int error);
+    void frameReceived(uint8_t const* buffer, size_t length, uint32_t timestamp);
 
     TxQueue _txQueue;
     ::io::MemoryQueueReader<TxQueue> _txReader;
     ::io::MemoryQueueWriter<TxQueue> _txWriter;
+    // frames taken from the TX queue in batched mode that haven't been accepted by the kernel yet
+    CANFrame _txBatchFrames[MAX_BATCH_SIZE];
+    ICANFrameSentListener* _txBatchListeners[MAX_BATCH_SIZE];
+    size_t _txBatchCount;
 
     DeviceConfig const& _config;
 
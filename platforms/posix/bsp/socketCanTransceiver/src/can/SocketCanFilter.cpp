@@ -0,0 +1,224 @@
+// Copyright 2024 Accenture.
+
+#include "can/SocketCanFilter.h"
+
+#include <can/canframes/CanId.h>
+#include <can/filter/IntervalFilter.h>
+
+#include <etl/algorithm.h>
+
+namespace can
+{
+namespace
+{
+/**
+ * Splits the range [from, to] into the minimum number of blocks with a power of two size that
+ * are aligned to their size, i.e. that can be expressed with a single id/mask pair.
+ */
+template<class F>
+void forEachBlock(uint32_t from, uint32_t const to, F&& function)
+{
+    while (true)
+    {
+        uint32_t size = 1U;
+        while (((from & ((size << 1U) - 1U)) == 0U) && ((to - from) >= ((size << 1U) - 1U)))
+        {
+            size <<= 1U;
+        }
+        function(from, size);
+        if ((to - from) < size)
+        {
+            break;
+        }
+        from += size;
+    }
+}
+
+size_t countBlocks(uint32_t const from, uint32_t const to)
+{
+    size_t count = 0U;
+    forEachBlock(from, to, [&count](uint32_t, uint32_t) { ++count; });
+    return count;
+}
+
+} // namespace
+
+// needed if ODR-used
+size_t const SocketCanFilter::MAX_EXTENDED_RANGES;
+
+SocketCanFilter::SocketCanFilter() : _baseIds(), _extendedRanges() {}
+
+void SocketCanFilter::mergeWithBitField(BitFieldFilter const& filter)
+{
+    _baseIds.mergeWithBitField(filter);
+}
+
+void SocketCanFilter::mergeWithStaticBitField(AbstractStaticBitFieldFilter const& filter)
+{
+    _baseIds.mergeWithStaticBitField(filter);
+}
+
+void SocketCanFilter::mergeWithInterval(IntervalFilter const& filter)
+{
+    // the base identifier part is capped by the bit field
+    _baseIds.mergeWithInterval(filter);
+    uint32_t const lowerBound = filter.getLowerBound();
+    uint32_t const upperBound = filter.getUpperBound();
+    if (CanId::isExtended(upperBound) && (lowerBound <= upperBound))
+    {
+        uint32_t const from = CanId::isExtended(lowerBound) ? CanId::rawId(lowerBound) : 0U;
+        addExtendedRange(from, CanId::rawId(upperBound));
+    }
+}
+
+size_t SocketCanFilter::getFilters(::etl::span<can_filter> const filters) const
+{
+    // smallest gap that needs to be bridged to fit into the buffer
+    uint32_t maxGap = 0U;
+    while (countFilters(maxGap) > filters.size())
+    {
+        if (maxGap >= CAN_EFF_MASK)
+        {
+            if (filters.empty())
+            {
+                return 0U;
+            }
+            // not even the joined ranges fit, accept all frames
+            filters[0].can_id   = 0U;
+            filters[0].can_mask = 0U;
+            return 1U;
+        }
+        maxGap = (maxGap << 1U) | 1U;
+    }
+
+    size_t count = 0U;
+    auto const append = [&filters, &count](canid_t const id, canid_t const mask)
+    {
+        if (count < filters.size())
+        {
+            filters[count].can_id   = id;
+            filters[count].can_mask = mask;
+            ++count;
+        }
+    };
+    forEachBaseRange(
+        maxGap,
+        [&append](Range const& range)
+        {
+            forEachBlock(
+                range.from,
+                range.to,
+                [&append](uint32_t const id, uint32_t const size)
+                { append(id, CAN_EFF_FLAG | (CAN_SFF_MASK & ~(size - 1U))); });
+        });
+    forEachExtendedRange(
+        maxGap,
+        [&append](Range const& range)
+        {
+            forEachBlock(
+                range.from,
+                range.to,
+                [&append](uint32_t const id, uint32_t const size)
+                { append(CAN_EFF_FLAG | id, CAN_EFF_FLAG | (CAN_EFF_MASK & ~(size - 1U))); });
+        });
+    return count;
+}
+
+void SocketCanFilter::addExtendedRange(uint32_t const from, uint32_t const to)
+{
+    // first range that is not completely before the new one and not adjacent to it
+    auto it = _extendedRanges.begin();
+    while ((it != _extendedRanges.end()) && ((it->to + 1U) < from))
+    {
+        ++it;
+    }
+
+    if ((it != _extendedRanges.end()) && (it->from <= (to + 1U)))
+    {
+        // overlapping or adjacent: extend the existing range and absorb its successors
+        it->from  = ::etl::min(it->from, from);
+        it->to    = ::etl::max(it->to, to);
+        auto next = it + 1;
+        while ((next != _extendedRanges.end()) && (next->from <= (it->to + 1U)))
+        {
+            it->to = ::etl::max(it->to, next->to);
+            next   = _extendedRanges.erase(next);
+        }
+    }
+    else if (!_extendedRanges.full())
+    {
+        (void)_extendedRanges.insert(it, Range{from, to});
+    }
+    else if (
+        (it == _extendedRanges.end())
+        || ((it != _extendedRanges.begin()) && ((from - (it - 1)->to) < (it->from - to))))
+    {
+        // join with the nearest preceding range
+        (it - 1)->to = to;
+    }
+    else
+    {
+        // join with the nearest following range
+        it->from = from;
+    }
+}
+
+template<class F>
+void SocketCanFilter::forEachBaseRange(uint32_t const maxGap, F&& function) const
+{
+    bool inRange = false;
+    Range range{0U, 0U};
+    for (uint32_t id = 0U; id <= BitFieldFilter::MAX_ID; ++id)
+    {
+        if (!_baseIds.match(id))
+        {
+            continue;
+        }
+        if (inRange && ((id - range.to - 1U) <= maxGap))
+        {
+            range.to = id;
+        }
+        else
+        {
+            if (inRange)
+            {
+                function(range);
+            }
+            range   = Range{id, id};
+            inRange = true;
+        }
+    }
+    if (inRange)
+    {
+        function(range);
+    }
+}
+
+template<class F>
+void SocketCanFilter::forEachExtendedRange(uint32_t const maxGap, F&& function) const
+{
+    auto it = _extendedRanges.begin();
+    while (it != _extendedRanges.end())
+    {
+        Range range = *it;
+        ++it;
+        while ((it != _extendedRanges.end()) && ((it->from - range.to - 1U) <= maxGap))
+        {
+            range.to = it->to;
+            ++it;
+        }
+        function(range);
+    }
+}
+
+size_t SocketCanFilter::countFilters(uint32_t const maxGap) const
+{
+    size_t count = 0U;
+    auto const countRange
+        = [&count](Range const& range) { count += countBlocks(range.from, range.to); };
+    forEachBaseRange(maxGap, countRange);
+    forEachExtendedRange(maxGap, countRange);
+    return count;
+}
+
+} // namespace can
@@ -2,20 +2,27 @@
 
 #include "can/SocketCanTransceiver.h"
 
+#include "can/SocketCanFilter.h"
+
+#include <bsp/timer/SystemTimer.h>
 #include <can/CanLogger.h>
 #include <can/canframes/ICANFrameSentListener.h>
+#include <interrupts/SuspendResumeAllInterruptsScopedLock.h>
 #include <linux/can.h>
 #include <linux/can/raw.h>
 #include <net/if.h>
 #include <sys/ioctl.h>
 #include <sys/socket.h>
 
+#include <cerrno>
 #include <fcntl.h>
 #include <signal.h>
+#include <time.h>
 #include <type_traits>
 #include <unistd.h>
 
 #include <etl/char_traits.h>
+#include <etl/algorithm.h>
 #include <etl/error_handler.h>
 #include <etl/span.h>
 #include <sys/types.h>
@@ -44,16 +51,72 @@ void signalGuarded(F&& function)
     pthread_sigmask(SIG_SETMASK, &oldSet, nullptr);
 }
 
+void toSocketCanFrame(CANFrame const& canFrame, can_frame& socketCanFrame)
+{
+    ::std::memset(&socketCanFrame, 0, sizeof(socketCanFrame));
+    socketCanFrame.can_id  = canFrame.getId();
+    int const length       = canFrame.getPayloadLength();
+    socketCanFrame.can_dlc = length;
+    ::std::memcpy(socketCanFrame.data, canFrame.getPayload(), length);
+}
+
+/**
+ * Returns true if a send error only means that the socket cannot take the frame right now.
+ * SocketCAN reports a full device queue with ENOBUFS rather than EAGAIN.
+ */
+bool isTransientSendError(int const error)
+{
+    return (error == EAGAIN) || (error == EWOULDBLOCK) || (error == ENOBUFS);
+}
+
+/**
+ * Returns the kernel receive timestamp of a message in the timebase of getSystemTimeUs32Bit().
+ * The kernel stamps frames with CLOCK_REALTIME, so the age of the frame is determined from the
+ * current real time and subtracted from the current system time. Messages without a timestamp
+ * are stamped with the current system time.
+ */
+uint32_t getReceiveTimestamp(msghdr& message)
+{
+    uint32_t const systemTimeUs = getSystemTimeUs32Bit();
+    for (cmsghdr* header = CMSG_FIRSTHDR(&message); header != nullptr;
+         header         = CMSG_NXTHDR(&message, header))
+    {
+        if ((header->cmsg_level == SOL_SOCKET) && (header->cmsg_type == SCM_TIMESTAMPNS))
+        {
+            timespec received;
+            ::std::memcpy(&received, CMSG_DATA(header), sizeof(received));
+            timespec now;
+            (void)clock_gettime(CLOCK_REALTIME, &now);
+            int64_t const ageNs
+                = ((static_cast<int64_t>(now.tv_sec) - static_cast<int64_t>(received.tv_sec))
+                   * 1000000000)
+                  + (static_cast<int64_t>(now.tv_nsec) - static_cast<int64_t>(received.tv_nsec));
+            if (ageNs > 0)
+            {
+                return systemTimeUs - static_cast<uint32_t>(ageNs / 1000);
+            }
+            break;
+        }
+    }
+    return systemTimeUs;
+}
+
 } // namespace
 
 // needed if ODR-used
 size_t const SocketCanTransceiver::TX_QUEUE_SIZE_BYTES;
+size_t const SocketCanTransceiver::MAX_BATCH_SIZE;
+size_t const SocketCanTransceiver::MAX_FILTER_COUNT;
+size_t const SocketCanTransceiver::CONTROL_BUFFER_SIZE;
 
 SocketCanTransceiver::SocketCanTransceiver(DeviceConfig const& config)
 : AbstractCANTransceiver(config.busId)
 , _txQueue()
 , _txReader(_txQueue)
 , _txWriter(_txQueue)
+, _txBatchFrames()
+, _txBatchListeners()
+, _txBatchCount(0U)
 , _config(config)
 , _fileDescriptor(-1)
 , _writable(false)
@@ -162,6 +225,14 @@ void SocketCanTransceiver::run(int maxSentPerRun, int maxReceivedPerRun)
                   { guardedRun(maxSentPerRun, maxReceivedPerRun); });
 }
 
+void SocketCanTransceiver::listenersChanged()
+{
+    if (_fileDescriptor >= 0)
+    {
+        signalGuarded([this] { guardedSetFilter(_fileDescriptor); });
+    }
+}
+
 void SocketCanTransceiver::guardedOpen()
 {
     char const* const name = _config.name;
@@ -207,6 +278,21 @@ void SocketCanTransceiver::guardedOpen()
         return;
     }
 
+    int const enableTimestamp = 1;
+    error                     = setsockopt(
+        fd, SOL_SOCKET, SO_TIMESTAMPNS, &enableTimestamp, sizeof(enableTimestamp));
+    if (error < 0)
+    {
+        // not fatal, frames are stamped on reception in user space instead
+        Logger::warn(
+            CAN,
+            "[SocketCanTransceiver] Failed to enable receive timestamps (node=%s, error=%d)",
+            name,
+            error);
+    }
+
+    guardedSetFilter(fd);
+
     struct sockaddr_can addr;
     ::std::memset(&addr, 0, sizeof(addr));
     addr.can_family  = AF_CAN;
@@ -226,6 +312,39 @@ void SocketCanTransceiver::guardedClose()
 {
     ::close(_fileDescriptor);
     _fileDescriptor = -1;
+    // the listeners of frames kept from a batch may be gone when the transceiver is reopened
+    _txBatchCount   = 0U;
+    ::etl::fill(_txBatchListeners, _txBatchListeners + MAX_BATCH_SIZE, nullptr);
+}
+
+void SocketCanTransceiver::guardedSetFilter(int const fd)
+{
+    can_filter filters[MAX_FILTER_COUNT];
+    size_t count = 0U;
+    {
+        // the listeners may be changed from another context, the socket is configured afterwards
+        ::interrupts::SuspendResumeAllInterruptsScopedLock const lock;
+        SocketCanFilter filter;
+        for (auto& listener : _listeners)
+        {
+            listener.getFilter().acceptMerger(filter);
+        }
+        count = filter.getFilters(filters);
+    }
+    int const error    = setsockopt(
+        fd,
+        SOL_CAN_RAW,
+        CAN_RAW_FILTER,
+        (count > 0U) ? filters : nullptr,
+        static_cast<socklen_t>(count * sizeof(can_filter)));
+    if (error < 0)
+    {
+        Logger::error(
+            CAN,
+            "[SocketCanTransceiver] Failed to set filter (node=%s, error=%d)",
+            _config.name,
+            error);
+    }
 }
 
 void SocketCanTransceiver::guardedRun(int maxSentPerRun, int maxReceivedPerRun)
@@ -233,63 +352,246 @@ void SocketCanTransceiver::guardedRun(int maxSentPerRun, int maxReceivedPerRun)
     // MUTED condition does not affect the messages already in the write queue;
     // the idea is that once we confirmed that we had accepted the message for delivery,
     // we shall try to deliver it.
+    if (_config.batchedIo)
+    {
+        guardedSendBatched(maxSentPerRun);
+        guardedReceiveBatched(maxReceivedPerRun);
+    }
+    else
+    {
+        guardedSend(maxSentPerRun);
+        guardedReceive(maxReceivedPerRun);
+    }
+}
+
+void SocketCanTransceiver::guardedSend(int const maxSentPerRun)
+{
     for (int count = 0; count < maxSentPerRun; ++count)
     {
-        auto memory = _txReader.peek();
-        if (memory.size() < TX_ELEMENT_SIZE_BYTES)
+        CANFrame canFrame;
+        ICANFrameSentListener* listener = nullptr;
+        if (!peekTxFrame(canFrame, listener))
         {
             break;
         }
-        CANFrame canFrame;
-        ::std::memcpy(static_cast<void*>(&canFrame), memory.data(), sizeof(canFrame));
-        ICANFrameSentListener* listener = nullptr;
-        ::std::memcpy(
-            static_cast<void*>(&listener), memory.data() + sizeof(canFrame), sizeof(void*));
-        _txReader.release();
         can_frame socketCanFrame;
-        ::std::memset(&socketCanFrame, 0, sizeof(socketCanFrame));
-        socketCanFrame.can_id  = canFrame.getId();
-        int length             = canFrame.getPayloadLength();
-        socketCanFrame.can_dlc = length;
-        ::std::memcpy(socketCanFrame.data, canFrame.getPayload(), length);
-        ::std::memset(socketCanFrame.data + length, 0, sizeof(socketCanFrame.data) - length);
+        toSocketCanFrame(canFrame, socketCanFrame);
         ssize_t const bytesWritten
             = ::write(_fileDescriptor, reinterpret_cast<char*>(&socketCanFrame), CAN_MTU);
-        if (bytesWritten != CAN_MTU)
+        int const error = (bytesWritten < 0) ? errno : 0;
+        if ((bytesWritten < 0) && isTransientSendError(error))
         {
+            // the frame stays queued and is written again on the next run
             break;
         }
-        if (listener != nullptr)
+        _txReader.release();
+        if (bytesWritten == CAN_MTU)
         {
-            listener->canFrameSent(canFrame);
+            frameSent(canFrame, listener);
+        }
+        else
+        {
+            frameDropped(canFrame, error);
         }
-        notifySentListeners(canFrame);
     }
+}
 
+void SocketCanTransceiver::guardedReceive(int const maxReceivedPerRun)
+{
+    static_assert(
+        CMSG_SPACE(sizeof(timespec)) <= CONTROL_BUFFER_SIZE,
+        "control buffer too small for the receive timestamp");
     for (int count = 0; count < maxReceivedPerRun; ++count)
     {
         alignas(can_frame) uint8_t buffer[CANFD_MTU];
-        ssize_t const length = read(_fileDescriptor, reinterpret_cast<char*>(buffer), CANFD_MTU);
+        alignas(cmsghdr) uint8_t control[CONTROL_BUFFER_SIZE];
+        iovec vector;
+        vector.iov_base = buffer;
+        vector.iov_len  = CANFD_MTU;
+        msghdr message;
+        ::std::memset(&message, 0, sizeof(message));
+        message.msg_iov        = &vector;
+        message.msg_iovlen     = 1U;
+        message.msg_control    = control;
+        message.msg_controllen = sizeof(control);
+        ssize_t const length   = recvmsg(_fileDescriptor, &message, 0);
         if (length < 0)
         {
             break;
         }
-        if (length == CAN_MTU)
+        frameReceived(buffer, static_cast<size_t>(length), getReceiveTimestamp(message));
+    }
+}
+
+void SocketCanTransceiver::guardedSendBatched(int const maxSentPerRun)
+{
+    can_frame socketCanFrames[MAX_BATCH_SIZE];
+    iovec vectors[MAX_BATCH_SIZE];
+    mmsghdr messages[MAX_BATCH_SIZE];
+    ::std::memset(messages, 0, sizeof(messages));
+
+    int remaining = maxSentPerRun;
+    while (remaining > 0)
+    {
+        size_t const batchSize = ::etl::min(static_cast<size_t>(remaining), MAX_BATCH_SIZE);
+        // frames not accepted by a previous sendmmsg() call are sent first
+        while ((_txBatchCount < batchSize)
+               && peekTxFrame(_txBatchFrames[_txBatchCount], _txBatchListeners[_txBatchCount]))
+        {
+            _txReader.release();
+            ++_txBatchCount;
+        }
+        size_t const count = ::etl::min(_txBatchCount, batchSize);
+        if (count == 0U)
+        {
+            break;
+        }
+        for (size_t i = 0U; i < count; ++i)
+        {
+            toSocketCanFrame(_txBatchFrames[i], socketCanFrames[i]);
+            vectors[i].iov_base            = &socketCanFrames[i];
+            vectors[i].iov_len             = CAN_MTU;
+            messages[i].msg_hdr.msg_iov    = &vectors[i];
+            messages[i].msg_hdr.msg_iovlen = 1U;
+        }
+        int const result = sendmmsg(_fileDescriptor, messages, static_cast<unsigned>(count), 0);
+        int const error  = (result < 0) ? errno : 0;
+        if ((result < 0) && isTransientSendError(error))
+        {
+            // the batch is kept and sent again on the next run
+            break;
+        }
+        size_t done = 0U;
+        if (result < 0)
+        {
+            // the first frame of the batch cannot be sent at all
+            frameDropped(_txBatchFrames[0U], error);
+            done = 1U;
+        }
+        else
+        {
+            done = static_cast<size_t>(result);
+            for (size_t i = 0U; i < done; ++i)
+            {
+                if (messages[i].msg_len == CAN_MTU)
+                {
+                    frameSent(_txBatchFrames[i], _txBatchListeners[i]);
+                }
+                else
+                {
+                    frameDropped(_txBatchFrames[i], 0);
+                }
+            }
+        }
+        // the frames the kernel didn't accept are kept for the next run
+        _txBatchCount -= done;
+        for (size_t i = 0U; i < _txBatchCount; ++i)
+        {
+            _txBatchFrames[i]    = _txBatchFrames[done + i];
+            _txBatchListeners[i] = _txBatchListeners[done + i];
+        }
+        // sendmmsg() reports the error of a partially sent batch with the next call
+        if ((result >= 0) && (done < count))
+        {
+            break;
+        }
+        remaining -= static_cast<int>(done);
+    }
+}
+
+void SocketCanTransceiver::guardedReceiveBatched(int const maxReceivedPerRun)
+{
+    alignas(can_frame) uint8_t buffers[MAX_BATCH_SIZE][CANFD_MTU];
+    alignas(cmsghdr) uint8_t controls[MAX_BATCH_SIZE][CONTROL_BUFFER_SIZE];
+    iovec vectors[MAX_BATCH_SIZE];
+    mmsghdr messages[MAX_BATCH_SIZE];
+    ::std::memset(messages, 0, sizeof(messages));
+    for (size_t i = 0U; i < MAX_BATCH_SIZE; ++i)
+    {
+        vectors[i].iov_base            = buffers[i];
+        vectors[i].iov_len             = CANFD_MTU;
+        messages[i].msg_hdr.msg_iov    = &vectors[i];
+        messages[i].msg_hdr.msg_iovlen = 1U;
+    }
+
+    int remaining = maxReceivedPerRun;
+    while (remaining > 0)
+    {
+        size_t const batchSize = ::etl::min(static_cast<size_t>(remaining), MAX_BATCH_SIZE);
+        for (size_t i = 0U; i < batchSize; ++i)
         {
-            can_frame const& socketCanFrame = *reinterpret_cast<can_frame const*>(buffer);
-            Logger::debug(
-                CAN,
-                "[SocketCanTransceiver] received CAN frame, id=0x%X, length=%d",
-                static_cast<int>(socketCanFrame.can_id),
-                static_cast<int>(socketCanFrame.can_dlc));
-            CANFrame canFrame;
-            canFrame.setId(socketCanFrame.can_id);
-            canFrame.setPayload(socketCanFrame.data, socketCanFrame.can_dlc);
-            canFrame.setPayloadLength(socketCanFrame.can_dlc);
-            canFrame.setTimestamp(0);
-
-            notifyListeners(canFrame);
+            // the kernel shrinks msg_controllen to the length actually used
+            messages[i].msg_hdr.msg_control    = controls[i];
+            messages[i].msg_hdr.msg_controllen = CONTROL_BUFFER_SIZE;
         }
+        int const received = recvmmsg(
+            _fileDescriptor, messages, static_cast<unsigned>(batchSize), MSG_DONTWAIT, nullptr);
+        if (received <= 0)
+        {
+            break;
+        }
+        for (size_t i = 0U; i < static_cast<size_t>(received); ++i)
+        {
+            frameReceived(
+                buffers[i], messages[i].msg_len, getReceiveTimestamp(messages[i].msg_hdr));
+        }
+        if (static_cast<size_t>(received) < batchSize)
+        {
+            break;
+        }
+        remaining -= received;
+    }
+}
+
+bool SocketCanTransceiver::peekTxFrame(CANFrame& canFrame, ICANFrameSentListener*& listener)
+{
+    auto memory = _txReader.peek();
+    if (memory.size() < TX_ELEMENT_SIZE_BYTES)
+    {
+        return false;
+    }
+    ::std::memcpy(static_cast<void*>(&canFrame), memory.data(), sizeof(canFrame));
+    ::std::memcpy(static_cast<void*>(&listener), memory.data() + sizeof(canFrame), sizeof(void*));
+    return true;
+}
+
+void SocketCanTransceiver::frameSent(CANFrame const& canFrame, ICANFrameSentListener* listener)
+{
+    if (listener != nullptr)
+    {
+        listener->canFrameSent(canFrame);
+    }
+    notifySentListeners(canFrame);
+}
+
+void SocketCanTransceiver::frameDropped(CANFrame const& canFrame, int const error)
+{
+    Logger::error(
+        CAN,
+        "[SocketCanTransceiver] Dropped CAN frame (node=%s, id=0x%X, error=%d)",
+        _config.name,
+        static_cast<int>(canFrame.getId()),
+        error);
+}
+
+void SocketCanTransceiver::frameReceived(
+    uint8_t const* const buffer, size_t const length, uint32_t const timestamp)
+{
+    if (length == CAN_MTU)
+    {
+        can_frame const& socketCanFrame = *reinterpret_cast<can_frame const*>(buffer);
+        Logger::debug(
+            CAN,
+            "[SocketCanTransceiver] received CAN frame, id=0x%X, length=%d",
+            static_cast<int>(socketCanFrame.can_id),
+            static_cast<int>(socketCanFrame.can_dlc));
+        CANFrame canFrame;
+        canFrame.setId(socketCanFrame.can_id);
+        canFrame.setPayload(socketCanFrame.data, socketCanFrame.can_dlc);
+        canFrame.setPayloadLength(socketCanFrame.can_dlc);
+        canFrame.setTimestamp(timestamp);
+
+        notifyListeners(canFrame);
     }
 }
 
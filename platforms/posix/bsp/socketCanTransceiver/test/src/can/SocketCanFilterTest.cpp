@@ -0,0 +1,161 @@
+// Copyright 2024 Accenture.
+
+#include "can/SocketCanFilter.h"
+
+#include <can/canframes/CanId.h>
+#include <can/filter/BitFieldFilter.h>
+#include <can/filter/IntervalFilter.h>
+
+#include <gmock/gmock.h>
+
+namespace
+{
+using namespace ::can;
+using namespace ::testing;
+
+MATCHER_P2(IsFilter, id, mask, "")
+{
+    return (arg.can_id == static_cast<canid_t>(id)) && (arg.can_mask == static_cast<canid_t>(mask));
+}
+
+/// Checks whether a frame with the given identifier passes the kernel filters.
+bool accepts(::std::vector<can_filter> const& filters, canid_t const id)
+{
+    for (can_filter const& filter : filters)
+    {
+        if (((id ^ filter.can_id) & filter.can_mask) == 0U)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+class SocketCanFilterTest : public Test
+{
+protected:
+    ::std::vector<can_filter> getFilters(size_t const capacity = 64U)
+    {
+        ::std::vector<can_filter> filters(capacity);
+        filters.resize(_cut.getFilters(::etl::span<can_filter>(filters.data(), filters.size())));
+        return filters;
+    }
+
+    SocketCanFilter _cut;
+};
+
+/**
+ * \desc
+ * Verifies that no frame is accepted if no filter has been merged.
+ */
+TEST_F(SocketCanFilterTest, empty_filter_accepts_nothing)
+{
+    EXPECT_THAT(getFilters(), IsEmpty());
+}
+
+/**
+ * \desc
+ * Verifies that single base identifiers and ranges are converted into aligned id/mask pairs.
+ */
+TEST_F(SocketCanFilterTest, base_ranges_are_split_into_aligned_blocks)
+{
+    BitFieldFilter bitField;
+    bitField.add(0x123U);
+    bitField.add(0x200U, 0x20FU);
+    bitField.acceptMerger(_cut);
+    IntervalFilter interval(0x7F8U, 0x7FFU);
+    interval.acceptMerger(_cut);
+
+    EXPECT_THAT(
+        getFilters(),
+        ElementsAre(
+            IsFilter(0x123U, CAN_EFF_FLAG | 0x7FFU),
+            IsFilter(0x200U, CAN_EFF_FLAG | 0x7F0U),
+            IsFilter(0x7F8U, CAN_EFF_FLAG | 0x7F8U)));
+}
+
+/**
+ * \desc
+ * Verifies that the extended part of an interval filter is converted into extended filters.
+ */
+TEST_F(SocketCanFilterTest, extended_intervals_are_converted)
+{
+    IntervalFilter interval(
+        CanId::Extended<0x18DA0000U>::value, CanId::Extended<0x18DAFFFFU>::value);
+    interval.acceptMerger(_cut);
+    IntervalFilter overlapping(
+        CanId::Extended<0x18DA8000U>::value, CanId::Extended<0x18DB0000U>::value);
+    overlapping.acceptMerger(_cut);
+
+    EXPECT_THAT(
+        getFilters(),
+        ElementsAre(
+            IsFilter(CAN_EFF_FLAG | 0x18DA0000U, CAN_EFF_FLAG | 0x1FFF0000U),
+            IsFilter(CAN_EFF_FLAG | 0x18DB0000U, CAN_EFF_FLAG | 0x1FFFFFFFU)));
+}
+
+/**
+ * \desc
+ * Verifies that an open interval filter accepts all base and extended frames.
+ */
+TEST_F(SocketCanFilterTest, open_interval_accepts_everything)
+{
+    IntervalFilter interval;
+    interval.open();
+    interval.acceptMerger(_cut);
+
+    EXPECT_THAT(
+        getFilters(),
+        ElementsAre(IsFilter(0U, CAN_EFF_FLAG), IsFilter(CAN_EFF_FLAG, CAN_EFF_FLAG)));
+}
+
+/**
+ * \desc
+ * Verifies that the ranges are joined if the number of filters exceeds the capacity and that
+ * all requested identifiers are still accepted.
+ */
+TEST_F(SocketCanFilterTest, ranges_are_joined_to_fit_capacity)
+{
+    BitFieldFilter bitField;
+    for (uint32_t id = 0x100U; id < 0x400U; id += 0x11U)
+    {
+        bitField.add(id);
+    }
+    bitField.acceptMerger(_cut);
+    for (uint32_t i = 0U; i < 2U * SocketCanFilter::MAX_EXTENDED_RANGES; ++i)
+    {
+        IntervalFilter interval(
+            CanId::id(0x1000U + (i * 0x100U), true), CanId::id(0x1010U + (i * 0x100U), true));
+        interval.acceptMerger(_cut);
+    }
+
+    ::std::vector<can_filter> const filters = getFilters(16U);
+    EXPECT_THAT(filters.size(), AllOf(Gt(0U), Le(16U)));
+    for (uint32_t id = 0x100U; id < 0x400U; id += 0x11U)
+    {
+        EXPECT_TRUE(accepts(filters, id)) << id;
+    }
+    for (uint32_t i = 0U; i < 2U * SocketCanFilter::MAX_EXTENDED_RANGES; ++i)
+    {
+        EXPECT_TRUE(accepts(filters, CAN_EFF_FLAG | (0x1000U + (i * 0x100U)))) << i;
+        EXPECT_TRUE(accepts(filters, CAN_EFF_FLAG | (0x1010U + (i * 0x100U)))) << i;
+    }
+    EXPECT_FALSE(accepts(filters, 0x000U));
+    EXPECT_FALSE(accepts(filters, 0x7FFU));
+    EXPECT_FALSE(accepts(filters, CAN_EFF_FLAG | 0x100U));
+}
+
+/**
+ * \desc
+ * Verifies that everything is accepted if even the joined ranges don't fit.
+ */
+TEST_F(SocketCanFilterTest, accepts_everything_if_joined_ranges_do_not_fit)
+{
+    BitFieldFilter bitField;
+    bitField.add(0x001U, 0x7FEU);
+    bitField.acceptMerger(_cut);
+
+    EXPECT_THAT(getFilters(2U), ElementsAre(IsFilter(0U, 0U)));
+}
+
+} // namespace
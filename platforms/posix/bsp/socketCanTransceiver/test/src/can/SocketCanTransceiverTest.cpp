@@ -2,6 +2,8 @@
 
 #include "can/SocketCanTransceiver.h"
 
+#include <can/canframes/ICANFrameSentListener.h>
+
 #include <gtest/gtest.h>
 
 namespace
@@ -20,4 +22,82 @@ TEST(SocketCanTransceiverTest, transceiver_creation)
     EXPECT_EQ(transceiver.getState(), ::can::ICanTransceiver::State::CLOSED);
 }
 
+/**
+ * \desc
+ * Verifies that running a closed SocketCanTransceiver in batched mode neither sends nor receives
+ * anything.
+ */
+TEST(SocketCanTransceiverTest, batched_run_of_closed_transceiver)
+{
+    ::can::SocketCanTransceiver::DeviceConfig config{"vcan0", {}, true};
+    ::can::SocketCanTransceiver transceiver{config};
+    ::can::CANFrame frame;
+    EXPECT_EQ(transceiver.write(frame), ::can::ICanTransceiver::ErrorCode::CAN_ERR_ILLEGAL_STATE);
+    transceiver.run(3, 3);
+    EXPECT_EQ(transceiver.getState(), ::can::ICanTransceiver::State::CLOSED);
+}
+
+class SentListener : public ::can::ICANFrameSentListener
+{
+public:
+    void canFrameSent(::can::CANFrame const& /* frame */) override { ++_sentCount; }
+
+    size_t _sentCount = 0U;
+};
+
+/**
+ * \desc
+ * Verifies that frames failing with a persistent error are dropped without a sent callback, so
+ * that the transmission doesn't stall. The interface doesn't exist, so every system call fails.
+ */
+TEST(SocketCanTransceiverTest, frames_with_send_error_are_dropped)
+{
+    ::can::SocketCanTransceiver::DeviceConfig config{"nocan0", {}};
+    ::can::SocketCanTransceiver transceiver{config};
+    ASSERT_EQ(transceiver.init(), ::can::ICanTransceiver::ErrorCode::CAN_ERR_OK);
+    ASSERT_EQ(transceiver.open(), ::can::ICanTransceiver::ErrorCode::CAN_ERR_OK);
+    ::can::CANFrame frame;
+    SentListener listener;
+    size_t queued = 0U;
+    while (transceiver.write(frame, listener) == ::can::ICanTransceiver::ErrorCode::CAN_ERR_OK)
+    {
+        ++queued;
+    }
+    ASSERT_GT(queued, 3U);
+    transceiver.run(3, 3);
+    for (size_t i = 0U; i < 3U; ++i)
+    {
+        EXPECT_EQ(transceiver.write(frame), ::can::ICanTransceiver::ErrorCode::CAN_ERR_OK);
+    }
+    EXPECT_EQ(
+        transceiver.write(frame), ::can::ICanTransceiver::ErrorCode::CAN_ERR_TX_HW_QUEUE_FULL);
+    EXPECT_EQ(0U, listener._sentCount);
+    EXPECT_EQ(transceiver.close(), ::can::ICanTransceiver::ErrorCode::CAN_ERR_OK);
+}
+
+/**
+ * \desc
+ * Verifies that in batched mode frames failing with a persistent error are dropped one by one
+ * without a sent callback, so that the transmission doesn't stall.
+ */
+TEST(SocketCanTransceiverTest, batched_frames_with_send_error_are_dropped)
+{
+    ::can::SocketCanTransceiver::DeviceConfig config{"nocan0", {}, true};
+    ::can::SocketCanTransceiver transceiver{config};
+    ASSERT_EQ(transceiver.init(), ::can::ICanTransceiver::ErrorCode::CAN_ERR_OK);
+    ASSERT_EQ(transceiver.open(), ::can::ICanTransceiver::ErrorCode::CAN_ERR_OK);
+    ::can::CANFrame frame;
+    SentListener listener;
+    while (transceiver.write(frame, listener) == ::can::ICanTransceiver::ErrorCode::CAN_ERR_OK) {}
+    transceiver.run(3, 3);
+    for (size_t i = 0U; i < 3U; ++i)
+    {
+        EXPECT_EQ(transceiver.write(frame), ::can::ICanTransceiver::ErrorCode::CAN_ERR_OK);
+    }
+    EXPECT_EQ(
+        transceiver.write(frame), ::can::ICanTransceiver::ErrorCode::CAN_ERR_TX_HW_QUEUE_FULL);
+    EXPECT_EQ(0U, listener._sentCount);
+    EXPECT_EQ(transceiver.close(), ::can::ICanTransceiver::ErrorCode::CAN_ERR_OK);
+}
+
 } // namespace
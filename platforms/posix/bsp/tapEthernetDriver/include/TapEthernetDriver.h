@@ -19,12 +19,34 @@ static constexpr uint16_t VID_MASK       = 0x0FFFU;
 /**
  * Driver for a TAP interface.
  *
+ * Received frames are read into a fixed pool of receive slots, each holding the frame data and the
+ * custom pbuf passed to lwip. Freed pbufs return their slot to the pool, so no memory is allocated
+ * while receiving. Frames are written with a single writev() call gathering the pbuf chain.
+ *
  * \note
  * This driver currently supports one netif only.
  */
 class TapEthernetDriver
 {
 public:
+    /**
+     * Counters of received and sent frames. The receive counters are updated by the context calling
+     * readFrames(), the send counters by the context calling writeFrame().
+     */
+    struct Statistics
+    {
+        /// Number of frames passed to the queue of received pbufs.
+        uint32_t rxFrames;
+        /// Number of frames dropped because no receive slot was free.
+        uint32_t rxPoolExhausted;
+        /// Number of times reading has been deferred because the queue of received pbufs was full.
+        uint32_t rxQueueFull;
+        /// Number of frames written to the tap interface.
+        uint32_t txFrames;
+        /// Number of frames dropped because they could not be written to the tap interface.
+        uint32_t txErrors;
+    };
+
     explicit TapEthernetDriver(::etl::array<uint8_t const, 6> macAddr);
 
     TapEthernetDriver(TapEthernetDriver const&)            = delete;
@@ -40,12 +62,28 @@ public:
 
     void stop();
 
-    void readFrame();
+    /**
+     * Reads a single frame from the tap interface if available. Reading is deferred while the
+     * queue of received pbufs is full, a frame is dropped if no receive slot is free.
+     * \return true if a frame has been read (and either queued or dropped)
+     */
+    bool readFrame();
 
-    bool writeFrame(pbuf* buf) const;
+    /**
+     * Reads the available frames from the tap interface, at most the given number.
+     * \param maxFrameCount maximum number of frames to read
+     * \return number of frames read
+     */
+    size_t readFrames(size_t maxFrameCount);
+
+    bool writeFrame(pbuf* buf);
 
     static constexpr uint8_t LENGTH_VLAN_TAG   = 4U;
     static constexpr uint16_t MAX_FRAME_LENGTH = 1518U + LENGTH_VLAN_TAG;
+    /// Number of receive slots, i.e. received frames that can be held by lwip at the same time.
+    static constexpr uint16_t RX_SLOT_COUNT    = 32U;
+    /// Maximum number of pbufs in a chain that is written without copying.
+    static constexpr uint8_t TX_IOV_COUNT      = 16U;
 
     /**
      * TODO: NYI
@@ -54,6 +92,8 @@ public:
 
     int getTapInterfaceFd() const { return _tapFd; }
 
+    Statistics const& getStatistics() const { return _statistics; }
+
     // Input prepared lwip pbufs to their interfaces. To be called from the lwip async context.
     void inputPbufs();
 
@@ -62,6 +102,24 @@ public:
 
     // Queue of pbufs filled in the main thread and consumed in the lwip async context.
     ::lwiputils::PbufQueue _queue;
+
+private:
+    struct RxSlot
+    {
+        ::lwiputils::RxCustomPbuf pbuf;
+        uint8_t data[MAX_FRAME_LENGTH];
+    };
+
+    // Queue of free receive slots, filled when lwip frees a pbuf and consumed by readFrame().
+    using RxSlotQueue = ::util::spsc::Queue<RxSlot*, RX_SLOT_COUNT>;
+
+    static void freeRxSlot(pbuf* p);
+
+    bool dropFrame();
+
+    ::etl::array<RxSlot, RX_SLOT_COUNT> _rxSlots;
+    RxSlotQueue _freeRxSlots;
+    Statistics _statistics;
 };
 
 } // namespace ethernet
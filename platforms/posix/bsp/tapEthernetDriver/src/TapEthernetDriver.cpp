@@ -16,6 +16,7 @@
 #include <linux/if.h>
 #include <linux/if_tun.h>
 #include <sys/ioctl.h>
+#include <sys/uio.h>
 
 #include <fcntl.h>
 #include <mutex>
@@ -28,7 +29,8 @@ static int allocTapInterface(char const* const ifName)
 {
     char const* cloneDev = "/dev/net/tun";
 
-    int fd = open(cloneDev, O_RDWR);
+    // non blocking to read all pending frames without polling before each read
+    int fd = open(cloneDev, O_RDWR | O_NONBLOCK);
     if (fd < 0)
     {
         return -1;
@@ -59,8 +61,17 @@ void TapEthernetDriver::setGroupcastAddressRecognition(::etl::array<uint8_t, 6>
 {}
 
 TapEthernetDriver::TapEthernetDriver(::etl::array<uint8_t const, 6> const macAddr)
-: _macAddr(macAddr), _tapFd(-1)
-{}
+: _macAddr(macAddr), _tapFd(-1), _rxSlots(), _freeRxSlots(), _statistics()
+{
+    // all slots are free initially, afterwards they are only returned by freeRxSlot()
+    auto sender = RxSlotQueue::Sender(_freeRxSlots);
+    for (RxSlot& slot : _rxSlots)
+    {
+        slot.pbuf.driver = this;
+        slot.pbuf.slot   = slot.data;
+        sender.write(&slot);
+    }
+}
 
 bool TapEthernetDriver::start(char const* const ifName)
 {
@@ -88,57 +99,116 @@ void TapEthernetDriver::stop()
     }
 }
 
-void TapEthernetDriver::readFrame()
+bool TapEthernetDriver::readFrame()
 {
-    auto sender = ::lwiputils::PbufQueue::Sender(_queue);
+    auto sender         = ::lwiputils::PbufQueue::Sender(_queue);
+    auto freeSlotReader = RxSlotQueue::Receiver(_freeRxSlots);
     if (sender.full())
     {
-        // TODO: increment queue full stat counter
-        return;
+        // the frames stay in the tap interface until the queue is processed
+        ++_statistics.rxQueueFull;
+        return false;
     }
-
-    auto* const frameData = new uint8_t[::ethernet::TapEthernetDriver::MAX_FRAME_LENGTH];
-    auto const nread = read(_tapFd, frameData, ::ethernet::TapEthernetDriver::MAX_FRAME_LENGTH);
-    if ((nread <= 0) || (nread > MAX_FRAME_LENGTH))
+    if (freeSlotReader.empty())
     {
-        delete[] frameData;
-        return;
+        // lwip may hold the slots until further frames arrive, so the frame needs to be dropped
+        return dropFrame();
     }
 
-    auto* const frameBuf = new ::lwiputils::RxCustomPbuf;
+    // the slot is only taken from the pool if a frame has been read into it
+    RxSlot* const slot = freeSlotReader.peek();
+    auto const nread   = read(_tapFd, slot->data, MAX_FRAME_LENGTH);
+    if (nread <= 0)
+    {
+        return false;
+    }
+    freeSlotReader.advance();
 
     // This lwip function is thread safe, so we can call it outside the lwip thread
     pbuf_alloced_custom(
         PBUF_RAW,
         static_cast<uint16_t>(nread),
         PBUF_REF,
-        &frameBuf->buf,
-        frameData,
-        ::ethernet::TapEthernetDriver::MAX_FRAME_LENGTH);
-    frameBuf->slot                     = frameData;
-    frameBuf->buf.custom_free_function = [](pbuf* p)
-    {
-        // We can "upcast" here since the initial allocation was made as RxCustimPbuf
-        // The pbuf is embedded as the first memeber so the address stays the same.
-        auto* driverPbuf = reinterpret_cast<::lwiputils::RxCustomPbuf*>(p);
-        delete[] reinterpret_cast<uint8_t*>(driverPbuf->slot);
-        delete driverPbuf;
-    };
-
-    sender.write(&frameBuf->buf.pbuf);
+        &slot->pbuf.buf,
+        slot->data,
+        MAX_FRAME_LENGTH);
+    slot->pbuf.buf.custom_free_function = &freeRxSlot;
+
+    sender.write(&slot->pbuf.buf.pbuf);
+    ++_statistics.rxFrames;
+    return true;
 }
 
-bool TapEthernetDriver::writeFrame(pbuf* const buf) const
+size_t TapEthernetDriver::readFrames(size_t const maxFrameCount)
+{
+    size_t frameCount = 0U;
+    while ((frameCount < maxFrameCount) && readFrame())
+    {
+        ++frameCount;
+    }
+    return frameCount;
+}
+
+bool TapEthernetDriver::writeFrame(pbuf* const buf)
 {
     if (_tapFd < 0)
     {
         return false;
     }
 
-    uint8_t sendBuffer[MAX_FRAME_LENGTH];
-    uint16_t const copiedBytes = pbuf_copy_partial(buf, sendBuffer, MAX_FRAME_LENGTH, 0U);
+    iovec iov[TX_IOV_COUNT];
+    size_t iovCount = 0U;
+    pbuf* q         = buf;
+    while ((q != nullptr) && (iovCount < TX_IOV_COUNT))
+    {
+        iov[iovCount].iov_base = q->payload;
+        iov[iovCount].iov_len  = q->len;
+        ++iovCount;
+        // the last pbuf of the frame holds the remaining length
+        q = (q->len < q->tot_len) ? q->next : nullptr;
+    }
+
+    ssize_t written;
+    if (q == nullptr)
+    {
+        written = writev(_tapFd, iov, static_cast<int>(iovCount));
+    }
+    else
+    {
+        // chain too long to be gathered, copy it
+        uint8_t sendBuffer[MAX_FRAME_LENGTH];
+        uint16_t const copiedBytes = pbuf_copy_partial(buf, sendBuffer, MAX_FRAME_LENGTH, 0U);
+        written                    = write(_tapFd, sendBuffer, copiedBytes);
+    }
+
+    if (written <= 0)
+    {
+        ++_statistics.txErrors;
+        return false;
+    }
+    ++_statistics.txFrames;
+    return true;
+}
+
+void TapEthernetDriver::freeRxSlot(pbuf* const p)
+{
+    // We can "upcast" here since the pbuf is embedded as the first member of the slot, so the
+    // address stays the same.
+    auto* const customPbuf = reinterpret_cast<::lwiputils::RxCustomPbuf*>(p);
+    auto* const driver     = static_cast<TapEthernetDriver*>(customPbuf->driver);
+    // pbufs are freed in the lwip async context only, which is the single producer of this queue
+    RxSlotQueue::Sender(driver->_freeRxSlots).write(reinterpret_cast<RxSlot*>(customPbuf));
+}
 
-    return (write(_tapFd, sendBuffer, copiedBytes) > 0);
+bool TapEthernetDriver::dropFrame()
+{
+    uint8_t frameData[MAX_FRAME_LENGTH];
+    if (read(_tapFd, frameData, MAX_FRAME_LENGTH) <= 0)
+    {
+        return false;
+    }
+    ++_statistics.rxPoolExhausted;
+    return true;
 }
 
 } // namespace ethernet
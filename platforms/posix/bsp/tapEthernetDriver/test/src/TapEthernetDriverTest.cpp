@@ -0,0 +1,243 @@
+// Copyright 2025 Accenture.
+
+#include "TapEthernetDriver.h"
+
+#include <lwip/pbuf.h>
+
+#include <gtest/gtest.h>
+
+#include <sys/socket.h>
+
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using ::ethernet::TapEthernetDriver;
+
+size_t const FRAME_LENGTH = 60U;
+
+/**
+ * The tap interface is replaced by one end of a socket pair, which keeps the frame boundaries like
+ * a tap interface. The test writes and reads frames at the other end.
+ */
+class TapEthernetDriverTest : public Test
+{
+public:
+    TapEthernetDriverTest() : _driver(::etl::array<uint8_t const, 6>{2U, 0U, 0U, 0U, 0U, 1U}) {}
+
+    void SetUp() override
+    {
+        int fds[2];
+        ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_NONBLOCK, 0, fds));
+        _driver._tapFd = fds[0];
+        _peerFd        = fds[1];
+    }
+
+    void TearDown() override
+    {
+        for (pbuf* const p : _heldPbufs)
+        {
+            (void)pbuf_free(p);
+        }
+        _driver.stop();
+        (void)close(_peerFd);
+    }
+
+    void sendFrame(uint8_t const value)
+    {
+        uint8_t frame[FRAME_LENGTH];
+        memset(frame, value, sizeof(frame));
+        ASSERT_EQ(static_cast<ssize_t>(sizeof(frame)), write(_peerFd, frame, sizeof(frame)));
+    }
+
+    std::vector<uint8_t> receiveFrame()
+    {
+        std::vector<uint8_t> frame(TapEthernetDriver::MAX_FRAME_LENGTH);
+        ssize_t const size = read(_peerFd, frame.data(), frame.size());
+        frame.resize((size > 0) ? static_cast<size_t>(size) : 0U);
+        return frame;
+    }
+
+    // takes the received pbufs from the queue like lwip, which holds them until they are freed
+    size_t holdReceivedPbufs()
+    {
+        auto receiver = ::lwiputils::PbufQueue::Receiver(_driver._queue);
+        size_t count  = 0U;
+        while (!receiver.empty())
+        {
+            _heldPbufs.push_back(receiver.read());
+            ++count;
+        }
+        return count;
+    }
+
+    void freeHeldPbufs()
+    {
+        for (pbuf* const p : _heldPbufs)
+        {
+            (void)pbuf_free(p);
+        }
+        _heldPbufs.clear();
+    }
+
+    // builds a chain of pbufs referencing the given data in pieces of the given length
+    pbuf* buildChain(std::vector<uint8_t>& data, size_t const pieceLength)
+    {
+        size_t const count = (data.size() + pieceLength - 1U) / pieceLength;
+        _chain.assign(count, pbuf());
+        for (size_t idx = 0U; idx < count; ++idx)
+        {
+            size_t const offset = idx * pieceLength;
+            size_t const length
+                = ((data.size() - offset) < pieceLength) ? (data.size() - offset) : pieceLength;
+            _chain[idx].payload = &data[offset];
+            _chain[idx].len     = static_cast<uint16_t>(length);
+            _chain[idx].tot_len = static_cast<uint16_t>(data.size() - offset);
+            _chain[idx].next    = ((idx + 1U) < count) ? &_chain[idx + 1U] : nullptr;
+        }
+        return _chain.data();
+    }
+
+protected:
+    TapEthernetDriver _driver;
+    int _peerFd = -1;
+    std::vector<pbuf*> _heldPbufs;
+    std::vector<pbuf> _chain;
+};
+
+/**
+ * \desc
+ * Verifies that reading without a pending frame doesn't queue anything.
+ */
+TEST_F(TapEthernetDriverTest, read_without_frame)
+{
+    EXPECT_FALSE(_driver.readFrame());
+    EXPECT_EQ(0U, _driver.readFrames(3U));
+    EXPECT_EQ(0U, holdReceivedPbufs());
+    EXPECT_EQ(0U, _driver.getStatistics().rxFrames);
+}
+
+/**
+ * \desc
+ * Verifies that a received frame is passed to the queue in a pbuf that references its data.
+ */
+TEST_F(TapEthernetDriverTest, read_frame_into_pbuf)
+{
+    sendFrame(0x5AU);
+    EXPECT_TRUE(_driver.readFrame());
+    ASSERT_EQ(1U, holdReceivedPbufs());
+    pbuf const* const p = _heldPbufs.front();
+    ASSERT_EQ(FRAME_LENGTH, p->tot_len);
+    ASSERT_EQ(FRAME_LENGTH, p->len);
+    EXPECT_EQ(0x5AU, static_cast<uint8_t const*>(p->payload)[0U]);
+    EXPECT_EQ(0x5AU, static_cast<uint8_t const*>(p->payload)[FRAME_LENGTH - 1U]);
+    EXPECT_EQ(1U, _driver.getStatistics().rxFrames);
+}
+
+/**
+ * \desc
+ * Verifies that reading is deferred while the queue of received pbufs is full, so that the frames
+ * stay in the tap interface.
+ */
+TEST_F(TapEthernetDriverTest, read_deferred_while_queue_full)
+{
+    size_t const queueSize = _driver._queue.capacity();
+    for (size_t idx = 0U; idx <= queueSize; ++idx)
+    {
+        sendFrame(static_cast<uint8_t>(idx));
+    }
+    EXPECT_EQ(queueSize, _driver.readFrames(queueSize + 1U));
+    EXPECT_EQ(1U, _driver.getStatistics().rxQueueFull);
+
+    EXPECT_EQ(queueSize, holdReceivedPbufs());
+    EXPECT_EQ(1U, _driver.readFrames(queueSize + 1U));
+    ASSERT_EQ(1U, holdReceivedPbufs());
+    EXPECT_EQ(static_cast<uint8_t>(queueSize), *static_cast<uint8_t*>(_heldPbufs.back()->payload));
+    EXPECT_EQ(queueSize + 1U, _driver.getStatistics().rxFrames);
+}
+
+/**
+ * \desc
+ * Verifies that a frame is dropped if lwip holds all receive slots, and that freed pbufs return
+ * their slots.
+ */
+TEST_F(TapEthernetDriverTest, read_frame_dropped_without_free_slot)
+{
+    while (_heldPbufs.size() < TapEthernetDriver::RX_SLOT_COUNT)
+    {
+        sendFrame(1U);
+        ASSERT_TRUE(_driver.readFrame());
+        (void)holdReceivedPbufs();
+    }
+    sendFrame(2U);
+    EXPECT_TRUE(_driver.readFrame());
+    EXPECT_EQ(0U, holdReceivedPbufs());
+    EXPECT_EQ(1U, _driver.getStatistics().rxPoolExhausted);
+    EXPECT_EQ(size_t{TapEthernetDriver::RX_SLOT_COUNT}, _driver.getStatistics().rxFrames);
+
+    freeHeldPbufs();
+    sendFrame(3U);
+    EXPECT_TRUE(_driver.readFrame());
+    ASSERT_EQ(1U, holdReceivedPbufs());
+    EXPECT_EQ(3U, *static_cast<uint8_t*>(_heldPbufs.front()->payload));
+}
+
+/**
+ * \desc
+ * Verifies that a pbuf chain is written as a single frame.
+ */
+TEST_F(TapEthernetDriverTest, write_frame_from_chain)
+{
+    std::vector<uint8_t> data(FRAME_LENGTH);
+    for (size_t idx = 0U; idx < data.size(); ++idx)
+    {
+        data[idx] = static_cast<uint8_t>(idx);
+    }
+    EXPECT_TRUE(_driver.writeFrame(buildChain(data, 14U)));
+    EXPECT_EQ(data, receiveFrame());
+    EXPECT_EQ(1U, _driver.getStatistics().txFrames);
+    EXPECT_EQ(0U, _driver.getStatistics().txErrors);
+}
+
+/**
+ * \desc
+ * Verifies that a pbuf chain with more pbufs than can be gathered is copied into a single frame.
+ */
+TEST_F(TapEthernetDriverTest, write_frame_from_long_chain)
+{
+    std::vector<uint8_t> data(TapEthernetDriver::TX_IOV_COUNT * 4U + 3U);
+    for (size_t idx = 0U; idx < data.size(); ++idx)
+    {
+        data[idx] = static_cast<uint8_t>(idx * 3U);
+    }
+    EXPECT_TRUE(_driver.writeFrame(buildChain(data, 4U)));
+    EXPECT_EQ(data, receiveFrame());
+    EXPECT_EQ(1U, _driver.getStatistics().txFrames);
+}
+
+/**
+ * \desc
+ * Verifies that a frame is dropped and counted if it cannot be written, and that nothing is
+ * written without a tap interface.
+ */
+TEST_F(TapEthernetDriverTest, write_frame_errors)
+{
+    std::vector<uint8_t> data(FRAME_LENGTH);
+    (void)close(_driver._tapFd);
+    // writing to a file descriptor opened for reading fails
+    _driver._tapFd = open("/dev/null", O_RDONLY);
+    ASSERT_GE(_driver._tapFd, 0);
+    EXPECT_FALSE(_driver.writeFrame(buildChain(data, 20U)));
+    EXPECT_EQ(1U, _driver.getStatistics().txErrors);
+    EXPECT_EQ(0U, _driver.getStatistics().txFrames);
+
+    _driver.stop();
+    EXPECT_FALSE(_driver.writeFrame(buildChain(data, 20U)));
+    EXPECT_EQ(1U, _driver.getStatistics().txErrors);
+}
+
+} // namespace
@@ -346,8 +346,21 @@ private:
         fpDevice->RXIMR[bufIdx]            = 0;
     }
 
+    /**
+     * Converts the time stamp of a message buffer to the timebase of getSystemTimeUs32Bit().
+     * \param frameTime value of the free running timer captured with the frame
+     * \param timerNow value of the free running timer sampled at systemTimeNow
+     * \param systemTimeNow system time in microseconds
+     */
+    uint32_t toSystemTimeUs(uint16_t frameTime, uint16_t timerNow, uint32_t systemTimeNow) const;
+
     uint8_t enqueueRxFrame(
-        uint32_t id, uint8_t length, vuint32_t payload[], bool extended, uint8_t const* map);
+        uint32_t id,
+        uint8_t length,
+        vuint32_t payload[],
+        bool extended,
+        uint32_t timestamp,
+        uint8_t const* map);
 };
 
 namespace CANRxBuffer
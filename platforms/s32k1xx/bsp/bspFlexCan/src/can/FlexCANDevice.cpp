@@ -229,6 +229,11 @@ uint8_t FlexCANDevice::receiveISR(uint8_t const* filterMap)
     interruptsToProcessMask = fpDevice->IFLAG1; // get current pending interrupts
     interruptsToProcessMask &= fRxInterruptMask;
 
+    // Reference point for the conversion of the message buffer time stamps. The free running
+    // timer is sampled before any buffer is locked, because reading it unlocks the buffers.
+    uint16_t const timerNow      = static_cast<uint16_t>(fpDevice->TIMER);
+    uint32_t const systemTimeNow = getSystemTimeUs32Bit();
+
     while (interruptsToProcessMask > 0)
     {
         fFramesReceivedTotal++;
@@ -252,6 +257,10 @@ uint8_t FlexCANDevice::receiveISR(uint8_t const* filterMap)
                 messageBuffer(bufIdx).FLAGS.B.DLC,
                 const_cast<vuint32_t*>(messageBuffer(bufIdx).DATA.W),
                 messageBuffer(bufIdx).FLAGS.B.IDE == 1,
+                toSystemTimeUs(
+                    static_cast<uint16_t>(messageBuffer(bufIdx).FLAGS.B.TIMESTAMP),
+                    timerNow,
+                    systemTimeNow),
                 filterMap);
         }
         currentInterruptFlag <<= 1;
@@ -265,8 +274,28 @@ uint8_t FlexCANDevice::receiveISR(uint8_t const* filterMap)
     return framesReceived;
 }
 
+uint32_t FlexCANDevice::toSystemTimeUs(
+    uint16_t const frameTime, uint16_t const timerNow, uint32_t const systemTimeNow) const
+{
+    if (fConfig.baudrate == 0U)
+    {
+        return systemTimeNow;
+    }
+    // The free running timer counts bit times. The age is signed because a frame may have been
+    // received after the timer has been sampled. It is converted in 64 bit because 32767 bit
+    // times at a low baudrate don't fit into 32 bit nanoseconds.
+    int64_t const ageBits = static_cast<int16_t>(static_cast<uint16_t>(timerNow - frameTime));
+    int64_t const ageUs   = (ageBits * 1000000) / static_cast<int64_t>(fConfig.baudrate);
+    return systemTimeNow - static_cast<uint32_t>(ageUs);
+}
+
 uint8_t FlexCANDevice::enqueueRxFrame(
-    uint32_t id, uint8_t length, vuint32_t payload[], bool extended, uint8_t const* filterMap)
+    uint32_t id,
+    uint8_t length,
+    vuint32_t payload[],
+    bool extended,
+    uint32_t timestamp,
+    uint8_t const* filterMap)
 {
     if (!fRxQueue.full())
     {
@@ -284,7 +313,7 @@ uint8_t FlexCANDevice::enqueueRxFrame(
         if (acceptRxFrame)
         {
             can::CANFrame& frame{fRxQueue.emplace(CanId::id(id, extended))};
-            frame.setTimestamp(getSystemTimeUs32Bit());
+            frame.setTimestamp(timestamp);
             frame.setPayloadLength(length);
             etl::be_uint32_ext_t{frame.getPayload()}                            = payload[0];
             etl::be_uint32_ext_t{frame.getPayload() + sizeof(etl::be_uint32_t)} = payload[1];
@@ -0,0 +1,91 @@
+import time
+import zlib
+
+import pytest
+import udsoncan
+import udsoncan.services as uds
+from helpers.helper_functions import hexlify
+
+# Size of the image that is downloaded into the emulated flash memory
+IMAGE_SIZE = 256 * 1024
+
+
+def start_download(uds_client, address, size):
+    uds_client.send_request(uds.DiagnosticSessionControl().make_request(0x03))
+    location = udsoncan.MemoryLocation(
+        address=address, memorysize=size, address_format=32, memorysize_format=32
+    )
+    return uds_client.send_request(
+        uds.RequestDownload().make_request(memory_location=location)
+    )
+
+
+# Test: Download an image and check the CRC of the RequestTransferExit response,
+# prints the throughput of the download
+def test_download_image(target_session, uds_transport):
+    assert target_session.capserial().wait_for_boot_complete()
+
+    uds_client = target_session.uds_client(uds_transport)
+    image = bytes((i * 7 + (i >> 8)) & 0xFF for i in range(IMAGE_SIZE))
+
+    payload = start_download(uds_client, 0, IMAGE_SIZE).get_payload()
+    assert payload[0:2] == bytes([0x74, 0x20])
+    # maxNumberOfBlockLength includes service id and block sequence counter
+    block_length = int.from_bytes(payload[2:4], "big") - 2
+    assert block_length > 0
+
+    start = time.monotonic()
+    counter = 1
+    for offset in range(0, IMAGE_SIZE, block_length):
+        req = uds.TransferData().make_request(
+            counter, image[offset : offset + block_length]
+        )
+        response = uds_client.send_request(req)
+        assert response.get_payload()[0:2] == bytes([0x76, counter])
+        counter = (counter + 1) & 0xFF
+
+    req = uds.RequestTransferExit().make_request()
+    payload = uds_client.send_request(req).get_payload()
+    duration = time.monotonic() - start
+
+    assert payload[0] == 0x77
+    assert int.from_bytes(payload[1:5], "big") == zlib.crc32(image)
+    print(
+        f"Downloaded {IMAGE_SIZE} bytes via {uds_transport} in {duration:.2f} s "
+        f"({IMAGE_SIZE / duration / 1024:.1f} KiB/s)"
+    )
+
+
+# Test: Checking NRC ISO_REQUEST_OUT_OF_RANGE is received for an address that
+# isn't the start of a flash sector
+def test_ISO_REQUEST_OUT_OF_RANGE(target_session, uds_transport):
+    assert target_session.capserial().wait_for_boot_complete()
+
+    uds_client = target_session.uds_client(uds_transport)
+    with pytest.raises(udsoncan.exceptions.NegativeResponseException) as exc_info:
+        start_download(uds_client, 0x100, 0x100)
+    assert hexlify(exc_info.value.response.get_payload()) == "7f 34 31"
+
+
+# Test: Checking NRC ISO_WRONG_BLOCK_SEQUENCE_COUNTER is received
+def test_ISO_WRONG_BLOCK_SEQUENCE_COUNTER(target_session, uds_transport):
+    assert target_session.capserial().wait_for_boot_complete()
+
+    uds_client = target_session.uds_client(uds_transport)
+    start_download(uds_client, 0, 0x100)
+    with pytest.raises(udsoncan.exceptions.NegativeResponseException) as exc_info:
+        uds_client.send_request(uds.TransferData().make_request(2, bytes(0x10)))
+    assert hexlify(exc_info.value.response.get_payload()) == "7f 36 73"
+
+
+# Test: Checking an abandoned download is aborted by the next session change,
+# so that a new download can be requested
+def test_download_after_abandoned_download(target_session, uds_transport):
+    assert target_session.capserial().wait_for_boot_complete()
+
+    uds_client = target_session.uds_client(uds_transport)
+    start_download(uds_client, 0, 0x100)
+    uds_client.send_request(uds.TransferData().make_request(1, bytes(0x10)))
+    # start_download() enters the extended session again
+    payload = start_download(uds_client, 0, 0x100).get_payload()
+    assert payload[0:2] == bytes([0x74, 0x20])